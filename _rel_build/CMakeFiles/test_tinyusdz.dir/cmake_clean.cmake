@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_tinyusdz.dir/tests/test-main.cc.o"
+  "CMakeFiles/test_tinyusdz.dir/tests/test-main.cc.o.d"
+  "test_tinyusdz"
+  "test_tinyusdz.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_tinyusdz.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
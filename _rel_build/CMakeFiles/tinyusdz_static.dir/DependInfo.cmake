@@ -0,0 +1,82 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/external/miniz.c" "CMakeFiles/tinyusdz_static.dir/src/external/miniz.c.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/external/miniz.c.o.d"
+  "/root/repo/src/lz4/lz4.c" "CMakeFiles/tinyusdz_static.dir/src/lz4/lz4.c.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/lz4/lz4.c.o.d"
+  "/root/repo/src/ascii-parser-basetype.cc" "CMakeFiles/tinyusdz_static.dir/src/ascii-parser-basetype.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/ascii-parser-basetype.cc.o.d"
+  "/root/repo/src/ascii-parser-timesamples-array.cc" "CMakeFiles/tinyusdz_static.dir/src/ascii-parser-timesamples-array.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/ascii-parser-timesamples-array.cc.o.d"
+  "/root/repo/src/ascii-parser-timesamples.cc" "CMakeFiles/tinyusdz_static.dir/src/ascii-parser-timesamples.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/ascii-parser-timesamples.cc.o.d"
+  "/root/repo/src/ascii-parser.cc" "CMakeFiles/tinyusdz_static.dir/src/ascii-parser.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/ascii-parser.cc.o.d"
+  "/root/repo/src/asset-resolution.cc" "CMakeFiles/tinyusdz_static.dir/src/asset-resolution.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/asset-resolution.cc.o.d"
+  "/root/repo/src/audio-loader.cc" "CMakeFiles/tinyusdz_static.dir/src/audio-loader.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/audio-loader.cc.o.d"
+  "/root/repo/src/base122.cc" "CMakeFiles/tinyusdz_static.dir/src/base122.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/base122.cc.o.d"
+  "/root/repo/src/composition.cc" "CMakeFiles/tinyusdz_static.dir/src/composition.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/composition.cc.o.d"
+  "/root/repo/src/crate-format.cc" "CMakeFiles/tinyusdz_static.dir/src/crate-format.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/crate-format.cc.o.d"
+  "/root/repo/src/crate-pprint.cc" "CMakeFiles/tinyusdz_static.dir/src/crate-pprint.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/crate-pprint.cc.o.d"
+  "/root/repo/src/crate-reader.cc" "CMakeFiles/tinyusdz_static.dir/src/crate-reader.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/crate-reader.cc.o.d"
+  "/root/repo/src/crate-writer.cc" "CMakeFiles/tinyusdz_static.dir/src/crate-writer.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/crate-writer.cc.o.d"
+  "/root/repo/src/external/fpng.cpp" "CMakeFiles/tinyusdz_static.dir/src/external/fpng.cpp.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/external/fpng.cpp.o.d"
+  "/root/repo/src/external/pugixml.cpp" "CMakeFiles/tinyusdz_static.dir/src/external/pugixml.cpp.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/external/pugixml.cpp.o.d"
+  "/root/repo/src/external/tiny_obj_loader.cc" "CMakeFiles/tinyusdz_static.dir/src/external/tiny_obj_loader.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/external/tiny_obj_loader.cc.o.d"
+  "/root/repo/src/external/tinyexr.cc" "CMakeFiles/tinyusdz_static.dir/src/external/tinyexr.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/external/tinyexr.cc.o.d"
+  "/root/repo/src/image-loader.cc" "CMakeFiles/tinyusdz_static.dir/src/image-loader.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/image-loader.cc.o.d"
+  "/root/repo/src/image-util.cc" "CMakeFiles/tinyusdz_static.dir/src/image-util.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/image-util.cc.o.d"
+  "/root/repo/src/image-writer.cc" "CMakeFiles/tinyusdz_static.dir/src/image-writer.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/image-writer.cc.o.d"
+  "/root/repo/src/integerCoding.cpp" "CMakeFiles/tinyusdz_static.dir/src/integerCoding.cpp.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/integerCoding.cpp.o.d"
+  "/root/repo/src/io-util.cc" "CMakeFiles/tinyusdz_static.dir/src/io-util.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/io-util.cc.o.d"
+  "/root/repo/src/linear-algebra.cc" "CMakeFiles/tinyusdz_static.dir/src/linear-algebra.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/linear-algebra.cc.o.d"
+  "/root/repo/src/lz4-compression.cc" "CMakeFiles/tinyusdz_static.dir/src/lz4-compression.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/lz4-compression.cc.o.d"
+  "/root/repo/src/path-util.cc" "CMakeFiles/tinyusdz_static.dir/src/path-util.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/path-util.cc.o.d"
+  "/root/repo/src/performance.cc" "CMakeFiles/tinyusdz_static.dir/src/performance.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/performance.cc.o.d"
+  "/root/repo/src/pprinter.cc" "CMakeFiles/tinyusdz_static.dir/src/pprinter.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/pprinter.cc.o.d"
+  "/root/repo/src/prim-composition.cc" "CMakeFiles/tinyusdz_static.dir/src/prim-composition.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/prim-composition.cc.o.d"
+  "/root/repo/src/prim-reconstruct.cc" "CMakeFiles/tinyusdz_static.dir/src/prim-reconstruct.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/prim-reconstruct.cc.o.d"
+  "/root/repo/src/prim-types.cc" "CMakeFiles/tinyusdz_static.dir/src/prim-types.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/prim-types.cc.o.d"
+  "/root/repo/src/primvar.cc" "CMakeFiles/tinyusdz_static.dir/src/primvar.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/primvar.cc.o.d"
+  "/root/repo/src/pxr-compat.cc" "CMakeFiles/tinyusdz_static.dir/src/pxr-compat.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/pxr-compat.cc.o.d"
+  "/root/repo/src/stage.cc" "CMakeFiles/tinyusdz_static.dir/src/stage.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/stage.cc.o.d"
+  "/root/repo/src/str-util.cc" "CMakeFiles/tinyusdz_static.dir/src/str-util.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/str-util.cc.o.d"
+  "/root/repo/src/tiny-format.cc" "CMakeFiles/tinyusdz_static.dir/src/tiny-format.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/tiny-format.cc.o.d"
+  "/root/repo/src/tinyusdz.cc" "CMakeFiles/tinyusdz_static.dir/src/tinyusdz.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/tinyusdz.cc.o.d"
+  "/root/repo/src/tydra/attribute-eval-typed-animatable-fallback.cc" "CMakeFiles/tinyusdz_static.dir/src/tydra/attribute-eval-typed-animatable-fallback.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/tydra/attribute-eval-typed-animatable-fallback.cc.o.d"
+  "/root/repo/src/tydra/attribute-eval-typed-animatable.cc" "CMakeFiles/tinyusdz_static.dir/src/tydra/attribute-eval-typed-animatable.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/tydra/attribute-eval-typed-animatable.cc.o.d"
+  "/root/repo/src/tydra/attribute-eval-typed-fallback.cc" "CMakeFiles/tinyusdz_static.dir/src/tydra/attribute-eval-typed-fallback.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/tydra/attribute-eval-typed-fallback.cc.o.d"
+  "/root/repo/src/tydra/attribute-eval-typed.cc" "CMakeFiles/tinyusdz_static.dir/src/tydra/attribute-eval-typed.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/tydra/attribute-eval-typed.cc.o.d"
+  "/root/repo/src/tydra/attribute-eval.cc" "CMakeFiles/tinyusdz_static.dir/src/tydra/attribute-eval.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/tydra/attribute-eval.cc.o.d"
+  "/root/repo/src/tydra/facial.cc" "CMakeFiles/tinyusdz_static.dir/src/tydra/facial.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/tydra/facial.cc.o.d"
+  "/root/repo/src/tydra/obj-export.cc" "CMakeFiles/tinyusdz_static.dir/src/tydra/obj-export.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/tydra/obj-export.cc.o.d"
+  "/root/repo/src/tydra/prim-apply.cc" "CMakeFiles/tinyusdz_static.dir/src/tydra/prim-apply.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/tydra/prim-apply.cc.o.d"
+  "/root/repo/src/tydra/render-data.cc" "CMakeFiles/tinyusdz_static.dir/src/tydra/render-data.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/tydra/render-data.cc.o.d"
+  "/root/repo/src/tydra/scene-access.cc" "CMakeFiles/tinyusdz_static.dir/src/tydra/scene-access.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/tydra/scene-access.cc.o.d"
+  "/root/repo/src/tydra/shader-network.cc" "CMakeFiles/tinyusdz_static.dir/src/tydra/shader-network.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/tydra/shader-network.cc.o.d"
+  "/root/repo/src/tydra/texture-util.cc" "CMakeFiles/tinyusdz_static.dir/src/tydra/texture-util.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/tydra/texture-util.cc.o.d"
+  "/root/repo/src/tydra/usd-export.cc" "CMakeFiles/tinyusdz_static.dir/src/tydra/usd-export.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/tydra/usd-export.cc.o.d"
+  "/root/repo/src/usdGeom.cc" "CMakeFiles/tinyusdz_static.dir/src/usdGeom.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/usdGeom.cc.o.d"
+  "/root/repo/src/usdLux.cc" "CMakeFiles/tinyusdz_static.dir/src/usdLux.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/usdLux.cc.o.d"
+  "/root/repo/src/usdMtlx.cc" "CMakeFiles/tinyusdz_static.dir/src/usdMtlx.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/usdMtlx.cc.o.d"
+  "/root/repo/src/usdObj.cc" "CMakeFiles/tinyusdz_static.dir/src/usdObj.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/usdObj.cc.o.d"
+  "/root/repo/src/usdShade.cc" "CMakeFiles/tinyusdz_static.dir/src/usdShade.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/usdShade.cc.o.d"
+  "/root/repo/src/usdSkel.cc" "CMakeFiles/tinyusdz_static.dir/src/usdSkel.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/usdSkel.cc.o.d"
+  "/root/repo/src/usdVox.cc" "CMakeFiles/tinyusdz_static.dir/src/usdVox.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/usdVox.cc.o.d"
+  "/root/repo/src/usda-reader.cc" "CMakeFiles/tinyusdz_static.dir/src/usda-reader.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/usda-reader.cc.o.d"
+  "/root/repo/src/usda-writer.cc" "CMakeFiles/tinyusdz_static.dir/src/usda-writer.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/usda-writer.cc.o.d"
+  "/root/repo/src/usdc-reader.cc" "CMakeFiles/tinyusdz_static.dir/src/usdc-reader.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/usdc-reader.cc.o.d"
+  "/root/repo/src/usdc-writer.cc" "CMakeFiles/tinyusdz_static.dir/src/usdc-writer.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/usdc-writer.cc.o.d"
+  "/root/repo/src/value-pprint.cc" "CMakeFiles/tinyusdz_static.dir/src/value-pprint.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/value-pprint.cc.o.d"
+  "/root/repo/src/value-types.cc" "CMakeFiles/tinyusdz_static.dir/src/value-types.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/value-types.cc.o.d"
+  "/root/repo/src/xform.cc" "CMakeFiles/tinyusdz_static.dir/src/xform.cc.o" "gcc" "CMakeFiles/tinyusdz_static.dir/src/xform.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
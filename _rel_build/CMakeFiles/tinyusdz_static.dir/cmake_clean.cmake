@@ -0,0 +1,137 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tinyusdz_static.dir/src/ascii-parser-basetype.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/ascii-parser-basetype.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/ascii-parser-timesamples-array.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/ascii-parser-timesamples-array.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/ascii-parser-timesamples.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/ascii-parser-timesamples.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/ascii-parser.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/ascii-parser.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/asset-resolution.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/asset-resolution.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/audio-loader.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/audio-loader.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/base122.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/base122.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/composition.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/composition.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/crate-format.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/crate-format.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/crate-pprint.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/crate-pprint.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/crate-reader.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/crate-reader.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/crate-writer.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/crate-writer.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/external/fpng.cpp.o"
+  "CMakeFiles/tinyusdz_static.dir/src/external/fpng.cpp.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/external/miniz.c.o"
+  "CMakeFiles/tinyusdz_static.dir/src/external/miniz.c.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/external/pugixml.cpp.o"
+  "CMakeFiles/tinyusdz_static.dir/src/external/pugixml.cpp.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/external/tiny_obj_loader.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/external/tiny_obj_loader.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/external/tinyexr.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/external/tinyexr.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/image-loader.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/image-loader.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/image-util.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/image-util.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/image-writer.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/image-writer.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/integerCoding.cpp.o"
+  "CMakeFiles/tinyusdz_static.dir/src/integerCoding.cpp.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/io-util.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/io-util.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/linear-algebra.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/linear-algebra.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/lz4-compression.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/lz4-compression.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/lz4/lz4.c.o"
+  "CMakeFiles/tinyusdz_static.dir/src/lz4/lz4.c.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/path-util.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/path-util.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/performance.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/performance.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/pprinter.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/pprinter.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/prim-composition.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/prim-composition.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/prim-reconstruct.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/prim-reconstruct.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/prim-types.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/prim-types.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/primvar.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/primvar.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/pxr-compat.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/pxr-compat.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/stage.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/stage.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/str-util.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/str-util.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/tiny-format.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/tiny-format.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/tinyusdz.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/tinyusdz.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/attribute-eval-typed-animatable-fallback.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/attribute-eval-typed-animatable-fallback.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/attribute-eval-typed-animatable.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/attribute-eval-typed-animatable.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/attribute-eval-typed-fallback.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/attribute-eval-typed-fallback.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/attribute-eval-typed.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/attribute-eval-typed.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/attribute-eval.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/attribute-eval.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/facial.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/facial.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/obj-export.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/obj-export.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/prim-apply.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/prim-apply.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/render-data.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/render-data.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/scene-access.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/scene-access.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/shader-network.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/shader-network.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/texture-util.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/texture-util.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/usd-export.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/tydra/usd-export.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/usdGeom.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/usdGeom.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/usdLux.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/usdLux.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/usdMtlx.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/usdMtlx.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/usdObj.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/usdObj.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/usdShade.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/usdShade.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/usdSkel.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/usdSkel.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/usdVox.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/usdVox.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/usda-reader.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/usda-reader.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/usda-writer.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/usda-writer.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/usdc-reader.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/usdc-reader.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/usdc-writer.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/usdc-writer.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/value-pprint.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/value-pprint.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/value-types.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/value-types.cc.o.d"
+  "CMakeFiles/tinyusdz_static.dir/src/xform.cc.o"
+  "CMakeFiles/tinyusdz_static.dir/src/xform.cc.o.d"
+  "libtinyusdz_static.a"
+  "libtinyusdz_static.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/tinyusdz_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_rel_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(usda-parser-unit-test "python3" "/root/repo/tests/usda/unit-runner.py" "--app" "/root/repo/_rel_build/test_tinyusdz" "--basedir" "/root/repo/tests/usda")
+set_tests_properties(usda-parser-unit-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1345;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(usdc-parser-unit-test "python3" "/root/repo/tests/usdc/unit-runner.py" "--app" "/root/repo/_rel_build/test_tinyusdz" "--basedir" "/root/repo/tests/usdc")
+set_tests_properties(usdc-parser-unit-test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1356;add_test;/root/repo/CMakeLists.txt;0;")
+subdirs("examples/tusdcat")
+subdirs("examples/tydra_api")
+subdirs("examples/tydra_to_renderscene")
+subdirs("examples/api_tutorial")
+subdirs("examples/file_format")
+subdirs("examples/asset_resolution")
+subdirs("examples/progressive_composition")
+subdirs("examples/save_usda")
+subdirs("tests/unit")
+subdirs("tests/decompress-int")
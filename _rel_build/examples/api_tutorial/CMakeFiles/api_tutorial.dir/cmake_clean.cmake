@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../api_tutorial"
+  "../../api_tutorial.pdb"
+  "CMakeFiles/api_tutorial.dir/api-tutorial-main.cc.o"
+  "CMakeFiles/api_tutorial.dir/api-tutorial-main.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/api_tutorial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
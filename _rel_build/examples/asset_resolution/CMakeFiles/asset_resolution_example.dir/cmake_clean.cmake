@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../asset_resolution_example"
+  "../../asset_resolution_example.pdb"
+  "CMakeFiles/asset_resolution_example.dir/asset-resolution-example.cc.o"
+  "CMakeFiles/asset_resolution_example.dir/asset-resolution-example.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/asset_resolution_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
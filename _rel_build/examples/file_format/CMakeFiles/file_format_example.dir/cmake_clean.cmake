@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../file_format_example"
+  "../../file_format_example.pdb"
+  "CMakeFiles/file_format_example.dir/file-format-example.cc.o"
+  "CMakeFiles/file_format_example.dir/file-format-example.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/file_format_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
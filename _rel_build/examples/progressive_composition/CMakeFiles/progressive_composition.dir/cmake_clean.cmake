@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../progressive_composition"
+  "../../progressive_composition.pdb"
+  "CMakeFiles/progressive_composition.dir/main.cc.o"
+  "CMakeFiles/progressive_composition.dir/main.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/progressive_composition.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
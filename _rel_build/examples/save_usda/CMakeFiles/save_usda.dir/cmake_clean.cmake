@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../save_usda"
+  "../../save_usda.pdb"
+  "CMakeFiles/save_usda.dir/main.cc.o"
+  "CMakeFiles/save_usda.dir/main.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/save_usda.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
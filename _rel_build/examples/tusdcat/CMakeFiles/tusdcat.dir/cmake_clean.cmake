@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../tusdcat"
+  "../../tusdcat.pdb"
+  "CMakeFiles/tusdcat.dir/main.cc.o"
+  "CMakeFiles/tusdcat.dir/main.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tusdcat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
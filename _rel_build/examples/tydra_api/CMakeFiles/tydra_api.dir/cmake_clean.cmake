@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../tydra_api"
+  "../../tydra_api.pdb"
+  "CMakeFiles/tydra_api.dir/tydra-api-main.cc.o"
+  "CMakeFiles/tydra_api.dir/tydra-api-main.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tydra_api.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../tydra_to_renderscene"
+  "../../tydra_to_renderscene.pdb"
+  "CMakeFiles/tydra_to_renderscene.dir/to-renderscene-main.cc.o"
+  "CMakeFiles/tydra_to_renderscene.dir/to-renderscene-main.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tydra_to_renderscene.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
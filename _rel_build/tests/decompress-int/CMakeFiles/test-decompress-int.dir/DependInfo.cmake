@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/lz4/lz4.c" "tests/decompress-int/CMakeFiles/test-decompress-int.dir/__/__/src/lz4/lz4.c.o" "gcc" "tests/decompress-int/CMakeFiles/test-decompress-int.dir/__/__/src/lz4/lz4.c.o.d"
+  "/root/repo/src/integerCoding.cpp" "tests/decompress-int/CMakeFiles/test-decompress-int.dir/__/__/src/integerCoding.cpp.o" "gcc" "tests/decompress-int/CMakeFiles/test-decompress-int.dir/__/__/src/integerCoding.cpp.o.d"
+  "/root/repo/src/lz4-compression.cc" "tests/decompress-int/CMakeFiles/test-decompress-int.dir/__/__/src/lz4-compression.cc.o" "gcc" "tests/decompress-int/CMakeFiles/test-decompress-int.dir/__/__/src/lz4-compression.cc.o.d"
+  "/root/repo/tests/decompress-int/test-decompress-int-main.cc" "tests/decompress-int/CMakeFiles/test-decompress-int.dir/test-decompress-int-main.cc.o" "gcc" "tests/decompress-int/CMakeFiles/test-decompress-int.dir/test-decompress-int-main.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../test-decompress-int"
+  "../../test-decompress-int.pdb"
+  "CMakeFiles/test-decompress-int.dir/__/__/src/integerCoding.cpp.o"
+  "CMakeFiles/test-decompress-int.dir/__/__/src/integerCoding.cpp.o.d"
+  "CMakeFiles/test-decompress-int.dir/__/__/src/lz4-compression.cc.o"
+  "CMakeFiles/test-decompress-int.dir/__/__/src/lz4-compression.cc.o.d"
+  "CMakeFiles/test-decompress-int.dir/__/__/src/lz4/lz4.c.o"
+  "CMakeFiles/test-decompress-int.dir/__/__/src/lz4/lz4.c.o.d"
+  "CMakeFiles/test-decompress-int.dir/test-decompress-int-main.cc.o"
+  "CMakeFiles/test-decompress-int.dir/test-decompress-int-main.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/test-decompress-int.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
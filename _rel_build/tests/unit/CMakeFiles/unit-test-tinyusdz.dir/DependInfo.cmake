@@ -0,0 +1,38 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/unit/unit-crate-reader.cc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-crate-reader.cc.o" "gcc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-crate-reader.cc.o.d"
+  "/root/repo/tests/unit/unit-customdata.cc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-customdata.cc.o" "gcc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-customdata.cc.o.d"
+  "/root/repo/tests/unit/unit-handle-allocator.cc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-handle-allocator.cc.o" "gcc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-handle-allocator.cc.o.d"
+  "/root/repo/tests/unit/unit-integer-coding.cc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-integer-coding.cc.o" "gcc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-integer-coding.cc.o.d"
+  "/root/repo/tests/unit/unit-ioutil.cc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-ioutil.cc.o" "gcc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-ioutil.cc.o.d"
+  "/root/repo/tests/unit/unit-main.cc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-main.cc.o" "gcc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-main.cc.o.d"
+  "/root/repo/tests/unit/unit-math.cc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-math.cc.o" "gcc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-math.cc.o.d"
+  "/root/repo/tests/unit/unit-pathutil.cc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-pathutil.cc.o" "gcc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-pathutil.cc.o.d"
+  "/root/repo/tests/unit/unit-pprint.cc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-pprint.cc.o" "gcc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-pprint.cc.o.d"
+  "/root/repo/tests/unit/unit-prim-types.cc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-prim-types.cc.o" "gcc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-prim-types.cc.o.d"
+  "/root/repo/tests/unit/unit-primvar.cc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-primvar.cc.o" "gcc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-primvar.cc.o.d"
+  "/root/repo/tests/unit/unit-pxr-compat-api.cc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-pxr-compat-api.cc.o" "gcc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-pxr-compat-api.cc.o.d"
+  "/root/repo/tests/unit/unit-strutil.cc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-strutil.cc.o" "gcc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-strutil.cc.o.d"
+  "/root/repo/tests/unit/unit-timesamples.cc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-timesamples.cc.o" "gcc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-timesamples.cc.o.d"
+  "/root/repo/tests/unit/unit-usda-reader.cc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-usda-reader.cc.o" "gcc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-usda-reader.cc.o.d"
+  "/root/repo/tests/unit/unit-usdc-reader.cc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-usdc-reader.cc.o" "gcc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-usdc-reader.cc.o.d"
+  "/root/repo/tests/unit/unit-usdc-writer.cc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-usdc-writer.cc.o" "gcc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-usdc-writer.cc.o.d"
+  "/root/repo/tests/unit/unit-value-types.cc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-value-types.cc.o" "gcc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-value-types.cc.o.d"
+  "/root/repo/tests/unit/unit-xform.cc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-xform.cc.o" "gcc" "tests/unit/CMakeFiles/unit-test-tinyusdz.dir/unit-xform.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/tinyusdz_static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "../../unit-test-tinyusdz"
+  "../../unit-test-tinyusdz.pdb"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-crate-reader.cc.o"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-crate-reader.cc.o.d"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-customdata.cc.o"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-customdata.cc.o.d"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-handle-allocator.cc.o"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-handle-allocator.cc.o.d"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-integer-coding.cc.o"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-integer-coding.cc.o.d"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-ioutil.cc.o"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-ioutil.cc.o.d"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-main.cc.o"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-main.cc.o.d"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-math.cc.o"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-math.cc.o.d"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-pathutil.cc.o"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-pathutil.cc.o.d"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-pprint.cc.o"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-pprint.cc.o.d"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-prim-types.cc.o"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-prim-types.cc.o.d"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-primvar.cc.o"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-primvar.cc.o.d"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-pxr-compat-api.cc.o"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-pxr-compat-api.cc.o.d"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-strutil.cc.o"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-strutil.cc.o.d"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-timesamples.cc.o"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-timesamples.cc.o.d"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-usda-reader.cc.o"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-usda-reader.cc.o.d"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-usdc-reader.cc.o"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-usdc-reader.cc.o.d"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-usdc-writer.cc.o"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-usdc-writer.cc.o.d"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-value-types.cc.o"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-value-types.cc.o.d"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-xform.cc.o"
+  "CMakeFiles/unit-test-tinyusdz.dir/unit-xform.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-test-tinyusdz.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit
+# Build directory: /root/repo/_rel_build/tests/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(unit-test-tinyusdz "/root/repo/_rel_build/unit-test-tinyusdz")
+set_tests_properties(unit-test-tinyusdz PROPERTIES  WORKING_DIRECTORY "/root/repo/_rel_build" _BACKTRACE_TRIPLES "/root/repo/tests/unit/CMakeLists.txt;39;add_test;/root/repo/tests/unit/CMakeLists.txt;0;")
@@ -0,0 +1,149 @@
+//
+// Benchmark for integer decoding(Usd_IntegerCompression) used in Crate(USDC).
+// Compares the scalar decoder and SIMD decoder on index streams typically seen
+// in USD assets(faceVertexIndices, faceVertexCounts, skinning joint indices).
+//
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ubench.h"
+
+#include "integerCoding.h"
+#include "lz4-compression.hh"
+
+using namespace tinyusdz;
+
+namespace {
+
+// Integer-coded(LZ4 decompressed) stream.
+struct EncodedInts {
+  std::vector<char> compressed;
+  std::vector<char> encoded;
+  size_t n{0};
+};
+
+EncodedInts Encode(const std::vector<int32_t> &ints) {
+  EncodedInts e;
+  e.n = ints.size();
+
+  std::string err;
+  e.compressed.resize(Usd_IntegerCompression::GetCompressedBufferSize(e.n));
+  size_t sz = Usd_IntegerCompression::CompressToBuffer(
+      ints.data(), e.n, e.compressed.data(), &err);
+  e.compressed.resize(sz);
+
+  e.encoded.resize(Usd_IntegerCompression::GetDecompressionWorkingSpaceSize(e.n));
+  sz = LZ4Compression::DecompressFromBuffer(e.compressed.data(), e.encoded.data(),
+                                            e.compressed.size(), e.encoded.size(),
+                                            &err);
+  e.encoded.resize(sz);
+
+  return e;
+}
+
+// faceVertexIndices of 1024x1024 quad grid mesh.
+const EncodedInts &FaceVertexIndices() {
+  static const EncodedInts e = []() {
+    const int32_t res = 1024;
+    std::vector<int32_t> ints;
+    ints.reserve(size_t(res * res * 4));
+    for (int32_t y = 0; y < res; y++) {
+      for (int32_t x = 0; x < res; x++) {
+        int32_t v0 = y * (res + 1) + x;
+        ints.push_back(v0);
+        ints.push_back(v0 + 1);
+        ints.push_back(v0 + res + 2);
+        ints.push_back(v0 + res + 1);
+      }
+    }
+    return Encode(ints);
+  }();
+  return e;
+}
+
+// faceVertexCounts of mixed tri/quad mesh.
+const EncodedInts &FaceVertexCounts() {
+  static const EncodedInts e = []() {
+    std::vector<int32_t> ints(1024 * 1024);
+    for (size_t i = 0; i < ints.size(); i++) {
+      ints[i] = ((i % 7) == 0) ? 3 : 4;
+    }
+    return Encode(ints);
+  }();
+  return e;
+}
+
+// Skinning joint indices(4 influences per vertex, 120 joints).
+const EncodedInts &JointIndices() {
+  static const EncodedInts e = []() {
+    std::vector<int32_t> ints(1024 * 1024 * 4);
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < ints.size(); i++) {
+      seed = seed * 1664525u + 1013904223u;
+      ints[i] = int32_t((i / 64) % 120 + ((seed >> 16) % 4));
+    }
+    return Encode(ints);
+  }();
+  return e;
+}
+
+void Decode(const EncodedInts &e, std::vector<int32_t> &out, bool simd) {
+  out.resize(e.n);
+  size_t n = Usd_IntegerCompression::DecodeFromBuffer(
+      e.encoded.data(), e.encoded.size(), out.data(), e.n, simd);
+  UBENCH_DO_NOTHING(&n);
+}
+
+void Decompress(const EncodedInts &e, std::vector<int32_t> &out) {
+  out.resize(e.n);
+  std::string err;
+  size_t n = Usd_IntegerCompression::DecompressFromBuffer(
+      e.compressed.data(), e.compressed.size(), out.data(), e.n, &err);
+  UBENCH_DO_NOTHING(&n);
+}
+
+}  // namespace
+
+UBENCH_EX(intcoding, faceVertexIndices_4M_scalar) {
+  const EncodedInts &e = FaceVertexIndices();
+  std::vector<int32_t> out;
+  UBENCH_DO_BENCHMARK() { Decode(e, out, /* simd */ false); }
+}
+
+UBENCH_EX(intcoding, faceVertexIndices_4M_simd) {
+  const EncodedInts &e = FaceVertexIndices();
+  std::vector<int32_t> out;
+  UBENCH_DO_BENCHMARK() { Decode(e, out, /* simd */ true); }
+}
+
+UBENCH_EX(intcoding, faceVertexCounts_1M_scalar) {
+  const EncodedInts &e = FaceVertexCounts();
+  std::vector<int32_t> out;
+  UBENCH_DO_BENCHMARK() { Decode(e, out, /* simd */ false); }
+}
+
+UBENCH_EX(intcoding, faceVertexCounts_1M_simd) {
+  const EncodedInts &e = FaceVertexCounts();
+  std::vector<int32_t> out;
+  UBENCH_DO_BENCHMARK() { Decode(e, out, /* simd */ true); }
+}
+
+UBENCH_EX(intcoding, jointIndices_4M_scalar) {
+  const EncodedInts &e = JointIndices();
+  std::vector<int32_t> out;
+  UBENCH_DO_BENCHMARK() { Decode(e, out, /* simd */ false); }
+}
+
+UBENCH_EX(intcoding, jointIndices_4M_simd) {
+  const EncodedInts &e = JointIndices();
+  std::vector<int32_t> out;
+  UBENCH_DO_BENCHMARK() { Decode(e, out, /* simd */ true); }
+}
+
+// LZ4 decompression + decoding
+UBENCH_EX(intcoding, faceVertexIndices_4M_decompress) {
+  const EncodedInts &e = FaceVertexIndices();
+  std::vector<int32_t> out;
+  UBENCH_DO_BENCHMARK() { Decompress(e, out); }
+}
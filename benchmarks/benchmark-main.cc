@@ -61,8 +61,7 @@ UBENCH(perf, timesamples_double_10M)
   tinyusdz::value::TimeSamples ts;
 
   for (size_t i = 0; i < ns; i++) {
-    ts.times.push_back(double(i));
-    ts.values.push_back(double(i));
+    ts.add_sample(double(i), tinyusdz::value::Value(double(i)));
   }
 }
 
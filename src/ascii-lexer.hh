@@ -0,0 +1,442 @@
+// SPDX-License-Identifier: Apache 2.0
+// Copyright 2023 - Present, Light Transport Entertainment Inc.
+//
+// Character scanning primitives for USDA parser.
+// Operates directly on the contiguous input buffer [p, end).
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// SIMD scanning. x86: SSE2. aarch64: NEON. Otherwise scalar only.
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || \
+    (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define TINYUSDZ_ASCII_LEXER_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#elif (defined(__aarch64__) || defined(_M_ARM64)) && \
+    (!defined(__BYTE_ORDER__) || (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__))
+#define TINYUSDZ_ASCII_LEXER_NEON
+#include <arm_neon.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+namespace tinyusdz {
+namespace ascii {
+namespace lex {
+
+inline bool IsSpace(const char c) {
+  return (c == ' ') || (c == '\t') || (c == '\f');
+}
+
+inline bool IsDigit(const char c) { return (c >= '0') && (c <= '9'); }
+
+inline bool IsAlpha(const char c) {
+  return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z'));
+}
+
+inline bool IsAlnum(const char c) { return IsAlpha(c) || IsDigit(c); }
+
+#if defined(TINYUSDZ_ASCII_LEXER_SSE2) || defined(TINYUSDZ_ASCII_LEXER_NEON)
+inline uint32_t CountTrailingZeros(uint64_t v) {
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long idx;
+#if defined(_M_X64) || defined(_M_ARM64)
+  _BitScanForward64(&idx, v);
+#else
+  if (_BitScanForward(&idx, uint32_t(v))) {
+    return uint32_t(idx);
+  }
+  _BitScanForward(&idx, uint32_t(v >> 32));
+  idx += 32;
+#endif
+  return uint32_t(idx);
+#else
+  return uint32_t(__builtin_ctzll(static_cast<unsigned long long>(v)));
+#endif
+}
+#endif
+
+#if defined(TINYUSDZ_ASCII_LEXER_NEON)
+// Bitmask of 16 byte compare result: 4 bits per byte.
+inline uint64_t NibbleMask(const uint8x16_t m) {
+  const uint8x8_t n = vshrn_n_u16(vreinterpretq_u16_u8(m), 4);
+  return vget_lane_u64(vreinterpret_u64_u8(n), 0);
+}
+#endif
+
+///
+/// Returns the pointer to the first char in [p, end) which is not ' ', '\t'
+/// or '\f'. `end` when not found.
+///
+inline const char *SkipSpaces(const char *p, const char *end) {
+  // Fast path: No or single space(e.g. `, `) is the most common case.
+  if ((p == end) || !IsSpace(*p)) {
+    return p;
+  }
+  p++;
+
+#if defined(TINYUSDZ_ASCII_LEXER_SSE2)
+  const __m128i sp = _mm_set1_epi8(' ');
+  const __m128i tab = _mm_set1_epi8('\t');
+  const __m128i ff = _mm_set1_epi8('\f');
+  while ((end - p) >= 16) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    const __m128i m = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(v, sp), _mm_cmpeq_epi8(v, tab)),
+        _mm_cmpeq_epi8(v, ff));
+    const uint32_t mask = uint32_t(_mm_movemask_epi8(m)) ^ 0xffffu;
+    if (mask) {
+      return p + CountTrailingZeros(mask);
+    }
+    p += 16;
+  }
+#elif defined(TINYUSDZ_ASCII_LEXER_NEON)
+  const uint8x16_t sp = vdupq_n_u8(uint8_t(' '));
+  const uint8x16_t tab = vdupq_n_u8(uint8_t('\t'));
+  const uint8x16_t ff = vdupq_n_u8(uint8_t('\f'));
+  while ((end - p) >= 16) {
+    const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t *>(p));
+    const uint8x16_t m =
+        vorrq_u8(vorrq_u8(vceqq_u8(v, sp), vceqq_u8(v, tab)), vceqq_u8(v, ff));
+    const uint64_t mask = ~NibbleMask(m);
+    if (mask) {
+      return p + (CountTrailingZeros(mask) >> 2);
+    }
+    p += 16;
+  }
+#endif
+
+  while ((p < end) && IsSpace(*p)) {
+    p++;
+  }
+
+  return p;
+}
+
+///
+/// Returns the pointer to the first '\n', '\r' or '\0'(end of input) in
+/// [p, end). `end` when not found.
+///
+inline const char *FindNewline(const char *p, const char *end) {
+#if defined(TINYUSDZ_ASCII_LEXER_SSE2)
+  const __m128i lf = _mm_set1_epi8('\n');
+  const __m128i cr = _mm_set1_epi8('\r');
+  const __m128i nul = _mm_setzero_si128();
+  while ((end - p) >= 16) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    const __m128i m = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(v, lf), _mm_cmpeq_epi8(v, cr)),
+        _mm_cmpeq_epi8(v, nul));
+    const uint32_t mask = uint32_t(_mm_movemask_epi8(m));
+    if (mask) {
+      return p + CountTrailingZeros(mask);
+    }
+    p += 16;
+  }
+#elif defined(TINYUSDZ_ASCII_LEXER_NEON)
+  const uint8x16_t lf = vdupq_n_u8(uint8_t('\n'));
+  const uint8x16_t cr = vdupq_n_u8(uint8_t('\r'));
+  const uint8x16_t nul = vdupq_n_u8(0);
+  while ((end - p) >= 16) {
+    const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t *>(p));
+    const uint8x16_t m =
+        vorrq_u8(vorrq_u8(vceqq_u8(v, lf), vceqq_u8(v, cr)), vceqq_u8(v, nul));
+    const uint64_t mask = NibbleMask(m);
+    if (mask) {
+      return p + (CountTrailingZeros(mask) >> 2);
+    }
+    p += 16;
+  }
+#endif
+
+  while ((p < end) && (*p != '\n') && (*p != '\r') && (*p != '\0')) {
+    p++;
+  }
+
+  return p;
+}
+
+///
+/// Skip ' ', '\t', '\f', newlines('\n', '\r' or "\r\n") and ';'(when
+/// `allow_semicolon` is true). `row` and `col` are updated.
+///
+inline const char *SkipSpacesAndNewlines(const char *p, const char *end,
+                                         const bool allow_semicolon, int *row,
+                                         int *col) {
+  while (p < end) {
+    const char c = *p;
+
+    if (IsSpace(c)) {
+      const char *q = SkipSpaces(p, end);
+      (*col) += int(q - p);
+      p = q;
+    } else if (allow_semicolon && (c == ';')) {
+      (*col)++;
+      p++;
+    } else if (c == '\n') {
+      (*col) = 0;
+      (*row)++;
+      p++;
+    } else if (c == '\r') {
+      p++;
+      // CRLF?
+      if ((p < end) && (*p == '\n')) {
+        p++;
+      }
+      (*col) = 0;
+      (*row)++;
+    } else {
+      break;
+    }
+  }
+
+  return p;
+}
+
+///
+/// Update `row` and `col` as if all chars in [p, end) are consumed.
+/// Newline is '\n', '\r' or "\r\n".
+///
+inline void AdvanceRowCol(const char *p, const char *end, int *row,
+                          int *col) {
+  while (p < end) {
+    const char *q = FindNewline(p, end);
+    (*col) += int(q - p);
+    if (q == end) {
+      break;
+    }
+
+    if (*q == '\0') {
+      (*col)++;
+      p = q + 1;
+      continue;
+    }
+
+    if ((*q == '\r') && ((q + 1) < end) && (q[1] == '\n')) {
+      q++;
+    }
+    (*col) = 0;
+    (*row)++;
+    p = q + 1;
+  }
+}
+
+///
+/// Returns the pointer to the first char in [p, end) which may change the
+/// nesting level of `{}` block or `()` metadata: '{', '}', '(', ')',
+/// '#'(comment), '"', '\''(string) or '@'(asset path). `end` when not found.
+///
+inline const char *FindBlockDelimiter(const char *p, const char *end) {
+#if defined(TINYUSDZ_ASCII_LEXER_SSE2)
+  const __m128i lb = _mm_set1_epi8('{');
+  const __m128i rb = _mm_set1_epi8('}');
+  const __m128i lp = _mm_set1_epi8('(');
+  const __m128i rp = _mm_set1_epi8(')');
+  const __m128i sharp = _mm_set1_epi8('#');
+  const __m128i dq = _mm_set1_epi8('"');
+  const __m128i sq = _mm_set1_epi8('\'');
+  const __m128i at = _mm_set1_epi8('@');
+  while ((end - p) >= 16) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    const __m128i m = _mm_or_si128(
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, lb), _mm_cmpeq_epi8(v, rb)),
+                     _mm_or_si128(_mm_cmpeq_epi8(v, lp), _mm_cmpeq_epi8(v, rp))),
+        _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, sharp), _mm_cmpeq_epi8(v, dq)),
+            _mm_or_si128(_mm_cmpeq_epi8(v, sq), _mm_cmpeq_epi8(v, at))));
+    const uint32_t mask = uint32_t(_mm_movemask_epi8(m));
+    if (mask) {
+      return p + CountTrailingZeros(mask);
+    }
+    p += 16;
+  }
+#elif defined(TINYUSDZ_ASCII_LEXER_NEON)
+  const uint8x16_t lb = vdupq_n_u8(uint8_t('{'));
+  const uint8x16_t rb = vdupq_n_u8(uint8_t('}'));
+  const uint8x16_t lp = vdupq_n_u8(uint8_t('('));
+  const uint8x16_t rp = vdupq_n_u8(uint8_t(')'));
+  const uint8x16_t sharp = vdupq_n_u8(uint8_t('#'));
+  const uint8x16_t dq = vdupq_n_u8(uint8_t('"'));
+  const uint8x16_t sq = vdupq_n_u8(uint8_t('\''));
+  const uint8x16_t at = vdupq_n_u8(uint8_t('@'));
+  while ((end - p) >= 16) {
+    const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t *>(p));
+    const uint8x16_t m = vorrq_u8(
+        vorrq_u8(vorrq_u8(vceqq_u8(v, lb), vceqq_u8(v, rb)),
+                 vorrq_u8(vceqq_u8(v, lp), vceqq_u8(v, rp))),
+        vorrq_u8(vorrq_u8(vceqq_u8(v, sharp), vceqq_u8(v, dq)),
+                 vorrq_u8(vceqq_u8(v, sq), vceqq_u8(v, at))));
+    const uint64_t mask = NibbleMask(m);
+    if (mask) {
+      return p + (CountTrailingZeros(mask) >> 2);
+    }
+    p += 16;
+  }
+#endif
+
+  while ((p < end) && (*p != '{') && (*p != '}') && (*p != '(') &&
+         (*p != ')') && (*p != '#') && (*p != '"') && (*p != '\'') &&
+         (*p != '@')) {
+    p++;
+  }
+
+  return p;
+}
+
+///
+/// Skip string literal(`"..."`, `'...'`, `"""..."""` or `'''...'''`)
+/// or asset path(`@...@` or `@@@...@@@`) which starts at `p`.
+/// Returns nullptr when the literal is not terminated.
+///
+inline const char *SkipQuoted(const char *p, const char *end) {
+  const char q = *p;
+
+  if (((end - p) >= 3) && (p[1] == q) && (p[2] == q)) {
+    // Triple-quoted. Can span multiple lines.
+    p += 3;
+    while (p < end) {
+      if ((*p == '\\') && ((end - p) >= 2)) {
+        p += 2;
+        continue;
+      }
+      if ((*p == q) && ((end - p) >= 3) && (p[1] == q) && (p[2] == q)) {
+        return p + 3;
+      }
+      p++;
+    }
+    return nullptr;
+  }
+
+  p++;
+  while (p < end) {
+    const char c = *p;
+    // No escape sequence in asset path(e.g. `@C:\\path\\to\\@`)
+    if ((c == '\\') && (q != '@') && ((end - p) >= 2)) {
+      p += 2;
+      continue;
+    }
+    if (c == q) {
+      return p + 1;
+    }
+    if ((c == '\n') || (c == '\r')) {
+      return nullptr;
+    }
+    p++;
+  }
+
+  return nullptr;
+}
+
+///
+/// Scan `{}` blocks in [p, end) with skipping comments, string literals and
+/// asset paths. The pointer next to `}` which closes the outermost block(not
+/// enclosed by `()`, e.g. dictionary in Prim metadata) is appended to
+/// `block_ends`.
+/// Returns false when brackets are not balanced or a literal is not
+/// terminated.
+///
+inline bool ScanBlocks(const char *p, const char *end,
+                       std::vector<const char *> *block_ends) {
+  int depth = 0;
+  int paren_depth = 0;
+
+  while ((p = FindBlockDelimiter(p, end)) < end) {
+    const char c = *p;
+    if (c == '#') {
+      p = FindNewline(p, end);
+    } else if (c == '{') {
+      depth++;
+      p++;
+    } else if (c == '}') {
+      depth--;
+      p++;
+      if ((depth == 0) && (paren_depth == 0)) {
+        block_ends->push_back(p);
+      } else if (depth < 0) {
+        return false;
+      }
+    } else if (c == '(') {
+      paren_depth++;
+      p++;
+    } else if (c == ')') {
+      paren_depth--;
+      p++;
+      if (paren_depth < 0) {
+        return false;
+      }
+    } else {
+      p = SkipQuoted(p, end);
+      if (!p) {
+        return false;
+      }
+    }
+  }
+
+  return (depth == 0) && (paren_depth == 0);
+}
+
+///
+/// Returns the pointer to the end of identifier chars(`_` | [a-zA-Z0-9]) in
+/// [p, end).
+///
+inline const char *SkipIdentifierChars(const char *p, const char *end) {
+  while ((p < end) && ((*p == '_') || IsAlnum(*p))) {
+    p++;
+  }
+  return p;
+}
+
+///
+/// Non-owning slice of the input buffer(`std::string_view` equivalent for
+/// C++14). Valid only while the input buffer is alive, so materialize it with
+/// `str()` before storing it.
+///
+struct StringSpan {
+  const char *data{nullptr};
+  size_t size{0};
+
+  bool empty() const { return size == 0; }
+
+  std::string str() const { return std::string(data, size); }
+
+  bool operator==(const char *s) const {
+    return (std::strlen(s) == size) && (std::memcmp(data, s, size) == 0);
+  }
+  bool operator!=(const char *s) const { return !(*this == s); }
+};
+
+///
+/// Scans an identifier (`_` | [a-zA-Z]) (`_` | [a-zA-Z0-9])* at `p`.
+/// Returns an empty span when [p, end) does not start with an identifier.
+///
+inline StringSpan ScanIdentifier(const char *p, const char *end) {
+  StringSpan span;
+  if ((p < end) && ((*p == '_') || IsAlpha(*p))) {
+    span.data = p;
+    span.size = size_t(SkipIdentifierChars(p + 1, end) - p);
+  }
+  return span;
+}
+
+///
+/// Returns the pointer to the end of digits in [p, end).
+///
+inline const char *SkipDigits(const char *p, const char *end) {
+  while ((p < end) && IsDigit(*p)) {
+    p++;
+  }
+  return p;
+}
+
+}  // namespace lex
+}  // namespace ascii
+}  // namespace tinyusdz
@@ -16,6 +16,7 @@
 #include <atomic>
 //#include <cassert>
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <iterator>
@@ -23,14 +24,15 @@
 #include <set>
 #include <sstream>
 #include <stack>
-#if defined(__wasi__)
-#else
-#include <mutex>
-#include <thread>
-#endif
+#include <type_traits>
 #include <vector>
 
+#include "ascii-lexer.hh"
 #include "ascii-parser.hh"
+#if defined(TINYUSDZ_USDA_PARSER_USE_THREAD)
+#include <mutex>
+#include <thread>
+#endif
 #include "str-util.hh"
 #include "path-util.hh"
 #include "tiny-format.hh"
@@ -141,11 +143,17 @@ int parseInt(const std::string &s, int *out_result) {
   return 0;  // OK
 }
 
-nonstd::expected<float, std::string> ParseFloat(const std::string &s) {
+nonstd::expected<float, std::string> ParseFloat(const char *s, size_t n) {
+
+  // fast_float does not accept leading '+'
+  if (n && (s[0] == '+')) {
+    s++;
+    n--;
+  }
 
   // Parse with fast_float
   float result;
-  auto ans = fast_float::from_chars(s.data(), s.data() + s.size(), result);
+  auto ans = fast_float::from_chars(s, s + n, result);
   if (ans.ec != std::errc()) {
     // Current `fast_float` implementation does not report detailed parsing err.
     return nonstd::make_unexpected("Parse failed.");
@@ -154,11 +162,17 @@ nonstd::expected<float, std::string> ParseFloat(const std::string &s) {
   return result;
 }
 
-nonstd::expected<double, std::string> ParseDouble(const std::string &s) {
+nonstd::expected<double, std::string> ParseDouble(const char *s, size_t n) {
+
+  // fast_float does not accept leading '+'
+  if (n && (s[0] == '+')) {
+    s++;
+    n--;
+  }
 
   // Parse with fast_float
   double result;
-  auto ans = fast_float::from_chars(s.data(), s.data() + s.size(), result);
+  auto ans = fast_float::from_chars(s, s + n, result);
   if (ans.ec != std::errc()) {
     // Current `fast_float` implementation does not report detailed parsing err.
     return nonstd::make_unexpected("Parse failed.");
@@ -167,6 +181,350 @@ nonstd::expected<double, std::string> ParseDouble(const std::string &s) {
   return result;
 }
 
+//
+// Fast path for arrays of float/double/int and their tuple types.
+// Parses numbers directly from the input buffer with fast_float.
+//
+template <typename T>
+struct NumericArrayTraits {
+  static constexpr bool supported = false;
+};
+
+#define DEFINE_NUMERIC_ARRAY_TRAITS(__ty, __basety, __n)             \
+  template <>                                                       \
+  struct NumericArrayTraits<__ty> {                                 \
+    using base_type = __basety;                                     \
+    static constexpr bool supported = true;                         \
+    static constexpr size_t ncomps = __n;                           \
+  };                                                                \
+  static_assert(sizeof(__ty) == sizeof(__basety) * __n,             \
+                "Tuple type must be a plain array of base type.");
+
+DEFINE_NUMERIC_ARRAY_TRAITS(int32_t, int32_t, 1)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::int2, int32_t, 2)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::int3, int32_t, 3)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::int4, int32_t, 4)
+DEFINE_NUMERIC_ARRAY_TRAITS(float, float, 1)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::float2, float, 2)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::float3, float, 3)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::float4, float, 4)
+DEFINE_NUMERIC_ARRAY_TRAITS(double, double, 1)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::double2, double, 2)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::double3, double, 3)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::double4, double, 4)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::point3f, float, 3)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::point3d, double, 3)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::normal3f, float, 3)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::normal3d, double, 3)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::vector3f, float, 3)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::vector3d, double, 3)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::color3f, float, 3)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::color3d, double, 3)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::color4f, float, 4)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::color4d, double, 4)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::texcoord2f, float, 2)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::texcoord2d, double, 2)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::texcoord3f, float, 3)
+DEFINE_NUMERIC_ARRAY_TRAITS(value::texcoord3d, double, 3)
+
+#undef DEFINE_NUMERIC_ARRAY_TRAITS
+
+// Returns nullptr when the input is not a plain number(e.g. `inf`) so that
+// the caller can fall back to the generic parser.
+template <typename T>
+const char *ParseNumber(const char *p, const char *end, T *out) {
+  if (p == end) {
+    return nullptr;
+  }
+
+  // fast_float does not accept leading '+'
+  if (*p == '+') {
+    p++;
+  } else if (*p == '-') {
+    if ((p + 1) == end) {
+      return nullptr;
+    }
+    if (!lex::IsDigit(p[1]) && (p[1] != '.')) {
+      // e.g. `-inf`
+      return nullptr;
+    }
+  }
+
+  if ((p == end) || (!lex::IsDigit(*p) && (*p != '.'))) {
+    return nullptr;
+  }
+
+  auto ans = fast_float::from_chars(p, end, *out);
+  if (ans.ec != std::errc()) {
+    return nullptr;
+  }
+
+  return ans.ptr;
+}
+
+// pxrUSD allow floating-point value to `int` type.
+template <>
+const char *ParseNumber(const char *p, const char *end, int32_t *out) {
+  double v;
+  const char *q = ParseNumber(p, end, &v);
+  if (q) {
+    (*out) = int32_t(v);
+  }
+  return q;
+}
+
+///
+/// Parse comma separated numeric elements in [p, end) to `dst`.
+/// Leading whitespaces and `,` after the last element are allowed.
+///
+/// Returns false when the input contains anything other than numbers,
+/// whitespaces and delimiters(e.g. comment, `inf`, syntax error) or the
+/// number of elements exceeds `capacity`.
+///
+template <typename T>
+bool ParseNumericArrayElements(const char *p, const char *end, int *row,
+                               int *col, T *dst, const size_t capacity,
+                               size_t *count) {
+  using B = typename NumericArrayTraits<T>::base_type;
+  constexpr size_t N = NumericArrayTraits<T>::ncomps;
+
+  auto skip = [&](const char *q) {
+    return lex::SkipSpacesAndNewlines(q, end, /* allow_semicolon */ false, row,
+                                      col);
+  };
+
+  // Consume `c`
+  auto expect = [&](const char *q, const char c) -> const char * {
+    if ((q < end) && (*q == c)) {
+      (*col)++;
+      return q + 1;
+    }
+    return nullptr;
+  };
+
+  size_t n = 0;
+  p = skip(p);
+
+  while (p < end) {
+    if (n == capacity) {
+      return false;
+    }
+
+    B v[N];
+
+    if (N > 1) {
+      p = expect(p, '(');
+      if (!p) {
+        return false;
+      }
+      p = skip(p);
+    }
+
+    for (size_t i = 0; i < N; i++) {
+      if (i > 0) {
+        p = expect(skip(p), ',');
+        if (!p) {
+          return false;
+        }
+        p = skip(p);
+      }
+
+      const char *q = ParseNumber(p, end, &v[i]);
+      if (!q) {
+        return false;
+      }
+      (*col) += int(q - p);
+      p = q;
+    }
+
+    if (N > 1) {
+      p = expect(skip(p), ')');
+      if (!p) {
+        return false;
+      }
+    }
+
+    memcpy(reinterpret_cast<void *>(&dst[n]), v, sizeof(T));
+    n++;
+
+    p = skip(p);
+    if (p == end) {
+      break;
+    }
+
+    // Allow `,` after the last element.
+    p = expect(p, ',');
+    if (!p) {
+      return false;
+    }
+    p = skip(p);
+  }
+
+  (*count) = n;
+  return true;
+}
+
+// Arrays smaller than this are always parsed in single thread.
+constexpr size_t kParallelArrayMinBytes = 256 * 1024;
+constexpr size_t kParallelArrayMinChunkBytes = 64 * 1024;
+
+///
+/// Parse the elements of numeric array until `]`(not consumed).
+///
+/// The closing bracket is found first, then the elements are parsed into the
+/// pre-sized `result`. Large array is split at element boundaries and parsed
+/// in parallel when `num_threads` > 1.
+///
+/// Returns false(`result`, `row` and `col` may be modified) when the input
+/// contains anything other than numbers, whitespaces and delimiters(e.g.
+/// comment, `inf`, syntax error). The caller must parse the array again with
+/// the generic parser in that case, which also reports errors.
+///
+template <typename T>
+typename std::enable_if<!NumericArrayTraits<T>::supported, bool>::type
+ParseNumericArray(const char *p, const char *end, int *row, int *col,
+                  std::vector<T> *result, const char **p_end,
+                  const int num_threads) {
+  (void)p;
+  (void)end;
+  (void)row;
+  (void)col;
+  (void)result;
+  (void)p_end;
+  (void)num_threads;
+  return false;
+}
+
+template <typename T>
+typename std::enable_if<NumericArrayTraits<T>::supported, bool>::type
+ParseNumericArray(const char *p, const char *end, int *row, int *col,
+                  std::vector<T> *result, const char **p_end,
+                  const int num_threads) {
+  constexpr size_t N = NumericArrayTraits<T>::ncomps;
+
+  // Element delimiter. The number of delimiters gives the exact number of
+  // elements for tuple types, and an upper bound for scalar types.
+  const char delim = (N == 1) ? ',' : '(';
+
+  const char *close =
+      reinterpret_cast<const char *>(memchr(p, ']', size_t(end - p)));
+  if (!close) {
+    return false;
+  }
+
+  const size_t nbytes = size_t(close - p);
+
+  size_t num_chunks = 1;
+#if defined(TINYUSDZ_USDA_PARSER_USE_THREAD)
+  if (nbytes >= kParallelArrayMinBytes) {
+    num_chunks = (std::min)(size_t(num_threads),
+                            nbytes / kParallelArrayMinChunkBytes);
+  }
+#else
+  (void)num_threads;
+#endif
+
+  if (num_chunks <= 1) {
+    const size_t n = size_t(std::count(p, close, delim)) + 1;
+    result->resize(n);
+
+    size_t count;
+    if (!ParseNumericArrayElements(p, close, row, col, result->data(), n,
+                                   &count)) {
+      return false;
+    }
+    result->resize(count);
+
+    (*p_end) = close;
+    return true;
+  }
+
+#if defined(TINYUSDZ_USDA_PARSER_USE_THREAD)
+  // Split the span right after `,` of element boundary, so that each chunk
+  // except for the last one contains exactly `# of delimiters` elements.
+  std::vector<const char *> bounds;
+  bounds.push_back(p);
+  for (size_t i = 1; i < num_chunks; i++) {
+    const char *q = (std::max)(bounds.back(), p + (nbytes * i) / num_chunks);
+    if (N > 1) {
+      // Find the end of tuple.
+      q = reinterpret_cast<const char *>(memchr(q, ')', size_t(close - q)));
+      if (!q) {
+        break;
+      }
+    }
+    q = reinterpret_cast<const char *>(memchr(q, ',', size_t(close - q)));
+    if (!q) {
+      break;
+    }
+    bounds.push_back(q + 1);
+  }
+  bounds.push_back(close);
+  num_chunks = bounds.size() - 1;
+
+  struct Chunk {
+    size_t offset{0};
+    size_t capacity{0};
+    size_t count{0};
+    int row{0};
+    int col{0};
+    bool ok{false};
+  };
+
+  std::vector<Chunk> chunks(num_chunks);
+  size_t n = 0;
+  for (size_t i = 0; i < num_chunks; i++) {
+    chunks[i].offset = n;
+    chunks[i].capacity =
+        size_t(std::count(bounds[i], bounds[i + 1], delim)) +
+        (((N == 1) && (i == (num_chunks - 1))) ? 1 : 0);
+    n += chunks[i].capacity;
+  }
+  result->resize(n);
+
+  std::atomic<size_t> counter(0);
+  std::vector<std::thread> workers;
+  for (size_t t = 0; t < num_chunks; t++) {
+    workers.emplace_back(std::thread([&]() {
+      size_t i = 0;
+      while ((i = counter++) < num_chunks) {
+        Chunk &chunk = chunks[i];
+        chunk.ok = ParseNumericArrayElements(
+            bounds[i], bounds[i + 1], &chunk.row, &chunk.col,
+            result->data() + chunk.offset, chunk.capacity, &chunk.count);
+      }
+    }));
+  }
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  for (size_t i = 0; i < num_chunks; i++) {
+    const Chunk &chunk = chunks[i];
+    if (!chunk.ok) {
+      return false;
+    }
+    if ((i < (num_chunks - 1)) && (chunk.count != chunk.capacity)) {
+      return false;
+    }
+
+    if (chunk.row > 0) {
+      (*row) += chunk.row;
+      (*col) = chunk.col;
+    } else {
+      (*col) += chunk.col;
+    }
+  }
+  result->resize(chunks.back().offset + chunks.back().count);
+
+  (*p_end) = close;
+  return true;
+#else
+  return false;
+#endif
+}
+
 }  // namespace
 
 //
@@ -799,9 +1157,10 @@ bool AsciiParser::ReadBasicType(int *value) {
   // pxrUSD allow floating-point value to `int` type.
   // so first try fp parsing.
   auto loc = CurrLoc();
-  std::string fp_str;
-  if (LexFloat(&fp_str)) {
-    auto flt = ParseDouble(fp_str);
+  const char *fp_str;
+  size_t fp_len;
+  if (LexFloat(&fp_str, &fp_len)) {
+    auto flt = ParseDouble(fp_str, fp_len);
     if (!flt) {
       PUSH_ERROR_AND_RETURN("Failed to parse floating value.");
     } else {
@@ -1922,7 +2281,21 @@ bool AsciiParser::ParseBasicTypeArray(std::vector<T> *result) {
     Rewind(1);
   }
 
-  if (!SepBy1BasicType<T>(',', ']', result)) {
+  // Fast path for numeric arrays. Fall back to the generic parser for the
+  // input it does not handle.
+  bool parsed{false};
+  {
+    Cursor cursor = _curr_cursor;
+    const char *p;
+    if (ParseNumericArray(CurrPtr(), EndPtr(), &cursor.row, &cursor.col,
+                          result, &p, GetNumThreads())) {
+      SetCurrPtr(p);
+      _curr_cursor = cursor;
+      parsed = true;
+    }
+  }
+
+  if (!parsed && !SepBy1BasicType<T>(',', ']', result)) {
     return false;
   }
 
@@ -2303,39 +2676,29 @@ bool AsciiParser::ParseBasicTypeArray(std::vector<Path> *result) {
 
 template <typename T>
 bool AsciiParser::MaybeNonFinite(T *out) {
-  auto loc = CurrLoc();
-
   // "-inf", "inf" or "nan"
-  std::vector<char> buf(4);
-  if (!CharN(3, &buf)) {
-    return false;
-  }
-  SeekTo(loc);
+  const char *p = CurrPtr();
+  const size_t n = size_t(EndPtr() - p);
 
-  if ((buf[0] == 'i') && (buf[1] == 'n') && (buf[2] == 'f')) {
+  size_t len = 0;
+  if ((n >= 3) && (memcmp(p, "inf", 3) == 0)) {
     (*out) = std::numeric_limits<T>::infinity();
-    return true;
-  }
-
-  if ((buf[0] == 'n') && (buf[1] == 'a') && (buf[2] == 'n')) {
+    len = 3;
+  } else if ((n >= 3) && (memcmp(p, "nan", 3) == 0)) {
     (*out) = std::numeric_limits<T>::quiet_NaN();
-    return true;
-  }
-
-  bool ok = CharN(4, &buf);
-  SeekTo(loc);
-
-  if (ok) {
-    if ((buf[0] == '-') && (buf[1] == 'i') && (buf[2] == 'n') &&
-        (buf[3] == 'f')) {
-      (*out) = -std::numeric_limits<T>::infinity();
-      return true;
-    }
-
+    len = 3;
+  } else if ((n >= 4) && (memcmp(p, "-inf", 4) == 0)) {
+    (*out) = -std::numeric_limits<T>::infinity();
+    len = 4;
+  } else {
     // NOTE: support "-nan"?
+    return false;
   }
 
-  return false;
+  SetCurrPtr(p + len);
+  _curr_cursor.col += int(len);
+
+  return true;
 }
 
 bool AsciiParser::ReadBasicType(value::texcoord2h *value) {
@@ -2822,12 +3185,13 @@ bool AsciiParser::ReadBasicType(float *value) {
     }
   }
 
-  std::string value_str;
-  if (!LexFloat(&value_str)) {
+  const char *value_str;
+  size_t value_len;
+  if (!LexFloat(&value_str, &value_len)) {
     PUSH_ERROR_AND_RETURN("Failed to lex floating value literal.");
   }
 
-  auto flt = ParseFloat(value_str);
+  auto flt = ParseFloat(value_str, value_len);
   if (flt) {
     (*value) = flt.value();
   } else {
@@ -2862,12 +3226,13 @@ bool AsciiParser::ReadBasicType(double *value) {
     }
   }
 
-  std::string value_str;
-  if (!LexFloat(&value_str)) {
+  const char *value_str;
+  size_t value_len;
+  if (!LexFloat(&value_str, &value_len)) {
     PUSH_ERROR_AND_RETURN("Failed to lex floating value literal.");
   }
 
-  auto flt = ParseDouble(value_str);
+  auto flt = ParseDouble(value_str, value_len);
   if (!flt) {
     PUSH_ERROR_AND_RETURN("Failed to parse floating value.");
   } else {
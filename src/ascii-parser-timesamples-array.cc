@@ -26,14 +26,14 @@
 #include <set>
 #include <sstream>
 #include <stack>
-#if defined(__wasi__)
-#else
-#include <mutex>
-#include <thread>
-#endif
 #include <vector>
 
+#include "ascii-lexer.hh"
 #include "ascii-parser.hh"
+#if defined(TINYUSDZ_USDA_PARSER_USE_THREAD)
+#include <mutex>
+#include <thread>
+#endif
 #include "str-util.hh"
 #include "tiny-format.hh"
 
@@ -221,10 +221,76 @@ bool AsciiParser::ParseTimeSampleValueOfArrayType(const std::string &type_name,
   return ParseTimeSampleValueOfArrayType(type_id.value(), result);
 }
 
+namespace {
+
+// timeSamples block smaller than this is always parsed in single thread.
+constexpr size_t kParallelTimeSamplesMinBytes = 256 * 1024;
+
+// Array values of these types may contain `]` or `#` in string literal, so
+// the extent of the value cannot be found by a simple scan.
+bool IsStringArrayType(const std::string &type_name) {
+  nonstd::optional<uint32_t> type_id = value::TryGetTypeId(type_name);
+  if (!type_id) {
+    return true;
+  }
+
+  return (type_id.value() == value::TypeTraits<value::AssetPath>::type_id()) ||
+         (type_id.value() == value::TypeTraits<value::token>::type_id()) ||
+         (type_id.value() == value::TypeTraits<std::string>::type_id());
+}
+
+}  // namespace
+
 bool AsciiParser::ParseTimeSamplesOfArray(const std::string &type_name,
                                    value::TimeSamples *ts_out) {
 
-  value::TimeSamples ts;
+#if defined(TINYUSDZ_USDA_PARSER_USE_THREAD)
+  if ((GetNumThreads() > 1) && !IsStringArrayType(type_name)) {
+    // Estimate the size of timeSamples block.
+    const char *p = CurrPtr();
+    const char *close =
+        reinterpret_cast<const char *>(memchr(p, '}', size_t(EndPtr() - p)));
+    if (close && (size_t(close - p) >= kParallelTimeSamplesMinBytes)) {
+      const uint64_t loc = CurrLoc();
+      const Cursor cursor = _curr_cursor;
+      const size_t num_errs = err_stack.size();
+
+      if (ParseTimeSamplesOfArray(type_name, /* parallel */ true, ts_out)) {
+        return true;
+      }
+
+      // Parse again in single thread, which also reports errors.
+      SeekTo(loc);
+      _curr_cursor = cursor;
+      while (err_stack.size() > num_errs) {
+        err_stack.pop();
+      }
+    }
+  }
+#endif
+
+  return ParseTimeSamplesOfArray(type_name, /* parallel */ false, ts_out);
+}
+
+bool AsciiParser::ParseTimeSamplesOfArray(const std::string &type_name,
+                                          const bool parallel,
+                                          value::TimeSamples *ts_out) {
+
+  std::vector<double> times;
+  std::vector<value::Value> values;
+
+  // [begin, end) of array values whose parsing is deferred.
+  struct ValueSpan {
+    size_t idx;
+    const char *begin;
+    const char *end;
+  };
+  std::vector<ValueSpan> spans;
+
+  auto add_sample = [&](double t, const value::Value &v) {
+    times.push_back(t);
+    values.push_back(v);
+  };
 
   if (!Expect('{')) {
     return false;
@@ -266,7 +332,28 @@ bool AsciiParser::ParseTimeSamplesOfArray(const std::string &type_name,
     }
 
     value::Value value;
-    if (!ParseTimeSampleValueOfArrayType(type_name, &value)) { // could be None(ValueBlock)
+    if (parallel) {
+      if (MaybeNone()) {
+        value = value::ValueBlock();
+      } else {
+        // Find the extent of array value. Parse it later.
+        const char *p = CurrPtr();
+        if ((p == EndPtr()) || (*p != '[')) {
+          return false;
+        }
+
+        const char *q = reinterpret_cast<const char *>(
+            memchr(p, ']', size_t(EndPtr() - p)));
+        if (!q || memchr(p, '#', size_t(q - p))) {
+          return false;
+        }
+        q++;
+
+        spans.push_back({times.size(), p, q});
+        lex::AdvanceRowCol(p, q, &_curr_cursor.row, &_curr_cursor.col);
+        SetCurrPtr(q);
+      }
+    } else if (!ParseTimeSampleValueOfArrayType(type_name, &value)) { // could be None(ValueBlock)
       return false;
     }
 
@@ -286,7 +373,7 @@ bool AsciiParser::ParseTimeSamplesOfArray(const std::string &type_name,
       DCOUT("sep = " << sep);
       if (sep == '}') {
         // End of item
-        ts.add_sample(timeVal, value);
+        add_sample(timeVal, value);
         break;
       } else if (sep == ',') {
         // ok
@@ -304,7 +391,7 @@ bool AsciiParser::ParseTimeSamplesOfArray(const std::string &type_name,
 
           if (nc == '}') {
             // End of item
-            ts.add_sample(timeVal, value);
+            add_sample(timeVal, value);
             break;
           }
         }
@@ -318,7 +405,56 @@ bool AsciiParser::ParseTimeSamplesOfArray(const std::string &type_name,
       return false;
     }
 
-    ts.add_sample(timeVal, value);
+    add_sample(timeVal, value);
+  }
+
+#if defined(TINYUSDZ_USDA_PARSER_USE_THREAD)
+  if (spans.size()) {
+    // Parse array values in parallel. Each worker has its own parser.
+    const size_t num_workers =
+        (std::min)(size_t(GetNumThreads()), spans.size());
+
+    AsciiParserOption option = _option;
+    option.num_threads =
+        (std::max)(1, GetNumThreads() / int(num_workers));
+
+    std::atomic<size_t> counter(0);
+    std::atomic<bool> failed(false);
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < num_workers; t++) {
+      workers.emplace_back(std::thread([&]() {
+        AsciiParser parser;
+        parser._option = option;
+
+        size_t i = 0;
+        while (!failed && ((i = counter++) < spans.size())) {
+          const ValueSpan &span = spans[i];
+          StreamReader sr(reinterpret_cast<const uint8_t *>(span.begin),
+                          uint64_t(span.end - span.begin),
+                          /* swap endian */ false);
+          parser._sr = &sr;
+          if (!parser.ParseTimeSampleValueOfArrayType(type_name,
+                                                      &values[span.idx])) {
+            failed = true;
+          }
+          parser._sr = nullptr;
+        }
+      }));
+    }
+
+    for (auto &worker : workers) {
+      worker.join();
+    }
+
+    if (failed) {
+      return false;
+    }
+  }
+#endif
+
+  value::TimeSamples ts;
+  for (size_t i = 0; i < times.size(); i++) {
+    ts.add_sample(times[i], values[i]);
   }
 
   DCOUT("Parse TimeSamples success. # of items = " << ts.size());
@@ -23,14 +23,15 @@
 #include <set>
 #include <sstream>
 #include <stack>
-#if defined(__wasi__)
-#else
-#include <mutex>
-#include <thread>
-#endif
 #include <vector>
 
+#include "ascii-lexer.hh"
 #include "ascii-parser.hh"
+#if defined(TINYUSDZ_USDA_PARSER_USE_THREAD)
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
 #include "path-util.hh"
 #include "str-util.hh"
 #include "tiny-format.hh"
@@ -912,24 +913,17 @@ bool AsciiParser::ParseDictElement(std::string *out_key,
 }
 
 bool AsciiParser::MaybeCustom() {
-  std::string tok;
-
-  auto loc = CurrLoc();
-  bool ok = ReadIdentifier(&tok);
-
-  if (!ok) {
-    // revert
-    SeekTo(loc);
+  lex::StringSpan tok;
+  if (!LookIdentifier(&tok)) {
     return false;
   }
 
   if (tok == "custom") {
     // cosume `custom` token.
+    Consume(tok);
     return true;
   }
 
-  // revert
-  SeekTo(loc);
   return false;
 }
 
@@ -1085,23 +1079,18 @@ bool AsciiParser::ParseVariants(VariantSelectionMap *out_map) {
 
 // 'None'
 bool AsciiParser::MaybeNone() {
-  std::vector<char> buf;
-
-  auto loc = CurrLoc();
+  const char *p = CurrPtr();
 
-  if (!CharN(4, &buf)) {
-    SeekTo(loc);
+  if ((EndPtr() - p) < 4) {
     return false;
   }
 
-  if ((buf[0] == 'N') && (buf[1] == 'o') && (buf[2] == 'n') &&
-      (buf[3] == 'e')) {
+  if (std::memcmp(p, "None", 4) == 0) {
     // got it
+    SetCurrPtr(p + 4);
     return true;
   }
 
-  SeekTo(loc);
-
   return false;
 }
 
@@ -1110,14 +1099,12 @@ bool AsciiParser::MaybeListEditQual(tinyusdz::ListEditQual *qual) {
     return false;
   }
 
-  std::string tok;
-
-  auto loc = CurrLoc();
-  if (!ReadIdentifier(&tok)) {
-    SeekTo(loc);
+  lex::StringSpan tok;
+  if (!LookIdentifier(&tok)) {
     return false;
   }
 
+  bool qualified{true};
   if (tok == "prepend") {
     DCOUT("`prepend` list edit qualifier.");
     (*qual) = tinyusdz::ListEditQual::Prepend;
@@ -1136,11 +1123,14 @@ bool AsciiParser::MaybeListEditQual(tinyusdz::ListEditQual *qual) {
   } else {
     DCOUT("No ListEdit qualifier.");
     // unqualified
-    // rewind
-    SeekTo(loc);
+    qualified = false;
     (*qual) = tinyusdz::ListEditQual::ResetToExplicit;
   }
 
+  if (qualified) {
+    Consume(tok);
+  }
+
   if (!SkipWhitespace()) {
     return false;
   }
@@ -1154,24 +1144,21 @@ bool AsciiParser::MaybeVariability(tinyusdz::Variability *variability,
     return false;
   }
 
-  std::string tok;
-
-  auto loc = CurrLoc();
-  if (!ReadIdentifier(&tok)) {
-    SeekTo(loc);
+  lex::StringSpan tok;
+  if (!LookIdentifier(&tok)) {
     return false;
   }
 
   if (tok == "uniform") {
     (*variability) = tinyusdz::Variability::Uniform;
     (*varying_authored) = false;
+    Consume(tok);
   } else if (tok == "varying") {
     (*variability) = tinyusdz::Variability::Varying;
     (*varying_authored) = true;
+    Consume(tok);
   } else {
     (*varying_authored) = false;
-    // rewind
-    SeekTo(loc);
   }
 
   if (!SkipWhitespace()) {
@@ -1194,61 +1181,46 @@ bool AsciiParser::IsSupportedAPISchema(const std::string &ty) {
 }
 
 bool AsciiParser::ReadStringLiteral(std::string *literal) {
-  std::stringstream ss;
+  const char *start = CurrPtr();
+  const char *end = EndPtr();
 
-  char c0;
-  if (!Char1(&c0)) {
+  if (start == end) {
     return false;
   }
 
   // TODO: Allow triple-quotated string?
 
-  bool single_quote{false};
-
-  if (c0 == '"') {
-    // ok
-  } else if (c0 == '\'') {
-    // ok
-    single_quote = true;
-  } else {
+  const char c0 = *start;
+  if ((c0 != '"') && (c0 != '\'')) {
     DCOUT("c0 = " << c0);
+    SetCurrPtr(start + 1);
     PUSH_ERROR_AND_RETURN(
         "String or Token literal expected but it does not start with \" or '");
   }
 
-  bool end_with_quotation{false};
-
-  while (!Eof()) {
-    char c;
-    if (!Char1(&c)) {
-      // this should not happen.
-      return false;
-    }
-
-    if ((c == '\n') || (c == '\r')) {
-      PUSH_ERROR_AND_RETURN("New line in string literal.");
-    }
-
-    if (single_quote) {
-      if (c == '\'') {
-        end_with_quotation = true;
-        break;
-      }
-    } else if (c == '"') {
-      end_with_quotation = true;
-      break;
-    }
+  bool single_quote = (c0 == '\'');
 
-    ss << c;
+  // Find the closing quote(or newline) and take the contents at once.
+  const char *p = start + 1;
+  while ((p < end) && (*p != c0) && (*p != '\n') && (*p != '\r') &&
+         (*p != '\0')) {
+    p++;
   }
 
-  if (!end_with_quotation) {
+  if ((p == end) || (*p == '\0')) {
+    SetCurrPtr(p);
     PUSH_ERROR_AND_RETURN(
         fmt::format("String literal expected but it does not end with {}.",
                     single_quote ? "'" : "\""));
   }
 
-  (*literal) = ss.str();
+  SetCurrPtr(p + 1);
+
+  if (*p != c0) {
+    PUSH_ERROR_AND_RETURN("New line in string literal.");
+  }
+
+  literal->assign(start + 1, size_t(p - (start + 1)));
 
   _curr_cursor.col += int(literal->size() + 2);  // +2 for quotation chars
 
@@ -1256,87 +1228,72 @@ bool AsciiParser::ReadStringLiteral(std::string *literal) {
 }
 
 bool AsciiParser::MaybeString(value::StringData *str) {
-  std::stringstream ss;
-
   if (!str) {
     return false;
   }
 
-  auto loc = CurrLoc();
   auto start_cursor = _curr_cursor;
 
-  char c0;
-  if (!Char1(&c0)) {
-    SeekTo(loc);
-    return false;
-  }
+  const char *start = CurrPtr();
+  const char *end = EndPtr();
 
   // ' or " allowed.
-  if ((c0 != '"') && (c0 != '\'')) {
-    SeekTo(loc);
+  if ((start == end) || ((*start != '"') && (*start != '\''))) {
     return false;
   }
 
-  bool single_quote = (c0 == '\'');
+  const char quote = *start;
+
+  // Scan to the closing quote. The contents are copied in segments between
+  // escaped quotes(\" or \'), so a plain string is copied only once.
+  std::string s;
+  const char *seg = start + 1;
+  const char *p = start + 1;
 
   bool end_with_quotation{false};
 
-  while (!Eof()) {
-    char c;
-    if (!Char1(&c)) {
-      // this should not happen.
-      SeekTo(loc);
-      return false;
-    }
+  while ((p < end) && (*p != '\0')) {
+    const char c = *p;
 
     if ((c == '\n') || (c == '\r')) {
-      SeekTo(loc);
       return false;
     }
 
     if (c == '\\') {
       // escaped quote? \" \'
-      char nc;
-      if (!LookChar1(&nc)) {
+      if ((p + 1) == end) {
         return false;
       }
 
-      if (nc == '\'') {
-        ss << "'";
-        _sr->seek_from_current(1);  // advance 1 char
-        continue;
-      } else if (nc == '"') {
-        ss << "\"";
-        _sr->seek_from_current(1);  // advance 1 char
+      if ((p[1] == '\'') || (p[1] == '"')) {
+        // drop '\'
+        s.append(seg, p);
+        seg = p + 1;
+        p += 2;
         continue;
       }
     }
 
-    if (single_quote) {
-      if (c == '\'') {
-        end_with_quotation = true;
-        break;
-      }
-    } else {
-      if (c == '"') {
-        end_with_quotation = true;
-        break;
-      }
+    if (c == quote) {
+      end_with_quotation = true;
+      break;
     }
 
-    ss << c;
+    p++;
   }
 
   if (!end_with_quotation) {
-    SeekTo(loc);
     return false;
   }
 
+  s.append(seg, p);
+  SetCurrPtr(p + 1);
+
   DCOUT("Single quoted string found. col " << start_cursor.col << ", row "
                                            << start_cursor.row);
 
-  size_t displayed_string_len = ss.str().size();
-  str->value = unescapeControlSequence(ss.str());
+  size_t displayed_string_len = s.size();
+  str->value = unescapeControlSequence(s);
   str->line_col = start_cursor.col;
   str->line_row = start_cursor.row;
   str->is_triple_quoted = false;
@@ -1352,31 +1309,25 @@ bool AsciiParser::MaybeTripleQuotedString(value::StringData *str) {
   auto loc = CurrLoc();
   auto start_cursor = _curr_cursor;
 
-  std::vector<char> triple_quote;
-  if (!CharN(3, &triple_quote)) {
-    SeekTo(loc);
-    return false;
-  }
-
-  if (triple_quote.size() != 3) {
-    SeekTo(loc);
+  // Look ahead without copying, since most strings are not triple-quoted.
+  const char *triple_quote = CurrPtr();
+  if ((EndPtr() - triple_quote) < 3) {
     return false;
   }
 
   bool single_quote = false;
 
-  if (triple_quote[0] == '"' && triple_quote[1] == '"' &&
-      triple_quote[2] == '"') {
+  if (std::memcmp(triple_quote, "\"\"\"", 3) == 0) {
     // ok
-  } else if (triple_quote[0] == '\'' && triple_quote[1] == '\'' &&
-             triple_quote[2] == '\'') {
+  } else if (std::memcmp(triple_quote, "\'\'\'", 3) == 0) {
     // ok
     single_quote = true;
   } else {
-    SeekTo(loc);
     return false;
   }
 
+  SetCurrPtr(triple_quote + 3);
+
   // Read until next triple-quote `"""` or "'''"
   std::stringstream str_buf;
 
@@ -1519,61 +1470,60 @@ bool AsciiParser::ReadPrimAttrIdentifier(std::string *token) {
   // - xformOp:transform
   // - primvars:uvmap1
 
-  std::stringstream ss;
+  const char *start = CurrPtr();
+  const char *end = EndPtr();
+  const char *p = start;
 
-  while (!Eof()) {
-    char c;
-    if (!Char1(&c)) {
-      // this should not happen.
-      return false;
-    }
+  while ((p < end) && (*p != '\0')) {
+    const char c = *p;
 
     if (c == '_') {
       // ok
     } else if (c == ':') {  // namespace
       // ':' must lie in the middle of string literal
-      if (ss.str().size() == 0) {
+      if (p == start) {
+        SetCurrPtr(p + 1);
         PUSH_ERROR_AND_RETURN("PrimAttr name must not starts with `:`");
       }
     } else if (c == '.') {  // delimiter for `connect`
       // '.' must lie in the middle of string literal
-      if (ss.str().size() == 0) {
+      if (p == start) {
+        SetCurrPtr(p + 1);
         PUSH_ERROR_AND_RETURN("PrimAttr name must not starts with `.`");
       }
-    } else if (std::isalnum(int(c))) {
+    } else if (lex::IsAlnum(c)) {
       // number must not be allowed for the first char.
-      if (ss.str().size() == 0) {
-        if (!std::isalpha(int(c))) {
-          PUSH_ERROR_AND_RETURN("PrimAttr name must not starts with number.");
-        }
+      if ((p == start) && !lex::IsAlpha(c)) {
+        SetCurrPtr(p + 1);
+        PUSH_ERROR_AND_RETURN("PrimAttr name must not starts with number.");
       }
     } else {
-      _sr->seek_from_current(-1);
       break;
     }
 
-    _curr_cursor.col++;
-
-    ss << c;
+    p++;
   }
 
+  _curr_cursor.col += int(p - start);
+  SetCurrPtr(p);
+
+  std::string tok(start, size_t(p - start));
+
   {
     std::string name_err;
-    if (!pathutil::ValidatePropPath(Path("", ss.str()), &name_err)) {
+    if (!pathutil::ValidatePropName(tok, &name_err)) {
       PUSH_ERROR_AND_RETURN_TAG(
           kAscii,
-          fmt::format("Invalid Property name `{}`: {}", ss.str(), name_err));
+          fmt::format("Invalid Property name `{}`: {}", tok, name_err));
     }
   }
 
   // '.' must lie in the middle of string literal
-  if (ss.str().back() == '.') {
+  if (tok.back() == '.') {
     PUSH_ERROR_AND_RETURN("PrimAttr name must not ends with `.`\n");
     return false;
   }
 
-  std::string tok = ss.str();
-
   if (contains(tok, '.')) {
     if (endsWith(tok, ".connect") || endsWith(tok, ".timeSamples")) {
       // OK
@@ -1593,62 +1543,42 @@ bool AsciiParser::ReadPrimAttrIdentifier(std::string *token) {
     }
   }
 
-  (*token) = ss.str();
+  (*token) = std::move(tok);
   DCOUT("primAttr identifier = " << (*token));
   return true;
 }
 
 bool AsciiParser::ReadIdentifier(std::string *token) {
-  // identifier = (`_` | [a-zA-Z]) (`_` | [a-zA-Z0-9]+)
-  std::stringstream ss;
-
-  // The first character.
-  {
-    char c;
-    if (!Char1(&c)) {
-      // this should not happen.
-      DCOUT("read1 failed.");
-      return false;
-    }
-
-    if (c == '_') {
-      // ok
-    } else if (!std::isalpha(int(c))) {
-      DCOUT(fmt::format("Invalid identiefier: '{}'", c));
-      _sr->seek_from_current(-1);
-      return false;
-    }
-    _curr_cursor.col++;
-
-    ss << c;
+  lex::StringSpan tok;
+  if (!LookIdentifier(&tok)) {
+    return false;
   }
 
-  while (!Eof()) {
-    char c;
-    if (!Char1(&c)) {
-      // this should not happen.
-      return false;
-    }
+  Consume(tok);
 
-    if (c == '_') {
-      // ok
-    } else if (!std::isalnum(int(c))) {
-      _sr->seek_from_current(-1);
-      break;  // end of identifier(e.g. ' ')
-    }
+  token->assign(tok.data, tok.size);
+  return true;
+}
 
-    _curr_cursor.col++;
+bool AsciiParser::LookIdentifier(lex::StringSpan *token) {
+  // identifier = (`_` | [a-zA-Z]) (`_` | [a-zA-Z0-9]+)
+  (*token) = lex::ScanIdentifier(CurrPtr(), EndPtr());
 
-    ss << c;
+  if (token->empty()) {
+    DCOUT("Invalid identiefier.");
+    return false;
   }
 
-  (*token) = ss.str();
   return true;
 }
 
+void AsciiParser::Consume(const lex::StringSpan &token) {
+  _curr_cursor.col += int(token.size);
+  SetCurrPtr(token.data + token.size);
+}
+
 bool AsciiParser::ReadPathIdentifier(std::string *path_identifier) {
   // path_identifier = `<` string `>`
-  std::stringstream ss;
 
   if (!Expect('<')) {
     return false;
@@ -1659,30 +1589,24 @@ bool AsciiParser::ReadPathIdentifier(std::string *path_identifier) {
   }
 
   // read until '>'
-  bool ok = false;
-  while (!Eof()) {
-    char c;
-    if (!Char1(&c)) {
-      // this should not happen.
-      return false;
-    }
-
-    if (c == '>') {
-      // end
-      ok = true;
-      _curr_cursor.col++;
-      break;
-    }
-
-    // TODO: Check if character is valid for path identifier
-    ss << c;
+  // TODO: Check if character is valid for path identifier
+  const char *start = CurrPtr();
+  const char *end = EndPtr();
+  const char *p = start;
+  while ((p < end) && (*p != '>') && (*p != '\0')) {
+    p++;
   }
 
-  if (!ok) {
+  if ((p == end) || (*p != '>')) {
+    SetCurrPtr(p);
     return false;
   }
 
-  (*path_identifier) = TrimString(ss.str());
+  // end
+  SetCurrPtr(p + 1);
+  _curr_cursor.col++;
+
+  (*path_identifier) = TrimString(std::string(start, size_t(p - start)));
   // std::cout << "PathIdentifier: " << (*path_identifier) << "\n";
 
   return true;
@@ -1735,42 +1659,25 @@ bool AsciiParser::ReadUntilNewline(std::string *str) {
 }
 
 bool AsciiParser::SkipUntilNewline() {
-  while (!Eof()) {
-    char c;
-    if (!Char1(&c)) {
-      // this should not happen.
-      return false;
-    }
-
-    if (c == '\n') {
-      break;
-    } else if (c == '\r') {
+  const char *end = EndPtr();
+  const char *p = lex::FindNewline(CurrPtr(), end);
+
+  if (p < end) {
+    if (*p == '\n') {
+      p++;
+    } else if (*p == '\r') {
+      p++;
       // CRLF?
-      if (_sr->tell() < (_sr->size() - 1)) {
-        char d;
-        if (!Char1(&d)) {
-          // this should not happen.
-          return false;
-        }
-
-        if (d == '\n') {
-          break;
-        }
-
-        // unwind 1 char
-        if (!_sr->seek_from_current(-1)) {
-          // this should not happen.
-          return false;
-        }
-
-        break;
+      if ((p < end) && (*p == '\n')) {
+        p++;
       }
-
     } else {
-      // continue
+      // '\0'(end of input)
     }
   }
 
+  SetCurrPtr(p);
+
   _curr_cursor.row++;
   _curr_cursor.col = 0;
   return true;
@@ -2049,17 +1956,6 @@ bool AsciiParser::ParseSharpComment() {
   return true;
 }
 
-// Fetch 1 char. Do not change input stream position.
-bool AsciiParser::LookChar1(char *c) {
-  if (!Char1(c)) {
-    return false;
-  }
-
-  Rewind(1);
-
-  return true;
-}
-
 // Fetch N chars. Do not change input stream position.
 bool AsciiParser::LookCharN(size_t n, std::vector<char> *nc) {
   std::vector<char> buf(n);
@@ -2076,8 +1972,6 @@ bool AsciiParser::LookCharN(size_t n, std::vector<char> *nc) {
   return ok;
 }
 
-bool AsciiParser::Char1(char *c) { return _sr->read1(c); }
-
 bool AsciiParser::CharN(size_t n, std::vector<char> *nc) {
   std::vector<char> buf(n);
 
@@ -2134,82 +2028,33 @@ bool AsciiParser::PopParserState(ParseState *state) {
   return true;
 }
 
-bool AsciiParser::SkipWhitespace() {
-  while (!Eof()) {
-    char c;
-    if (!Char1(&c)) {
-      // this should not happen.
-      return false;
-    }
-    _curr_cursor.col++;
-
-    if ((c == ' ') || (c == '\t') || (c == '\f')) {
-      // continue
-    } else {
-      break;
-    }
+int AsciiParser::GetNumThreads() const {
+#if defined(TINYUSDZ_USDA_PARSER_USE_THREAD)
+  int num_threads = _option.num_threads;
+  if (num_threads == -1) {
+    num_threads = (std::max)(1, int(std::thread::hardware_concurrency()));
   }
+  // Limit to 1024 threads.
+  return (std::max)(1, (std::min)(1024, num_threads));
+#else
+  return 1;
+#endif
+}
 
-  // unwind 1 char
-  if (!_sr->seek_from_current(-1)) {
-    return false;
-  }
-  _curr_cursor.col--;
+bool AsciiParser::SkipWhitespace() {
+  const char *p = CurrPtr();
+  const char *q = lex::SkipSpaces(p, EndPtr());
+
+  _curr_cursor.col += int(q - p);
+  SetCurrPtr(q);
 
   return true;
 }
 
 bool AsciiParser::SkipWhitespaceAndNewline(const bool allow_semicolon) {
   // USDA also allow C-style ';' as a newline separator.
-  while (!Eof()) {
-    char c;
-    if (!Char1(&c)) {
-      // this should not happen.
-      return false;
-    }
-
-    // printf("sws c = %c\n", c);
-
-    if ((c == ' ') || (c == '\t') || (c == '\f')) {
-      _curr_cursor.col++;
-      // continue
-    } else if (allow_semicolon && (c == ';')) {
-      _curr_cursor.col++;
-      // continue
-    } else if (c == '\n') {
-      _curr_cursor.col = 0;
-      _curr_cursor.row++;
-      // continue
-    } else if (c == '\r') {
-      // CRLF?
-      if (_sr->tell() < (_sr->size() - 1)) {
-        char d;
-        if (!Char1(&d)) {
-          // this should not happen.
-          return false;
-        }
-
-        if (d == '\n') {
-          // CRLF
-        } else {
-          // unwind 1 char
-          if (!_sr->seek_from_current(-1)) {
-            // this should not happen.
-            return false;
-          }
-        }
-      }
-      _curr_cursor.col = 0;
-      _curr_cursor.row++;
-      // continue
-    } else {
-      // end loop
-      if (!_sr->seek_from_current(-1)) {
-        return false;
-      }
-      break;
-    }
-  }
+  SetCurrPtr(lex::SkipSpacesAndNewlines(CurrPtr(), EndPtr(), allow_semicolon,
+                                        &_curr_cursor.row, &_curr_cursor.col));
 
   return true;
 }
@@ -2218,58 +2063,17 @@ bool AsciiParser::SkipCommentAndWhitespaceAndNewline(
     const bool allow_semicolon) {
   // Skip multiple line of comments.
   while (!Eof()) {
-    char c;
-    if (!Char1(&c)) {
-      // this should not happen.
-      return false;
-    }
-
-    // printf("sws c = %c\n", c);
-
-    if (c == '#') {
-      if (!SkipUntilNewline()) {
-        return false;
-      }
-    } else if ((c == ' ') || (c == '\t') || (c == '\f')) {
-      _curr_cursor.col++;
-      // continue
-    } else if (allow_semicolon && (c == ';')) {
-      _curr_cursor.col++;
-      // continue
-    } else if (c == '\n') {
-      _curr_cursor.col = 0;
-      _curr_cursor.row++;
-      // continue
-    } else if (c == '\r') {
-      // CRLF?
-      if (_sr->tell() < (_sr->size() - 1)) {
-        char d;
-        if (!Char1(&d)) {
-          // this should not happen.
-          return false;
-        }
-
-        if (d == '\n') {
-          // CRLF
-        } else {
-          // unwind 1 char
-          if (!_sr->seek_from_current(-1)) {
-            // this should not happen.
-            return false;
-          }
-        }
-      }
-      _curr_cursor.col = 0;
-      _curr_cursor.row++;
-      // continue
-    } else {
-      // std::cout << "unwind\n";
-      // end loop
-      if (!_sr->seek_from_current(-1)) {
-        return false;
-      }
+    if (!SkipWhitespaceAndNewline(allow_semicolon)) {
+      return false;
+    }
+
+    if (Eof() || (*CurrPtr() != '#')) {
       break;
     }
+
+    if (!SkipUntilNewline()) {
+      return false;
+    }
   }
 
   return true;
@@ -2379,7 +2183,6 @@ bool AsciiParser::ParseAssetIdentifier(value::AssetPath *out,
   // TODO: Correctly support escape characters
 
   // look ahead.
-  std::vector<char> buf;
   uint64_t curr = _sr->tell();
   bool maybe_triple{false};
 
@@ -2387,8 +2190,10 @@ bool AsciiParser::ParseAssetIdentifier(value::AssetPath *out,
     return false;
   }
 
-  if (CharN(3, &buf)) {
-    if (buf[0] == '@' && buf[1] == '@' && buf[2] == '@') {
+  {
+    const char *p = CurrPtr();
+    if (((EndPtr() - p) >= 3) && (std::memcmp(p, "@@@", 3) == 0)) {
+      SetCurrPtr(p + 3);
       maybe_triple = true;
     }
   }
@@ -2414,27 +2219,19 @@ bool AsciiParser::ParseAssetIdentifier(value::AssetPath *out,
           "Asset must start with '@', '\'' or '\"', but got '" + sstr + "'");
     }
 
-    std::string tok;
-
     // Read until next delimiter
-    bool found_delimiter = false;
-    while (!Eof()) {
-      char c;
-
-      if (!Char1(&c)) {
-        return false;
-      }
-
-      if (c == delim) {
-        found_delimiter = true;
-        break;
-      }
-
-      tok += c;
+    const char *start = CurrPtr();
+    const char *end = EndPtr();
+    const char *p = start;
+    while ((p < end) && (*p != delim) && (*p != '\0')) {
+      p++;
     }
 
+    bool found_delimiter = (p < end) && (*p == delim);
+    SetCurrPtr(found_delimiter ? (p + 1) : p);
+
     if (found_delimiter) {
-      (*out) = tok;
+      (*out) = std::string(start, size_t(p - start));
       (*triple_deliminated) = false;
 
       valid = true;
@@ -2811,7 +2608,7 @@ bool AsciiParser::ParseMetaValue(const VariableDef &def, MetaVariable *outvar) {
   return true;
 }
 
-bool AsciiParser::LexFloat(std::string *result) {
+bool AsciiParser::LexFloat(const char **token, size_t *len) {
   // FLOATVAL : ('+' or '-')? FLOAT
   // FLOAT
   //     :   ('0'..'9')+ '.' ('0'..'9')* EXPONENT?
@@ -2820,168 +2617,93 @@ bool AsciiParser::LexFloat(std::string *result) {
   //     ;
   // EXPONENT : ('e'|'E') ('+'|'-')? ('0'..'9')+ ;
 
-  std::stringstream ss;
+  const char *start = CurrPtr();
+  const char *end = EndPtr();
+  const char *p = start;
 
-  bool has_sign{false};
   bool leading_decimal_dots{false};
   {
-    char sc;
-    if (!Char1(&sc)) {
+    if (p == end) {
       return false;
     }
     _curr_cursor.col++;
 
     // sign, '.' or [0-9]
+    const char sc = *p;
     if ((sc == '+') || (sc == '-')) {
-      ss << sc;
-      has_sign = true;
-
-      char c;
-      if (!Char1(&c)) {
+      p++;
+      if (p == end) {
         return false;
       }
 
-      if (c == '.') {
-        // ok. something like `+.7`, `-.53`
+      if (*p == '.') {
+        // ok. something like `+.7`, `-.53`. rescan again in 2.
         leading_decimal_dots = true;
         _curr_cursor.col++;
-        ss << c;
-
-      } else {
-        // unwind and continue
-        _sr->seek_from_current(-1);
       }
 
-    } else if ((sc >= '0') && (sc <= '9')) {
+    } else if (lex::IsDigit(sc)) {
       // ok
-      ss << sc;
+      p++;
     } else if (sc == '.') {
       // ok but rescan again in 2.
       leading_decimal_dots = true;
-      if (!Rewind(1)) {
-        return false;
-      }
       _curr_cursor.col--;
     } else {
       PUSH_ERROR_AND_RETURN("Sign or `.` or 0-9 expected.");
     }
   }
 
-  (void)has_sign;
-
   // 1. Read the integer part
-  char curr;
   if (!leading_decimal_dots) {
-    // std::cout << "1 read int part: ss = " << ss.str() << "\n";
-
-    while (!Eof()) {
-      if (!Char1(&curr)) {
-        return false;
-      }
-
-      // std::cout << "1 curr = " << curr << "\n";
-      if ((curr >= '0') && (curr <= '9')) {
-        // continue
-        ss << curr;
-      } else {
-        _sr->seek_from_current(-1);
-        break;
-      }
-    }
-  }
-
-  if (Eof()) {
-    (*result) = ss.str();
-    return true;
-  }
-
-  if (!Char1(&curr)) {
-    return false;
+    p = lex::SkipDigits(p, end);
   }
 
-  // std::cout << "before 2: ss = " << ss.str() << ", curr = " << curr <<
-  // "\n";
-
   // 2. Read the decimal part
-  if (curr == '.') {
-    ss << curr;
-
-    while (!Eof()) {
-      if (!Char1(&curr)) {
-        return false;
-      }
-
-      if ((curr >= '0') && (curr <= '9')) {
-        ss << curr;
-      } else {
-        break;
-      }
-    }
-
-  } else if ((curr == 'e') || (curr == 'E')) {
-    // go to 3.
-  } else {
-    // end
-    (*result) = ss.str();
-    _sr->seek_from_current(-1);
-    return true;
-  }
-
-  if (Eof()) {
-    (*result) = ss.str();
-    return true;
+  if ((p < end) && (*p == '.')) {
+    p = lex::SkipDigits(p + 1, end);
   }
 
   // 3. Read the exponent part
-  bool has_exp_sign{false};
-  if ((curr == 'e') || (curr == 'E')) {
-    ss << curr;
-
-    if (!Char1(&curr)) {
+  if ((p < end) && ((*p == 'e') || (*p == 'E'))) {
+    p++;
+    if (p == end) {
       return false;
     }
 
-    if ((curr == '+') || (curr == '-')) {
+    bool has_exp_sign{false};
+    if ((*p == '+') || (*p == '-')) {
       // exp sign
-      ss << curr;
       has_exp_sign = true;
-
-    } else if ((curr >= '0') && (curr <= '9')) {
+    } else if (lex::IsDigit(*p)) {
       // ok
-      ss << curr;
     } else {
       // Empty E is not allowed.
       PUSH_ERROR_AND_RETURN("Empty `E' is not allowed.");
     }
+    p++;
 
-    while (!Eof()) {
-      if (!Char1(&curr)) {
-        return false;
-      }
-
-      if ((curr >= '0') && (curr <= '9')) {
+    while (p < end) {
+      if (lex::IsDigit(*p)) {
         // ok
-        ss << curr;
-
-      } else if ((curr == '+') || (curr == '-')) {
+      } else if ((*p == '+') || (*p == '-')) {
         if (has_exp_sign) {
           // No multiple sign characters
           PUSH_ERROR_AND_RETURN("No multiple exponential sign characters.");
         }
-
-        ss << curr;
         has_exp_sign = true;
       } else {
         // end
-        _sr->seek_from_current(-1);
         break;
       }
+      p++;
     }
-  } else {
-    _sr->seek_from_current(-1);
   }
 
-  (*result) = ss.str();
+  SetCurrPtr(p);
+
+  (*token) = start;
+  (*len) = size_t(p - start);
   return true;
 }
 
@@ -3298,7 +3020,7 @@ bool AsciiParser::ParseAttrMeta(AttrMeta *out_meta) {
 
       {
         std::string name_err;
-        if (!pathutil::ValidatePropPath(Path("", varname), &name_err)) {
+        if (!pathutil::ValidatePropName(varname, &name_err)) {
           PUSH_ERROR_AND_RETURN_TAG(
               kAscii,
               fmt::format("Invalid Property name `{}`: {}", varname, name_err));
@@ -3806,7 +3528,7 @@ bool AsciiParser::ParsePrimProps(std::map<std::string, Property> *props,
         p.relationship().metas() = metap.value();
       }
 
-      (*props)[attr_name] = p;
+      (*props)[attr_name] = std::move(p);
 
       return true;
     }
@@ -3867,7 +3589,7 @@ bool AsciiParser::ParsePrimProps(std::map<std::string, Property> *props,
       p.relationship().metas() = metap.value();
     }
 
-    (*props)[attr_name] = p;
+    (*props)[attr_name] = std::move(p);
 
     return true;
   }
@@ -3987,7 +3709,7 @@ bool AsciiParser::ParsePrimProps(std::map<std::string, Property> *props,
 
     p.attribute().metas() = meta;
 
-    (*props)[attr_name] = p;
+    (*props)[attr_name] = std::move(p);
 
     return true;
   }
@@ -4067,7 +3789,7 @@ bool AsciiParser::ParsePrimProps(std::map<std::string, Property> *props,
       //}
 
       Property p(std::move(attr), custom_qual);
-      (*props)[attr_name] = p;
+      (*props)[attr_name] = std::move(p);
     }
 
     DCOUT(fmt::format("Added attribute connection to `{}`", attr_name));
@@ -4134,7 +3856,7 @@ bool AsciiParser::ParsePrimProps(std::map<std::string, Property> *props,
         PUSH_ERROR_AND_RETURN(fmt::format("Variability mismatch. Attribute `{}` already has variability `{}`, but timeSampled value has variability `{}`.", attr_name, to_string(pattr->variability()), to_string(variability)));
       }
 
-      pattr->get_var().set_timesamples(ts);
+      pattr->get_var().set_timesamples(std::move(ts));
 
       // Set PropType to Attrib(since previously created Property may have EmptyAttrib).
       props->at(attr_name).set_property_type(Property::Type::Attrib);
@@ -4144,7 +3866,7 @@ bool AsciiParser::ParsePrimProps(std::map<std::string, Property> *props,
       pattr = &attr;  
 
       primvar::PrimVar var;
-      var.set_timesamples(ts);
+      var.set_timesamples(std::move(ts));
       if (array_qual) {
         pattr->set_type_name(type_name + "[]");
       } else {
@@ -4159,9 +3881,9 @@ bool AsciiParser::ParsePrimProps(std::map<std::string, Property> *props,
 
       pattr->name() = attr_name;
 
-      Property p(attr, custom_qual);
+      Property p(std::move(attr), custom_qual);
       p.set_property_type(Property::Type::Attrib);
-      (*props)[attr_name] = p;
+      (*props)[attr_name] = std::move(p);
     }
 
     return true;
@@ -4536,9 +4258,10 @@ bool AsciiParser::ParsePrimProps(std::map<std::string, Property> *props,
       props->at(attr_name).set_property_type(Property::Type::Attrib);
     } else {
       pattr->variability() = variability;
-      Property p(*pattr, custom_qual);
+      // `pattr` points to the local `_attr` here.
+      Property p(std::move(*pattr), custom_qual);
 
-      (*props)[primattr_name] = p;
+      (*props)[primattr_name] = std::move(p);
     }
 
     return true;
@@ -4713,16 +4436,12 @@ bool AsciiParser::ParseVariantSet(
       }
 
       DCOUT("Read first token in VariantSet stmt");
-      Identifier tok;
-      if (!ReadBasicType(&tok)) {
+      lex::StringSpan tok;
+      if (!LookIdentifier(&tok)) {
         PUSH_ERROR_AND_RETURN(
             "Failed to parse an identifier in variantSet block statement.");
       }
 
-      if (!Rewind(tok.size())) {
-        return false;
-      }
-
       if (tok == "variantSet") {
         PUSH_ERROR_AND_RETURN("Nested `variantSet` is not supported yet.");
       }
@@ -4753,8 +4472,10 @@ bool AsciiParser::ParseVariantSet(
         }
         DCOUT(fmt::format("Done parse `{}` block.", to_string(child_spec)));
 
-        DCOUT(fmt::format("Add primIdx {} to variant {}", idx, variantName));
-        variantContent.primIndices.push_back(idx);
+        if (!_last_block_filtered) {
+          DCOUT(fmt::format("Add primIdx {} to variant {}", idx, variantName));
+          variantContent.primIndices.push_back(idx);
+        }
 
       } else {
         DCOUT("Enter ParsePrimProps.");
@@ -4785,6 +4506,17 @@ bool AsciiParser::ParseVariantSet(
   return true;
 }
 
+void AsciiParser::FilterProperties(const Path &prim_path,
+                                   std::map<std::string, Property> *props) {
+  for (auto it = props->begin(); it != props->end();) {
+    if (_property_filter_fun(prim_path, it->first)) {
+      ++it;
+    } else {
+      it = props->erase(it);
+    }
+  }
+}
+
 ///
 /// Parse block.
 ///
@@ -4940,6 +4672,17 @@ bool AsciiParser::ParseBlock(const Specifier spec, const int64_t primIdx,
     PushPrimPath(full_path);
   }
 
+  // Selective loading. The block of the filtered-out Prim is still parsed to
+  // advance the stream, but the Prim and its descendants are not constructed.
+  bool filtered = (_filtered_block_depth > 0);
+  if (!filtered && _prim_filter_fun) {
+    filtered = !_prim_filter_fun(Path(GetCurrentPrimPath(), ""), prim_type);
+  }
+
+  if (filtered) {
+    _filtered_block_depth++;
+  }
+
   // expect = '}'
   //        | def_block
   //        | prim_attr+
@@ -4963,8 +4706,8 @@ bool AsciiParser::ParseBlock(const Specifier spec, const int64_t primIdx,
       }
 
       DCOUT("Read stmt token");
-      Identifier tok;
-      if (!ReadBasicType(&tok)) {
+      lex::StringSpan tok;
+      if (!LookIdentifier(&tok)) {
         // maybe ';'?
 
         if (LookChar1(&c)) {
@@ -4978,6 +4721,8 @@ bool AsciiParser::ParseBlock(const Specifier spec, const int64_t primIdx,
       }
 
       if (tok == "variantSet") {
+        Consume(tok);
+
         if (!SkipWhitespace()) {
           return false;
         }
@@ -5011,10 +4756,6 @@ bool AsciiParser::ParseBlock(const Specifier spec, const int64_t primIdx,
         continue;
       }
 
-      if (!Rewind(tok.size())) {
-        return false;
-      }
-
       Specifier child_spec{Specifier::Invalid};
       if (tok == "def") {
         child_spec = Specifier::Def;
@@ -5049,6 +4790,18 @@ bool AsciiParser::ParseBlock(const Specifier spec, const int64_t primIdx,
     }
   }
 
+  if (filtered) {
+    DCOUT("Skip Prim by filter: " << GetCurrentPrimPath());
+    _filtered_block_depth--;
+    PopPrimPath();
+    _last_block_filtered = true;
+    return true;
+  }
+
+  if (_property_filter_fun) {
+    FilterProperties(Path(GetCurrentPrimPath(), ""), &props);
+  }
+
   std::string pTy = prim_type;
 
   if (_primspec_mode) {
@@ -5059,8 +4812,13 @@ bool AsciiParser::ParseBlock(const Specifier spec, const int64_t primIdx,
 
       // pass prim_type as is(empty = empty string)
       nonstd::expected<bool, std::string> ret =
-          _primspec_fun(fullpath, spec, prim_type, pname, primIdx,
-                        parentPrimIdx, props, in_metas, variantSetList);
+          _prim_record_fun
+              ? _prim_record_fun(std::string(), fullpath, spec, prim_type,
+                                 pname, primIdx, parentPrimIdx,
+                                 std::move(props), std::move(in_metas),
+                                 std::move(variantSetList))
+              : _primspec_fun(fullpath, spec, prim_type, pname, primIdx,
+                              parentPrimIdx, props, in_metas, variantSetList);
 
       if (!ret) {
         // construction failed.
@@ -5090,14 +4848,19 @@ bool AsciiParser::ParseBlock(const Specifier spec, const int64_t primIdx,
       }
     }
 
-    if (_prim_construct_fun_map.count(pTy)) {
-      auto construct_fun = _prim_construct_fun_map[pTy];
-
+    auto construct_it = _prim_construct_fun_map.find(pTy);
+    if (construct_it != _prim_construct_fun_map.end()) {
       Path fullpath(GetCurrentPrimPath(), "");
       Path pname(prim_name, "");
       nonstd::expected<bool, std::string> ret =
-          construct_fun(fullpath, spec, prim_type, pname, primIdx,
-                        parentPrimIdx, props, in_metas, variantSetList);
+          _prim_record_fun
+              ? _prim_record_fun(pTy, fullpath, spec, prim_type, pname,
+                                 primIdx, parentPrimIdx, std::move(props),
+                                 std::move(in_metas),
+                                 std::move(variantSetList))
+              : construct_it->second(fullpath, spec, prim_type, pname,
+                                     primIdx, parentPrimIdx, props, in_metas,
+                                     variantSetList);
 
       if (!ret) {
         // construction failed.
@@ -5114,9 +4877,362 @@ bool AsciiParser::ParseBlock(const Specifier spec, const int64_t primIdx,
 
   PopPrimPath();
 
+  _last_block_filtered = false;
+
+  return true;
+}
+
+bool AsciiParser::ParseRootBlocks(size_t *num_blocks) {
+  size_t n = 0;
+
+  // parse blocks
+  while (!Eof()) {
+    if (!SkipCommentAndWhitespaceAndNewline()) {
+      return false;
+    }
+
+    if (Eof()) {
+      // Whitespaces in the end of line.
+      break;
+    }
+
+    // Look ahead token
+    lex::StringSpan tok;
+    if (!LookIdentifier(&tok)) {
+      PUSH_ERROR_AND_RETURN("Identifier expected.\n");
+    }
+
+    Specifier spec{Specifier::Invalid};
+    if (tok == "def") {
+      spec = Specifier::Def;
+    } else if (tok == "over") {
+      spec = Specifier::Over;
+    } else if (tok == "class") {
+      spec = Specifier::Class;
+    } else {
+      PUSH_ERROR_AND_RETURN("Invalid specifier token '" + tok.str() + "'");
+    }
+
+    int64_t primIdx = _prim_idx_assign_fun(-1);
+    DCOUT("Enter parseDef. primIdx = " << primIdx
+                                       << ", parentPrimIdx = root(-1)");
+    bool block_ok = ParseBlock(spec, primIdx, /* parent */ -1, /* depth */ 0,
+                               /* in_variantStmt */ false);
+    if (!block_ok) {
+      PUSH_ERROR_AND_RETURN("Failed to parse `def` block.");
+    }
+
+    n++;
+  }
+
+  if (num_blocks) {
+    (*num_blocks) = n;
+  }
+
+  return true;
+}
+
+#if defined(TINYUSDZ_USDA_PARSER_USE_THREAD)
+
+namespace {
+
+// Input smaller than this is always parsed in single thread.
+constexpr size_t kParallelRootBlocksMinBytes = 1024 * 1024;
+
+// Split root blocks into (# of threads * this) groups to balance the load.
+constexpr size_t kRootBlockGroupsPerThread = 4;
+
+void RemapPrimIndices(const std::vector<int64_t> &indices,
+                      AsciiParser::VariantSetList *variantSets) {
+  for (auto &variantSet : *variantSets) {
+    for (auto &variant : variantSet.second) {
+      for (auto &idx : variant.second.primIndices) {
+        if ((idx >= 0) && (size_t(idx) < indices.size())) {
+          idx = indices[size_t(idx)];
+        }
+      }
+      RemapPrimIndices(indices, &variant.second.variantSets);
+    }
+  }
+}
+
+}  // namespace
+
+///
+/// Root(top-level) Prim blocks are independent each other, so they can be
+/// parsed in parallel. Each group of root blocks is parsed by its own
+/// AsciiParser on a worker thread, which records Prim callback invocations
+/// instead of calling them. The main thread replays the recorded callbacks in
+/// file order as soon as each group is parsed, so the callbacks see exactly
+/// the same sequence of invocations(and Prim indices) as single-threaded
+/// parsing.
+///
+bool AsciiParser::ParseRootBlocksInParallel() {
+  const char *begin = CurrPtr();
+  const char *end = EndPtr();
+
+  std::vector<const char *> block_ends;
+  if ((size_t(end - begin) < kParallelRootBlocksMinBytes) ||
+      !lex::ScanBlocks(begin, end, &block_ends) || (block_ends.size() < 2)) {
+    return ParseRootBlocks();
+  }
+
+  const size_t num_threads = size_t(GetNumThreads());
+
+  // Recorded invocation of Prim callback.
+  struct DeferredCallback {
+    enum class Type { AssignPrimIdx, ConstructPrim, PrimSpec };
+    Type type{Type::AssignPrimIdx};
+    std::string prim_type;  // key of `_prim_construct_fun_map`
+    Path full_path;
+    Specifier spec{Specifier::Invalid};
+    std::string primTypeName;
+    Path prim_name;
+    int64_t primIdx{-1};
+    int64_t parentPrimIdx{-1};
+    std::map<std::string, Property> properties;
+    PrimMetaMap metas;
+    VariantSetList variantSetList;
+  };
+
+  struct BlockGroup {
+    const char *begin{nullptr};
+    const char *end{nullptr};
+    size_t num_blocks{0};
+
+    bool ok{false};
+    Cursor cursor;  // relative to the beginning of the group.
+    std::vector<DeferredCallback> callbacks;
+    std::stack<ErrorDiagnostic> warns;
+  };
+
+  std::vector<BlockGroup> groups;
+  {
+    const size_t num_groups = (std::min)(
+        block_ends.size(), num_threads * kRootBlockGroupsPerThread);
+    const size_t group_bytes = size_t(end - begin) / num_groups;
+
+    BlockGroup group;
+    group.begin = begin;
+    for (size_t i = 0; i < block_ends.size(); i++) {
+      group.num_blocks++;
+      if ((size_t(block_ends[i] - group.begin) >= group_bytes) ||
+          (i == (block_ends.size() - 1))) {
+        // The last group also contains trailing whitespaces and comments.
+        group.end = (i == (block_ends.size() - 1)) ? end : block_ends[i];
+        groups.emplace_back(std::move(group));
+
+        group = BlockGroup();
+        group.begin = block_ends[i];
+      }
+    }
+  }
+
+  auto parse_group = [this](BlockGroup &group) {
+    std::vector<DeferredCallback> &callbacks = group.callbacks;
+
+    StreamReader sr(reinterpret_cast<const uint8_t *>(group.begin),
+                    uint64_t(group.end - group.begin), /* swap endian */ false);
+    AsciiParser parser(&sr);
+    parser._toplevel = _toplevel;
+    parser._sub_layered = _sub_layered;
+    parser._referenced = _referenced;
+    parser._payloaded = _payloaded;
+    parser._option = _option;
+    parser._option.num_threads = 1;
+    parser._version = _version;
+    parser._base_dir = _base_dir;
+    parser._stage_metas = _stage_metas;
+    parser._primspec_mode = _primspec_mode;
+    parser.PushPrimPath("/");
+
+    int64_t num_prims = 0;
+    parser._prim_idx_assign_fun = [&](const int64_t parentPrimIdx) {
+      DeferredCallback cb;
+      cb.type = DeferredCallback::Type::AssignPrimIdx;
+      cb.parentPrimIdx = parentPrimIdx;
+      callbacks.emplace_back(std::move(cb));
+      return num_prims++;
+    };
+
+    // Construct functions are not called in the worker. Only the set of
+    // registered Prim types is used to pick the callback in ParseBlock.
+    parser._prim_construct_fun_map = _prim_construct_fun_map;
+    parser._primspec_fun = _primspec_fun;
+    // Property filter(user callback) is applied in replay_group() on this
+    // thread, so that it is not called from multiple threads.
+    parser._prim_filter_fun = _prim_filter_fun;
+    parser._prim_record_fun =
+        [&callbacks](const std::string &prim_type, const Path &full_path,
+                     const Specifier spec, const std::string &primTypeName,
+                     const Path &prim_name, const int64_t primIdx,
+                     const int64_t parentPrimIdx,
+                     std::map<std::string, Property> &&properties,
+                     PrimMetaMap &&in_meta, VariantSetList &&in_variantSetList)
+        -> nonstd::expected<bool, std::string> {
+      DeferredCallback cb;
+      cb.type = prim_type.empty() ? DeferredCallback::Type::PrimSpec
+                                  : DeferredCallback::Type::ConstructPrim;
+      cb.prim_type = prim_type;
+      cb.full_path = full_path;
+      cb.spec = spec;
+      cb.primTypeName = primTypeName;
+      cb.prim_name = prim_name;
+      cb.primIdx = primIdx;
+      cb.parentPrimIdx = parentPrimIdx;
+      cb.properties = std::move(properties);
+      cb.metas = std::move(in_meta);
+      cb.variantSetList = std::move(in_variantSetList);
+      callbacks.emplace_back(std::move(cb));
+      return true;
+    };
+
+    size_t num_blocks{0};
+    group.ok = parser.ParseRootBlocks(&num_blocks) &&
+               (num_blocks == group.num_blocks);
+    group.cursor = parser._curr_cursor;
+    group.warns = std::move(parser.warn_stack);
+  };
+
+  // Replay the recorded callbacks of the group. Returns false when a
+  // callback failed.
+  auto replay_group = [this](BlockGroup &group) {
+    // Prim index in the group -> Prim index in the whole scene.
+    std::vector<int64_t> indices;
+    auto remap = [&indices](const int64_t idx) {
+      if ((idx >= 0) && (size_t(idx) < indices.size())) {
+        return indices[size_t(idx)];
+      }
+      return idx;
+    };
+
+    for (auto &cb : group.callbacks) {
+      if (cb.type == DeferredCallback::Type::AssignPrimIdx) {
+        indices.push_back(_prim_idx_assign_fun(remap(cb.parentPrimIdx)));
+        continue;
+      }
+
+      RemapPrimIndices(indices, &cb.variantSetList);
+
+      if (_property_filter_fun) {
+        FilterProperties(cb.full_path, &cb.properties);
+      }
+
+      nonstd::expected<bool, std::string> ret;
+      if (cb.type == DeferredCallback::Type::PrimSpec) {
+        ret = _primspec_fun(cb.full_path, cb.spec, cb.primTypeName,
+                            cb.prim_name, remap(cb.primIdx),
+                            remap(cb.parentPrimIdx), cb.properties, cb.metas,
+                            cb.variantSetList);
+        if (!ret) {
+          PUSH_ERROR_AND_RETURN(fmt::format(
+              "Constructing PrimSpec typeName `{}`, elementName `{}` failed: "
+              "{}",
+              cb.primTypeName, cb.prim_name.prim_part(), ret.error()));
+        }
+      } else {
+        ret = _prim_construct_fun_map.at(cb.prim_type)(
+            cb.full_path, cb.spec, cb.primTypeName, cb.prim_name,
+            remap(cb.primIdx), remap(cb.parentPrimIdx), cb.properties,
+            cb.metas, cb.variantSetList);
+        if (!ret) {
+          PUSH_ERROR_AND_RETURN("Constructing Prim type `" + cb.prim_type +
+                                "` failed: " + ret.error());
+        }
+      }
+    }
+
+    // Release parsed data.
+    group.callbacks.clear();
+    group.callbacks.shrink_to_fit();
+
+    // Append warnings in order, with the cursor location in the whole input.
+    std::vector<ErrorDiagnostic> warns;
+    while (!group.warns.empty()) {
+      warns.push_back(group.warns.top());
+      group.warns.pop();
+    }
+    for (auto it = warns.rbegin(); it != warns.rend(); ++it) {
+      ErrorDiagnostic diag = *it;
+      if (diag.cursor.row == 0) {
+        diag.cursor.col += _curr_cursor.col;
+      }
+      diag.cursor.row += _curr_cursor.row;
+      warn_stack.push(diag);
+    }
+
+    return true;
+  };
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<bool> done(groups.size(), false);
+  std::atomic<size_t> counter(0);
+  std::atomic<bool> cancel(false);
+
+  std::vector<std::thread> workers;
+  for (size_t t = 0; t < (std::min)(num_threads, groups.size()); t++) {
+    workers.emplace_back(std::thread([&]() {
+      size_t i = 0;
+      while (!cancel && ((i = counter++) < groups.size())) {
+        parse_group(groups[i]);
+
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          done[i] = true;
+        }
+        cv.notify_all();
+      }
+    }));
+  }
+
+  bool ret = true;
+  size_t i = 0;
+  for (; i < groups.size(); i++) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      cv.wait(lock, [&]() { return bool(done[i]); });
+    }
+
+    BlockGroup &group = groups[i];
+    if (!group.ok) {
+      // Parse the rest in single thread, which also reports errors.
+      break;
+    }
+
+    if (!replay_group(group)) {
+      ret = false;
+      break;
+    }
+
+    if (group.cursor.row > 0) {
+      _curr_cursor.row += group.cursor.row;
+      _curr_cursor.col = group.cursor.col;
+    } else {
+      _curr_cursor.col += group.cursor.col;
+    }
+  }
+
+  cancel = true;
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  if (!ret) {
+    PUSH_ERROR_AND_RETURN("Failed to parse `def` block.");
+  }
+
+  if (i < groups.size()) {
+    SetCurrPtr(groups[i].begin);
+    return ParseRootBlocks();
+  }
+
+  SetCurrPtr(end);
   return true;
 }
 
+#endif
+
 ///
 /// Parser entry point
 /// TODO: Refactor and use unified code path regardless of LoadState.
@@ -5168,52 +5284,13 @@ bool AsciiParser::Parse(const uint32_t load_states,
 
   PushPrimPath("/");
 
-  // parse blocks
-  while (!Eof()) {
-    if (!SkipCommentAndWhitespaceAndNewline()) {
-      return false;
-    }
-
-    if (Eof()) {
-      // Whitespaces in the end of line.
-      break;
-    }
-
-    // Look ahead token
-    auto curr_loc = _sr->tell();
-
-    Identifier tok;
-    if (!ReadBasicType(&tok)) {
-      PUSH_ERROR_AND_RETURN("Identifier expected.\n");
-    }
-
-    // Rewind
-    if (!SeekTo(curr_loc)) {
-      return false;
-    }
-
-    Specifier spec{Specifier::Invalid};
-    if (tok == "def") {
-      spec = Specifier::Def;
-    } else if (tok == "over") {
-      spec = Specifier::Over;
-    } else if (tok == "class") {
-      spec = Specifier::Class;
-    } else {
-      PUSH_ERROR_AND_RETURN("Invalid specifier token '" + tok + "'");
-    }
-
-    int64_t primIdx = _prim_idx_assign_fun(-1);
-    DCOUT("Enter parseDef. primIdx = " << primIdx
-                                       << ", parentPrimIdx = root(-1)");
-    bool block_ok = ParseBlock(spec, primIdx, /* parent */ -1, /* depth */ 0,
-                               /* in_variantStmt */ false);
-    if (!block_ok) {
-      PUSH_ERROR_AND_RETURN("Failed to parse `def` block.");
-    }
+#if defined(TINYUSDZ_USDA_PARSER_USE_THREAD)
+  if (GetNumThreads() > 1) {
+    return ParseRootBlocksInParallel();
   }
+#endif
 
-  return true;
+  return ParseRootBlocks();
 }
 
 bool ParseUnregistredValue(const std::string &_typeName, const std::string &str,
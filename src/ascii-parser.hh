@@ -12,11 +12,22 @@
 #include <stack>
 
 // #include "external/better-enums/enum.h"
+#include "ascii-lexer.hh"
 #include "composition.hh"
 #include "prim-types.hh"
 #include "stream-reader.hh"
 #include "tinyusdz.hh"
 
+// Use std::thread to parse large array literals and timeSamples in parallel.
+// # of threads is controlled by `AsciiParserOption::num_threads` at runtime.
+#if defined(__wasi__)
+// no threading
+#elif defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+// no threading
+#else
+#define TINYUSDZ_USDA_PARSER_USE_THREAD
+#endif
+
 //
 #ifdef __clang__
 #pragma clang diagnostic push
@@ -59,6 +70,10 @@ struct AsciiParserOption {
   bool allow_unknown_prim{true};
   bool allow_unknown_apiSchema{true};
   bool strict_allowedToken_check{false};
+
+  // # of threads to parse large array literals and timeSamples.
+  // -1 = use system's # of threads, 1 = no threading.
+  int num_threads{-1};
 };
 
 ///
@@ -294,6 +309,34 @@ class AsciiParser {
 
   void RegisterPrimSpecFunction(PrimSpecFunction fun) { _primspec_fun = fun; }
 
+  ///
+  /// Load-time Prim filter. Called after parsing the header of a Prim block.
+  /// Return false to skip the Prim: The block is parsed, but no construction
+  /// callback is called for the Prim and its descendants.
+  /// Called from worker threads when parsing root blocks in parallel.
+  ///
+  /// @param[in] full_path Absolute Prim Path(e.g. "/scope/gmesh0")
+  /// @param[in] primTypeName typeName of this Prim(empty when not authored)
+  ///
+  using PrimFilterFunction = std::function<bool(
+      const Path &full_path, const std::string &primTypeName)>;
+
+  void RegisterPrimFilterFunction(PrimFilterFunction fun) {
+    _prim_filter_fun = fun;
+  }
+
+  ///
+  /// Load-time Property filter. Return false to remove the Property from
+  /// `properties` passed to the construction callback.
+  /// Always called from the thread calling Parse().
+  ///
+  using PropertyFilterFunction = std::function<bool(
+      const Path &prim_path, const std::string &prop_name)>;
+
+  void RegisterPropertyFilterFunction(PropertyFilterFunction fun) {
+    _property_filter_fun = fun;
+  }
+
   ///
   /// Base filesystem directory to search asset files.
   ///
@@ -607,6 +650,14 @@ class AsciiParser {
   bool ParseTimeSamplesOfArray(const std::string &type_name,
                                value::TimeSamples *ts);
 
+  ///
+  /// @param[in] parallel Defer parsing array values and parse them in
+  /// parallel. Returns false(without reliable error message) when the input
+  /// is not suited for it.
+  ///
+  bool ParseTimeSamplesOfArray(const std::string &type_name,
+                               const bool parallel, value::TimeSamples *ts);
+
   ///
   /// `variants` in Prim meta.
   ///
@@ -681,7 +732,8 @@ class AsciiParser {
   template <typename T>
   bool MaybeNonFinite(T *out);
 
-  bool LexFloat(std::string *result);
+  // Lex floating point literal. `token` points to the input buffer(no copy).
+  bool LexFloat(const char **token, size_t *len);
 
   bool Expect(char expect_c);
 
@@ -690,6 +742,12 @@ class AsciiParser {
                               // quote chars.
   bool ReadPrimAttrIdentifier(std::string *token);
   bool ReadIdentifier(std::string *token);  // no '"'
+
+  // Look ahead an identifier without consuming it. `token` references the
+  // input buffer(no copy), so keywords can be tested without allocation.
+  bool LookIdentifier(lex::StringSpan *token);
+  // Consume the token returned by Look***().
+  void Consume(const lex::StringSpan &token);
   bool ReadPathIdentifier(
       std::string *path_identifier);  // '<' + identifier + '>'
 
@@ -746,12 +804,34 @@ class AsciiParser {
   // Look***() : Fetch chars but do not change input stream position.
   //
 
-  bool LookChar1(char *c);
+  bool LookChar1(char *c) {
+    if (_sr->eof()) {
+      return false;
+    }
+    (*c) = *CurrPtr();
+    return true;
+  }
   bool LookCharN(size_t n, std::vector<char> *nc);
 
-  bool Char1(char *c);
+  bool Char1(char *c) { return _sr->read1(c); }
   bool CharN(size_t n, std::vector<char> *nc);
 
+  //
+  // Direct access to the input buffer(for lexing with pointer scan).
+  // The input buffer is contiguous, so a token can be referenced without
+  // copying.
+  //
+  const char *CurrPtr() const {
+    return reinterpret_cast<const char *>(_sr->data() + _sr->tell());
+  }
+  const char *EndPtr() const {
+    return reinterpret_cast<const char *>(_sr->data() + _sr->size());
+  }
+  void SetCurrPtr(const char *p) {
+    _sr->seek_set(
+        uint64_t(p - reinterpret_cast<const char *>(_sr->data())));
+  }
+
   bool Rewind(size_t offset);
   uint64_t CurrLoc();
   bool SeekTo(uint64_t pos);  // Move to absolute `pos` bytes location
@@ -759,6 +839,22 @@ class AsciiParser {
   bool PushParserState();
   bool PopParserState(ParseState *state);
 
+  // # of threads for parallel parsing. Resolved from `_option.num_threads`.
+  int GetNumThreads() const;
+
+  ///
+  /// Parse root(top-level) Prim blocks until EOF.
+  ///
+  /// @param[out] num_blocks # of root blocks parsed(optional).
+  ///
+  bool ParseRootBlocks(size_t *num_blocks = nullptr);
+
+  ///
+  /// Parse root Prim blocks in parallel. Falls back to ParseRootBlocks() for
+  /// the input not suited for it(e.g. small input).
+  ///
+  bool ParseRootBlocksInParallel();
+
   //
   // Valid after ParseStageMetas() --------------
   //
@@ -779,6 +875,10 @@ class AsciiParser {
                   const int64_t parentPrimIdx, const uint32_t depth,
                   const bool in_variant = false);
 
+  // Remove Properties rejected by `_property_filter_fun` from `props`.
+  void FilterProperties(const Path &prim_path,
+                        std::map<std::string, Property> *props);
+
   // Parse `varianntSet` stmt
   bool ParseVariantSet(const int64_t primIdx, const int64_t parentPrimIdx,
                        const uint32_t depth,
@@ -874,6 +974,28 @@ class AsciiParser {
 
   // For composition. PrimSpec is typeless so single callback function only.
   PrimSpecFunction _primspec_fun{nullptr};
+
+  PrimFilterFunction _prim_filter_fun{nullptr};
+  PropertyFilterFunction _property_filter_fun{nullptr};
+
+  // Nest level of the Prim blocks skipped by `_prim_filter_fun`.
+  uint32_t _filtered_block_depth{0};
+
+  // True when the last parsed Prim block was skipped by `_prim_filter_fun`.
+  bool _last_block_filtered{false};
+
+  // Internal. Used by the worker parser of ParseRootBlocksInParallel to
+  // record Prim/PrimSpec construction. Parsed Prim contents are handed over
+  // as rvalues, so recording does not copy properties and metadatum.
+  // `prim_type` is the key of `_prim_construct_fun_map`, or empty for
+  // PrimSpec.
+  using PrimRecordFunction = std::function<nonstd::expected<bool, std::string>(
+      const std::string &prim_type, const Path &full_path,
+      const Specifier spec, const std::string &primTypeName,
+      const Path &prim_name, const int64_t primIdx,
+      const int64_t parentPrimIdx, std::map<std::string, Property> &&properties,
+      PrimMetaMap &&in_meta, VariantSetList &&in_variantSetList)>;
+  PrimRecordFunction _prim_record_fun{nullptr};
 };
 
 ///
@@ -33,8 +33,8 @@ class Asset {
 
   void shrink_to_fit() { buf_.shrink_to_fit(); }
 
-  void set_data(const std::vector<uint8_t> &&rhs) {
-    buf_ = rhs;
+  void set_data(std::vector<uint8_t> &&rhs) {
+    buf_ = std::move(rhs);
   }
 
   void set_name(const std::string &name) {
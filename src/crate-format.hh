@@ -316,17 +316,17 @@ inline void hash_combine(std::size_t &seed, const T &v) {
 
 struct PathHasher {
   size_t operator()(const Path &path) const {
-    size_t seed = std::hash<std::string>()(path.prim_part());
-    hash_combine(seed, std::hash<std::string>()(path.prop_part()));
-    //hash_combine(seed, std::hash<std::string>()(path.GetLocalPart()));
-    hash_combine(seed, std::hash<bool>()(path.is_valid()));
-
-    return seed;
+    // Precomputed from prim_part, prop_part and is_valid.
+    return path.hash();
   }
 };
 
 struct PathKeyEqual {
   bool operator()(const Path &lhs, const Path &rhs) const {
+    if (lhs.is_same_node(rhs)) {
+      return true;
+    }
+
     bool ret = lhs.prim_part() == rhs.prim_part();
     ret &= lhs.prop_part() == rhs.prop_part();
     //ret &= lhs.GetLocalPart() == rhs.GetLocalPart();
@@ -471,32 +471,82 @@ class CrateValue {
   }
 #endif
 
+  // Zero-copy array(see `CrateReaderConfig::zeroCopyArrays`)
+  void SetBorrowedArray(const value::BorrowedArray &v) {
+    value_ = nullptr;
+    borrowed_ = v;
+  }
+
+  bool is_borrowed_array() const { return borrowed_.valid(); }
+
+  const value::BorrowedArray &get_borrowed_array() const {
+    return borrowed_;
+  }
+
+  // Value decoded on the first access(see
+  // `CrateReaderConfig::deferredValueUnpack`)
+  void SetDeferredValue(const value::DeferredValue &v) {
+    value_ = nullptr;
+    deferred_ = v;
+  }
+
+  bool is_deferred_value() const { return deferred_.valid(); }
+
+  const value::DeferredValue &get_deferred_value() const {
+    return deferred_;
+  }
+
   // Type-safe way to get concrete value.
+  // Borrowed array is copied. Deferred value is decoded.
   template <class T>
   nonstd::optional<T> get_value() const {
+    if (borrowed_.valid()) {
+      return borrowed_.to_value().get_value<T>();
+    }
+    if (deferred_.valid()) {
+      return deferred_.get().get_value<T>();
+    }
     return value_.get_value<T>();
   }
 
-  // Return null when type-mismatch
+  // Return null when type-mismatch(or the value is borrowed array)
   template <class T>
   const T *as() const {
     return value_.as<T>();
   }
 
   std::string type_name() const {
+    if (borrowed_.valid()) {
+      return value::GetTypeName(borrowed_.type_id);
+    }
+    if (deferred_.valid()) {
+      return value::GetTypeName(deferred_.type_id);
+    }
     return value_.type_name();
   }
 
   uint32_t type_id() const {
+    if (borrowed_.valid()) {
+      return borrowed_.type_id;
+    }
+    if (deferred_.valid()) {
+      return deferred_.type_id;
+    }
     return value_.type_id();
   }
 
+  // NOTE: Empty for borrowed array. Deferred value is decoded.
   const value::Value &get_raw() const {
+    if (deferred_.valid()) {
+      return deferred_.get();
+    }
     return value_;
   }
 
  private:
   value::Value value_;
+  value::BorrowedArray borrowed_;
+  value::DeferredValue deferred_;
 };
 
 // In-memory storage for a single "spec" -- prim, property, etc.
@@ -21,6 +21,11 @@
 #include <thread>
 #endif
 
+#if defined(TINYUSDZ_CRATE_USE_THREAD)
+#include <atomic>
+#include <memory>
+#endif
+
 #include <unordered_set>
 #include <stack>
 
@@ -105,8 +110,64 @@ CrateReader::CrateReader(StreamReader *sr, const CrateReaderConfig &config) : _s
 
   //_impl = new Impl();
 
+  if (!_config.bufferOwner || !sr) {
+    // Deferred TimeSamples are decoded after Crate data is read, so they
+    // must keep the buffer alive.
+    _config.deferredTimeSamples = false;
+  }
+}
+
+struct CrateReader::DeferredDecodeContext {
+  std::shared_ptr<const void> bufferOwner;
+  const uint8_t *data{nullptr};
+  uint64_t size{0};
+  bool swap_endian{false};
+  uint8_t version[3] = {0, 0, 0};
+  CrateReaderConfig config;
+};
+
+std::shared_ptr<const CrateReader::DeferredDecodeContext>
+CrateReader::GetDeferredDecodeContext() {
+  if (!_deferred_ctx) {
+    auto ctx = std::make_shared<DeferredDecodeContext>();
+    ctx->bufferOwner = _config.bufferOwner;
+    ctx->data = _sr->data();
+    ctx->size = _sr->size();
+    ctx->swap_endian = _sr->swap_endian();
+    ctx->version[0] = _version[0];
+    ctx->version[1] = _version[1];
+    ctx->version[2] = _version[2];
+    ctx->config = _config;
+    ctx->config.numThreads = 1;
+    ctx->config.deferredTimeSamples = false;
+    ctx->config.deferredValueUnpack = false;
+    _deferred_ctx = ctx;
+  }
+
+  return _deferred_ctx;
+}
+
+namespace {
+
+// Values of these types are decoded without token/string/path tables(and
+// field/spec data), so they can be decoded from the buffer only.
+bool IsTableFreeValueRep(const crate::ValueRep &rep) {
+  const uint32_t ty = rep.GetType();
+  if ((ty >= uint32_t(crate::CrateDataTypeId::CRATE_DATA_TYPE_BOOL)) &&
+      (ty <= uint32_t(crate::CrateDataTypeId::CRATE_DATA_TYPE_DOUBLE))) {
+    return true;
+  }
+  if ((ty >= uint32_t(crate::CrateDataTypeId::CRATE_DATA_TYPE_MATRIX2D)) &&
+      (ty <= uint32_t(crate::CrateDataTypeId::CRATE_DATA_TYPE_VEC4I))) {
+    return true;
+  }
+  return (ty == uint32_t(crate::CrateDataTypeId::CRATE_DATA_TYPE_DOUBLE_VECTOR)) ||
+         (ty == uint32_t(crate::CrateDataTypeId::CRATE_DATA_TYPE_VALUE_BLOCK)) ||
+         (ty == uint32_t(crate::CrateDataTypeId::CRATE_DATA_TYPE_TIME_CODE));
 }
 
+}  // namespace
+
 CrateReader::~CrateReader() {
   //delete _impl;
   //_impl = nullptr;
@@ -139,6 +200,10 @@ nonstd::optional<crate::Field> CrateReader::GetField(crate::Index index) const {
 
 const nonstd::optional<value::token> CrateReader::GetToken(
     crate::Index token_index) const {
+  if (_parent) {
+    return _parent->GetToken(token_index);
+  }
+
   if (token_index.value < _tokens.size()) {
     return _tokens[token_index.value];
   } else {
@@ -150,6 +215,13 @@ const nonstd::optional<value::token> CrateReader::GetToken(
 const nonstd::optional<value::token> CrateReader::GetStringToken(
     crate::Index string_index) const {
 
+  if (_parent) {
+    // Report out-of-range error to this(worker) reader, not to `_parent`.
+    if (string_index.value < _parent->_string_indices.size()) {
+      return _parent->GetStringToken(string_index);
+    }
+  }
+
   if (string_index.value < _string_indices.size()) {
     crate::Index s_idx = _string_indices[string_index.value];
     return GetToken(s_idx);
@@ -161,6 +233,9 @@ const nonstd::optional<value::token> CrateReader::GetStringToken(
 }
 
 nonstd::optional<Path> CrateReader::GetPath(crate::Index index) const {
+  if (_parent) {
+    return _parent->GetPath(index);
+  }
 
   if (index.value < _paths.size()) {
     // ok
@@ -172,6 +247,10 @@ nonstd::optional<Path> CrateReader::GetPath(crate::Index index) const {
 }
 
 nonstd::optional<Path> CrateReader::GetElementPath(crate::Index index) const {
+  if (_parent) {
+    return _parent->GetElementPath(index);
+  }
+
   if (index.value < _elemPaths.size()) {
     // ok
   } else {
@@ -831,8 +910,6 @@ bool CrateReader::ReadTimeSamples(value::TimeSamples *d) {
             std::to_string(offset));
   }
 
-  // TODO(syoyo): Deduplicate times?
-
   crate::ValueRep times_rep{0};
   if (!ReadValueRep(&times_rep)) {
     PUSH_ERROR_AND_RETURN_TAG(kTag, "Failed to read ValueRep for TimeSample' `times` element.");
@@ -852,20 +929,25 @@ bool CrateReader::ReadTimeSamples(value::TimeSamples *d) {
   }
 #endif
 
-  crate::CrateValue times_value;
-  if (!UnpackValueRep(times_rep, &times_value)) {
-    PUSH_ERROR_AND_RETURN_TAG(kTag, "Failed to unpack value of TimeSample's `times` element.");
-  }
+  // `times` array is usually shared among TimeSamples in Crate data(same
+  // ValueRep), so decode it only once.
+  std::shared_ptr<const std::vector<double>> times = FindSharedTimes(times_rep);
+  if (!times) {
+    crate::CrateValue times_value;
+    if (!UnpackValueRep(times_rep, &times_value)) {
+      PUSH_ERROR_AND_RETURN_TAG(kTag, "Failed to unpack value of TimeSample's `times` element.");
+    }
 
-  // must be an array of double.
-  DCOUT("TimeSample times:" << times_value.type_name());
+    // must be an array of double.
+    DCOUT("TimeSample times:" << times_value.type_name());
 
-  std::vector<double> times;
-  if (auto pv = times_value.get_value<std::vector<double>>()) {
-    times = pv.value();
-    DCOUT("`times` = " << times);
-  } else {
-    PUSH_ERROR_AND_RETURN_TAG(kTag, fmt::format("`times` in TimeSamples must be type `double[]`, but got type `{}`", times_value.type_name()));
+    if (auto pv = times_value.get_value<std::vector<double>>()) {
+      DCOUT("`times` = " << pv.value());
+      times = AddSharedTimes(times_rep, std::make_shared<const std::vector<double>>(
+                                            std::move(pv.value())));
+    } else {
+      PUSH_ERROR_AND_RETURN_TAG(kTag, fmt::format("`times` in TimeSamples must be type `double[]`, but got type `{}`", times_value.type_name()));
+    }
   }
 
   //
@@ -900,18 +982,49 @@ bool CrateReader::ReadTimeSamples(value::TimeSamples *d) {
 
   DCOUT("Number of values = " << num_values);
 
-  if (times.size() != num_values) {
+  if (times->size() != num_values) {
     PUSH_ERROR_AND_RETURN_TAG(kTag, "# of `times` elements and # of values in Crate differs.");
   }
 
+  auto reps = std::make_shared<std::vector<crate::ValueRep>>();
+  reps->resize(static_cast<size_t>(num_values));
+  bool deferred = _config.deferredTimeSamples;
   for (size_t i = 0; i < num_values; i++) {
-
-    crate::ValueRep rep;
-    if (!ReadValueRep(&rep)) {
+    if (!ReadValueRep(&(*reps)[i])) {
       PUSH_ERROR_AND_RETURN_TAG(kTag, "Failed to read ValueRep for TimeSample' value element.");
     }
+    deferred &= IsTableFreeValueRep((*reps)[i]);
+  }
 
-    auto next_vrep_loc = _sr->tell();
+  if (deferred) {
+    // Decoders keep Crate data and ValueReps only(not this CrateReader).
+    std::shared_ptr<const DeferredDecodeContext> ctx =
+        GetDeferredDecodeContext();
+    d->set_deferred_samples(
+        times,
+        [ctx, reps](size_t idx, value::Value *dst, std::string *err) {
+          if (idx >= reps->size()) {
+            if (err) {
+              (*err) += "TimeSamples value index out of range.\n";
+            }
+            return false;
+          }
+          return UnpackDeferredValue(*ctx, (*reps)[idx], dst, err);
+        },
+        _config.maxCachedTimeSamples);
+
+    _sr->seek_set(values_offset);
+    if (!_sr->seek_from_current(int64_t(sizeof(uint64_t) * num_values))) {
+      PUSH_ERROR_AND_RETURN_TAG(kTag, "Failed to seek over TimeSamples's values.");
+    }
+
+    return true;
+  }
+
+  std::vector<value::Value> values(static_cast<size_t>(num_values));
+  for (size_t i = 0; i < num_values; i++) {
+
+    const crate::ValueRep &rep = (*reps)[i];
 
     ///
     /// Type check of the content of `value` will be done at ReconstructPrim() in usdc-reader.cc.
@@ -921,13 +1034,12 @@ bool CrateReader::ReadTimeSamples(value::TimeSamples *d) {
       PUSH_ERROR_AND_RETURN_TAG(kTag, "Failed to unpack value of TimeSample's value element.");
     }
 
-    d->add_sample(times[i], value.get_raw());
-
-    // UnpackValueRep() will change StreamReader's read position.
-    // Revert to next ValueRep location here.
-    _sr->seek_set(next_vrep_loc);
+    values[i] = value.get_raw();
   }
 
+  // Samples share `times` with other TimeSamples.
+  d->set_samples(times, std::move(values));
+
   // Move to next location.
   // sizeof(uint64) = sizeof(ValueRep)
   _sr->seek_set(values_offset);
@@ -939,6 +1051,36 @@ bool CrateReader::ReadTimeSamples(value::TimeSamples *d) {
   return true;
 }
 
+std::shared_ptr<const std::vector<double>> CrateReader::FindSharedTimes(
+    const crate::ValueRep &rep) const {
+  const CrateReader *root = _parent ? _parent : this;
+
+#if defined(TINYUSDZ_CRATE_USE_THREAD)
+  std::lock_guard<std::mutex> lock(root->_shared_times_mutex);
+#endif
+
+  auto it = root->_shared_times.find(rep.GetData());
+  if (it != root->_shared_times.end()) {
+    return it->second;
+  }
+
+  return nullptr;
+}
+
+std::shared_ptr<const std::vector<double>> CrateReader::AddSharedTimes(
+    const crate::ValueRep &rep,
+    std::shared_ptr<const std::vector<double>> times) const {
+  const CrateReader *root = _parent ? _parent : this;
+
+#if defined(TINYUSDZ_CRATE_USE_THREAD)
+  std::lock_guard<std::mutex> lock(root->_shared_times_mutex);
+#endif
+
+  // Another worker may have added the same `times` already.
+  return root->_shared_times.emplace(rep.GetData(), std::move(times))
+      .first->second;
+}
+
 bool CrateReader::ReadStringArray(std::vector<std::string> *d) {
   // array data is not compressed
   auto ReadFn = [this](std::vector<std::string> &result) -> bool {
@@ -5180,6 +5322,243 @@ bool CrateReader::BuildNodeHierarchy(
 }
 #endif
 
+#if defined(TINYUSDZ_CRATE_USE_THREAD)
+bool CrateReader::BuildDecompressedPathsAndNodesParallel(
+    std::vector<uint32_t> const &pathIndexes,
+    std::vector<int32_t> const &elementTokenIndexes,
+    std::vector<int32_t> const &jumps,
+    std::vector<bool> &visit_table /* inout */) {
+
+  const size_t n = pathIndexes.size();
+  if ((elementTokenIndexes.size() != n) || (jumps.size() != n)) {
+    PUSH_ERROR_AND_RETURN_TAG(kTag, "Size mismatch of compressed path arrays.");
+  }
+
+  if (n == 0) {
+    return true;
+  }
+
+  //
+  // 1. Traverse the PathIndex tree(integer arrays only) in serial and record
+  // the parent and depth of each entry. Index range, token index and
+  // circular referencing are validated here.
+  //
+  std::vector<int64_t> parents(n, -2); // -1 = root, -2 = not visited
+  std::vector<uint32_t> depths(n, 0);
+  uint32_t maxDepth = 0;
+
+  struct Item {
+    size_t index;
+    int64_t parent;
+    uint32_t depth;
+  };
+
+  std::stack<Item> siblingStack;
+  siblingStack.push({0, -1, 0});
+
+  size_t nIter = 0;
+  const size_t maxIter = _config.maxPathIndicesDecodeIteration;
+
+  while (!siblingStack.empty()) {
+    Item item = siblingStack.top();
+    siblingStack.pop();
+
+    size_t thisIndex = item.index;
+    int64_t parent = item.parent;
+    uint32_t depth = item.depth;
+
+    while (true) {
+      if (nIter >= maxIter) {
+        PUSH_ERROR_AND_RETURN("PathIndex tree Too deep.");
+      }
+      nIter++;
+
+      if (thisIndex >= n) {
+        PUSH_ERROR_AND_RETURN_TAG(kTag, "Index is out-of-range");
+      }
+
+      size_t pathIdx = pathIndexes[thisIndex];
+      if ((pathIdx >= _paths.size()) || (pathIdx >= _elemPaths.size()) ||
+          (pathIdx >= _nodes.size()) || (pathIdx >= visit_table.size())) {
+        PUSH_ERROR_AND_RETURN_TAG(kTag, "PathIndex out-of-range.");
+      }
+
+      if (visit_table[pathIdx] || (parents[thisIndex] != -2)) {
+        PUSH_ERROR_AND_RETURN_TAG(kTag, fmt::format("Circular referencing of Path index {}(thisIndex {}) detected. Invalid Paths data.", pathIdx, thisIndex));
+      }
+
+      if (parent != -1) {
+        int32_t _tokenIndex = elementTokenIndexes[thisIndex];
+        bool isPrimPropertyPath = _tokenIndex < 0;
+        uint32_t tokenIndex = uint32_t(isPrimPropertyPath ? -_tokenIndex : _tokenIndex);
+        if (tokenIndex >= _tokens.size()) {
+          PUSH_ERROR_AND_RETURN("Invalid tokenIndex in BuildDecompressedPathsAndNodesParallel.");
+        }
+      }
+
+      visit_table[pathIdx] = true;
+      parents[thisIndex] = parent;
+      depths[thisIndex] = depth;
+      maxDepth = (std::max)(maxDepth, depth);
+
+      bool hasChild = (jumps[thisIndex] > 0) || (jumps[thisIndex] == -1);
+      bool hasSibling = (jumps[thisIndex] >= 0);
+
+      if (hasChild && hasSibling) {
+        size_t siblingIndex = thisIndex + size_t(jumps[thisIndex]);
+        if (siblingIndex >= n) {
+          PUSH_ERROR_AND_RETURN("jump index corrupted.");
+        }
+        siblingStack.push({siblingIndex, parent, depth});
+      }
+
+      if (hasChild) {
+        parent = int64_t(thisIndex);
+        depth++;
+        thisIndex++;
+      } else if (hasSibling) {
+        thisIndex++;
+      } else {
+        break;
+      }
+    }
+  }
+
+  //
+  // 2. Decode entries whose depth is less than or equal to `splitDepth` in
+  // serial, then decode each subtree rooted at `splitDepth` in parallel.
+  // Entries are stored in pre-order, so a subtree occupies a contiguous range
+  // and the parent always appears before its children.
+  // Children are added to the parent Node in ascending order of entries, so
+  // the result does not depend on the number of threads.
+  //
+  const size_t numThreads = size_t((std::max)(1, _config.numThreads));
+
+  std::vector<size_t> depthCounts(size_t(maxDepth) + 1, 0);
+  for (size_t i = 0; i < n; i++) {
+    if (parents[i] == -2) {
+      // Not reachable from the root.
+      PUSH_ERROR_AND_RETURN_TAG(kTag, fmt::format("Path entry {} is not reachable from the root. Invalid Paths data.", i));
+    }
+    depthCounts[depths[i]]++;
+  }
+
+  uint32_t splitDepth = maxDepth;
+  for (uint32_t d = 0; d <= maxDepth; d++) {
+    // Have enough tasks for load balancing.
+    if (depthCounts[d] >= numThreads * 4) {
+      splitDepth = d;
+      break;
+    }
+  }
+
+  // Decode an entry. Its parent entry must be decoded in advance.
+  auto DecodeEntry = [&](size_t thisIndex, std::string *err) -> bool {
+    size_t pathIdx = pathIndexes[thisIndex];
+    int64_t parent = parents[thisIndex];
+
+    if (parent == -1) {
+      // root node.
+      _paths[pathIdx] = Path::make_root_path();
+      _nodes[pathIdx] = Node(parent, _paths[pathIdx]);
+      return true;
+    }
+
+    size_t parentPathIdx = pathIndexes[size_t(parent)];
+
+    int32_t _tokenIndex = elementTokenIndexes[thisIndex];
+    bool isPrimPropertyPath = _tokenIndex < 0;
+    uint32_t tokenIndex = uint32_t(isPrimPropertyPath ? -_tokenIndex : _tokenIndex);
+    const auto &elemToken = _tokens[size_t(tokenIndex)];
+
+    _paths[pathIdx] =
+        isPrimPropertyPath ? _paths[parentPathIdx].AppendProperty(elemToken.str())
+                           : _paths[parentPathIdx].AppendElement(elemToken.str());
+    _elemPaths[pathIdx] = Path(elemToken.str(), "");
+
+    _nodes[pathIdx] = Node(parent, _paths[pathIdx]);
+
+    if (!_nodes[parentPathIdx].AddChildren(_elemPaths[pathIdx].full_path_name(),
+                                           pathIdx)) {
+      (*err) += fmt::format("Invalid path index. Duplicated child `{}` in Path entry {}.\n", _elemPaths[pathIdx].full_path_name(), thisIndex);
+      return false;
+    }
+
+    return true;
+  };
+
+  std::vector<size_t> subtreeRoots;
+  {
+    std::string err;
+    for (size_t i = 0; i < n; i++) {
+      if (depths[i] <= splitDepth) {
+        if (!DecodeEntry(i, &err)) {
+          PUSH_ERROR_AND_RETURN_TAG(kTag, err);
+        }
+
+        if (depths[i] == splitDepth) {
+          subtreeRoots.push_back(i);
+        }
+      }
+    }
+  }
+
+  std::vector<std::string> errs(subtreeRoots.size());
+  std::atomic<size_t> counter(0);
+  std::atomic<bool> failed(false);
+
+  auto DecodeSubtrees = [&]() {
+    size_t k = 0;
+    while ((k = counter++) < subtreeRoots.size()) {
+      if (failed.load()) {
+        break;
+      }
+
+      const size_t rootIndex = subtreeRoots[k];
+      for (size_t i = rootIndex + 1; (i < n) && (depths[i] > splitDepth); i++) {
+        if (parents[i] < int64_t(rootIndex)) {
+          // Parent entry is out of this subtree.
+          errs[k] += fmt::format("Path entry {} is not in the subtree of entry {}. Invalid Paths data.\n", i, rootIndex);
+          failed = true;
+          break;
+        }
+
+        if (!DecodeEntry(i, &errs[k])) {
+          failed = true;
+          break;
+        }
+      }
+    }
+  };
+
+  size_t nthreads = (std::min)(numThreads, subtreeRoots.size());
+  if (nthreads > 1) {
+    std::vector<std::thread> threads;
+    threads.reserve(nthreads);
+    for (size_t t = 0; t < nthreads; t++) {
+      threads.emplace_back(DecodeSubtrees);
+    }
+
+    for (auto &th : threads) {
+      th.join();
+    }
+  } else {
+    DecodeSubtrees();
+  }
+
+  if (failed) {
+    for (size_t k = 0; k < errs.size(); k++) {
+      if (!errs[k].empty()) {
+        PUSH_ERROR(errs[k]);
+      }
+    }
+    return false;
+  }
+
+  return true;
+}
+#endif
+
 bool CrateReader::ReadCompressedPaths(const uint64_t maxNumPaths) {
   std::vector<uint32_t> pathIndexes;
   std::vector<int32_t> elementTokenIndexes;
@@ -5354,6 +5733,29 @@ bool CrateReader::ReadCompressedPaths(const uint64_t maxNumPaths) {
     visit_table[i] = false;
   }
 
+#if defined(TINYUSDZ_CRATE_USE_THREAD)
+  if ((_config.numThreads > 1) &&
+      (pathIndexes.size() > _config.minPathsForParallelDecode)) {
+    if (!BuildDecompressedPathsAndNodesParallel(pathIndexes, elementTokenIndexes,
+                                                jumps, visit_table)) {
+      return false;
+    }
+
+    size_t sumDecodedPaths = 0;
+    for (size_t i = 0; i < visit_table.size(); i++) {
+      if (visit_table[i]) {
+        sumDecodedPaths++;
+      }
+    }
+    if (sumDecodedPaths != numEncodedPaths) {
+      PUSH_ERROR_AND_RETURN(fmt::format("Decoded {} paths but numEncodedPaths in Crate is {}. Possible corruption of Crate data.",
+        sumDecodedPaths, numEncodedPaths));
+    }
+
+    return true;
+  }
+#endif
+
   // Now build the paths.
 #if defined(TINYUSDZ_CRATE_USE_FOR_BASED_PATH_INDEX_DECODER)
   BuildDecompressedPathsArg arg;
@@ -5446,6 +5848,25 @@ bool CrateReader::ReadSection(crate::Section *s) {
   return true;
 }
 
+bool CrateReader::DecompressLZ4FromStream(size_t compressedSize, char *dst,
+                                          size_t uncompressedSize) {
+  // StreamReader is backed by memory, so LZ4 data is decoded in place.
+  uint64_t loc = _sr->tell();
+  if ((compressedSize > _sr->size()) ||
+      (loc > (_sr->size() - compressedSize))) {
+    PUSH_ERROR_AND_RETURN_TAG(kTag, "LZ4 compressed data exceeds USDC data.");
+  }
+
+  const char *src = reinterpret_cast<const char *>(_sr->data() + loc);
+  if (uncompressedSize != LZ4Compression::DecompressFromBuffer(
+                              src, dst, compressedSize, uncompressedSize,
+                              &_err)) {
+    return false;
+  }
+
+  return _sr->seek_set(loc + compressedSize);
+}
+
 bool CrateReader::ReadTokens() {
   if ((_tokens_index < 0) || (_tokens_index >= int64_t(_toc.sections.size()))) {
     PUSH_ERROR_AND_RETURN_TAG(kTag, "Invalid index for `TOKENS` section.");
@@ -5527,33 +5948,13 @@ bool CrateReader::ReadTokens() {
     PUSH_ERROR_AND_RETURN_TAG(kTag, "Compressed data size exceeds `TOKENS` section size.");
   }
 
-  // To combat with heap-buffer flow in lz4 cuased by corrupted lz4 compressed data,
-  // We allocate same size of uncompressedSize(or larger one),
-  // And further, extra 128 bytes for safety(LZ4_FAST_DEC_LOOP does 16 bytes stride memcpy)
-
-  uint64_t bufSize = (std::max)(compressedSize, uncompressedSize);
-  CHECK_MEMORY_USAGE(bufSize+128);
   CHECK_MEMORY_USAGE(uncompressedSize);
 
-
-  // dst
+  // dst. Compressed data is decoded from Crate data directly(no copy).
   std::vector<char> chars(static_cast<size_t>(uncompressedSize));
-  memset(chars.data(), 0, chars.size());
 
-  std::vector<char> compressed(static_cast<size_t>(bufSize + 128));
-  memset(compressed.data(), 0, compressed.size());
-
-  if (compressedSize !=
-      _sr->read(size_t(compressedSize), size_t(compressedSize),
-                reinterpret_cast<uint8_t *>(compressed.data()))) {
-    PUSH_ERROR_AND_RETURN_TAG(kTag, "Failed to read compressed data at `TOKENS` section.");
-    return false;
-  }
-
-  if (uncompressedSize !=
-      LZ4Compression::DecompressFromBuffer(compressed.data(), chars.data(),
-                                           size_t(compressedSize),
-                                           size_t(uncompressedSize), &_err)) {
+  if (!DecompressLZ4FromStream(size_t(compressedSize), chars.data(),
+                               size_t(uncompressedSize))) {
     PUSH_ERROR_AND_RETURN_TAG(kTag, "Failed to decompress data of Tokens.");
   }
 
@@ -5563,6 +5964,8 @@ bool CrateReader::ReadTokens() {
   const char *pcurr = ps;
   size_t nbytes_remain = size_t(chars.size());
 
+  _tokens.reserve(size_t(num_tokens));
+
   auto my_strnlen = [](const char *s, const size_t max_length) -> size_t {
     if (!s) return 0;
 
@@ -5590,13 +5993,8 @@ bool CrateReader::ReadTokens() {
       return false;
     }
 
-    std::string str;
-    if (len > 0) {
-      str = std::string(pcurr, len);
-    } else {
-      // Empty string allowed
-      str = std::string();
-    }
+    // Intern the token directly from the string buffer(empty string allowed).
+    value::token tok(pcurr, len);
 
     pcurr += len + 1;  // +1 = '\0'
     nbytes_remain = size_t(pe - pcurr);
@@ -5605,8 +6003,6 @@ bool CrateReader::ReadTokens() {
       return false;
     }
 
-    value::token tok(str);
-
     DCOUT("token[" << i << "] = " << tok);
     _tokens.push_back(tok);
 
@@ -5742,17 +6138,6 @@ bool CrateReader::ReadFields() {
       PUSH_ERROR_AND_RETURN_TAG(kTag, "Compressed Value reps size exceeds USDC data.");
     }
 
-    CHECK_MEMORY_USAGE(size_t(reps_size));
-
-    // TODO: Decompress from _sr directly.
-    std::vector<char> comp_buffer(static_cast<size_t>(reps_size));
-
-    if (reps_size !=
-        _sr->read(size_t(reps_size), size_t(reps_size),
-                  reinterpret_cast<uint8_t *>(comp_buffer.data()))) {
-      PUSH_ERROR_AND_RETURN_TAG(kTag, "Failed to read reps data at `FIELDS` section.");
-    }
-
     // reps datasize = LZ4 compressed. uncompressed size = num_fields * 8 bytes
     size_t uncompressed_size = size_t(num_fields) * sizeof(uint64_t);
     CHECK_MEMORY_USAGE(uncompressed_size);
@@ -5760,11 +6145,9 @@ bool CrateReader::ReadFields() {
     std::vector<uint64_t> reps_data;
     reps_data.resize(static_cast<size_t>(num_fields));
 
-
-    if (uncompressed_size != LZ4Compression::DecompressFromBuffer(
-                                 comp_buffer.data(),
+    if (!DecompressLZ4FromStream(size_t(reps_size),
                                  reinterpret_cast<char *>(reps_data.data()),
-                                 size_t(reps_size), uncompressed_size, &_err)) {
+                                 uncompressed_size)) {
       PUSH_ERROR_AND_RETURN_TAG(kTag, "Failed to read Fields ValueRep data.");
     }
 
@@ -5773,9 +6156,11 @@ bool CrateReader::ReadFields() {
     }
 
     REDUCE_MEMORY_USAGE(uncompressed_size);
-    REDUCE_MEMORY_USAGE(size_t(reps_size)); // comp_buffer
   }
 
+#ifdef TINYUSDZ_LOCAL_DEBUG_PRINT
+  // NOTE: `TOKENS` may not be available yet when sections are read in
+  // parallel.
   DCOUT("num_fields = " << num_fields);
   for (size_t i = 0; i < num_fields; i++) {
     if (auto tokv = GetToken(_fields[i].token_index)) {
@@ -5783,6 +6168,7 @@ bool CrateReader::ReadFields() {
                      << ", value = " << _fields[i].value_rep.GetStringRepr());
     }
   }
+#endif
 
   return true;
 }
@@ -5892,7 +6278,7 @@ bool CrateReader::ReadFieldSets() {
   return true;
 }
 
-bool CrateReader::BuildLiveFieldSets() {
+bool CrateReader::BuildLiveFieldSetsSerial() {
   for (auto fsBegin = _fieldset_indices.begin(),
             fsEnd = std::find(fsBegin, _fieldset_indices.end(), crate::Index());
        fsBegin != _fieldset_indices.end();
@@ -5903,7 +6289,6 @@ bool CrateReader::BuildLiveFieldSets() {
 
     pairs.resize(size_t(fsEnd - fsBegin));
     DCOUT("range size = " << (fsEnd - fsBegin));
-    // TODO(syoyo): Parallelize.
     for (size_t i = 0; fsBegin != fsEnd; ++fsBegin, ++i) {
       if (fsBegin->value < _fields.size()) {
         // ok
@@ -5917,7 +6302,8 @@ bool CrateReader::BuildLiveFieldSets() {
       if (auto tokv = GetToken(field.token_index)) {
         pairs[i].first = tokv.value().str();
 
-        if (!UnpackValueRep(field.value_rep, &pairs[i].second)) {
+        if (!UnpackFieldValue(pairs[i].first, field.value_rep,
+                              &pairs[i].second)) {
           PUSH_ERROR("BuildLiveFieldSets: Failed to unpack ValueRep : "
                      << field.value_rep.GetStringRepr());
           return false;
@@ -5928,6 +6314,173 @@ bool CrateReader::BuildLiveFieldSets() {
     }
   }
 
+  return true;
+}
+
+#if defined(TINYUSDZ_CRATE_USE_THREAD)
+bool CrateReader::BuildLiveFieldSetsParallel() {
+  // Unpacking a ValueRep moves the read cursor of StreamReader and updates
+  // error/memory counters, so each worker thread uses its own CrateReader
+  // (with its own StreamReader over the same buffer) which refers to the
+  // token/string/path tables of this reader.
+  //
+  // Fieldset entries(and the name of each field) are setup in serial at first,
+  // then ValueReps are unpacked into preallocated slots in parallel, so the
+  // result is identical to BuildLiveFieldSetsSerial().
+
+  struct UnpackItem {
+    const std::string *name;
+    const crate::ValueRep *rep;
+    crate::CrateValue *dst;
+  };
+
+  std::vector<UnpackItem> items;
+  items.reserve(_fieldset_indices.size());
+
+  for (auto fsBegin = _fieldset_indices.begin(),
+            fsEnd = std::find(fsBegin, _fieldset_indices.end(), crate::Index());
+       fsBegin != _fieldset_indices.end();
+       fsBegin = fsEnd + 1, fsEnd = std::find(fsBegin, _fieldset_indices.end(),
+                                              crate::Index())) {
+    // NOTE: std::map does not invalidate references to its elements on insert.
+    auto &pairs = _live_fieldsets[crate::Index(
+        uint32_t(fsBegin - _fieldset_indices.begin()))];
+
+    pairs.resize(size_t(fsEnd - fsBegin));
+    for (size_t i = 0; fsBegin != fsEnd; ++fsBegin, ++i) {
+      if (fsBegin->value < _fields.size()) {
+        // ok
+      } else {
+        PUSH_ERROR("Invalid live field set data.");
+        return false;
+      }
+
+      auto const &field = _fields[fsBegin->value];
+      if (auto tokv = GetToken(field.token_index)) {
+        pairs[i].first = tokv.value().str();
+        items.push_back({&pairs[i].first, &field.value_rep, &pairs[i].second});
+      } else {
+        PUSH_ERROR("Invalid token index.");
+      }
+    }
+  }
+
+  size_t num_threads = (std::min)(size_t(_config.numThreads), items.size());
+  if (num_threads == 0) {
+    return true;
+  }
+
+  std::vector<std::unique_ptr<CrateReader>> workers(num_threads);
+  std::vector<std::unique_ptr<StreamReader>> worker_srs(num_threads);
+  for (size_t t = 0; t < num_threads; t++) {
+    worker_srs[t].reset(
+        new StreamReader(_sr->data(), _sr->size(), _sr->swap_endian()));
+    workers[t].reset(new CrateReader(worker_srs[t].get(), _config));
+    workers[t]->_parent = this;
+    workers[t]->_memoryUsage = _memoryUsage;
+    for (size_t v = 0; v < 3; v++) {
+      workers[t]->_version[v] = _version[v];
+    }
+  }
+
+  std::atomic<size_t> counter(0);
+  std::atomic<bool> failed(false);
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+
+  for (size_t t = 0; t < num_threads; t++) {
+    threads.emplace_back([&, t]() {
+      CrateReader *worker = workers[t].get();
+      size_t i = 0;
+      while ((i = counter++) < items.size()) {
+        if (failed.load()) {
+          break;
+        }
+
+        if (!worker->UnpackFieldValue(*items[i].name, *items[i].rep,
+                                      items[i].dst)) {
+          worker->PushError("BuildLiveFieldSets: Failed to unpack ValueRep : " +
+                            items[i].rep->GetStringRepr() + "\n");
+          failed = true;
+          break;
+        }
+      }
+    });
+  }
+
+  for (auto &th : threads) {
+    th.join();
+  }
+
+  // Merge per-thread results in thread order.
+  uint64_t base_usage = _memoryUsage;
+  for (size_t t = 0; t < num_threads; t++) {
+    _warn += workers[t]->_warn;
+    _err += workers[t]->_err;
+    if (workers[t]->_memoryUsage > base_usage) {
+      _memoryUsage += workers[t]->_memoryUsage - base_usage;
+    }
+  }
+
+  if (failed) {
+    return false;
+  }
+
+  if (_memoryUsage > _config.maxMemoryBudget) {
+    PUSH_ERROR_AND_RETURN_TAG(kTag, "Reached to max memory budget.");
+  }
+
+  return true;
+}
+#endif
+
+bool CrateReader::BuildLiveFieldSets() {
+  if (_config.deferredValueUnpack) {
+    // Only record the range of each fieldset. Values are unpacked in
+    // UnpackLiveFieldSet().
+    for (auto fsBegin = _fieldset_indices.begin(),
+              fsEnd = std::find(fsBegin, _fieldset_indices.end(), crate::Index());
+         fsBegin != _fieldset_indices.end();
+         fsBegin = fsEnd + 1, fsEnd = std::find(fsBegin, _fieldset_indices.end(),
+                                                crate::Index())) {
+      for (auto it = fsBegin; it != fsEnd; ++it) {
+        if (it->value >= _fields.size()) {
+          PUSH_ERROR("Invalid live field set data.");
+          return false;
+        }
+      }
+
+      size_t begin = size_t(fsBegin - _fieldset_indices.begin());
+      size_t end = size_t(fsEnd - _fieldset_indices.begin());
+      _fieldset_ranges[uint32_t(begin)] = std::make_pair(begin, end);
+
+      if (fsEnd == _fieldset_indices.end()) {
+        break;
+      }
+    }
+
+    DCOUT("# of deferred fieldsets = " << _fieldset_ranges.size());
+    return true;
+  }
+
+#if defined(TINYUSDZ_CRATE_USE_THREAD)
+  if ((_config.numThreads > 1) &&
+      (_fieldset_indices.size() > _config.minFieldsForParallelUnpack)) {
+    if (!BuildLiveFieldSetsParallel()) {
+      return false;
+    }
+  } else {
+    if (!BuildLiveFieldSetsSerial()) {
+      return false;
+    }
+  }
+#else
+  if (!BuildLiveFieldSetsSerial()) {
+    return false;
+  }
+#endif
+
   DCOUT("# of live fieldsets = " << _live_fieldsets.size());
 
 #ifdef TINYUSDZ_LOCAL_DEBUG_PRINT
@@ -5947,6 +6500,334 @@ bool CrateReader::BuildLiveFieldSets() {
   return true;
 }
 
+bool CrateReader::HasLiveFieldSet(crate::Index fieldset_index) const {
+  if (_config.deferredValueUnpack) {
+    return _fieldset_ranges.count(fieldset_index.value);
+  }
+
+  return _live_fieldsets.count(fieldset_index);
+}
+
+bool CrateReader::UnpackLiveFieldSet(crate::Index fieldset_index,
+                                     FieldValuePairVector *fvs) {
+  if (!fvs) {
+    return false;
+  }
+
+  if (!_config.deferredValueUnpack) {
+    // Already unpacked.
+    auto it = _live_fieldsets.find(fieldset_index);
+    if (it == _live_fieldsets.end()) {
+      PUSH_ERROR_AND_RETURN_TAG(kTag, "FieldSet id: " + std::to_string(fieldset_index.value) + " not found.");
+    }
+    (*fvs) = it->second;
+    return true;
+  }
+
+  auto it = _fieldset_ranges.find(fieldset_index.value);
+  if (it == _fieldset_ranges.end()) {
+    PUSH_ERROR_AND_RETURN_TAG(kTag, "FieldSet id: " + std::to_string(fieldset_index.value) + " not found.");
+  }
+
+  size_t begin = it->second.first;
+  size_t end = it->second.second;
+
+  fvs->clear();
+  fvs->resize(end - begin);
+
+  for (size_t i = begin; i < end; i++) {
+    // range is validated in BuildLiveFieldSets()
+    auto const &field = _fields[_fieldset_indices[i].value];
+    auto &fv = (*fvs)[i - begin];
+
+    if (auto tokv = GetToken(field.token_index)) {
+      fv.first = tokv.value().str();
+    } else {
+      PUSH_ERROR_AND_RETURN("Invalid token index.");
+    }
+
+    if (!UnpackFieldValue(fv.first, field.value_rep, &fv.second)) {
+      PUSH_ERROR_AND_RETURN("UnpackLiveFieldSet: Failed to unpack ValueRep : "
+                 << field.value_rep.GetStringRepr());
+    }
+  }
+
+  return true;
+}
+
+bool CrateReader::UnpackLiveFieldSet(crate::Index fieldset_index,
+                                     const std::set<std::string> &names,
+                                     FieldValuePairVector *fvs) {
+  if (!fvs) {
+    return false;
+  }
+
+  fvs->clear();
+
+  if (!_config.deferredValueUnpack) {
+    // Already unpacked.
+    auto it = _live_fieldsets.find(fieldset_index);
+    if (it == _live_fieldsets.end()) {
+      PUSH_ERROR_AND_RETURN_TAG(kTag, "FieldSet id: " + std::to_string(fieldset_index.value) + " not found.");
+    }
+    for (const auto &fv : it->second) {
+      if (names.count(fv.first)) {
+        fvs->push_back(fv);
+      }
+    }
+    return true;
+  }
+
+  auto it = _fieldset_ranges.find(fieldset_index.value);
+  if (it == _fieldset_ranges.end()) {
+    PUSH_ERROR_AND_RETURN_TAG(kTag, "FieldSet id: " + std::to_string(fieldset_index.value) + " not found.");
+  }
+
+  for (size_t i = it->second.first; i < it->second.second; i++) {
+    // range is validated in BuildLiveFieldSets()
+    auto const &field = _fields[_fieldset_indices[i].value];
+
+    auto tokv = GetToken(field.token_index);
+    if (!tokv) {
+      PUSH_ERROR_AND_RETURN("Invalid token index.");
+    }
+
+    if (!names.count(tokv.value().str())) {
+      continue;
+    }
+
+    crate::FieldValuePair fv;
+    fv.first = tokv.value().str();
+    if (!UnpackFieldValue(fv.first, field.value_rep, &fv.second)) {
+      PUSH_ERROR_AND_RETURN("UnpackLiveFieldSet: Failed to unpack ValueRep : "
+                 << field.value_rep.GetStringRepr());
+    }
+    fvs->emplace_back(std::move(fv));
+  }
+
+  return true;
+}
+
+bool CrateReader::UnpackDeferredValue(const DeferredDecodeContext &ctx,
+                                      const crate::ValueRep &rep,
+                                      value::Value *dst, std::string *err) {
+  if (!dst) {
+    return false;
+  }
+
+  // Use a temporary reader per call, so decoding is thread-safe and decoded
+  // values(owned by TimeSamples or Attributes) do not accumulate memory
+  // usage.
+  StreamReader sr(ctx.data, ctx.size, ctx.swap_endian);
+  CrateReader reader(&sr, ctx.config);
+  reader._version[0] = ctx.version[0];
+  reader._version[1] = ctx.version[1];
+  reader._version[2] = ctx.version[2];
+
+  crate::CrateValue value;
+  if (!reader.UnpackValueRep(rep, &value)) {
+    if (err) {
+      (*err) += "Failed to unpack deferred value: " + rep.GetStringRepr() +
+                "\n";
+      (*err) += reader.GetError();
+    }
+    return false;
+  }
+
+  (*dst) = value.get_raw();
+  return true;
+}
+
+namespace {
+
+bool IsLittleEndianHost() {
+  uint32_t i = 1;
+  uint8_t c;
+  memcpy(&c, &i, 1);
+  return c == 1;
+}
+
+// Numeric array types which are referenced without copy(zero-copy array) or
+// decoded without token/string/path tables(deferred value).
+// `elem_align` : alignment of the scalar component.
+bool GetNumericArrayType(const crate::ValueRep &rep, uint32_t *tyid,
+                         size_t *elem_size, size_t *elem_align) {
+#define NUMERIC_ARRAY_TYPE(__dtyid, __ty, __scalar_ty)              \
+  case crate::CrateDataTypeId::__dtyid: {                           \
+    (*tyid) = value::TypeTraits<std::vector<__ty>>::type_id();      \
+    (*elem_size) = sizeof(__ty);                                    \
+    (*elem_align) = sizeof(__scalar_ty);                            \
+    return true;                                                    \
+  }
+
+  switch (static_cast<crate::CrateDataTypeId>(rep.GetType())) {
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_INT, int32_t, int32_t)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_UINT, uint32_t, uint32_t)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_INT64, int64_t, int64_t)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_UINT64, uint64_t, uint64_t)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_HALF, value::half, uint16_t)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_FLOAT, float, float)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_DOUBLE, double, double)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_MATRIX2D, value::matrix2d, double)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_MATRIX3D, value::matrix3d, double)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_MATRIX4D, value::matrix4d, double)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_QUATD, value::quatd, double)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_QUATF, value::quatf, float)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_QUATH, value::quath, uint16_t)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_VEC2D, value::double2, double)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_VEC2F, value::float2, float)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_VEC2H, value::half2, uint16_t)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_VEC2I, value::int2, int32_t)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_VEC3D, value::double3, double)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_VEC3F, value::float3, float)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_VEC3H, value::half3, uint16_t)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_VEC3I, value::int3, int32_t)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_VEC4D, value::double4, double)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_VEC4F, value::float4, float)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_VEC4H, value::half4, uint16_t)
+    NUMERIC_ARRAY_TYPE(CRATE_DATA_TYPE_VEC4I, value::int4, int32_t)
+    default:
+      return false;
+  }
+
+#undef NUMERIC_ARRAY_TYPE
+}
+
+}  // namespace
+
+bool CrateReader::TryGetBorrowedArray(const crate::ValueRep &rep,
+                                      value::BorrowedArray *dst) {
+  if (!dst) {
+    return false;
+  }
+
+  if (!_config.zeroCopyArrays || !_config.bufferOwner) {
+    return false;
+  }
+
+  if (!rep.IsArray() || rep.IsInlined() || rep.IsCompressed()) {
+    return false;
+  }
+
+  if (rep.GetPayload() == 0) {  // empty array
+    return false;
+  }
+
+  if (_sr->swap_endian() || !IsLittleEndianHost()) {
+    return false;
+  }
+
+  uint32_t tyid{value::TYPE_ID_INVALID};
+  size_t elem_size{0};
+  size_t elem_align{0};
+
+  if (!GetNumericArrayType(rep, &tyid, &elem_size, &elem_align)) {
+    return false;
+  }
+
+  // Parse array header(the number of elements).
+  uint64_t offset = rep.GetPayload();
+  uint64_t n{0};
+  if (VERSION_LESS_THAN_0_8_0(_version)) {
+    // shapesize(uint32, not used) + n(uint32)
+    offset += sizeof(uint32_t);
+    uint32_t _n;
+    if ((offset + sizeof(uint32_t)) > _sr->size()) {
+      return false;
+    }
+    memcpy(&_n, _sr->data() + offset, sizeof(uint32_t));
+    offset += sizeof(uint32_t);
+    n = _n;
+  } else {
+    if ((offset + sizeof(uint64_t)) > _sr->size()) {
+      return false;
+    }
+    memcpy(&n, _sr->data() + offset, sizeof(uint64_t));
+    offset += sizeof(uint64_t);
+  }
+
+  if ((n == 0) || (n > _config.maxArrayElements)) {
+    // Let UnpackValueRep() handle it.
+    return false;
+  }
+
+  if ((_sr->size() - offset) / elem_size < n) {
+    return false;
+  }
+
+  const uint8_t *p = _sr->data() + offset;
+  if ((reinterpret_cast<uintptr_t>(p) % elem_align) != 0) {
+    return false;
+  }
+
+  dst->type_id = tyid;
+  dst->underlying_type_id = tyid;
+  dst->data = p;
+  dst->size = size_t(n);
+  dst->owner = _config.bufferOwner;
+
+  return true;
+}
+
+bool CrateReader::TryGetDeferredValue(const crate::ValueRep &rep,
+                                      value::DeferredValue *dst) {
+  if (!dst) {
+    return false;
+  }
+
+  if (!_config.deferredValueUnpack || !_config.bufferOwner) {
+    return false;
+  }
+
+  if (!rep.IsArray() || rep.IsInlined()) {
+    return false;
+  }
+
+  if (rep.GetPayload() == 0) {  // empty array
+    return false;
+  }
+
+  uint32_t tyid{value::TYPE_ID_INVALID};
+  size_t elem_size{0};
+  size_t elem_align{0};
+  if (!GetNumericArrayType(rep, &tyid, &elem_size, &elem_align)) {
+    return false;
+  }
+
+  std::shared_ptr<const DeferredDecodeContext> ctx = GetDeferredDecodeContext();
+
+  dst->type_id = tyid;
+  dst->underlying_type_id = tyid;
+  dst->decoder = [ctx, rep](value::Value *v, std::string *err) {
+    return UnpackDeferredValue(*ctx, rep, v, err);
+  };
+  dst->decoded = std::make_shared<value::DeferredValue::Decoded>();
+
+  return true;
+}
+
+bool CrateReader::UnpackFieldValue(const std::string &name,
+                                   const crate::ValueRep &rep,
+                                   crate::CrateValue *value) {
+  if (_config.zeroCopyArrays && (name == "default")) {
+    value::BorrowedArray view;
+    if (TryGetBorrowedArray(rep, &view)) {
+      value->SetBorrowedArray(view);
+      return true;
+    }
+  }
+
+  if (_config.deferredValueUnpack && (name == "default")) {
+    value::DeferredValue dv;
+    if (TryGetDeferredValue(rep, &dv)) {
+      value->SetDeferredValue(dv);
+      return true;
+    }
+  }
+
+  return UnpackValueRep(rep, value);
+}
+
 bool CrateReader::ReadSpecs() {
   if ((_specs_index < 0) || (_specs_index >= int64_t(_toc.sections.size()))) {
     PUSH_ERROR("Invalid index for `SPECS` section.");
@@ -6253,6 +7134,144 @@ bool CrateReader::ReadBootStrap() {
   return true;
 }
 
+bool CrateReader::ReadSections() {
+#if defined(TINYUSDZ_CRATE_USE_THREAD)
+  if (_config.numThreads > 1) {
+    uint64_t total_bytes = 0;
+    for (int64_t idx : {_tokens_index, _strings_index, _fields_index,
+                        _fieldsets_index, _paths_index, _specs_index}) {
+      if ((idx >= 0) && (idx < int64_t(_toc.sections.size())) &&
+          (_toc.sections[size_t(idx)].size > 0)) {
+        total_bytes += uint64_t(_toc.sections[size_t(idx)].size);
+      }
+    }
+
+    if (total_bytes > _config.minSectionBytesForParallelRead) {
+      return ReadSectionsParallel();
+    }
+  }
+#endif
+
+  if (!ReadTokens()) {
+    return false;
+  }
+
+  if (!ReadStrings()) {
+    return false;
+  }
+
+  if (!ReadFields()) {
+    return false;
+  }
+
+  if (!ReadFieldSets()) {
+    return false;
+  }
+
+  if (!ReadPaths()) {
+    return false;
+  }
+
+  if (!ReadSpecs()) {
+    return false;
+  }
+
+  return true;
+}
+
+#if defined(TINYUSDZ_CRATE_USE_THREAD)
+bool CrateReader::ReadSectionsParallel() {
+  // `PATHS` requires `TOKENS`, so these two are read in this thread.
+  // STRINGS, FIELDS, FIELDSETS and SPECS do not depend on other sections and
+  // are read in worker threads. Each section is read by its own CrateReader
+  // (with its own StreamReader over the same buffer), then the result is moved
+  // to this reader.
+
+  enum { kStrings = 0, kFields, kFieldSets, kSpecs, kNumWorkerSections };
+
+  std::vector<std::unique_ptr<CrateReader>> workers(kNumWorkerSections);
+  std::vector<std::unique_ptr<StreamReader>> worker_srs(kNumWorkerSections);
+  for (size_t i = 0; i < kNumWorkerSections; i++) {
+    worker_srs[i].reset(
+        new StreamReader(_sr->data(), _sr->size(), _sr->swap_endian()));
+    workers[i].reset(new CrateReader(worker_srs[i].get(), _config));
+    workers[i]->_toc = _toc;
+    workers[i]->_strings_index = _strings_index;
+    workers[i]->_fields_index = _fields_index;
+    workers[i]->_fieldsets_index = _fieldsets_index;
+    workers[i]->_specs_index = _specs_index;
+    workers[i]->_memoryUsage = _memoryUsage;
+    for (size_t v = 0; v < 3; v++) {
+      workers[i]->_version[v] = _version[v];
+    }
+  }
+
+  size_t num_threads =
+      (std::min)(size_t(_config.numThreads - 1), size_t(kNumWorkerSections));
+
+  std::atomic<size_t> counter(0);
+  std::vector<int> section_ok(kNumWorkerSections, 0);
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+
+  for (size_t t = 0; t < num_threads; t++) {
+    threads.emplace_back([&]() {
+      size_t i = 0;
+      while ((i = counter++) < kNumWorkerSections) {
+        CrateReader *worker = workers[i].get();
+        bool ret = false;
+        if (i == kStrings) {
+          ret = worker->ReadStrings();
+        } else if (i == kFields) {
+          ret = worker->ReadFields();
+        } else if (i == kFieldSets) {
+          ret = worker->ReadFieldSets();
+        } else {
+          ret = worker->ReadSpecs();
+        }
+        section_ok[i] = ret ? 1 : 0;
+      }
+    });
+  }
+
+  uint64_t base_usage = _memoryUsage;
+
+  bool ok = ReadTokens() && ReadPaths();
+
+  for (auto &th : threads) {
+    th.join();
+  }
+
+  // Merge per-section results in section order.
+  for (size_t i = 0; i < kNumWorkerSections; i++) {
+    _warn += workers[i]->_warn;
+    _err += workers[i]->_err;
+    if (workers[i]->_memoryUsage > base_usage) {
+      _memoryUsage += workers[i]->_memoryUsage - base_usage;
+    }
+    if (!section_ok[i]) {
+      ok = false;
+    }
+  }
+
+  if (!ok) {
+    return false;
+  }
+
+  if (_memoryUsage > _config.maxMemoryBudget) {
+    PUSH_ERROR_AND_RETURN_TAG(kTag, "Reached to max memory budget.");
+  }
+
+  _string_indices = std::move(workers[kStrings]->_string_indices);
+  _fields = std::move(workers[kFields]->_fields);
+  _fieldset_indices = std::move(workers[kFieldSets]->_fieldset_indices);
+  _specs = std::move(workers[kSpecs]->_specs);
+
+  return true;
+}
+#endif
+
 bool CrateReader::ReadTOC() {
 
   DCOUT(fmt::format("Memory budget: {} bytes", _config.maxMemoryBudget));
@@ -3,7 +3,10 @@
 // Copyright 2023 - Present, Light Transport Entertainment Inc.
 #pragma once
 
+#include <memory>
+#include <set>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 
 //
@@ -13,6 +16,20 @@
 #include "prim-types.hh"
 #include "stream-reader.hh"
 
+// Use std::thread to decode Crate data in parallel.
+// # of threads is controlled by `CrateReaderConfig::numThreads` at runtime.
+#if defined(__wasi__)
+// no threading
+#elif defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+// no threading
+#else
+#define TINYUSDZ_CRATE_USE_THREAD
+#endif
+
+#if defined(TINYUSDZ_CRATE_USE_THREAD)
+#include <mutex>
+#endif
+
 namespace tinyusdz {
 namespace crate {
 
@@ -24,6 +41,46 @@ namespace crate {
 struct CrateReaderConfig {
   int numThreads = -1;
 
+  // Use multi-threaded unpacking in BuildLiveFieldSets when the number of
+  // fields to unpack is larger than this value.
+  size_t minFieldsForParallelUnpack = 1024;
+
+  // Decode PATHS(build Path and Node hierarchy) in parallel when the number of
+  // encoded paths is larger than this value.
+  size_t minPathsForParallelDecode = 1024 * 16;
+
+  // Read known sections(TOKENS, STRINGS, FIELDS, ...) in parallel in
+  // ReadSections() when the total byte size of these sections is larger than
+  // this value.
+  size_t minSectionBytesForParallelRead = 1024 * 1024;
+
+  // Do not unpack field values in BuildLiveFieldSets.
+  // Values are unpacked on demand with UnpackLiveFieldSet().
+  // Crate data(StreamReader) must be alive until all required values are
+  // unpacked. With `bufferOwner`, numeric array values of `default` field
+  // are not decoded in UnpackLiveFieldSet() either. They are unpacked as
+  // value::DeferredValue, which is decoded on the first access.
+  bool deferredValueUnpack = false;
+
+  // Do not copy uncompressed array data of `default` field values(e.g.
+  // `point3f[] points`). Instead, the value references Crate data directly as
+  // value::BorrowedArray. Requires `bufferOwner`, which keeps Crate data(e.g.
+  // memory-mapped file) alive. Data must be little-endian and properly
+  // aligned, otherwise the array is copied as usual.
+  bool zeroCopyArrays = false;
+  std::shared_ptr<const void> bufferOwner;
+
+  // Do not decode TimeSamples values when reading Crate data. Each sample
+  // value is decoded on demand(e.g. value::TimeSamples::get()). Requires
+  // `bufferOwner`, since decoders of deferred TimeSamples keep Crate data
+  // alive(not this CrateReader). TimeSamples whose values reference
+  // token/string/path tables(e.g. `token[]`) are decoded as usual.
+  bool deferredTimeSamples = false;
+
+  // Max number of decoded sample values kept in each deferred TimeSamples.
+  // 0 = no limit.
+  size_t maxCachedTimeSamples = 0;
+
   // For malcious Crate data.
   // Set limits to prevent infinite-loop, buffer-overrun, out-of-memory, etc.
   size_t maxTOCSections = 32;
@@ -170,8 +227,41 @@ class CrateReader {
   bool ReadFieldSets();
   bool ReadSpecs();
 
+  ///
+  /// Read all known sections above. Sections which do not depend on each
+  /// other are read in parallel when multi-threading is enabled.
+  ///
+  bool ReadSections();
+
   bool BuildLiveFieldSets();
 
+  ///
+  /// True when field values are unpacked on demand(`deferredValueUnpack`).
+  ///
+  bool IsDeferredValueUnpack() const { return _config.deferredValueUnpack; }
+
+  ///
+  /// Check if the fieldset exists.
+  /// Valid after BuildLiveFieldSets().
+  ///
+  bool HasLiveFieldSet(crate::Index fieldset_index) const;
+
+  ///
+  /// Unpack field values of the fieldset to `fvs`.
+  /// Valid after BuildLiveFieldSets(). Used in `deferredValueUnpack` mode.
+  ///
+  bool UnpackLiveFieldSet(crate::Index fieldset_index,
+                          FieldValuePairVector *fvs);
+
+  ///
+  /// Unpack field values of the fieldset whose name is in `names` to `fvs`.
+  /// Values of other fields are not unpacked.
+  /// Valid after BuildLiveFieldSets().
+  ///
+  bool UnpackLiveFieldSet(crate::Index fieldset_index,
+                          const std::set<std::string> &names,
+                          FieldValuePairVector *fvs);
+
   std::string GetError();
   std::string GetWarning();
 
@@ -185,9 +275,9 @@ class CrateReader {
   ///
   size_t NumNodes() const { return _nodes.size(); }
 
-  const std::vector<Node> GetNodes() const { return _nodes; }
+  const std::vector<Node> &GetNodes() const { return _nodes; }
 
-  const std::vector<value::token> GetTokens() const { return _tokens; }
+  const std::vector<value::token> &GetTokens() const { return _tokens; }
 
   const std::vector<crate::Index> GetStringIndices() const {
     return _string_indices;
@@ -295,9 +385,41 @@ class CrateReader {
 #endif
 
   bool UnpackValueRep(const crate::ValueRep &rep, crate::CrateValue *value);
+
+  // Unpack field value. `default` value is unpacked as zero-copy array(or
+  // deferred value) when possible.
+  bool UnpackFieldValue(const std::string &name, const crate::ValueRep &rep,
+                        crate::CrateValue *value);
+
+  // Returns true when `rep` is uncompressed array which can be referenced
+  // without copy.
+  bool TryGetBorrowedArray(const crate::ValueRep &rep,
+                           value::BorrowedArray *dst);
   bool UnpackInlinedValueRep(const crate::ValueRep &rep,
                              crate::CrateValue *value);
 
+  // Find/register decoded `times` array of TimeSamples. Thread-safe.
+  std::shared_ptr<const std::vector<double>> FindSharedTimes(
+      const crate::ValueRep &rep) const;
+  std::shared_ptr<const std::vector<double>> AddSharedTimes(
+      const crate::ValueRep &rep,
+      std::shared_ptr<const std::vector<double>> times) const;
+
+  // Crate data and settings to decode deferred values(TimeSamples and
+  // value::DeferredValue) without CrateReader.
+  struct DeferredDecodeContext;
+  std::shared_ptr<const DeferredDecodeContext> GetDeferredDecodeContext();
+
+  // Decode a deferred value. Thread-safe.
+  static bool UnpackDeferredValue(const DeferredDecodeContext &ctx,
+                                  const crate::ValueRep &rep,
+                                  value::Value *dst, std::string *err);
+
+  // `deferredValueUnpack` mode. Returns false when `rep` cannot be
+  // deferred(e.g. token[], inlined value).
+  bool TryGetDeferredValue(const crate::ValueRep &rep,
+                           value::DeferredValue *dst);
+
   //
   // Construct node hierarchy.
   //
@@ -309,8 +431,29 @@ class CrateReader {
                                        // circular referencing
       size_t curIndex, int64_t parentNodeIndex);
 
+#if defined(TINYUSDZ_CRATE_USE_THREAD)
+  //
+  // Build `_paths`, `_elemPaths` and `_nodes` at once.
+  // Sibling subtrees are decoded in parallel.
+  //
+  bool BuildDecompressedPathsAndNodesParallel(
+      std::vector<uint32_t> const &pathIndexes,
+      std::vector<int32_t> const &elementTokenIndexes,
+      std::vector<int32_t> const &jumps,
+      std::vector<bool> &visit_table);
+#endif
+
   bool ReadCompressedPaths(const uint64_t ref_num_paths);
 
+#if defined(TINYUSDZ_CRATE_USE_THREAD)
+  bool ReadSectionsParallel();
+#endif
+
+  // Decompress LZ4 data at the current read position of StreamReader
+  // without copying compressed data to a temporary buffer.
+  bool DecompressLZ4FromStream(size_t compressedSize, char *dst,
+                               size_t uncompressedSize);
+
   template <class Int>
   bool ReadCompressedInts(Int *out, size_t num_elements);
 
@@ -374,6 +517,11 @@ class CrateReader {
 
   bool ReadVariantSelectionMap(VariantSelectionMap *d);
 
+  bool BuildLiveFieldSetsSerial();
+#if defined(TINYUSDZ_CRATE_USE_THREAD)
+  bool BuildLiveFieldSetsParallel();
+#endif
+
   // Read 64bit uint with range check
   bool ReadNum(uint64_t &n, uint64_t maxnum);
 
@@ -408,6 +556,10 @@ class CrateReader {
   std::map<crate::Index, FieldValuePairVector>
       _live_fieldsets;  // <fieldset index, List of field with unpacked Values>
 
+  // For `deferredValueUnpack` mode.
+  // <fieldset index, (begin, end) range in `_fieldset_indices`>
+  std::unordered_map<uint32_t, std::pair<size_t, size_t>> _fieldset_ranges;
+
   const StreamReader *_sr{};
 
   void PushError(const std::string &s) const { _err += s; }
@@ -423,6 +575,22 @@ class CrateReader {
   // Approximated uncompressed memory usage(vertices, `tokens`, ...) in bytes.
   uint64_t _memoryUsage{0};
 
+  // Worker reader for multi-threaded value unpacking.
+  // Token/string/path tables are looked up from `_parent`.
+  const CrateReader *_parent{nullptr};
+
+  // For `deferredTimeSamples` and `deferredValueUnpack` mode. Shared by
+  // decoders of deferred values.
+  std::shared_ptr<const DeferredDecodeContext> _deferred_ctx;
+
+  // Decoded `times` arrays of TimeSamples keyed by ValueRep.
+  // Workers use the one in `_parent`.
+  mutable std::unordered_map<uint64_t, std::shared_ptr<const std::vector<double>>>
+      _shared_times;
+#if defined(TINYUSDZ_CRATE_USE_THREAD)
+  mutable std::mutex _shared_times_mutex;
+#endif
+
   class Impl;
   Impl *_impl;
 };
@@ -1,3 +1,5 @@
+#include <array>
+#include <cmath>
 #include <limits>
 #include <cstdint>
 #include <cstring>
@@ -5,18 +7,6 @@
 #include "crate-writer.hh"
 #include "value-types.hh"
 
-#ifdef __clang__
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Weverything"
-#endif
-
-// TODO: Use std:: version for C++17
-#include "nonstd/optional.hpp"
-
-#ifdef __clang__
-#pragma clang diagnostic pop
-#endif
-
 namespace tinyusdz {
 namespace crate {
 
@@ -69,6 +59,10 @@ nonstd::optional<Tto> TryExactlyRepresentable(const Tfrom &from) {
   Tfrom minval = static_cast<Tfrom>(std::numeric_limits<Tto>::lowest());
   Tfrom maxval = static_cast<Tfrom>(std::numeric_limits<Tto>::max());
 
+  if (std::isnan(static_cast<double>(from))) {
+    return nonstd::nullopt;
+  }
+
   if (from < minval) {
     return nonstd::nullopt;
   }
@@ -86,6 +80,30 @@ nonstd::optional<Tto> TryExactlyRepresentable(const Tfrom &from) {
   return nonstd::nullopt;
 }
 
+namespace {
+
+// Check if each component of the vector can be represented by int8.
+template<typename T, size_t N>
+nonstd::optional<uint32_t> TryEncodeVecInline(const std::array<T, N> &v) {
+  static_assert(N <= 4, "N must be 2, 3 or 4");
+
+  uint32_t dst{0};
+
+  std::array<int8_t, N> ivec;
+  for (size_t i = 0; i < N; i++) {
+    if (auto f = TryExactlyRepresentable<T, int8_t>(v[i])) {
+      ivec[i] = f.value();
+    } else {
+      return nonstd::nullopt;
+    }
+  }
+
+  memcpy(&dst, &ivec[0], sizeof(ivec));
+  return dst;
+}
+
+} // namespace
+
 // NOTE `Inline` payload is 6bytes.
 //
 // - Inlineable value
@@ -95,7 +113,7 @@ nonstd::optional<Tto> TryExactlyRepresentable(const Tfrom &from) {
 //   - Diagonal matrix as int8 x N  (n = 2, 3 or 4)
 //   - empty dictionary
 
-inline nonstd::optional<uint32_t> TryEncodeInline(double v) {
+nonstd::optional<uint32_t> TryEncodeInline(double v) {
   uint32_t dst;
 
   nonstd::optional<float> f = TryExactlyRepresentable<double, float>(v);
@@ -108,7 +126,7 @@ inline nonstd::optional<uint32_t> TryEncodeInline(double v) {
   return nonstd::nullopt;
 }
 
-inline nonstd::optional<uint32_t> TryEncodeInline(uint64_t v) {
+nonstd::optional<uint32_t> TryEncodeInline(uint64_t v) {
   uint32_t dst;
 
   nonstd::optional<uint32_t> f = TryExactlyRepresentable<uint64_t, uint32_t>(v);
@@ -121,7 +139,7 @@ inline nonstd::optional<uint32_t> TryEncodeInline(uint64_t v) {
   return nonstd::nullopt;
 }
 
-inline nonstd::optional<uint32_t> TryEncodeInline(int64_t v) {
+nonstd::optional<uint32_t> TryEncodeInline(int64_t v) {
   uint32_t dst;
 
   nonstd::optional<int32_t> f = TryExactlyRepresentable<int64_t, int32_t>(v);
@@ -134,7 +152,43 @@ inline nonstd::optional<uint32_t> TryEncodeInline(int64_t v) {
   return nonstd::nullopt;
 }
 
-inline nonstd::optional<uint32_t> TryEncodeInline(value::vector3f v) {
+nonstd::optional<uint32_t> TryEncodeInline(const value::float2 &v) {
+  return TryEncodeVecInline(v);
+}
+
+nonstd::optional<uint32_t> TryEncodeInline(const value::float3 &v) {
+  return TryEncodeVecInline(v);
+}
+
+nonstd::optional<uint32_t> TryEncodeInline(const value::float4 &v) {
+  return TryEncodeVecInline(v);
+}
+
+nonstd::optional<uint32_t> TryEncodeInline(const value::double2 &v) {
+  return TryEncodeVecInline(v);
+}
+
+nonstd::optional<uint32_t> TryEncodeInline(const value::double3 &v) {
+  return TryEncodeVecInline(v);
+}
+
+nonstd::optional<uint32_t> TryEncodeInline(const value::double4 &v) {
+  return TryEncodeVecInline(v);
+}
+
+nonstd::optional<uint32_t> TryEncodeInline(const value::int2 &v) {
+  return TryEncodeVecInline(v);
+}
+
+nonstd::optional<uint32_t> TryEncodeInline(const value::int3 &v) {
+  return TryEncodeVecInline(v);
+}
+
+nonstd::optional<uint32_t> TryEncodeInline(const value::int4 &v) {
+  return TryEncodeVecInline(v);
+}
+
+nonstd::optional<uint32_t> TryEncodeInline(value::vector3f v) {
   uint32_t dst;
 
   // Check if each component of the vector can be represented by int8.
@@ -151,7 +205,7 @@ inline nonstd::optional<uint32_t> TryEncodeInline(value::vector3f v) {
   return dst;
 }
 
-inline nonstd::optional<uint32_t> TryEncodeInline(value::vector3d v) {
+nonstd::optional<uint32_t> TryEncodeInline(value::vector3d v) {
   uint32_t dst;
 
   // Check if each component of the vector can be represented by int8.
@@ -168,7 +222,7 @@ inline nonstd::optional<uint32_t> TryEncodeInline(value::vector3d v) {
   return dst;
 }
 
-inline nonstd::optional<uint32_t> TryEncodeInline(value::color4f v) {
+nonstd::optional<uint32_t> TryEncodeInline(value::color4f v) {
   uint32_t dst;
 
   // Check if each component of the vector can be represented by int8.
@@ -185,7 +239,7 @@ inline nonstd::optional<uint32_t> TryEncodeInline(value::color4f v) {
   return dst;
 }
 
-inline nonstd::optional<uint32_t> TryEncodeInline(value::color4d v) {
+nonstd::optional<uint32_t> TryEncodeInline(value::color4d v) {
   uint32_t dst;
 
   // Check if each component of the vector can be represented by int8.
@@ -202,11 +256,7 @@ inline nonstd::optional<uint32_t> TryEncodeInline(value::color4d v) {
   return dst;
 }
 
-//
-// TODO: Implement more TryEncodeInline for scalar value types
-//
-
-inline nonstd::optional<uint32_t> TryEncodeInline(value::matrix2d v) {
+nonstd::optional<uint32_t> TryEncodeInline(value::matrix2d v) {
   uint32_t dst;
 
   // Check if a matrix is a diagonal matrix and its diagonal component can be represented by int8.
@@ -232,7 +282,7 @@ inline nonstd::optional<uint32_t> TryEncodeInline(value::matrix2d v) {
   return dst;
 }
 
-inline nonstd::optional<uint32_t> TryEncodeInline(value::matrix3d v) {
+nonstd::optional<uint32_t> TryEncodeInline(value::matrix3d v) {
   uint32_t dst;
 
   // Check if a matrix is a diagonal matrix and its diagonal component can be represented by int8.
@@ -258,7 +308,7 @@ inline nonstd::optional<uint32_t> TryEncodeInline(value::matrix3d v) {
   return dst;
 }
 
-inline nonstd::optional<uint32_t> TryEncodeInline(value::matrix4d v) {
+nonstd::optional<uint32_t> TryEncodeInline(value::matrix4d v) {
   uint32_t dst;
 
   // Check if a matrix is a diagonal matrix and its diagonal component can be represented by int8.
@@ -284,7 +334,7 @@ inline nonstd::optional<uint32_t> TryEncodeInline(value::matrix4d v) {
   return dst;
 }
 
-inline nonstd::optional<uint32_t> TryEncodeInline(value::dict v) {
+nonstd::optional<uint32_t> TryEncodeInline(value::dict v) {
   uint32_t dst{0};
 
   if (v.empty()) {
@@ -30,11 +30,29 @@
 #include "lz4-compression.hh"
 #include "integerCoding.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <limits>
 #include <memory>
-#include <unordered_map>
+#include <vector>
+
+// (TinyUSDZ) SIMD decoder for 32-bit integer coding.
+// x86: SSSE3(selected at runtime). aarch64: NEON.
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#if defined(_MSC_VER) && !defined(__clang__)
+#define TINYUSDZ_INTCODING_SSSE3
+#include <intrin.h>
+#include <tmmintrin.h>
+#elif defined(__GNUC__) || defined(__clang__)
+#define TINYUSDZ_INTCODING_SSSE3
+#include <immintrin.h>
+#endif
+#elif (defined(__aarch64__) || defined(_M_ARM64)) && \
+    (!defined(__BYTE_ORDER__) || (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__))
+#define TINYUSDZ_INTCODING_NEON
+#include <arm_neon.h>
+#endif
 
 //PXR_NAMESPACE_OPEN_SCOPE
 namespace tinyusdz {
@@ -159,6 +177,14 @@ _Signed(Int x)
     return x;
 }
 
+// (TinyUSDZ) `cur - prev` with wrap around(avoids signed integer overflow).
+template <class SInt>
+inline SInt _Delta(SInt cur, SInt prev)
+{
+    using UInt = typename std::make_unsigned<SInt>::type;
+    return static_cast<SInt>(static_cast<UInt>(cur) - static_cast<UInt>(prev));
+}
+
 template <class T>
 inline char *_WriteBits(char *p, T val)
 {
@@ -226,7 +252,7 @@ void _EncodeNHelper(
 
     uint8_t codeByte = 0;
     for (int i = 0; i != N; ++i) {
-        SInt val = _Signed(*cur) - prevVal;
+        SInt val = _Delta(_Signed(*cur), prevVal);
         prevVal = _Signed(*cur++);
         Code code = getCode(val);
         codeByte |= (code << (2 * i));
@@ -286,6 +312,43 @@ void _DecodeNHelper(
     }
 }
 
+// (TinyUSDZ) Find the most common delta. Deltas are sorted instead of counted
+// with a hash map, which is much faster for large arrays. Ties are resolved to
+// the largest value as in pxrUSD, so the encoded output is unchanged.
+template <class Int>
+typename std::make_signed<Int>::type
+_FindCommonValue(Int const *begin, size_t numInts)
+{
+    using SInt = typename std::make_signed<Int>::type;
+
+    std::vector<SInt> deltas(numInts);
+    SInt prevVal = 0;
+    for (size_t i = 0; i != numInts; ++i) {
+        deltas[i] = _Delta(_Signed(begin[i]), prevVal);
+        prevVal = _Signed(begin[i]);
+    }
+
+    std::sort(deltas.begin(), deltas.end());
+
+    SInt commonValue = 0;
+    size_t commonCount = 0;
+    for (size_t i = 0; i != numInts;) {
+        size_t j = i + 1;
+        while ((j != numInts) && (deltas[j] == deltas[i])) {
+            ++j;
+        }
+        // Values are visited in ascending order, so `>=` takes the largest
+        // value in case of a tie.
+        if ((j - i) >= commonCount) {
+            commonValue = deltas[i];
+            commonCount = j - i;
+        }
+        i = j;
+    }
+
+    return commonValue;
+}
+
 template <class Int>
 size_t
 _EncodeIntegers(Int const *begin, size_t numInts, char *output)
@@ -296,26 +359,7 @@ _EncodeIntegers(Int const *begin, size_t numInts, char *output)
         return 0;
 
     // First find the most common element value.
-    SInt commonValue = 0;
-    {
-        size_t commonCount = 0;
-        std::unordered_map<SInt, size_t> counts;
-        SInt prevVal = 0;
-        for (Int const *cur = begin, *end = begin + numInts;
-             cur != end; ++cur) {
-            SInt val = _Signed(*cur) - prevVal;
-            const size_t count = ++counts[val];
-            if (count > commonCount) {
-                commonValue = val;
-                commonCount = count;
-            } else if (count == commonCount && val > commonValue) {
-                // Take the largest common value in case of a tie -- this gives
-                // the biggest potential savings in the encoded stream.
-                commonValue = val;
-            }
-            prevVal = _Signed(*cur);
-        }
-    }
+    SInt commonValue = _FindCommonValue(begin, numInts);
 
     // Now code the values.
     
@@ -373,6 +417,547 @@ size_t _DecodeIntegers(char const *data, size_t numInts, Int *result)
     return numInts;
 }
 
+////////////////////////////////////////////////////////////////////////
+// (TinyUSDZ) Bounds-checked and SIMD decoders for 32-bit integers.
+//
+// Each code byte describes 4 integers, so SIMD decoders process 4 integers
+// per code byte: variable-length deltas are expanded into 32-bit lanes with a
+// byte shuffle(looked up by the code byte), sign-extended, then
+// reconstructed with a prefix sum.
+
+// Returns the number of bytes in the variable-length section for `code`.
+inline size_t _VarIntSize32(uint32_t code)
+{
+    return (code == 0) ? 0 : (code == 1) ? 1 : (code == 2) ? 2 : 4;
+}
+
+// Scalar decoder with bounds checking of the input buffer.
+// Decodes `numInts` integers from `codesIn`/`vintsIn`(`end` is the end of
+// input buffer).
+template <class Int>
+bool _DecodeIntegers32Checked(char const *codesIn, char const *vintsIn,
+                              char const *end, int32_t commonValue,
+                              int32_t &prevVal, Int *result, size_t numInts)
+{
+    using SmallInt = typename _SmallTypes<Int>::SmallInt;
+    using MediumInt = typename _SmallTypes<Int>::MediumInt;
+
+    // Use unsigned arithmetic to wrap around as in pxrUSD.
+    uint32_t prev = static_cast<uint32_t>(prevVal);
+
+    while (numInts > 0) {
+        size_t n = (numInts < 4) ? numInts : 4;
+        uint8_t codeByte = static_cast<uint8_t>(*codesIn++);
+        for (size_t i = 0; i != n; ++i) {
+            uint32_t code = (codeByte >> (2 * i)) & 3;
+            size_t sz = _VarIntSize32(code);
+            if (sz > size_t(end - vintsIn)) {
+                return false;
+            }
+            switch (code) {
+            default:
+            case 0:
+                prev += static_cast<uint32_t>(commonValue);
+                break;
+            case 1:
+                prev += static_cast<uint32_t>(int32_t(_ReadBits<SmallInt>(vintsIn)));
+                break;
+            case 2:
+                prev += static_cast<uint32_t>(int32_t(_ReadBits<MediumInt>(vintsIn)));
+                break;
+            case 3:
+                prev += static_cast<uint32_t>(_ReadBits<int32_t>(vintsIn));
+                break;
+            }
+            *result++ = static_cast<Int>(prev);
+        }
+        numInts -= n;
+    }
+
+    prevVal = static_cast<int32_t>(prev);
+    return true;
+}
+
+#if defined(TINYUSDZ_INTCODING_SSSE3) || defined(TINYUSDZ_INTCODING_NEON)
+
+struct _DecodeTable32
+{
+    // Byte shuffle to move the variable-length delta of each lane to the upper
+    // bytes of the lane. 0x80 = zero fill.
+    uint8_t shuffle[256][16];
+    // Arithmetic right shift amount to sign-extend each lane.
+    int32_t shift[256][4];
+    // All bits set for the lane with `Common` code.
+    int32_t commonMask[256][4];
+    // The number of bytes consumed from the variable-length section.
+    uint8_t length[256];
+};
+
+inline const _DecodeTable32 &_GetDecodeTable32()
+{
+    static const _DecodeTable32 table = []() {
+        _DecodeTable32 t;
+        for (uint32_t c = 0; c < 256; c++) {
+            uint8_t offset = 0;
+            for (uint32_t lane = 0; lane < 4; lane++) {
+                uint32_t code = (c >> (2 * lane)) & 3;
+                size_t sz = _VarIntSize32(code);
+                for (size_t k = 0; k < 4; k++) {
+                    t.shuffle[c][4 * lane + k] = 0x80;
+                }
+                for (size_t k = 0; k < sz; k++) {
+                    t.shuffle[c][4 * lane + (4 - sz) + k] =
+                        static_cast<uint8_t>(offset + k);
+                }
+                t.shift[c][lane] = (sz == 0) ? 0 : int32_t(32 - 8 * sz);
+                t.commonMask[c][lane] = (code == 0) ? -1 : 0;
+                offset = static_cast<uint8_t>(offset + sz);
+            }
+            t.length[c] = offset;
+        }
+        return t;
+    }();
+
+    return table;
+}
+#endif
+
+#if defined(TINYUSDZ_INTCODING_SSSE3)
+
+inline bool _HasSSSE3()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 9)) != 0;
+#else
+    static const bool has_ssse3 = __builtin_cpu_supports("ssse3");
+    return has_ssse3;
+#endif
+}
+
+template <class Int>
+#if !defined(_MSC_VER) || defined(__clang__)
+__attribute__((target("ssse3")))
+#endif
+bool _DecodeIntegers32SSSE3(char const *data, size_t dataSize,
+                            size_t numInts, Int *result)
+{
+    const _DecodeTable32 &table = _GetDecodeTable32();
+
+    char const *end = data + dataSize;
+
+    int32_t commonValue = _ReadBits<int32_t>(data);
+
+    size_t numCodesBytes = (numInts * 2 + 7) / 8;
+    if (numCodesBytes > size_t(end - data)) {
+        return false;
+    }
+
+    char const *codesIn = data;
+    char const *vintsIn = data + numCodesBytes;
+
+    const __m128i common = _mm_set1_epi32(commonValue);
+    const __m128i c16 = _mm_set1_epi32(16);
+    const __m128i c24 = _mm_set1_epi32(24);
+    __m128i prev = _mm_setzero_si128();
+
+    size_t intsLeft = numInts;
+    while ((intsLeft >= 4) && (size_t(end - vintsIn) >= 16)) {
+        const uint8_t code = static_cast<uint8_t>(*codesIn++);
+
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(vintsIn));
+        v = _mm_shuffle_epi8(v, _mm_loadu_si128(reinterpret_cast<const __m128i *>(table.shuffle[code])));
+
+        // Sign extend.
+        const __m128i shift = _mm_loadu_si128(reinterpret_cast<const __m128i *>(table.shift[code]));
+        const __m128i m16 = _mm_cmpeq_epi32(shift, c16);
+        const __m128i m24 = _mm_cmpeq_epi32(shift, c24);
+        __m128i d = _mm_andnot_si128(_mm_or_si128(m16, m24), v);
+        d = _mm_or_si128(d, _mm_and_si128(m16, _mm_srai_epi32(v, 16)));
+        d = _mm_or_si128(d, _mm_and_si128(m24, _mm_srai_epi32(v, 24)));
+
+        // Common value.
+        const __m128i cmask = _mm_loadu_si128(reinterpret_cast<const __m128i *>(table.commonMask[code]));
+        d = _mm_add_epi32(d, _mm_and_si128(cmask, common));
+
+        // Prefix sum.
+        d = _mm_add_epi32(d, _mm_slli_si128(d, 4));
+        d = _mm_add_epi32(d, _mm_slli_si128(d, 8));
+        d = _mm_add_epi32(d, prev);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(result), d);
+        prev = _mm_shuffle_epi32(d, 0xff);
+
+        vintsIn += table.length[code];
+        result += 4;
+        intsLeft -= 4;
+    }
+
+    int32_t prevVal = _mm_cvtsi128_si32(prev);
+
+    return _DecodeIntegers32Checked(codesIn, vintsIn, end, commonValue, prevVal,
+                                    result, intsLeft);
+}
+
+#endif // TINYUSDZ_INTCODING_SSSE3
+
+#if defined(TINYUSDZ_INTCODING_NEON)
+
+template <class Int>
+bool _DecodeIntegers32NEON(char const *data, size_t dataSize,
+                           size_t numInts, Int *result)
+{
+    const _DecodeTable32 &table = _GetDecodeTable32();
+
+    char const *end = data + dataSize;
+
+    int32_t commonValue = _ReadBits<int32_t>(data);
+
+    size_t numCodesBytes = (numInts * 2 + 7) / 8;
+    if (numCodesBytes > size_t(end - data)) {
+        return false;
+    }
+
+    char const *codesIn = data;
+    char const *vintsIn = data + numCodesBytes;
+
+    const int32x4_t common = vdupq_n_s32(commonValue);
+    const int32x4_t zero = vdupq_n_s32(0);
+    int32x4_t prev = vdupq_n_s32(0);
+
+    size_t intsLeft = numInts;
+    while ((intsLeft >= 4) && (size_t(end - vintsIn) >= 16)) {
+        const uint8_t code = static_cast<uint8_t>(*codesIn++);
+
+        uint8x16_t bytes = vld1q_u8(reinterpret_cast<const uint8_t *>(vintsIn));
+        bytes = vqtbl1q_u8(bytes, vld1q_u8(table.shuffle[code]));
+
+        // Sign extend(negative shift = arithmetic right shift).
+        int32x4_t d = vshlq_s32(vreinterpretq_s32_u8(bytes),
+                                vnegq_s32(vld1q_s32(table.shift[code])));
+
+        // Common value.
+        d = vaddq_s32(d, vandq_s32(vld1q_s32(table.commonMask[code]), common));
+
+        // Prefix sum.
+        d = vaddq_s32(d, vextq_s32(zero, d, 3));
+        d = vaddq_s32(d, vextq_s32(zero, d, 2));
+        d = vaddq_s32(d, prev);
+
+        vst1q_s32(reinterpret_cast<int32_t *>(result), d);
+        prev = vdupq_n_s32(vgetq_lane_s32(d, 3));
+
+        vintsIn += table.length[code];
+        result += 4;
+        intsLeft -= 4;
+    }
+
+    int32_t prevVal = vgetq_lane_s32(prev, 0);
+
+    return _DecodeIntegers32Checked(codesIn, vintsIn, end, commonValue, prevVal,
+                                    result, intsLeft);
+}
+
+#endif // TINYUSDZ_INTCODING_NEON
+
+inline bool _HasSIMDDecoder32()
+{
+#if defined(TINYUSDZ_INTCODING_SSSE3)
+    return _HasSSSE3();
+#elif defined(TINYUSDZ_INTCODING_NEON)
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Decode 32-bit integers with bounds checking.
+// Returns the number of decoded integers(0 for corrupted data).
+template <class Int>
+size_t _DecodeIntegers32(char const *data, size_t dataSize, size_t numInts,
+                         Int *result, bool allowSIMD)
+{
+    static_assert(sizeof(Int) == 4, "");
+
+    if (numInts == 0) {
+        return 0;
+    }
+
+    if (dataSize < sizeof(int32_t)) {
+        return 0;
+    }
+
+#if defined(TINYUSDZ_INTCODING_SSSE3)
+    if (allowSIMD && _HasSSSE3()) {
+        return _DecodeIntegers32SSSE3(data, dataSize, numInts, result) ? numInts : 0;
+    }
+#elif defined(TINYUSDZ_INTCODING_NEON)
+    if (allowSIMD) {
+        return _DecodeIntegers32NEON(data, dataSize, numInts, result) ? numInts : 0;
+    }
+#else
+    (void)allowSIMD;
+#endif
+
+    char const *end = data + dataSize;
+    int32_t commonValue = _ReadBits<int32_t>(data);
+    size_t numCodesBytes = (numInts * 2 + 7) / 8;
+    if (numCodesBytes > size_t(end - data)) {
+        return 0;
+    }
+
+    int32_t prevVal = 0;
+    if (!_DecodeIntegers32Checked(data, data + numCodesBytes, end, commonValue,
+                                  prevVal, result, numInts)) {
+        return 0;
+    }
+
+    return numInts;
+}
+
+////////////////////////////////////////////////////////////////////////
+// (TinyUSDZ) SIMD encoders for 32-bit integers.
+//
+// Deltas and 2-bit codes of 4 integers are computed at once, then the
+// variable-length deltas are packed with a byte shuffle(looked up by the code
+// byte). The output is identical to the scalar encoder.
+
+#if defined(TINYUSDZ_INTCODING_SSSE3) || defined(TINYUSDZ_INTCODING_NEON)
+
+struct _EncodeTable32
+{
+    // Byte shuffle to gather the lower bytes of each lane into a contiguous
+    // variable-length delta sequence. 0x80 = zero fill.
+    uint8_t shuffle[256][16];
+    // The number of bytes written to the variable-length section.
+    uint8_t length[256];
+};
+
+inline const _EncodeTable32 &_GetEncodeTable32()
+{
+    static const _EncodeTable32 table = []() {
+        _EncodeTable32 t;
+        for (uint32_t c = 0; c < 256; c++) {
+            uint8_t offset = 0;
+            for (size_t k = 0; k < 16; k++) {
+                t.shuffle[c][k] = 0x80;
+            }
+            for (uint32_t lane = 0; lane < 4; lane++) {
+                uint32_t code = (c >> (2 * lane)) & 3;
+                size_t sz = _VarIntSize32(code);
+                for (size_t k = 0; k < sz; k++) {
+                    t.shuffle[c][offset + k] =
+                        static_cast<uint8_t>(4 * lane + k);
+                }
+                offset = static_cast<uint8_t>(offset + sz);
+            }
+            t.length[c] = offset;
+        }
+        return t;
+    }();
+
+    return table;
+}
+
+// Encode the remaining(< 4) integers with the scalar encoder.
+template <class Int>
+char *_EncodeIntegers32Tail(Int const *cur, size_t intsLeft, int32_t commonValue,
+                            int32_t prevVal, char *codesOut, char *vintsOut)
+{
+    switch (intsLeft) {
+    case 0: default: break;
+    case 1: _EncodeNHelper<1>(cur, static_cast<Int>(commonValue), prevVal, codesOut, vintsOut);
+        break;
+    case 2: _EncodeNHelper<2>(cur, static_cast<Int>(commonValue), prevVal, codesOut, vintsOut);
+        break;
+    case 3: _EncodeNHelper<3>(cur, static_cast<Int>(commonValue), prevVal, codesOut, vintsOut);
+        break;
+    };
+
+    return vintsOut;
+}
+
+#endif
+
+#if defined(TINYUSDZ_INTCODING_SSSE3)
+
+template <class Int>
+#if !defined(_MSC_VER) || defined(__clang__)
+__attribute__((target("ssse3")))
+#endif
+size_t _EncodeIntegers32SSSE3(Int const *begin, size_t numInts, char *output)
+{
+    const _EncodeTable32 &table = _GetEncodeTable32();
+
+    const int32_t commonValue = _FindCommonValue(begin, numInts);
+
+    char *codesOut = _WriteBits(output, commonValue);
+    char *vintsOut = codesOut + (numInts * 2 + 7) / 8;
+
+    const __m128i common = _mm_set1_epi32(commonValue);
+    const __m128i smallMin = _mm_set1_epi32(-129);
+    const __m128i smallMax = _mm_set1_epi32(128);
+    const __m128i mediumMin = _mm_set1_epi32(-32769);
+    const __m128i mediumMax = _mm_set1_epi32(32768);
+    const __m128i large = _mm_set1_epi32(3);
+    __m128i prev = _mm_setzero_si128();
+
+    Int const *cur = begin;
+    size_t intsLeft = numInts;
+    while (intsLeft >= 4) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cur));
+
+        // Deltas: x - [prev[3], x[0], x[1], x[2]]
+        const __m128i d = _mm_sub_epi32(x, _mm_alignr_epi8(x, prev, 12));
+        prev = x;
+
+        // Code: Common = 0, Small = 1, Medium = 2, Large = 3
+        const __m128i isSmall = _mm_and_si128(_mm_cmpgt_epi32(d, smallMin),
+                                              _mm_cmplt_epi32(d, smallMax));
+        const __m128i isMedium = _mm_and_si128(_mm_cmpgt_epi32(d, mediumMin),
+                                               _mm_cmplt_epi32(d, mediumMax));
+        __m128i code = _mm_add_epi32(large, _mm_add_epi32(isSmall, isMedium));
+        code = _mm_andnot_si128(_mm_cmpeq_epi32(d, common), code);
+
+        // Gather 2-bit codes of each lane into a byte.
+        code = _mm_packus_epi16(_mm_packs_epi32(code, code), code);
+        const uint32_t c = static_cast<uint32_t>(_mm_cvtsi128_si32(code));
+        const uint8_t codeByte = static_cast<uint8_t>(
+            (c & 0x3) | ((c >> 6) & 0xc) | ((c >> 12) & 0x30) |
+            ((c >> 18) & 0xc0));
+
+        // NOTE: Storing 16 bytes does not exceed the output buffer, since the
+        // variable-length section has 4 bytes per integer at most.
+        const __m128i v = _mm_shuffle_epi8(
+            d, _mm_loadu_si128(reinterpret_cast<const __m128i *>(table.shuffle[codeByte])));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(vintsOut), v);
+
+        *codesOut++ = static_cast<char>(codeByte);
+        vintsOut += table.length[codeByte];
+        cur += 4;
+        intsLeft -= 4;
+    }
+
+    const int32_t prevVal = _mm_cvtsi128_si32(_mm_shuffle_epi32(prev, 0xff));
+
+    vintsOut = _EncodeIntegers32Tail(cur, intsLeft, commonValue, prevVal,
+                                     codesOut, vintsOut);
+
+    return size_t(vintsOut - output);
+}
+
+#endif // TINYUSDZ_INTCODING_SSSE3
+
+#if defined(TINYUSDZ_INTCODING_NEON)
+
+template <class Int>
+size_t _EncodeIntegers32NEON(Int const *begin, size_t numInts, char *output)
+{
+    const _EncodeTable32 &table = _GetEncodeTable32();
+
+    const int32_t commonValue = _FindCommonValue(begin, numInts);
+
+    char *codesOut = _WriteBits(output, commonValue);
+    char *vintsOut = codesOut + (numInts * 2 + 7) / 8;
+
+    static const int32_t kCodeShift[4] = {0, 2, 4, 6};
+
+    const int32x4_t common = vdupq_n_s32(commonValue);
+    const int32x4_t smallMin = vdupq_n_s32(-128);
+    const int32x4_t smallMax = vdupq_n_s32(127);
+    const int32x4_t mediumMin = vdupq_n_s32(-32768);
+    const int32x4_t mediumMax = vdupq_n_s32(32767);
+    const int32x4_t large = vdupq_n_s32(3);
+    const int32x4_t codeShift = vld1q_s32(kCodeShift);
+    int32x4_t prev = vdupq_n_s32(0);
+
+    Int const *cur = begin;
+    size_t intsLeft = numInts;
+    while (intsLeft >= 4) {
+        const int32x4_t x = vld1q_s32(reinterpret_cast<const int32_t *>(cur));
+
+        // Deltas: x - [prev[3], x[0], x[1], x[2]]
+        const int32x4_t d = vsubq_s32(x, vextq_s32(prev, x, 3));
+        prev = x;
+
+        // Code: Common = 0, Small = 1, Medium = 2, Large = 3
+        const uint32x4_t isSmall =
+            vandq_u32(vcgeq_s32(d, smallMin), vcleq_s32(d, smallMax));
+        const uint32x4_t isMedium =
+            vandq_u32(vcgeq_s32(d, mediumMin), vcleq_s32(d, mediumMax));
+        int32x4_t code = vaddq_s32(
+            large, vaddq_s32(vreinterpretq_s32_u32(isSmall),
+                             vreinterpretq_s32_u32(isMedium)));
+        code = vbicq_s32(code, vreinterpretq_s32_u32(vceqq_s32(d, common)));
+
+        // Gather 2-bit codes of each lane into a byte.
+        const uint8_t codeByte =
+            static_cast<uint8_t>(vaddvq_s32(vshlq_s32(code, codeShift)));
+
+        // NOTE: Storing 16 bytes does not exceed the output buffer, since the
+        // variable-length section has 4 bytes per integer at most.
+        const uint8x16_t v = vqtbl1q_u8(vreinterpretq_u8_s32(d),
+                                        vld1q_u8(table.shuffle[codeByte]));
+        vst1q_u8(reinterpret_cast<uint8_t *>(vintsOut), v);
+
+        *codesOut++ = static_cast<char>(codeByte);
+        vintsOut += table.length[codeByte];
+        cur += 4;
+        intsLeft -= 4;
+    }
+
+    const int32_t prevVal = vgetq_lane_s32(prev, 3);
+
+    vintsOut = _EncodeIntegers32Tail(cur, intsLeft, commonValue, prevVal,
+                                     codesOut, vintsOut);
+
+    return size_t(vintsOut - output);
+}
+
+#endif // TINYUSDZ_INTCODING_NEON
+
+// Encode 32-bit integers. `output` must have _GetEncodedBufferSize() bytes.
+// Returns the number of bytes written.
+template <class Int>
+size_t _EncodeIntegers32(Int const *begin, size_t numInts, char *output,
+                         bool allowSIMD)
+{
+    static_assert(sizeof(Int) == 4, "");
+
+    if (numInts == 0) {
+        return 0;
+    }
+
+#if defined(TINYUSDZ_INTCODING_SSSE3)
+    if (allowSIMD && _HasSSSE3()) {
+        return _EncodeIntegers32SSSE3(begin, numInts, output);
+    }
+#elif defined(TINYUSDZ_INTCODING_NEON)
+    if (allowSIMD) {
+        return _EncodeIntegers32NEON(begin, numInts, output);
+    }
+#else
+    (void)allowSIMD;
+#endif
+
+    return _EncodeIntegers(begin, numInts, output);
+}
+
+template <class Int>
+inline typename std::enable_if<sizeof(Int) == 4, size_t>::type
+_EncodeIntegersFast(Int const *begin, size_t numInts, char *output)
+{
+    return _EncodeIntegers32(begin, numInts, output, /* allowSIMD */true);
+}
+
+template <class Int>
+inline typename std::enable_if<sizeof(Int) == 8, size_t>::type
+_EncodeIntegersFast(Int const *begin, size_t numInts, char *output)
+{
+    return _EncodeIntegers(begin, numInts, output);
+}
+
 template <class Int>
 size_t
 _CompressIntegers(Int const *begin, size_t numInts, char *output, std::string *err)
@@ -382,7 +967,7 @@ _CompressIntegers(Int const *begin, size_t numInts, char *output, std::string *e
         encodeBuffer(new char[_GetEncodedBufferSize<Int>(numInts)]);
     
     // Encode first.
-    size_t encodedSize = _EncodeIntegers(begin, numInts, encodeBuffer.get());
+    size_t encodedSize = _EncodeIntegersFast(begin, numInts, encodeBuffer.get());
 
     // Then compress.
     return LZ4Compression::CompressToBuffer(
@@ -411,6 +996,36 @@ size_t _DecompressIntegers(char const *compressed, size_t compressedSize,
     return _DecodeIntegers(workingSpace, numInts, ints);
 }
 
+template <class Int>
+size_t _DecompressIntegers32(char const *compressed, size_t compressedSize,
+                             Int *ints, size_t numInts, std::string *err, char *workingSpace)
+{
+    // Working space.
+    size_t workingSpaceSize =
+        Usd_IntegerCompression::GetDecompressionWorkingSpaceSize(numInts);
+    std::unique_ptr<char[]> tmpSpace;
+    if (!workingSpace) {
+        tmpSpace.reset(new char[workingSpaceSize]);
+        workingSpace = tmpSpace.get();
+    }
+
+    size_t decompSz = LZ4Compression::DecompressFromBuffer(
+        compressed, workingSpace, compressedSize, workingSpaceSize, err);
+
+    if (decompSz == 0)
+        return 0;
+
+    size_t n = _DecodeIntegers32(workingSpace, decompSz, numInts, ints,
+                                 /* allowSIMD */true);
+    if ((n == 0) && (numInts > 0)) {
+        if (err) {
+            (*err) += "Corrupted integer-coded data.\n";
+        }
+    }
+
+    return n;
+}
+
 
 } // anon
 
@@ -449,8 +1064,8 @@ Usd_IntegerCompression::DecompressFromBuffer(
     char const *compressed, size_t compressedSize,
     int32_t *ints, size_t numInts, std::string *err, char *workingSpace)
 {
-    return _DecompressIntegers(compressed, compressedSize,
-                               ints, numInts, err, workingSpace);
+    return _DecompressIntegers32(compressed, compressedSize,
+                                 ints, numInts, err, workingSpace);
 }
 
 size_t
@@ -458,8 +1073,44 @@ Usd_IntegerCompression::DecompressFromBuffer(
     char const *compressed, size_t compressedSize,
     uint32_t *ints, size_t numInts, std::string *err, char *workingSpace)
 {
-    return _DecompressIntegers(compressed, compressedSize,
-                               ints, numInts, err, workingSpace);
+    return _DecompressIntegers32(compressed, compressedSize,
+                                 ints, numInts, err, workingSpace);
+}
+
+size_t
+Usd_IntegerCompression::DecodeFromBuffer(
+    char const *encoded, size_t encodedSize,
+    int32_t *ints, size_t numInts, bool allowSIMD)
+{
+    return _DecodeIntegers32(encoded, encodedSize, numInts, ints, allowSIMD);
+}
+
+size_t
+Usd_IntegerCompression::DecodeFromBuffer(
+    char const *encoded, size_t encodedSize,
+    uint32_t *ints, size_t numInts, bool allowSIMD)
+{
+    return _DecodeIntegers32(encoded, encodedSize, numInts, ints, allowSIMD);
+}
+
+size_t
+Usd_IntegerCompression::EncodeToBuffer(
+    int32_t const *ints, size_t numInts, char *encoded, bool allowSIMD)
+{
+    return _EncodeIntegers32(ints, numInts, encoded, allowSIMD);
+}
+
+size_t
+Usd_IntegerCompression::EncodeToBuffer(
+    uint32_t const *ints, size_t numInts, char *encoded, bool allowSIMD)
+{
+    return _EncodeIntegers32(ints, numInts, encoded, allowSIMD);
+}
+
+bool
+Usd_IntegerCompression::HasSIMDDecoder()
+{
+    return _HasSIMDDecoder32();
 }
 
 ////////////////////////////////////////////////////////////////////////
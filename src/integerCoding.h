@@ -29,6 +29,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 
 #define USD_API 
 //PXR_NAMESPACE_OPEN_SCOPE
@@ -84,6 +85,44 @@ public:
         char const *compressed, size_t compressedSize,
         uint32_t *ints, size_t numInts, std::string *err,
         char *workingSpace=nullptr);
+
+    // (TinyUSDZ extension)
+    // Decode \p numInts 32-bit integers into \p ints from \p encodedSize
+    // bytes of integer-coded(LZ4 decompressed) data \p encoded.  The SIMD
+    // decoder(SSSE3 or NEON) is used when \p allowSIMD is true and the
+    // running CPU supports it.  Return the number of decoded integers, or 0
+    // when \p encoded is corrupted.
+    USD_API
+    static size_t DecodeFromBuffer(
+        char const *encoded, size_t encodedSize,
+        int32_t *ints, size_t numInts, bool allowSIMD=true);
+
+    USD_API
+    static size_t DecodeFromBuffer(
+        char const *encoded, size_t encodedSize,
+        uint32_t *ints, size_t numInts, bool allowSIMD=true);
+
+    // (TinyUSDZ extension)
+    // Integer-code(without LZ4 compression) \p numInts 32-bit integers from
+    // \p ints to \p encoded.  The \p encoded space must point to at least
+    // GetDecompressionWorkingSpaceSize(numInts) bytes.  The SIMD encoder
+    // (SSSE3 or NEON) is used when \p allowSIMD is true and the running CPU
+    // supports it; its output is identical to the scalar encoder.  Return the
+    // number of bytes written to \p encoded.
+    USD_API
+    static size_t EncodeToBuffer(
+        int32_t const *ints, size_t numInts, char *encoded,
+        bool allowSIMD=true);
+
+    USD_API
+    static size_t EncodeToBuffer(
+        uint32_t const *ints, size_t numInts, char *encoded,
+        bool allowSIMD=true);
+
+    // (TinyUSDZ extension)
+    // Return true when the SIMD decoder is available on the running CPU.
+    USD_API
+    static bool HasSIMDDecoder();
 };
 
 class Usd_IntegerCompression64
@@ -721,8 +721,9 @@ bool ReadFileHeader(std::vector<uint8_t> *out, std::string *err,
 #endif
 }
 
-bool WriteWholeFile(const std::string &filepath, const unsigned char *contents,
-                    size_t content_bytes, std::string *err) {
+bool WriteFileStream(const std::string &filepath,
+                     const std::function<bool(std::ostream &)> &writer,
+                     std::string *err) {
 #ifdef _WIN32
 #if defined(__GLIBCXX__)  // mingw
   int file_descriptor = _wopen(UTF8ToWchar(filepath).c_str(),
@@ -745,8 +746,11 @@ bool WriteWholeFile(const std::string &filepath, const unsigned char *contents,
     return false;
   }
 
-  f.write(reinterpret_cast<const char *>(contents),
-          static_cast<std::streamsize>(content_bytes));
+  if (!writer(f)) {
+    return false;
+  }
+
+  f.flush();
   if (!f) {
     if (err) {
       (*err) += "File write error: " + filepath + "\n";
@@ -757,9 +761,22 @@ bool WriteWholeFile(const std::string &filepath, const unsigned char *contents,
   return true;
 }
 
-#ifdef _WIN32
-bool WriteWholeFile(const std::wstring &filepath, const unsigned char *contents,
+bool WriteWholeFile(const std::string &filepath, const unsigned char *contents,
                     size_t content_bytes, std::string *err) {
+  return WriteFileStream(
+      filepath,
+      [&](std::ostream &f) {
+        f.write(reinterpret_cast<const char *>(contents),
+                static_cast<std::streamsize>(content_bytes));
+        return true;
+      },
+      err);
+}
+
+#ifdef _WIN32
+bool WriteFileStream(const std::wstring &filepath,
+                     const std::function<bool(std::ostream &)> &writer,
+                     std::string *err) {
 #if defined(__GLIBCXX__)  // mingw
   int file_descriptor =
       _wopen(filepath.c_str(), _O_CREAT | _O_WRONLY | _O_TRUNC | _O_BINARY);
@@ -782,8 +799,11 @@ bool WriteWholeFile(const std::wstring &filepath, const unsigned char *contents,
     return false;
   }
 
-  f.write(reinterpret_cast<const char *>(contents),
-          static_cast<std::streamsize>(content_bytes));
+  if (!writer(f)) {
+    return false;
+  }
+
+  f.flush();
   if (!f) {
     if (err) {
       (*err) += "File write error: " + WcharToUTF8(filepath) + "\n";
@@ -793,6 +813,18 @@ bool WriteWholeFile(const std::wstring &filepath, const unsigned char *contents,
 
   return true;
 }
+
+bool WriteWholeFile(const std::wstring &filepath, const unsigned char *contents,
+                    size_t content_bytes, std::string *err) {
+  return WriteFileStream(
+      filepath,
+      [&](std::ostream &f) {
+        f.write(reinterpret_cast<const char *>(contents),
+                static_cast<std::streamsize>(content_bytes));
+        return true;
+      },
+      err);
+}
 #endif
 
 std::string GetBaseDir(const std::string &filepath) {
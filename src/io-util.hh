@@ -10,6 +10,8 @@
 #include <algorithm>
 #include <map>
 #include <cstdint>
+#include <functional>
+#include <iosfwd>
 
 #ifdef TINYUSDZ_ANDROID_LOAD_FROM_ASSETS
 #include <android/asset_manager.h>
@@ -172,6 +174,22 @@ bool WriteWholeFile(const std::wstring &filepath,
                     const unsigned char *contents, size_t content_bytes, std::string *err);
 #endif
 
+///
+/// Write data to file(UTF8 filepath) through std::ostream.
+/// `writer` is called with the opened file stream, so the contents can be
+/// written piece by piece without building the whole file in memory.
+/// `writer` returns false to abort writing(`err` should be set by `writer`).
+///
+bool WriteFileStream(const std::string &filepath,
+                     const std::function<bool(std::ostream &)> &writer,
+                     std::string *err);
+
+#ifdef _WIN32
+bool WriteFileStream(const std::wstring &filepath,
+                     const std::function<bool(std::ostream &)> &writer,
+                     std::string *err);
+#endif
+
 std::string GetBaseDir(const std::string &filepath);
 std::string GetBaseFilename(const std::string &filepath);
 std::string GetFileExtension(const std::string &filepath);
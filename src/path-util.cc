@@ -208,28 +208,32 @@ bool ValidatePrimPath(const Path &path, std::string *err) {
 }
 
 bool ValidatePropPath(const Path &path, std::string *err) {
-  if (path.prop_part() == ":") {
+  return ValidatePropName(path.prop_part(), err);
+}
+
+bool ValidatePropName(const std::string &prop_name, std::string *err) {
+  if (prop_name == ":") {
     if (err) {
       (*err) = "Proparty path is composed of namespace delimiter only(`:`).";
     }
     return false;
   }
 
-  if (startsWith(path.prop_part(), ":")) {
+  if (startsWith(prop_name, ":")) {
     if (err) {
       (*err) = "Property path starts with namespace delimiter(`:`).";
     }
     return false;
   }
 
-  if (endsWith(path.prop_part(), ":")) {
+  if (endsWith(prop_name, ":")) {
     if (err) {
       (*err) = "Property path ends with namespace delimiter(`:`).";
     }
     return false;
   }
 
-  if (contains_str(path.prop_part(), "::")) {
+  if (contains_str(prop_name, "::")) {
     if (err) {
       (*err) = "Empty path among namespace delimiters(`::`) in Property path.";
     }
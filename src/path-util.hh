@@ -24,6 +24,12 @@ bool ValidatePrimPath(const Path &path, std::string *err);
 ///
 bool ValidatePropPath(const Path &path, std::string *err);
 
+///
+/// Validate Property name(e.g. `primvars:st`). Same as ValidatePropPath(), but
+/// does not construct a Path.
+///
+bool ValidatePropName(const std::string &prop_name, std::string *err);
+
 ///
 ///
 /// Construct Path from a string.
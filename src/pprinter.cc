@@ -7,6 +7,8 @@
 //
 #include "pprinter.hh"
 
+#include <cmath>
+
 #include "prim-pprint.hh"
 #include "prim-types.hh"
 #include "str-util.hh"
@@ -41,6 +43,20 @@
 #pragma clang diagnostic pop
 #endif
 
+// Use std::thread to print Prim subtrees in parallel(prim::print_prims).
+#if defined(__wasi__)
+// no threading
+#elif defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+// no threading
+#else
+#define TINYUSDZ_PPRINT_USE_THREAD
+#endif
+
+#if defined(TINYUSDZ_PPRINT_USE_THREAD)
+#include <atomic>
+#include <thread>
+#endif
+
 // TODO:
 // - [ ] Print properties based on lexcographically(USDA)
 // - [ ] Refactor variantSet stmt print.
@@ -69,6 +85,13 @@ inline std::string dtos(const float v) {
 #endif
 
 inline std::string dtos(const double v) {
+  // dtoa_milo does not handle non-finite values.
+  if (std::isnan(v)) {
+    return "nan";
+  } else if (std::isinf(v)) {
+    return (v < 0.0) ? "-inf" : "inf";
+  }
+
   char buf[128];
   dtoa_milo(v, buf);
 
@@ -1291,10 +1314,10 @@ std::string print_timesamples(const value::TimeSamples &v,
 
   ss << "{\n";
 
-  for (size_t i = 0; i < v.size(); i++) {
+  // NOTE: get_samples() is empty when failed to decode deferred samples.
+  for (const auto &sample : v.get_samples()) {
     ss << pprint::Indent(indent + 1);
-    ss << v.get_samples()[i].t << ": "
-       << value::pprint_value(v.get_samples()[i].value);
+    ss << sample.t << ": " << value::pprint_value(sample.value);
     ss << ",\n";  // USDA allow ',' for the last item
   }
   ss << pprint::Indent(indent) << "}\n";
@@ -1383,7 +1406,13 @@ std::string print_prop(const Property &prop, const std::string &prop_name,
           ss << "None";
         } else {
           // default value
-          ss << value::pprint_value(attr.get_var().value_raw());
+          const primvar::PrimVar &var = attr.get_var();
+          if (var.is_borrowed_array()) {
+            ss << value::pprint_value(var.get_default_raw());
+          } else {
+            // Avoid copying the value.
+            ss << value::pprint_value(var.value_raw());
+          }
         }
       }
 
@@ -4656,7 +4685,13 @@ std::string print_layer(const Layer &layer, const uint32_t indent) {
 // prim-pprint.hh
 namespace prim {
 
-std::string print_prim(const Prim &prim, const uint32_t indent) {
+namespace {
+
+// Print Prim up to(not including) child Prims: Prim header, properties and
+// VariantSets. `require_newline` is set when a blank line is required before
+// child Prims.
+std::string print_prim_head(const Prim &prim, const uint32_t indent,
+                            bool *require_newline) {
   std::stringstream ss;
 
   // Currently, Prim's elementName is read from name variable in concrete Prim
@@ -4664,14 +4699,14 @@ std::string print_prim(const Prim &prim, const uint32_t indent) {
   // TODO: use prim.elementPath for elementName.
   std::string s = pprint_value(prim.data(), indent, /* closing_brace */ false);
 
-  bool require_newline = true;
+  (*require_newline) = true;
 
   // Check last 2 chars.
   // if it ends with '{\n', no properties are authored so do not emit blank line
   // before printing VariantSet or child Prims.
   if (s.size() > 2) {
     if ((s[s.size() - 2] == '{') && (s[s.size() - 1] == '\n')) {
-      require_newline = false;
+      (*require_newline) = false;
     }
   }
 
@@ -4681,13 +4716,13 @@ std::string print_prim(const Prim &prim, const uint32_t indent) {
   // print variant
   //
   if (prim.variantSets().size()) {
-    if (require_newline) {
+    if (*require_newline) {
       ss << "\n";
     }
 
     // need to add blank line after VariantSet stmt and before child Prims,
     // so set require_newline true
-    require_newline = true;
+    (*require_newline) = true;
 
     for (const auto &variantSet : prim.variantSets()) {
       ss << pprint::Indent(indent + 1) << "variantSet "
@@ -4747,51 +4782,296 @@ std::string print_prim(const Prim &prim, const uint32_t indent) {
     }
   }
 
+  return ss.str();
+}
+
+// Child Prims in print order. nullptr for the name in `primChildren` which
+// does not exist in children.
+std::vector<const Prim *> get_child_prims(const Prim &prim) {
+  std::vector<const Prim *> children;
+
+  if (prim.metas().primChildren.size() == prim.children().size()) {
+    // Use primChildren info to determine the order of the traversal.
+
+    std::map<std::string, const Prim *> primNameTable;
+    for (size_t i = 0; i < prim.children().size(); i++) {
+      primNameTable.emplace(prim.children()[i].element_name(),
+                            &prim.children()[i]);
+    }
+
+    for (size_t i = 0; i < prim.metas().primChildren.size(); i++) {
+      value::token nameTok = prim.metas().primChildren[i];
+      DCOUT(fmt::format("primChildren  {}/{} = {}", i,
+                        prim.metas().primChildren.size(), nameTok.str()));
+      const auto it = primNameTable.find(nameTok.str());
+      if (it != primNameTable.end()) {
+        children.push_back(it->second);
+      } else {
+        // TODO: Report warning?
+        children.push_back(nullptr);
+      }
+    }
+
+  } else {
+    for (size_t i = 0; i < prim.children().size(); i++) {
+      children.push_back(&prim.children()[i]);
+    }
+  }
+
+  return children;
+}
+
+}  // namespace
+
+std::string print_prim(const Prim &prim, const uint32_t indent) {
+  std::stringstream ss;
+
+  bool require_newline = true;
+  ss << print_prim_head(prim, indent, &require_newline);
+
   //
   // primChildren
   //
   if (prim.children().size()) {
     if (require_newline) {
       ss << "\n";
-      require_newline = false;
     }
-    if (prim.metas().primChildren.size() == prim.children().size()) {
-      // Use primChildren info to determine the order of the traversal.
 
-      std::map<std::string, const Prim *> primNameTable;
-      for (size_t i = 0; i < prim.children().size(); i++) {
-        primNameTable.emplace(prim.children()[i].element_name(),
-                              &prim.children()[i]);
+    std::vector<const Prim *> children = get_child_prims(prim);
+    for (size_t i = 0; i < children.size(); i++) {
+      if (i > 0) {
+        ss << "\n";
+      }
+      if (children[i]) {
+        ss << print_prim(*children[i], indent + 1);
       }
+    }
+  }
 
-      for (size_t i = 0; i < prim.metas().primChildren.size(); i++) {
-        if (i > 0) {
-          ss << "\n";
+  ss << pprint::Indent(indent) << "}\n";
+
+  return ss.str();
+}
+
+namespace {
+
+// A piece of the output of print_prims(): `prim` subtree(printed in
+// parallel) or literal string when `prim` is nullptr.
+struct PrimPrintTask {
+  const Prim *prim{nullptr};
+  uint32_t indent{0};
+  std::string str;
+};
+
+void AddPrimPrintTask(const Prim *prim, const uint32_t indent,
+                      std::vector<PrimPrintTask> *tasks) {
+  PrimPrintTask task;
+  task.prim = prim;
+  task.indent = indent;
+  tasks->emplace_back(std::move(task));
+}
+
+void AddPrimPrintTask(std::string &&str, std::vector<PrimPrintTask> *tasks) {
+  if (str.empty()) {
+    return;
+  }
+
+  if (tasks->size() && !tasks->back().prim) {
+    tasks->back().str += str;
+    return;
+  }
+
+  PrimPrintTask task;
+  task.str = std::move(str);
+  tasks->emplace_back(std::move(task));
+}
+
+// Split the task of printing `prim` into the tasks of printing its child
+// Prims. Same output as print_prim().
+void ExpandPrimPrintTask(const Prim &prim, const uint32_t indent,
+                         std::vector<PrimPrintTask> *tasks) {
+  bool require_newline = true;
+  std::string s = print_prim_head(prim, indent, &require_newline);
+  if (require_newline) {
+    s += "\n";
+  }
+  AddPrimPrintTask(std::move(s), tasks);
+
+  std::vector<const Prim *> children = get_child_prims(prim);
+  for (size_t i = 0; i < children.size(); i++) {
+    if (i > 0) {
+      AddPrimPrintTask("\n", tasks);
+    }
+    if (children[i]) {
+      AddPrimPrintTask(children[i], indent + 1, tasks);
+    }
+  }
+
+  AddPrimPrintTask(pprint::Indent(indent) + "}\n", tasks);
+}
+
+// Resolve `num_threads`(-1 = hardware concurrency) to [1, 1024].
+int ResolvePrintThreads(int num_threads) {
+#if defined(TINYUSDZ_PPRINT_USE_THREAD)
+  if (num_threads == -1) {
+    num_threads = (std::max)(1, int(std::thread::hardware_concurrency()));
+  }
+  // Limit to 1024 threads.
+  return (std::max)(1, (std::min)(1024, num_threads));
+#else
+  (void)num_threads;
+  return 1;
+#endif
+}
+
+// Build the print tasks of `prims`. Prim tasks are not printed yet(empty
+// `str`).
+std::vector<PrimPrintTask> BuildPrimPrintTasks(
+    const std::vector<const Prim *> &prims, const uint32_t indent,
+    const int num_threads) {
+  std::vector<PrimPrintTask> tasks;
+  for (size_t i = 0; i < prims.size(); i++) {
+    if (i > 0) {
+      AddPrimPrintTask("\n", &tasks);
+    }
+    AddPrimPrintTask(prims[i], indent, &tasks);
+  }
+
+  if (num_threads > 1) {
+    // Descend into the Prim tree(e.g. single `/World` root Prim) until there
+    // are enough subtrees to balance the load among threads.
+    const size_t kTasksPerThread = 8;
+    const uint32_t kMaxExpandDepth = 8;
+    const size_t min_tasks = size_t(num_threads) * kTasksPerThread;
+
+    for (uint32_t depth = 0; depth < kMaxExpandDepth; depth++) {
+      size_t num_prim_tasks = 0;
+      bool expandable = false;
+      for (const auto &task : tasks) {
+        if (task.prim) {
+          num_prim_tasks++;
+          expandable |= (task.prim->children().size() > 0);
         }
-        value::token nameTok = prim.metas().primChildren[i];
-        DCOUT(fmt::format("primChildren  {}/{} = {}", i,
-                          prim.metas().primChildren.size(), nameTok.str()));
-        const auto it = primNameTable.find(nameTok.str());
-        if (it != primNameTable.end()) {
-          ss << print_prim(*(it->second), indent + 1);
+      }
+
+      if ((num_prim_tasks >= min_tasks) || !expandable) {
+        break;
+      }
+
+      std::vector<PrimPrintTask> expanded;
+      for (auto &task : tasks) {
+        if (task.prim && task.prim->children().size()) {
+          ExpandPrimPrintTask(*task.prim, task.indent, &expanded);
+        } else if (task.prim) {
+          AddPrimPrintTask(task.prim, task.indent, &expanded);
         } else {
-          // TODO: Report warning?
+          AddPrimPrintTask(std::move(task.str), &expanded);
         }
       }
+      tasks = std::move(expanded);
+    }
+  }
 
-    } else {
-      for (size_t i = 0; i < prim.children().size(); i++) {
-        if (i > 0) {
-          ss << "\n";
-        }
-        ss << print_prim(prim.children()[i], indent + 1);
+  return tasks;
+}
+
+// Print Prim tasks in `tasks[begin, end)`, in parallel when `num_threads` > 1.
+void PrintPrimTasks(std::vector<PrimPrintTask> *tasks, const size_t begin,
+                    const size_t end, const int num_threads) {
+  std::vector<size_t> prim_task_indices;
+  for (size_t i = begin; i < end; i++) {
+    if ((*tasks)[i].prim) {
+      prim_task_indices.push_back(i);
+    }
+  }
+
+#if defined(TINYUSDZ_PPRINT_USE_THREAD)
+  const size_t nthreads =
+      (std::min)(size_t(num_threads), prim_task_indices.size());
+  if (nthreads > 1) {
+    std::atomic<size_t> counter(0);
+
+    auto PrintPrims = [&]() {
+      size_t i = 0;
+      while ((i = counter++) < prim_task_indices.size()) {
+        PrimPrintTask &task = (*tasks)[prim_task_indices[i]];
+        task.str = print_prim(*task.prim, task.indent);
       }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(nthreads);
+    for (size_t t = 0; t < nthreads; t++) {
+      threads.emplace_back(PrintPrims);
+    }
+
+    for (auto &th : threads) {
+      th.join();
     }
+    return;
+  }
+#else
+  (void)num_threads;
+#endif
+
+  for (size_t i : prim_task_indices) {
+    PrimPrintTask &task = (*tasks)[i];
+    task.str = print_prim(*task.prim, task.indent);
   }
+}
 
-  ss << pprint::Indent(indent) << "}\n";
+}  // namespace
 
-  return ss.str();
+std::string print_prims(const std::vector<const Prim *> &prims,
+                        const uint32_t indent, int num_threads) {
+  num_threads = ResolvePrintThreads(num_threads);
+  std::vector<PrimPrintTask> tasks =
+      BuildPrimPrintTasks(prims, indent, num_threads);
+  PrintPrimTasks(&tasks, 0, tasks.size(), num_threads);
+
+  size_t total = 0;
+  for (const auto &task : tasks) {
+    total += task.str.size();
+  }
+
+  std::string s;
+  s.reserve(total);
+  for (const auto &task : tasks) {
+    s += task.str;
+  }
+
+  return s;
+}
+
+void print_prims(std::ostream &os, const std::vector<const Prim *> &prims,
+                 const uint32_t indent, int num_threads) {
+  num_threads = ResolvePrintThreads(num_threads);
+  std::vector<PrimPrintTask> tasks =
+      BuildPrimPrintTasks(prims, indent, num_threads);
+
+  // Print `num_threads` Prim subtrees at a time, then write and release them
+  // before printing the next batch, so that at most one batch of the output
+  // is held in memory.
+  size_t begin = 0;
+  while (begin < tasks.size()) {
+    size_t end = begin;
+    size_t num_prim_tasks = 0;
+    while ((end < tasks.size()) && (num_prim_tasks < size_t(num_threads))) {
+      if (tasks[end].prim) {
+        num_prim_tasks++;
+      }
+      end++;
+    }
+
+    PrintPrimTasks(&tasks, begin, end, num_threads);
+
+    for (size_t i = begin; i < end; i++) {
+      os << tasks[i].str;
+      std::string().swap(tasks[i].str);
+    }
+
+    begin = end;
+  }
 }
 
 std::string print_primspec(const PrimSpec &primspec, const uint32_t indent) {
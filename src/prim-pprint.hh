@@ -4,8 +4,10 @@
  
 #pragma once
 
+#include <iosfwd>
 #include <string>
 #include <cstdint>
+#include <vector>
 
 #include "prim-types.hh"
 
@@ -20,6 +22,22 @@ std::string print_payload(const PayloadList &payload, const uint32_t indent);
 std::string print_layeroffset(const LayerOffset &layeroffset, const uint32_t indent);
 
 std::string print_prim(const Prim &prim, const uint32_t indent=0);
+
+///
+/// Print Prims(separated by a blank line). Same output as calling print_prim()
+/// for each Prim, but Prim subtrees are printed in parallel.
+///
+/// @param[in] num_threads # of threads. -1 = use all cores. 1 = no threading.
+///
+std::string print_prims(const std::vector<const Prim *> &prims, const uint32_t indent=0, int num_threads=-1);
+
+///
+/// Write Prims to the stream. Same output as print_prims(), but the output is
+/// written piece by piece instead of being concatenated into one string.
+/// Prim subtrees are printed in batches of `num_threads` and each batch is
+/// written and released before the next one.
+///
+void print_prims(std::ostream &os, const std::vector<const Prim *> &prims, const uint32_t indent=0, int num_threads=-1);
 std::string print_primspec(const PrimSpec &primspec, const uint32_t indent=0);
 
 } // namespace prim
@@ -23,8 +23,8 @@
 #include "value-types.hh"
 
 // For PUSH_ERROR_AND_RETURN
-#define PushError(s) if (err) { (*err) = s + (*err); }
-#define PushWarn(s) if (warn) { (*warn) = s + (*err); }
+#define PushError(s) do { if (err) { (*err) = s + (*err); } } while (0)
+#define PushWarn(s) do { if (warn) { (*warn) = s + (*warn); } } while (0)
 
 // __VA_ARGS__ does not allow empty, thus # of args must be 2+
 #define PUSH_WARN_F(s, ...) PUSH_WARN(fmt::format(s, __VA_ARGS__))
@@ -59,6 +59,29 @@ constexpr auto kSkelBlendShapes = "skel:blendShapes";
 constexpr auto kSkelBlendShapeTargets = "skel:blendShapeTargets";
 constexpr auto kInputsVarname = "inputs:varname";
 
+///
+/// Hash of the property name for the per-schema dispatch of properties.
+/// Each schema `switch`es on the hash with `case PropNameHash("points"):`
+/// labels, so the property is compared against one candidate name only,
+/// instead of running the whole chain of PARSE_*** macros. Hash collision
+/// among the names of a schema is a compile error(duplicated case value).
+/// The PARSE_*** macro compares the name, so a colliding custom property
+/// name falls through to ADD_PROPERTY.
+///
+constexpr uint32_t PropNameHash(const char *s, uint32_t h = 2166136261u) {
+  // FNV-1a. Recursive to be constexpr in C++11 compilers.
+  return (*s == '\0') ? h
+                      : PropNameHash(s + 1, (h ^ uint32_t(uint8_t(*s))) * 16777619u);
+}
+
+inline uint32_t PropNameHash(const std::string &s) {
+  uint32_t h = 2166136261u;
+  for (const char c : s) {
+    h = (h ^ uint32_t(uint8_t(c))) * 16777619u;
+  }
+  return h;
+}
+
 ///
 /// TinyUSDZ reconstruct some frequently used shaders(e.g. UsdPreviewSurface)
 /// here, not in Tydra
@@ -126,7 +149,12 @@ static nonstd::optional<Animatable<T>> ConvertToAnimatable(const primvar::PrimVa
 
   bool ok = false;
 
-  if (var.has_value()) {
+  if (var.is_deferred_value() &&
+      dst.set_deferred_default(var.deferred_value())) {
+    // Keep the value deferred(e.g. array value in USDC). The value is decoded
+    // when it is evaluated.
+    ok = true;
+  } else if (var.has_value()) {
 
     if (auto pv = var.get_value<T>()) {
       dst.set_default(pv.value());
@@ -136,9 +164,26 @@ static nonstd::optional<Animatable<T>> ConvertToAnimatable(const primvar::PrimVa
     }
   }
 
-  if (var.has_timesamples()) {
-    for (size_t i = 0; i < var.ts_raw().size(); i++) {
-      const value::TimeSamples::Sample &s = var.ts_raw().get_samples()[i];
+  if (var.has_timesamples() && var.ts_raw().is_deferred()) {
+    // Keep samples deferred(e.g. TimeSamples in USDC). Sample values are
+    // decoded when they are evaluated.
+    TypedTimeSamples<T> ts;
+    if (!ts.set_deferred(var.ts_raw())) {
+      DCOUT("Failed to decode the first sample or type mismatch. expected " << value::TypeTraits<T>::type_name() << ", but got " << var.ts_raw().type_name());
+      return nonstd::nullopt;
+    }
+    dst.set_timesamples(std::move(ts));
+
+    ok = true;
+  } else if (var.has_timesamples()) {
+    const std::vector<value::TimeSamples::Sample> &samples = var.ts_raw().get_samples();
+    if (samples.size() != var.ts_raw().size()) {
+      DCOUT("Failed to decode TimeSamples.");
+      return nonstd::nullopt;
+    }
+
+    for (size_t i = 0; i < samples.size(); i++) {
+      const value::TimeSamples::Sample &s = samples[i];
 
       // Attribute Block?
       if (s.blocked || s.value.is_none()) {
@@ -196,8 +241,14 @@ nonstd::optional<Animatable<Extent>> ConvertToAnimatable(const primvar::PrimVar
   }
 
   if (var.has_timesamples()) {
-    for (size_t i = 0; i < var.ts_raw().size(); i++) {
-      const value::TimeSamples::Sample &s = var.ts_raw().get_samples()[i];
+    const std::vector<value::TimeSamples::Sample> &samples = var.ts_raw().get_samples();
+    if (samples.size() != var.ts_raw().size()) {
+      DCOUT("Failed to decode TimeSamples.");
+      return nonstd::nullopt;
+    }
+
+    for (size_t i = 0; i < samples.size(); i++) {
+      const value::TimeSamples::Sample &s = samples[i];
 
       // Attribute Block?
       if (s.blocked || s.value.is_none()) {
@@ -327,8 +378,8 @@ static bool ConvertStringDataAttributeToStringAttribute(
 
 // For animatable attribute(`varying`)
 template<typename T>
-static ParseResult ParseTypedAttribute(std::set<std::string> &table, /* inout */
-  const std::string prop_name,
+static ParseResult ParseTypedAttribute(PropertyNameTable &table, /* inout */
+  const std::string &prop_name,
   const Property &prop,
   const std::string &name,
   TypedAttributeWithFallback<Animatable<T>> &target)
@@ -500,8 +551,8 @@ static ParseResult ParseTypedAttribute(std::set<std::string> &table, /* inout */
 
 // For 'uniform' attribute
 template<typename T>
-static ParseResult ParseTypedAttribute(std::set<std::string> &table, /* inout */
-  const std::string prop_name,
+static ParseResult ParseTypedAttribute(PropertyNameTable &table, /* inout */
+  const std::string &prop_name,
   const Property &prop,
   const std::string &name,
   TypedAttributeWithFallback<T> &target) /* out */
@@ -623,8 +674,8 @@ static ParseResult ParseTypedAttribute(std::set<std::string> &table, /* inout */
 
 // For animatable attribute(`varying`)
 template<typename T>
-static ParseResult ParseTypedAttribute(std::set<std::string> &table, /* inout */
-  const std::string prop_name,
+static ParseResult ParseTypedAttribute(PropertyNameTable &table, /* inout */
+  const std::string &prop_name,
   const Property &prop,
   const std::string &name,
   TypedAttribute<Animatable<T>> &target) /* out */
@@ -757,8 +808,8 @@ static ParseResult ParseTypedAttribute(std::set<std::string> &table, /* inout */
 
 // TODO: Unify code with TypedAttribute<Animatable<T>> variant
 template<typename T>
-static ParseResult ParseTypedAttribute(std::set<std::string> &table, /* inout */
-  const std::string prop_name,
+static ParseResult ParseTypedAttribute(PropertyNameTable &table, /* inout */
+  const std::string &prop_name,
   const Property &prop,
   const std::string &name,
   TypedAttribute<T> &target) /* out */
@@ -888,8 +939,8 @@ static ParseResult ParseTypedAttribute(std::set<std::string> &table, /* inout */
 
 // Special case for Extent(float3[2]) type.
 // TODO: Reuse code of ParseTypedAttribute as much as possible
-static ParseResult ParseExtentAttribute(std::set<std::string> &table, /* inout */
-  const std::string prop_name,
+static ParseResult ParseExtentAttribute(PropertyNameTable &table, /* inout */
+  const std::string &prop_name,
   const Property &prop,
   const std::string &name,
   TypedAttribute<Animatable<Extent>> &target) /* out */
@@ -1093,8 +1144,8 @@ static nonstd::expected<bool, std::string> CheckAllowedTokens(
 // Allowed syntax:
 //   "T varname"
 template<typename T>
-static ParseResult ParseShaderOutputTerminalAttribute(std::set<std::string> &table, /* inout */
-  const std::string prop_name,
+static ParseResult ParseShaderOutputTerminalAttribute(PropertyNameTable &table, /* inout */
+  const std::string &prop_name,
   const Property &prop,
   const std::string &name,
   TypedTerminalAttribute<T> &target) /* out */
@@ -1204,8 +1255,8 @@ static ParseResult ParseShaderOutputTerminalAttribute(std::set<std::string> &tab
 // Allowed syntax:
 //   "token outputs:surface"
 //   "token outputs:surface.connect = </path/to/conn/>"
-static ParseResult ParseShaderOutputProperty(std::set<std::string> &table, /* inout */
-  const std::string prop_name,
+static ParseResult ParseShaderOutputProperty(PropertyNameTable &table, /* inout */
+  const std::string &prop_name,
   const Property &prop,
   const std::string &name,
   nonstd::optional<Relationship> &target) /* out */
@@ -1300,8 +1351,8 @@ static ParseResult ParseShaderOutputProperty(std::set<std::string> &table, /* in
 
 // Allowed syntax:
 //   "token outputs:surface.connect = </path/to/conn/>"
-static ParseResult ParseShaderInputConnectionProperty(std::set<std::string> &table, /* inout */
-  const std::string prop_name,
+static ParseResult ParseShaderInputConnectionProperty(PropertyNameTable &table, /* inout */
+  const std::string &prop_name,
   const Property &prop,
   const std::string &name,
   TypedConnection<value::token> &target) /* out */
@@ -1372,7 +1423,7 @@ static ParseResult ParseShaderInputConnectionProperty(std::set<std::string> &tab
 }
 
 // Rel with single targetPath(or empty)
-#define PARSE_SINGLE_TARGET_PATH_RELATION(__table, __prop, __propname, __target) \
+#define PARSE_SINGLE_TARGET_PATH_RELATION(__table, __prop, __propname, __target) { \
   if (prop.first == __propname) { \
     if (__table.count(__propname)) { \
        continue; \
@@ -1406,10 +1457,11 @@ static ParseResult ParseShaderInputConnectionProperty(std::set<std::string> &tab
     } else { \
       PUSH_ERROR_AND_RETURN(fmt::format("Internal error. Property `{}` is not a valid Relationship.", __propname)); \
     } \
-  }
+  } \
+}
 
 // Rel with targetPaths(single path or array of Paths)
-#define PARSE_TARGET_PATHS_RELATION(__table, __prop, __propname, __target) \
+#define PARSE_TARGET_PATHS_RELATION(__table, __prop, __propname, __target) { \
   if (prop.first == __propname) { \
     if (__table.count(__propname)) { \
        continue; \
@@ -1422,18 +1474,21 @@ static ParseResult ParseShaderInputConnectionProperty(std::set<std::string> &tab
     table.insert(prop.first); \
     DCOUT("Added rel " << __propname); \
     continue; \
-  }
+  } \
+}
 
 
 #define PARSE_SHADER_TERMINAL_ATTRIBUTE(__table, __prop, __name, __klass, __target) { \
-  ParseResult ret = ParseShaderOutputTerminalAttribute(__table, __prop.first, __prop.second, __name, __target); \
-  if (ret.code == ParseResult::ResultCode::Success || ret.code == ParseResult::ResultCode::AlreadyProcessed) { \
-    DCOUT("Added shader terminal attribute: " << __name); \
-    continue; /* got it */\
-  } else if (ret.code == ParseResult::ResultCode::Unmatched) { \
-    /* go next */ \
-  } else { \
-    PUSH_ERROR_AND_RETURN(fmt::format("Parsing shader output property `{}` failed. Error: {}", __name, ret.err)); \
+  if (__prop.first == __name) { \
+    ParseResult ret = ParseShaderOutputTerminalAttribute(__table, __prop.first, __prop.second, __name, __target); \
+    if (ret.code == ParseResult::ResultCode::Success || ret.code == ParseResult::ResultCode::AlreadyProcessed) { \
+      DCOUT("Added shader terminal attribute: " << __name); \
+      continue; /* got it */\
+    } else if (ret.code == ParseResult::ResultCode::Unmatched) { \
+      /* go next */ \
+    } else { \
+      PUSH_ERROR_AND_RETURN(fmt::format("Parsing shader output property `{}` failed. Error: {}", __name, ret.err)); \
+    } \
   } \
 }
 
@@ -1452,14 +1507,16 @@ static ParseResult ParseShaderInputConnectionProperty(std::set<std::string> &tab
 #endif
 
 #define PARSE_SHADER_INPUT_CONNECTION_PROPERTY(__table, __prop, __name, __klass, __target) { \
-  ParseResult ret = ParseShaderInputConnectionProperty(__table, __prop.first, __prop.second, __name, __target); \
-  if (ret.code == ParseResult::ResultCode::Success || ret.code == ParseResult::ResultCode::AlreadyProcessed) { \
-    DCOUT("Added shader input connection: " << __name); \
-    continue; /* got it */\
-  } else if (ret.code == ParseResult::ResultCode::Unmatched) { \
-    /* go next */ \
-  } else { \
-    PUSH_ERROR_AND_RETURN(fmt::format("Parsing shader property `{}` failed. Error: {}", __name, ret.err)); \
+  if (__prop.first == __name) { \
+    ParseResult ret = ParseShaderInputConnectionProperty(__table, __prop.first, __prop.second, __name, __target); \
+    if (ret.code == ParseResult::ResultCode::Success || ret.code == ParseResult::ResultCode::AlreadyProcessed) { \
+      DCOUT("Added shader input connection: " << __name); \
+      continue; /* got it */\
+    } else if (ret.code == ParseResult::ResultCode::Unmatched) { \
+      /* go next */ \
+    } else { \
+      PUSH_ERROR_AND_RETURN(fmt::format("Parsing shader property `{}` failed. Error: {}", __name, ret.err)); \
+    } \
   } \
 }
 
@@ -1510,36 +1567,46 @@ nonstd::expected<T, std::string> EnumHandler(
 
 } // namespace
 
+// NOTE: Compare the name first, so that unmatched properties(the majority in
+// the chain of PARSE_*** macros) do not construct `std::string` arguments.
+// PARSE_*** macros are enclosed in braces(not `do { } while (0)`) since they
+// `continue` the loop over properties.
 #define PARSE_TYPED_ATTRIBUTE(__table, __prop, __name, __klass, __target) { \
-  ParseResult ret = ParseTypedAttribute(__table, __prop.first, __prop.second, __name, __target); \
-  if (ret.code == ParseResult::ResultCode::Success || ret.code == ParseResult::ResultCode::AlreadyProcessed) { \
-    continue; /* got it */\
-  } else if (ret.code == ParseResult::ResultCode::Unmatched) { \
-    /* go next */ \
-  } else { \
-    PUSH_ERROR_AND_RETURN(fmt::format("Parsing attribute `{}` failed. Error: {}", __name, ret.err)); \
+  if (__prop.first == __name) { \
+    ParseResult ret = ParseTypedAttribute(__table, __prop.first, __prop.second, __name, __target); \
+    if (ret.code == ParseResult::ResultCode::Success || ret.code == ParseResult::ResultCode::AlreadyProcessed) { \
+      continue; /* got it */\
+    } else if (ret.code == ParseResult::ResultCode::Unmatched) { \
+      /* go next */ \
+    } else { \
+      PUSH_ERROR_AND_RETURN(fmt::format("Parsing attribute `{}` failed. Error: {}", __name, ret.err)); \
+    } \
   } \
 }
 
 #define PARSE_TYPED_ATTRIBUTE_NOCONTINUE(__table, __prop, __name, __klass, __target) { \
-  ParseResult ret = ParseTypedAttribute(__table, __prop.first, __prop.second, __name, __target); \
-  if (ret.code == ParseResult::ResultCode::Success || ret.code == ParseResult::ResultCode::AlreadyProcessed) { \
-    /* do nothing */ \
-  } else if (ret.code == ParseResult::ResultCode::Unmatched) { \
-    /* go next */ \
-  } else { \
-    PUSH_ERROR_AND_RETURN(fmt::format("Parsing attribute `{}` failed. Error: {}", __name, ret.err)); \
+  if (__prop.first == __name) { \
+    ParseResult ret = ParseTypedAttribute(__table, __prop.first, __prop.second, __name, __target); \
+    if (ret.code == ParseResult::ResultCode::Success || ret.code == ParseResult::ResultCode::AlreadyProcessed) { \
+      /* do nothing */ \
+    } else if (ret.code == ParseResult::ResultCode::Unmatched) { \
+      /* go next */ \
+    } else { \
+      PUSH_ERROR_AND_RETURN(fmt::format("Parsing attribute `{}` failed. Error: {}", __name, ret.err)); \
+    } \
   } \
 }
 
 #define PARSE_EXTENT_ATTRIBUTE(__table, __prop, __name, __klass, __target) { \
-  ParseResult ret = ParseExtentAttribute(__table, __prop.first, __prop.second, __name, __target); \
-  if (ret.code == ParseResult::ResultCode::Success || ret.code == ParseResult::ResultCode::AlreadyProcessed) { \
-    continue; /* got it */\
-  } else if (ret.code == ParseResult::ResultCode::Unmatched) { \
-    /* go next */ \
-  } else { \
-    PUSH_ERROR_AND_RETURN(fmt::format("Parsing attribute `extent` failed. Error: {}", ret.err)); \
+  if (__prop.first == __name) { \
+    ParseResult ret = ParseExtentAttribute(__table, __prop.first, __prop.second, __name, __target); \
+    if (ret.code == ParseResult::ResultCode::Success || ret.code == ParseResult::ResultCode::AlreadyProcessed) { \
+      continue; /* got it */\
+    } else if (ret.code == ParseResult::ResultCode::Unmatched) { \
+      /* go next */ \
+    } else { \
+      PUSH_ERROR_AND_RETURN(fmt::format("Parsing attribute `extent` failed. Error: {}", ret.err)); \
+    } \
   } \
 }
 
@@ -1908,7 +1975,11 @@ bool ParseTimeSampledEnumProperty(
   /* Check if the property name is a predefined property */  \
   if (!__table.count(__prop.first)) {                        \
     DCOUT("custom property added: name = " << __prop.first); \
-    __dst[__prop.first] = __prop.second;                     \
+    /* emplace() to skip default construction of Property */ \
+    auto __ret = __dst.emplace(__prop.first, __prop.second); \
+    if (!__ret.second) {                                     \
+      __ret.first->second = __prop.second;                   \
+    }                                                        \
     __table.insert(__prop.first);                            \
   } \
  }
@@ -1930,7 +2001,7 @@ bool ParseTimeSampledEnumProperty(
 
 bool ReconstructXformOpsFromProperties(
   const Specifier &spec,
-  std::set<std::string> &table, /* inout */
+  PropertyNameTable &table, /* inout */
   const std::map<std::string, Property> &properties,
   std::vector<XformOp> *xformOps,
   std::string *err)
@@ -2530,7 +2601,7 @@ bool ReconstructXformOpsFromProperties(
 namespace {
 
 bool ReconstructMaterialBindingProperties(
-  std::set<std::string> &table, /* inout */
+  PropertyNameTable &table, /* inout */
   const std::map<std::string, Property> &properties,
   MaterialBinding *mb, /* inout */
   std::string *err)
@@ -2541,9 +2612,17 @@ bool ReconstructMaterialBindingProperties(
   }
 
   for (const auto &prop : properties) {
-    PARSE_SINGLE_TARGET_PATH_RELATION(table, prop, kMaterialBinding, mb->materialBinding)
-    PARSE_SINGLE_TARGET_PATH_RELATION(table, prop, kMaterialBindingPreview, mb->materialBindingPreview)
-    PARSE_SINGLE_TARGET_PATH_RELATION(table, prop, kMaterialBindingPreview, mb->materialBindingFull)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash(kMaterialBinding):
+        PARSE_SINGLE_TARGET_PATH_RELATION(table, prop, kMaterialBinding, mb->materialBinding)
+        break;
+      case PropNameHash(kMaterialBindingPreview):
+        PARSE_SINGLE_TARGET_PATH_RELATION(table, prop, kMaterialBindingPreview, mb->materialBindingPreview)
+        PARSE_SINGLE_TARGET_PATH_RELATION(table, prop, kMaterialBindingPreview, mb->materialBindingFull)
+        break;
+      default:
+        break;
+    }
     // material:binding:collection
     if (prop.first == kMaterialBindingCollection) {
 
@@ -2630,7 +2709,7 @@ bool ReconstructMaterialBindingProperties(
 }
 
 bool ReconstructCollectionProperties(
-  std::set<std::string> &table, /* inout */
+  PropertyNameTable &table, /* inout */
   const std::map<std::string, Property> &properties,
   Collection *coll, /* inout */
   std::string *warn,
@@ -2723,7 +2802,7 @@ bool ReconstructCollectionProperties(
 // xformOps and built-in props
 bool ReconstructGPrimProperties(
   const Specifier &spec,
-  std::set<std::string> &table, /* inout */
+  PropertyNameTable &table, /* inout */
   const std::map<std::string, Property> &properties,
   GPrim *gprim, /* inout */
   std::string *warn,
@@ -2746,15 +2825,31 @@ bool ReconstructGPrimProperties(
   }
 
   for (const auto &prop : properties) {
-    PARSE_SINGLE_TARGET_PATH_RELATION(table, prop, kProxyPrim, gprim->proxyPrim)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "doubleSided", GPrim, gprim->doubleSided)
-    PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, kVisibility, Visibility, VisibilityEnumHandler, GPrim,
-                   gprim->visibility, strict_allowedToken_check)
-    PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "purpose", Purpose, PurposeEnumHandler, GPrim,
-                       gprim->purpose, strict_allowedToken_check)
-    PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "orientation", Orientation, OrientationEnumHandler, GPrim,
-                       gprim->orientation, strict_allowedToken_check)
-    PARSE_EXTENT_ATTRIBUTE(table, prop, "extent", GPrim, gprim->extent)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash(kProxyPrim):
+        PARSE_SINGLE_TARGET_PATH_RELATION(table, prop, kProxyPrim, gprim->proxyPrim)
+        break;
+      case PropNameHash("doubleSided"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "doubleSided", GPrim, gprim->doubleSided)
+        break;
+      case PropNameHash(kVisibility):
+        PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, kVisibility, Visibility, VisibilityEnumHandler, GPrim,
+                       gprim->visibility, strict_allowedToken_check)
+        break;
+      case PropNameHash("purpose"):
+        PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "purpose", Purpose, PurposeEnumHandler, GPrim,
+                           gprim->purpose, strict_allowedToken_check)
+        break;
+      case PropNameHash("orientation"):
+        PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "orientation", Orientation, OrientationEnumHandler, GPrim,
+                           gprim->orientation, strict_allowedToken_check)
+        break;
+      case PropNameHash("extent"):
+        PARSE_EXTENT_ATTRIBUTE(table, prop, "extent", GPrim, gprim->extent)
+        break;
+      default:
+        break;
+    }
   }
 
   return true;
@@ -2776,7 +2871,7 @@ bool ReconstructPrim<Xform>(
   (void)options;
   (void)references;
 
-  std::set<std::string> table;
+  PropertyNameTable table;
   if (!ReconstructGPrimProperties(spec, table, properties, xform, warn, err, options.strict_allowedToken_check)) {
     return false;
   }
@@ -2805,7 +2900,7 @@ bool ReconstructPrim<Model>(
   (void)err;
   (void)options;
 
-  std::set<std::string> table;
+  PropertyNameTable table;
   for (const auto &prop : properties) {
     ADD_PROPERTY(table, prop, Model, model->props)
     PARSE_PROPERTY_END_MAKE_WARN(table, prop)
@@ -2832,7 +2927,7 @@ bool ReconstructPrim<Scope>(
   (void)options;
 
   DCOUT("Scope");
-  std::set<std::string> table;
+  PropertyNameTable table;
   for (const auto &prop : properties) {
     PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, kVisibility, Visibility, VisibilityEnumHandler, Scope,
                    scope->visibility, options.strict_allowedToken_check)
@@ -2856,7 +2951,7 @@ bool ReconstructPrim<SkelRoot>(
   (void)references;
   (void)options;
 
-  std::set<std::string> table;
+  PropertyNameTable table;
   if (!prim::ReconstructXformOpsFromProperties(spec, table, properties, &root->xformOps, err)) {
     return false;
   }
@@ -2867,11 +2962,21 @@ bool ReconstructPrim<SkelRoot>(
 
   // custom props only
   for (const auto &prop : properties) {
-    PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, kVisibility, Visibility, VisibilityEnumHandler, SkelRoot,
-                   root->visibility, options.strict_allowedToken_check)
-    PARSE_UNIFORM_ENUM_PROPERTY(table, prop, kPurpose, Purpose, PurposeEnumHandler, SkelRoot,
-                       root->purpose, options.strict_allowedToken_check)
-    PARSE_EXTENT_ATTRIBUTE(table, prop, kExtent, SkelRoot, root->extent)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash(kVisibility):
+        PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, kVisibility, Visibility, VisibilityEnumHandler, SkelRoot,
+                       root->visibility, options.strict_allowedToken_check)
+        break;
+      case PropNameHash(kPurpose):
+        PARSE_UNIFORM_ENUM_PROPERTY(table, prop, kPurpose, Purpose, PurposeEnumHandler, SkelRoot,
+                           root->purpose, options.strict_allowedToken_check)
+        break;
+      case PropNameHash(kExtent):
+        PARSE_EXTENT_ATTRIBUTE(table, prop, kExtent, SkelRoot, root->extent)
+        break;
+      default:
+        break;
+    }
     ADD_PROPERTY(table, prop, SkelRoot, root->props)
     PARSE_PROPERTY_END_MAKE_WARN(table, prop)
   }
@@ -2893,7 +2998,7 @@ bool ReconstructPrim<Skeleton>(
   (void)references;
   (void)options;
 
-  std::set<std::string> table;
+  PropertyNameTable table;
   if (!prim::ReconstructXformOpsFromProperties(spec, table, properties, &skel->xformOps, err)) {
     return false;
   }
@@ -2922,15 +3027,33 @@ bool ReconstructPrim<Skeleton>(
 
     //
 
-    PARSE_TYPED_ATTRIBUTE(table, prop, "bindTransforms", Skeleton, skel->bindTransforms)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "joints", Skeleton, skel->joints)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "jointNames", Skeleton, skel->jointNames)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "restTransforms", Skeleton, skel->restTransforms)
-    PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, kVisibility, Visibility, VisibilityEnumHandler, Skeleton,
-                   skel->visibility, options.strict_allowedToken_check)
-    PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "purpose", Purpose, PurposeEnumHandler, Skeleton,
-                       skel->purpose, options.strict_allowedToken_check)
-    PARSE_EXTENT_ATTRIBUTE(table, prop, "extent", Skeleton, skel->extent)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("bindTransforms"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "bindTransforms", Skeleton, skel->bindTransforms)
+        break;
+      case PropNameHash("joints"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "joints", Skeleton, skel->joints)
+        break;
+      case PropNameHash("jointNames"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "jointNames", Skeleton, skel->jointNames)
+        break;
+      case PropNameHash("restTransforms"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "restTransforms", Skeleton, skel->restTransforms)
+        break;
+      case PropNameHash(kVisibility):
+        PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, kVisibility, Visibility, VisibilityEnumHandler, Skeleton,
+                       skel->visibility, options.strict_allowedToken_check)
+        break;
+      case PropNameHash("purpose"):
+        PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "purpose", Purpose, PurposeEnumHandler, Skeleton,
+                           skel->purpose, options.strict_allowedToken_check)
+        break;
+      case PropNameHash("extent"):
+        PARSE_EXTENT_ATTRIBUTE(table, prop, "extent", Skeleton, skel->extent)
+        break;
+      default:
+        break;
+    }
     ADD_PROPERTY(table, prop, Skeleton, skel->props)
     PARSE_PROPERTY_END_MAKE_ERROR(table, prop)
   }
@@ -2986,14 +3109,30 @@ bool ReconstructPrim<SkelAnimation>(
   (void)warn;
   (void)references;
   (void)options;
-  std::set<std::string> table;
+  PropertyNameTable table;
   for (auto &prop : properties) {
-    PARSE_TYPED_ATTRIBUTE(table, prop, "joints", SkelAnimation, skelanim->joints)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "translations", SkelAnimation, skelanim->translations)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "rotations", SkelAnimation, skelanim->rotations)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "scales", SkelAnimation, skelanim->scales)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "blendShapes", SkelAnimation, skelanim->blendShapes)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "blendShapeWeights", SkelAnimation, skelanim->blendShapeWeights)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("joints"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "joints", SkelAnimation, skelanim->joints)
+        break;
+      case PropNameHash("translations"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "translations", SkelAnimation, skelanim->translations)
+        break;
+      case PropNameHash("rotations"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "rotations", SkelAnimation, skelanim->rotations)
+        break;
+      case PropNameHash("scales"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "scales", SkelAnimation, skelanim->scales)
+        break;
+      case PropNameHash("blendShapes"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "blendShapes", SkelAnimation, skelanim->blendShapes)
+        break;
+      case PropNameHash("blendShapeWeights"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "blendShapeWeights", SkelAnimation, skelanim->blendShapeWeights)
+        break;
+      default:
+        break;
+    }
     ADD_PROPERTY(table, prop, Skeleton, skelanim->props)
     PARSE_PROPERTY_END_MAKE_ERROR(table, prop)
   }
@@ -3021,11 +3160,21 @@ bool ReconstructPrim<BlendShape>(
   constexpr auto kNormalOffsets = "normalOffsets";
   constexpr auto kPointIndices = "pointIndices";
 
-  std::set<std::string> table;
+  PropertyNameTable table;
   for (auto &prop : properties) {
-    PARSE_TYPED_ATTRIBUTE(table, prop, kOffsets, BlendShape, bs->offsets)
-    PARSE_TYPED_ATTRIBUTE(table, prop, kNormalOffsets, BlendShape, bs->normalOffsets)
-    PARSE_TYPED_ATTRIBUTE(table, prop, kPointIndices, BlendShape, bs->pointIndices)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash(kOffsets):
+        PARSE_TYPED_ATTRIBUTE(table, prop, kOffsets, BlendShape, bs->offsets)
+        break;
+      case PropNameHash(kNormalOffsets):
+        PARSE_TYPED_ATTRIBUTE(table, prop, kNormalOffsets, BlendShape, bs->normalOffsets)
+        break;
+      case PropNameHash(kPointIndices):
+        PARSE_TYPED_ATTRIBUTE(table, prop, kPointIndices, BlendShape, bs->pointIndices)
+        break;
+      default:
+        break;
+    }
     ADD_PROPERTY(table, prop, Skeleton, bs->props)
     PARSE_PROPERTY_END_MAKE_ERROR(table, prop)
   }
@@ -3058,7 +3207,7 @@ bool ReconstructPrim(
   (void)references;
   (void)properties;
 
-  std::set<std::string> table;
+  PropertyNameTable table;
   if (!ReconstructGPrimProperties(spec, table, properties, gprim, warn, err, options.strict_allowedToken_check)) {
     return false;
   }
@@ -3115,28 +3264,50 @@ bool ReconstructPrim(
     return EnumHandler<GeomBasisCurves::Wrap>("wrap", tok, enums);
   };
 
-  std::set<std::string> table;
+  PropertyNameTable table;
   if (!ReconstructGPrimProperties(spec, table, properties, curves, warn, err, options.strict_allowedToken_check)) {
     return false;
   }
 
   for (const auto &prop : properties) {
-    PARSE_TYPED_ATTRIBUTE(table, prop, "curveVertexCounts", GeomBasisCurves,
-                         curves->curveVertexCounts)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "points", GeomBasisCurves, curves->points)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "velocities", GeomBasisCurves,
-                          curves->velocities)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "normals", GeomBasisCurves,
-                  curves->normals)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "accelerations", GeomBasisCurves,
-                 curves->accelerations)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "widths", GeomBasisCurves, curves->widths)
-    PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "type", GeomBasisCurves::Type, TypeHandler, GeomBasisCurves,
-                       curves->type, options.strict_allowedToken_check)
-    PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "basis", GeomBasisCurves::Basis, BasisHandler, GeomBasisCurves,
-                       curves->basis, options.strict_allowedToken_check)
-    PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "wrap", GeomBasisCurves::Wrap, WrapHandler, GeomBasisCurves,
-                       curves->wrap, options.strict_allowedToken_check)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("curveVertexCounts"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "curveVertexCounts", GeomBasisCurves,
+                             curves->curveVertexCounts)
+        break;
+      case PropNameHash("points"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "points", GeomBasisCurves, curves->points)
+        break;
+      case PropNameHash("velocities"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "velocities", GeomBasisCurves,
+                              curves->velocities)
+        break;
+      case PropNameHash("normals"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "normals", GeomBasisCurves,
+                      curves->normals)
+        break;
+      case PropNameHash("accelerations"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "accelerations", GeomBasisCurves,
+                     curves->accelerations)
+        break;
+      case PropNameHash("widths"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "widths", GeomBasisCurves, curves->widths)
+        break;
+      case PropNameHash("type"):
+        PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "type", GeomBasisCurves::Type, TypeHandler, GeomBasisCurves,
+                           curves->type, options.strict_allowedToken_check)
+        break;
+      case PropNameHash("basis"):
+        PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "basis", GeomBasisCurves::Basis, BasisHandler, GeomBasisCurves,
+                           curves->basis, options.strict_allowedToken_check)
+        break;
+      case PropNameHash("wrap"):
+        PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "wrap", GeomBasisCurves::Wrap, WrapHandler, GeomBasisCurves,
+                           curves->wrap, options.strict_allowedToken_check)
+        break;
+      default:
+        break;
+    }
 
     ADD_PROPERTY(table, prop, GeomBasisCurves, curves->props)
 
@@ -3158,28 +3329,56 @@ bool ReconstructPrim(
   (void)references;
   (void)options;
 
-  std::set<std::string> table;
+  PropertyNameTable table;
   if (!ReconstructGPrimProperties(spec, table, properties, curves, warn, err, options.strict_allowedToken_check)) {
     return false;
   }
 
   for (const auto &prop : properties) {
-    PARSE_TYPED_ATTRIBUTE(table, prop, "curveVertexCounts", GeomNurbsCurves,
-                         curves->curveVertexCounts)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "points", GeomNurbsCurves, curves->points)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "velocities", GeomNurbsCurves,
-                          curves->velocities)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "normals", GeomNurbsCurves,
-                  curves->normals)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "accelerations", GeomNurbsCurves,
-                 curves->accelerations)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "widths", GeomNurbsCurves, curves->widths)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("curveVertexCounts"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "curveVertexCounts", GeomNurbsCurves,
+                             curves->curveVertexCounts)
+        break;
+      case PropNameHash("points"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "points", GeomNurbsCurves, curves->points)
+        break;
+      case PropNameHash("velocities"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "velocities", GeomNurbsCurves,
+                              curves->velocities)
+        break;
+      case PropNameHash("normals"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "normals", GeomNurbsCurves,
+                      curves->normals)
+        break;
+      case PropNameHash("accelerations"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "accelerations", GeomNurbsCurves,
+                     curves->accelerations)
+        break;
+      case PropNameHash("widths"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "widths", GeomNurbsCurves, curves->widths)
+        break;
+      default:
+        break;
+    }
 
     //
-    PARSE_TYPED_ATTRIBUTE(table, prop, "order", GeomNurbsCurves, curves->order)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "knots", GeomNurbsCurves, curves->knots)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "ranges", GeomNurbsCurves, curves->ranges)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "pointWeights", GeomNurbsCurves, curves->pointWeights)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("order"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "order", GeomNurbsCurves, curves->order)
+        break;
+      case PropNameHash("knots"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "knots", GeomNurbsCurves, curves->knots)
+        break;
+      case PropNameHash("ranges"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "ranges", GeomNurbsCurves, curves->ranges)
+        break;
+      case PropNameHash("pointWeights"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "pointWeights", GeomNurbsCurves, curves->pointWeights)
+        break;
+      default:
+        break;
+    }
 
     ADD_PROPERTY(table, prop, GeomBasisCurves, curves->props)
 
@@ -3202,7 +3401,7 @@ bool ReconstructPrim<SphereLight>(
   (void)references;
 
   (void)options;
-  std::set<std::string> table;
+  PropertyNameTable table;
 
   if (!prim::ReconstructXformOpsFromProperties(spec, table, properties, &light->xformOps, err)) {
     return false;
@@ -3210,15 +3409,31 @@ bool ReconstructPrim<SphereLight>(
 
   for (const auto &prop : properties) {
     // PARSE_PROPERTY(prop, "inputs:colorTemperature", light->colorTemperature)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:color", SphereLight, light->color)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:radius", SphereLight, light->radius)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:intensity", SphereLight,
-                   light->intensity)
-    PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, kVisibility, Visibility, VisibilityEnumHandler, SphereLight,
-                   light->visibility, options.strict_allowedToken_check)
-    PARSE_UNIFORM_ENUM_PROPERTY(table, prop, kPurpose, Purpose, PurposeEnumHandler, SphereLight,
-                       light->purpose, options.strict_allowedToken_check)
-    PARSE_EXTENT_ATTRIBUTE(table, prop, kExtent, SphereLight, light->extent)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("inputs:color"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:color", SphereLight, light->color)
+        break;
+      case PropNameHash("inputs:radius"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:radius", SphereLight, light->radius)
+        break;
+      case PropNameHash("inputs:intensity"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:intensity", SphereLight,
+                       light->intensity)
+        break;
+      case PropNameHash(kVisibility):
+        PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, kVisibility, Visibility, VisibilityEnumHandler, SphereLight,
+                       light->visibility, options.strict_allowedToken_check)
+        break;
+      case PropNameHash(kPurpose):
+        PARSE_UNIFORM_ENUM_PROPERTY(table, prop, kPurpose, Purpose, PurposeEnumHandler, SphereLight,
+                           light->purpose, options.strict_allowedToken_check)
+        break;
+      case PropNameHash(kExtent):
+        PARSE_EXTENT_ATTRIBUTE(table, prop, kExtent, SphereLight, light->extent)
+        break;
+      default:
+        break;
+    }
     ADD_PROPERTY(table, prop, SphereLight, light->props)
     PARSE_PROPERTY_END_MAKE_WARN(table, prop)
   }
@@ -3239,7 +3454,7 @@ bool ReconstructPrim<RectLight>(
   (void)references;
   (void)options;
 
-  std::set<std::string> table;
+  PropertyNameTable table;
 
   if (!prim::ReconstructXformOpsFromProperties(spec, table, properties, &light->xformOps, err)) {
     return false;
@@ -3247,17 +3462,37 @@ bool ReconstructPrim<RectLight>(
 
   for (const auto &prop : properties) {
     // PARSE_PROPERTY(prop, "inputs:colorTemperature", light->colorTemperature)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:texture:file", UsdUVTexture, light->file)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:color", RectLight, light->color)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:height", RectLight, light->height)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:width", RectLight, light->width)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:intensity", RectLight,
-                   light->intensity)
-    PARSE_EXTENT_ATTRIBUTE(table, prop, kExtent, RectLight, light->extent)
-    PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, kVisibility, Visibility, VisibilityEnumHandler, RectLight,
-                   light->visibility, options.strict_allowedToken_check)
-    PARSE_UNIFORM_ENUM_PROPERTY(table, prop, kPurpose, Purpose, PurposeEnumHandler, RectLight,
-                       light->purpose, options.strict_allowedToken_check)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("inputs:texture:file"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:texture:file", UsdUVTexture, light->file)
+        break;
+      case PropNameHash("inputs:color"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:color", RectLight, light->color)
+        break;
+      case PropNameHash("inputs:height"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:height", RectLight, light->height)
+        break;
+      case PropNameHash("inputs:width"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:width", RectLight, light->width)
+        break;
+      case PropNameHash("inputs:intensity"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:intensity", RectLight,
+                       light->intensity)
+        break;
+      case PropNameHash(kExtent):
+        PARSE_EXTENT_ATTRIBUTE(table, prop, kExtent, RectLight, light->extent)
+        break;
+      case PropNameHash(kVisibility):
+        PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, kVisibility, Visibility, VisibilityEnumHandler, RectLight,
+                       light->visibility, options.strict_allowedToken_check)
+        break;
+      case PropNameHash(kPurpose):
+        PARSE_UNIFORM_ENUM_PROPERTY(table, prop, kPurpose, Purpose, PurposeEnumHandler, RectLight,
+                           light->purpose, options.strict_allowedToken_check)
+        break;
+      default:
+        break;
+    }
     ADD_PROPERTY(table, prop, SphereLight, light->props)
     PARSE_PROPERTY_END_MAKE_WARN(table, prop)
   }
@@ -3278,7 +3513,7 @@ bool ReconstructPrim<DiskLight>(
   (void)references;
   (void)options;
 
-  std::set<std::string> table;
+  PropertyNameTable table;
 
   if (!prim::ReconstructXformOpsFromProperties(spec, table, properties, &light->xformOps, err)) {
     return false;
@@ -3286,12 +3521,24 @@ bool ReconstructPrim<DiskLight>(
 
   for (const auto &prop : properties) {
     // PARSE_PROPERTY(prop, "inputs:colorTemperature", light->colorTemperature)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:radius", DiskLight, light->radius)
-    PARSE_EXTENT_ATTRIBUTE(table, prop, kExtent, DiskLight, light->extent)
-    PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, kVisibility, Visibility, VisibilityEnumHandler, DiskLight,
-                       light->visibility, options.strict_allowedToken_check)
-    PARSE_UNIFORM_ENUM_PROPERTY(table, prop, kPurpose, Purpose, PurposeEnumHandler, DiskLight,
-                       light->purpose, options.strict_allowedToken_check)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("inputs:radius"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:radius", DiskLight, light->radius)
+        break;
+      case PropNameHash(kExtent):
+        PARSE_EXTENT_ATTRIBUTE(table, prop, kExtent, DiskLight, light->extent)
+        break;
+      case PropNameHash(kVisibility):
+        PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, kVisibility, Visibility, VisibilityEnumHandler, DiskLight,
+                           light->visibility, options.strict_allowedToken_check)
+        break;
+      case PropNameHash(kPurpose):
+        PARSE_UNIFORM_ENUM_PROPERTY(table, prop, kPurpose, Purpose, PurposeEnumHandler, DiskLight,
+                           light->purpose, options.strict_allowedToken_check)
+        break;
+      default:
+        break;
+    }
     ADD_PROPERTY(table, prop, DiskLight, light->props)
     PARSE_PROPERTY_END_MAKE_WARN(table, prop)
   }
@@ -3312,7 +3559,7 @@ bool ReconstructPrim<CylinderLight>(
   (void)references;
   (void)options;
 
-  std::set<std::string> table;
+  PropertyNameTable table;
 
   if (!prim::ReconstructXformOpsFromProperties(spec, table, properties, &light->xformOps, err)) {
     return false;
@@ -3320,13 +3567,27 @@ bool ReconstructPrim<CylinderLight>(
 
   for (const auto &prop : properties) {
     // PARSE_PROPERTY(prop, "inputs:colorTemperature", light->colorTemperature)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:length", CylinderLight, light->length)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:radius", CylinderLight, light->radius)
-    PARSE_EXTENT_ATTRIBUTE(table, prop, kExtent, CylinderLight, light->extent)
-    PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, kVisibility, Visibility, VisibilityEnumHandler, CylindrLight,
-                   light->visibility, options.strict_allowedToken_check)
-    PARSE_UNIFORM_ENUM_PROPERTY(table, prop, kPurpose, Purpose, PurposeEnumHandler, CylinderLight,
-                       light->purpose, options.strict_allowedToken_check)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("inputs:length"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:length", CylinderLight, light->length)
+        break;
+      case PropNameHash("inputs:radius"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:radius", CylinderLight, light->radius)
+        break;
+      case PropNameHash(kExtent):
+        PARSE_EXTENT_ATTRIBUTE(table, prop, kExtent, CylinderLight, light->extent)
+        break;
+      case PropNameHash(kVisibility):
+        PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, kVisibility, Visibility, VisibilityEnumHandler, CylindrLight,
+                       light->visibility, options.strict_allowedToken_check)
+        break;
+      case PropNameHash(kPurpose):
+        PARSE_UNIFORM_ENUM_PROPERTY(table, prop, kPurpose, Purpose, PurposeEnumHandler, CylinderLight,
+                           light->purpose, options.strict_allowedToken_check)
+        break;
+      default:
+        break;
+    }
     ADD_PROPERTY(table, prop, SphereLight, light->props)
     PARSE_PROPERTY_END_MAKE_WARN(table, prop)
   }
@@ -3347,7 +3608,7 @@ bool ReconstructPrim<DistantLight>(
   (void)references;
   (void)options;
 
-  std::set<std::string> table;
+  PropertyNameTable table;
 
   if (!prim::ReconstructXformOpsFromProperties(spec, table, properties, &light->xformOps, err)) {
     return false;
@@ -3355,11 +3616,21 @@ bool ReconstructPrim<DistantLight>(
 
   for (const auto &prop : properties) {
     // PARSE_PROPERTY(prop, "inputs:colorTemperature", light->colorTemperature)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:angle", DistantLight, light->angle)
-    PARSE_UNIFORM_ENUM_PROPERTY(table, prop, kPurpose, Purpose, PurposeEnumHandler, DistantLight,
-                       light->purpose, options.strict_allowedToken_check)
-    PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, kVisibility, Visibility, VisibilityEnumHandler, DistantLight,
-                   light->visibility, options.strict_allowedToken_check)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("inputs:angle"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:angle", DistantLight, light->angle)
+        break;
+      case PropNameHash(kPurpose):
+        PARSE_UNIFORM_ENUM_PROPERTY(table, prop, kPurpose, Purpose, PurposeEnumHandler, DistantLight,
+                           light->purpose, options.strict_allowedToken_check)
+        break;
+      case PropNameHash(kVisibility):
+        PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, kVisibility, Visibility, VisibilityEnumHandler, DistantLight,
+                       light->visibility, options.strict_allowedToken_check)
+        break;
+      default:
+        break;
+    }
     ADD_PROPERTY(table, prop, SphereLight, light->props)
     PARSE_PROPERTY_END_MAKE_WARN(table, prop)
   }
@@ -3380,26 +3651,46 @@ bool ReconstructPrim<DomeLight>(
   (void)references;
   (void)options;
 
-  std::set<std::string> table;
+  PropertyNameTable table;
 
   if (!prim::ReconstructXformOpsFromProperties(spec, table, properties, &light->xformOps, err)) {
     return false;
   }
 
   for (const auto &prop : properties) {
-    PARSE_TYPED_ATTRIBUTE(table, prop, "guideRadius", DomeLight, light->guideRadius)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:diffuse", DomeLight, light->diffuse)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:specular", DomeLight,
-                   light->specular)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:colorTemperature", DomeLight,
-                   light->colorTemperature)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:color", DomeLight, light->color)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:intensity", DomeLight,
-                   light->intensity)
-    PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, kVisibility, Visibility, VisibilityEnumHandler, DomeLight,
-                   light->visibility, options.strict_allowedToken_check)
-    PARSE_UNIFORM_ENUM_PROPERTY(table, prop, kPurpose, Purpose, PurposeEnumHandler, DomeLight,
-                       light->purpose, options.strict_allowedToken_check)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("guideRadius"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "guideRadius", DomeLight, light->guideRadius)
+        break;
+      case PropNameHash("inputs:diffuse"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:diffuse", DomeLight, light->diffuse)
+        break;
+      case PropNameHash("inputs:specular"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:specular", DomeLight,
+                       light->specular)
+        break;
+      case PropNameHash("inputs:colorTemperature"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:colorTemperature", DomeLight,
+                       light->colorTemperature)
+        break;
+      case PropNameHash("inputs:color"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:color", DomeLight, light->color)
+        break;
+      case PropNameHash("inputs:intensity"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:intensity", DomeLight,
+                       light->intensity)
+        break;
+      case PropNameHash(kVisibility):
+        PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, kVisibility, Visibility, VisibilityEnumHandler, DomeLight,
+                       light->visibility, options.strict_allowedToken_check)
+        break;
+      case PropNameHash(kPurpose):
+        PARSE_UNIFORM_ENUM_PROPERTY(table, prop, kPurpose, Purpose, PurposeEnumHandler, DomeLight,
+                           light->purpose, options.strict_allowedToken_check)
+        break;
+      default:
+        break;
+    }
     ADD_PROPERTY(table, prop, DomeLight, light->props)
     PARSE_PROPERTY_END_MAKE_WARN(table, prop)
   }
@@ -3424,7 +3715,7 @@ bool ReconstructPrim<GeomSphere>(
 
   DCOUT("Reconstruct Sphere.");
 
-  std::set<std::string> table;
+  PropertyNameTable table;
   if (!ReconstructGPrimProperties(spec, table, properties, sphere, warn, err, options.strict_allowedToken_check)) {
     return false;
   }
@@ -3454,19 +3745,35 @@ bool ReconstructPrim<GeomPoints>(
 
   DCOUT("Reconstruct Points.");
 
-  std::set<std::string> table;
+  PropertyNameTable table;
   if (!ReconstructGPrimProperties(spec, table, properties, points, warn, err, options.strict_allowedToken_check)) {
     return false;
   }
 
   for (const auto &prop : properties) {
     DCOUT("prop: " << prop.first);
-    PARSE_TYPED_ATTRIBUTE(table, prop, "points", GeomPoints, points->points)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "normals", GeomPoints, points->normals)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "widths", GeomPoints, points->widths)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "ids", GeomPoints, points->ids)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "velocities", GeomPoints, points->velocities)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "accelerations", GeomPoints, points->accelerations)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("points"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "points", GeomPoints, points->points)
+        break;
+      case PropNameHash("normals"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "normals", GeomPoints, points->normals)
+        break;
+      case PropNameHash("widths"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "widths", GeomPoints, points->widths)
+        break;
+      case PropNameHash("ids"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "ids", GeomPoints, points->ids)
+        break;
+      case PropNameHash("velocities"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "velocities", GeomPoints, points->velocities)
+        break;
+      case PropNameHash("accelerations"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "accelerations", GeomPoints, points->accelerations)
+        break;
+      default:
+        break;
+    }
     ADD_PROPERTY(table, prop, GeomSphere, points->props)
     PARSE_PROPERTY_END_MAKE_ERROR(table, prop)
   }
@@ -3488,16 +3795,26 @@ bool ReconstructPrim<GeomCone>(
   (void)references;
   (void)options;
 
-  std::set<std::string> table;
+  PropertyNameTable table;
   if (!ReconstructGPrimProperties(spec, table, properties, cone, warn, err, options.strict_allowedToken_check)) {
     return false;
   }
 
   for (const auto &prop : properties) {
     DCOUT("prop: " << prop.first);
-    PARSE_TYPED_ATTRIBUTE(table, prop, "radius", GeomCone, cone->radius)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "height", GeomCone, cone->height)
-    PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "axis", Axis, AxisEnumHandler, GeomCone, cone->axis, options.strict_allowedToken_check)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("radius"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "radius", GeomCone, cone->radius)
+        break;
+      case PropNameHash("height"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "height", GeomCone, cone->height)
+        break;
+      case PropNameHash("axis"):
+        PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "axis", Axis, AxisEnumHandler, GeomCone, cone->axis, options.strict_allowedToken_check)
+        break;
+      default:
+        break;
+    }
     ADD_PROPERTY(table, prop, GeomCone, cone->props)
     PARSE_PROPERTY_END_MAKE_ERROR(table, prop)
   }
@@ -3519,18 +3836,28 @@ bool ReconstructPrim<GeomCylinder>(
   (void)references;
   (void)options;
 
-  std::set<std::string> table;
+  PropertyNameTable table;
   if (!ReconstructGPrimProperties(spec, table, properties, cylinder, warn, err, options.strict_allowedToken_check)) {
     return false;
   }
 
   for (const auto &prop : properties) {
     DCOUT("prop: " << prop.first);
-    PARSE_TYPED_ATTRIBUTE(table, prop, "radius", GeomCylinder,
-                         cylinder->radius)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "height", GeomCylinder,
-                         cylinder->height)
-    PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "axis", Axis, AxisEnumHandler, GeomCylinder, cylinder->axis, options.strict_allowedToken_check)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("radius"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "radius", GeomCylinder,
+                             cylinder->radius)
+        break;
+      case PropNameHash("height"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "height", GeomCylinder,
+                             cylinder->height)
+        break;
+      case PropNameHash("axis"):
+        PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "axis", Axis, AxisEnumHandler, GeomCylinder, cylinder->axis, options.strict_allowedToken_check)
+        break;
+      default:
+        break;
+    }
     ADD_PROPERTY(table, prop, GeomCylinder, cylinder->props)
     PARSE_PROPERTY_END_MAKE_ERROR(table, prop)
   }
@@ -3552,15 +3879,25 @@ bool ReconstructPrim<GeomCapsule>(
   (void)references;
   (void)options;
 
-  std::set<std::string> table;
+  PropertyNameTable table;
   if (!ReconstructGPrimProperties(spec, table, properties, capsule, warn, err, options.strict_allowedToken_check)) {
     return false;
   }
 
   for (const auto &prop : properties) {
-    PARSE_TYPED_ATTRIBUTE(table, prop, "radius", GeomCapsule, capsule->radius)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "height", GeomCapsule, capsule->height)
-    PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "axis", Axis, AxisEnumHandler, GeomCapsule, capsule->axis, options.strict_allowedToken_check)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("radius"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "radius", GeomCapsule, capsule->radius)
+        break;
+      case PropNameHash("height"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "height", GeomCapsule, capsule->height)
+        break;
+      case PropNameHash("axis"):
+        PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "axis", Axis, AxisEnumHandler, GeomCapsule, capsule->axis, options.strict_allowedToken_check)
+        break;
+      default:
+        break;
+    }
     ADD_PROPERTY(table, prop, GeomCapsule, capsule->props)
     PARSE_PROPERTY_END_MAKE_ERROR(table, prop)
   }
@@ -3585,7 +3922,7 @@ bool ReconstructPrim<GeomCube>(
   //
   // pxrUSD says... "If you author size you must also author extent."
   //
-  std::set<std::string> table;
+  PropertyNameTable table;
   if (!ReconstructGPrimProperties(spec, table, properties, cube, warn, err, options.strict_allowedToken_check)) {
     return false;
   }
@@ -3675,45 +4012,81 @@ bool ReconstructPrim<GeomMesh>(
                                                     enums);
   };
 
-  std::set<std::string> table;
+  PropertyNameTable table;
   if (!ReconstructGPrimProperties(spec, table, properties, mesh, warn, err, options.strict_allowedToken_check)) {
     return false;
   }
 
   for (const auto &prop : properties) {
     DCOUT("GeomMesh prop: " << prop.first);
-    PARSE_SINGLE_TARGET_PATH_RELATION(table, prop, kSkelSkeleton, mesh->skeleton)
-    PARSE_TARGET_PATHS_RELATION(table, prop, kSkelBlendShapeTargets, mesh->blendShapeTargets)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "points", GeomMesh, mesh->points)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "normals", GeomMesh, mesh->normals)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "faceVertexCounts", GeomMesh,
-                         mesh->faceVertexCounts)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "faceVertexIndices", GeomMesh,
-                         mesh->faceVertexIndices)
-    // Subd
-    PARSE_TYPED_ATTRIBUTE(table, prop, "cornerIndices", GeomMesh,
-                         mesh->cornerIndices)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "cornerSharpnesses", GeomMesh,
-                         mesh->cornerSharpnesses)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "creaseIndices", GeomMesh,
-                         mesh->creaseIndices)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "creaseLengths", GeomMesh,
-                         mesh->creaseLengths)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "creaseSharpnesses", GeomMesh,
-                         mesh->creaseSharpnesses)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "holeIndices", GeomMesh,
-                         mesh->holeIndices)
-    PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "subdivisionScheme", GeomMesh::SubdivisionScheme,
-                       SubdivisionSchemeHandler, GeomMesh,
-                       mesh->subdivisionScheme, options.strict_allowedToken_check)
-    PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, "interpolateBoundary",
-                       GeomMesh::InterpolateBoundary, InterpolateBoundaryHandler, GeomMesh,
-                       mesh->interpolateBoundary, options.strict_allowedToken_check)
-    PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, "facevaryingLinearInterpolation",
-                       GeomMesh::FaceVaryingLinearInterpolation, FaceVaryingLinearInterpolationHandler, GeomMesh,
-                       mesh->faceVaryingLinearInterpolation, options.strict_allowedToken_check)
-    // blendShape names
-    PARSE_TYPED_ATTRIBUTE(table, prop, kSkelBlendShapes, GeomMesh, mesh->blendShapes)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash(kSkelSkeleton):
+        PARSE_SINGLE_TARGET_PATH_RELATION(table, prop, kSkelSkeleton, mesh->skeleton)
+        break;
+      case PropNameHash(kSkelBlendShapeTargets):
+        PARSE_TARGET_PATHS_RELATION(table, prop, kSkelBlendShapeTargets, mesh->blendShapeTargets)
+        break;
+      case PropNameHash("points"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "points", GeomMesh, mesh->points)
+        break;
+      case PropNameHash("normals"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "normals", GeomMesh, mesh->normals)
+        break;
+      case PropNameHash("faceVertexCounts"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "faceVertexCounts", GeomMesh,
+                             mesh->faceVertexCounts)
+        break;
+      case PropNameHash("faceVertexIndices"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "faceVertexIndices", GeomMesh,
+                             mesh->faceVertexIndices)
+        break;
+      // Subd
+      case PropNameHash("cornerIndices"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "cornerIndices", GeomMesh,
+                             mesh->cornerIndices)
+        break;
+      case PropNameHash("cornerSharpnesses"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "cornerSharpnesses", GeomMesh,
+                             mesh->cornerSharpnesses)
+        break;
+      case PropNameHash("creaseIndices"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "creaseIndices", GeomMesh,
+                             mesh->creaseIndices)
+        break;
+      case PropNameHash("creaseLengths"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "creaseLengths", GeomMesh,
+                             mesh->creaseLengths)
+        break;
+      case PropNameHash("creaseSharpnesses"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "creaseSharpnesses", GeomMesh,
+                             mesh->creaseSharpnesses)
+        break;
+      case PropNameHash("holeIndices"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "holeIndices", GeomMesh,
+                             mesh->holeIndices)
+        break;
+      case PropNameHash("subdivisionScheme"):
+        PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "subdivisionScheme", GeomMesh::SubdivisionScheme,
+                           SubdivisionSchemeHandler, GeomMesh,
+                           mesh->subdivisionScheme, options.strict_allowedToken_check)
+        break;
+      case PropNameHash("interpolateBoundary"):
+        PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, "interpolateBoundary",
+                           GeomMesh::InterpolateBoundary, InterpolateBoundaryHandler, GeomMesh,
+                           mesh->interpolateBoundary, options.strict_allowedToken_check)
+        break;
+      case PropNameHash("facevaryingLinearInterpolation"):
+        PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, "facevaryingLinearInterpolation",
+                           GeomMesh::FaceVaryingLinearInterpolation, FaceVaryingLinearInterpolationHandler, GeomMesh,
+                           mesh->faceVaryingLinearInterpolation, options.strict_allowedToken_check)
+        break;
+      // blendShape names
+      case PropNameHash(kSkelBlendShapes):
+        PARSE_TYPED_ATTRIBUTE(table, prop, kSkelBlendShapes, GeomMesh, mesh->blendShapes)
+        break;
+      default:
+        break;
+    }
 
     // subsetFamily for GeomSubset
     if (startsWith(prop.first, "subsetFamily")) {
@@ -3813,36 +4186,68 @@ bool ReconstructPrim<GeomCamera>(
         quote(tok) + " is invalid token for `stereoRole` propety");
   };
 
-  std::set<std::string> table;
+  PropertyNameTable table;
   if (!ReconstructGPrimProperties(spec, table, properties, camera, warn, err, options.strict_allowedToken_check)) {
     return false;
   }
 
   for (const auto &prop : properties) {
-    PARSE_TYPED_ATTRIBUTE(table, prop, "focalLength", GeomCamera, camera->focalLength)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "focusDistance", GeomCamera,
-                   camera->focusDistance)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "exposure", GeomCamera, camera->exposure)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "fStop", GeomCamera, camera->fStop)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "horizontalAperture", GeomCamera,
-                   camera->horizontalAperture)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "horizontalApertureOffset", GeomCamera,
-                   camera->horizontalApertureOffset)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "verticalAperture", GeomCamera,
-                   camera->verticalAperture)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "verticalApertureOffset", GeomCamera,
-                   camera->verticalApertureOffset)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "clippingRange", GeomCamera,
-                   camera->clippingRange)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "clippingPlanes", GeomCamera,
-                   camera->clippingPlanes)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "shutter:open", GeomCamera, camera->shutterOpen)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "shutter:close", GeomCamera,
-                   camera->shutterClose)
-    PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, "projection", GeomCamera::Projection, ProjectionHandler, GeomCamera,
-                       camera->projection, options.strict_allowedToken_check)
-    PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "stereoRole", GeomCamera::StereoRole, StereoRoleHandler, GeomCamera,
-                       camera->stereoRole, options.strict_allowedToken_check)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("focalLength"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "focalLength", GeomCamera, camera->focalLength)
+        break;
+      case PropNameHash("focusDistance"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "focusDistance", GeomCamera,
+                       camera->focusDistance)
+        break;
+      case PropNameHash("exposure"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "exposure", GeomCamera, camera->exposure)
+        break;
+      case PropNameHash("fStop"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "fStop", GeomCamera, camera->fStop)
+        break;
+      case PropNameHash("horizontalAperture"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "horizontalAperture", GeomCamera,
+                       camera->horizontalAperture)
+        break;
+      case PropNameHash("horizontalApertureOffset"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "horizontalApertureOffset", GeomCamera,
+                       camera->horizontalApertureOffset)
+        break;
+      case PropNameHash("verticalAperture"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "verticalAperture", GeomCamera,
+                       camera->verticalAperture)
+        break;
+      case PropNameHash("verticalApertureOffset"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "verticalApertureOffset", GeomCamera,
+                       camera->verticalApertureOffset)
+        break;
+      case PropNameHash("clippingRange"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "clippingRange", GeomCamera,
+                       camera->clippingRange)
+        break;
+      case PropNameHash("clippingPlanes"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "clippingPlanes", GeomCamera,
+                       camera->clippingPlanes)
+        break;
+      case PropNameHash("shutter:open"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "shutter:open", GeomCamera, camera->shutterOpen)
+        break;
+      case PropNameHash("shutter:close"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "shutter:close", GeomCamera,
+                       camera->shutterClose)
+        break;
+      case PropNameHash("projection"):
+        PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, "projection", GeomCamera::Projection, ProjectionHandler, GeomCamera,
+                           camera->projection, options.strict_allowedToken_check)
+        break;
+      case PropNameHash("stereoRole"):
+        PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "stereoRole", GeomCamera::StereoRole, StereoRoleHandler, GeomCamera,
+                           camera->stereoRole, options.strict_allowedToken_check)
+        break;
+      default:
+        break;
+    }
     ADD_PROPERTY(table, prop, GeomCamera, camera->props)
     PARSE_PROPERTY_END_MAKE_ERROR(table, prop)
   }
@@ -3877,7 +4282,7 @@ bool ReconstructPrim<GeomSubset>(
                                                     enums);
   };
 
-  std::set<std::string> table;
+  PropertyNameTable table;
 
   if (!prim::ReconstructMaterialBindingProperties(table, properties, subset, err)) {
     return false;
@@ -3889,9 +4294,19 @@ bool ReconstructPrim<GeomSubset>(
   }
 
   for (const auto &prop : properties) {
-    PARSE_TYPED_ATTRIBUTE(table, prop, "familyName", GeomSubset, subset->familyName)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "indices", GeomSubset, subset->indices)
-    PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "elementType", GeomSubset::ElementType, ElementTypeHandler, GeomSubset, subset->elementType, options.strict_allowedToken_check)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("familyName"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "familyName", GeomSubset, subset->familyName)
+        break;
+      case PropNameHash("indices"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "indices", GeomSubset, subset->indices)
+        break;
+      case PropNameHash("elementType"):
+        PARSE_UNIFORM_ENUM_PROPERTY(table, prop, "elementType", GeomSubset::ElementType, ElementTypeHandler, GeomSubset, subset->elementType, options.strict_allowedToken_check)
+        break;
+      default:
+        break;
+    }
     ADD_PROPERTY(table, prop, GeomSubset, subset->props)
     PARSE_PROPERTY_END_MAKE_WARN(table, prop)
   }
@@ -3915,22 +4330,46 @@ bool ReconstructPrim<PointInstancer>(
 
   DCOUT("Reconstruct PointInstancer.");
 
-  std::set<std::string> table;
+  PropertyNameTable table;
   if (!ReconstructGPrimProperties(spec, table, properties, instancer, warn, err, options.strict_allowedToken_check)) {
     return false;
   }
 
   for (const auto &prop : properties) {
-    PARSE_TARGET_PATHS_RELATION(table, prop, "prototypes", instancer->prototypes)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "protoIndices", PointInstancer, instancer->protoIndices)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "ids", PointInstancer, instancer->ids)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "positions", PointInstancer, instancer->positions)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "orientations", PointInstancer, instancer->orientations)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "scales", PointInstancer, instancer->scales)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "velocities", PointInstancer, instancer->velocities)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "accelerations", PointInstancer, instancer->accelerations)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "angularVelocities", PointInstancer, instancer->angularVelocities)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "invisibleIds", PointInstancer, instancer->invisibleIds)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("prototypes"):
+        PARSE_TARGET_PATHS_RELATION(table, prop, "prototypes", instancer->prototypes)
+        break;
+      case PropNameHash("protoIndices"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "protoIndices", PointInstancer, instancer->protoIndices)
+        break;
+      case PropNameHash("ids"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "ids", PointInstancer, instancer->ids)
+        break;
+      case PropNameHash("positions"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "positions", PointInstancer, instancer->positions)
+        break;
+      case PropNameHash("orientations"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "orientations", PointInstancer, instancer->orientations)
+        break;
+      case PropNameHash("scales"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "scales", PointInstancer, instancer->scales)
+        break;
+      case PropNameHash("velocities"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "velocities", PointInstancer, instancer->velocities)
+        break;
+      case PropNameHash("accelerations"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "accelerations", PointInstancer, instancer->accelerations)
+        break;
+      case PropNameHash("angularVelocities"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "angularVelocities", PointInstancer, instancer->angularVelocities)
+        break;
+      case PropNameHash("invisibleIds"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "invisibleIds", PointInstancer, instancer->invisibleIds)
+        break;
+      default:
+        break;
+    }
 
     ADD_PROPERTY(table, prop, PointInstancer, instancer->props)
     PARSE_PROPERTY_END_MAKE_ERROR(table, prop)
@@ -3959,7 +4398,7 @@ bool ReconstructShader<ShaderNode>(
   // TODO: references
   (void)references;
 
-  std::set<std::string> table;
+  PropertyNameTable table;
   table.insert("info:id"); // `info:id` is already parsed in ReconstructPrim<Shader>
 
   // Add everything to props.
@@ -3997,46 +4436,88 @@ bool ReconstructShader<UsdPreviewSurface>(
         "inputs:opacityMode", tok, enums);
   };
 
-  std::set<std::string> table;
+  PropertyNameTable table;
   table.insert("info:id"); // `info:id` is already parsed in ReconstructPrim<Shader>
   for (auto &prop : properties) {
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:diffuseColor", UsdPreviewSurface,
-                         surface->diffuseColor)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:emissiveColor", UsdPreviewSurface,
-                         surface->emissiveColor)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:roughness", UsdPreviewSurface,
-                         surface->roughness)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:specularColor", UsdPreviewSurface,
-                         surface->specularColor)  // specular workflow
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:metallic", UsdPreviewSurface,
-                         surface->metallic)  // non specular workflow
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:clearcoat", UsdPreviewSurface,
-                         surface->clearcoat)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:clearcoatRoughness",
-                         UsdPreviewSurface, surface->clearcoatRoughness)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:opacity", UsdPreviewSurface,
-                         surface->opacity)
-    // From 2.6
-    PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, "inputs:opacityMode",
-                       UsdPreviewSurface::OpacityMode, OpacityModeHandler, UsdPreviewSurface,
-                       surface->opacityMode, options.strict_allowedToken_check)
-
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:opacityThreshold",
-                         UsdPreviewSurface, surface->opacityThreshold)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:ior", UsdPreviewSurface,
-                         surface->ior)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:normal", UsdPreviewSurface,
-                         surface->normal)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:dispacement", UsdPreviewSurface,
-                         surface->displacement)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:occlusion", UsdPreviewSurface,
-                         surface->occlusion)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:useSpecularWorkflow",
-                         UsdPreviewSurface, surface->useSpecularWorkflow)
-    PARSE_SHADER_TERMINAL_ATTRIBUTE(table, prop, "outputs:surface", UsdPreviewSurface,
-                   surface->outputsSurface)
-    PARSE_SHADER_TERMINAL_ATTRIBUTE(table, prop, "outputs:displacement", UsdPreviewSurface,
-                   surface->outputsDisplacement)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("inputs:diffuseColor"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:diffuseColor", UsdPreviewSurface,
+                             surface->diffuseColor)
+        break;
+      case PropNameHash("inputs:emissiveColor"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:emissiveColor", UsdPreviewSurface,
+                             surface->emissiveColor)
+        break;
+      case PropNameHash("inputs:roughness"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:roughness", UsdPreviewSurface,
+                             surface->roughness)
+        break;
+      case PropNameHash("inputs:specularColor"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:specularColor", UsdPreviewSurface,
+                             surface->specularColor)  // specular workflow
+        break;
+      case PropNameHash("inputs:metallic"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:metallic", UsdPreviewSurface,
+                             surface->metallic)  // non specular workflow
+        break;
+      case PropNameHash("inputs:clearcoat"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:clearcoat", UsdPreviewSurface,
+                             surface->clearcoat)
+        break;
+      case PropNameHash("inputs:clearcoatRoughness"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:clearcoatRoughness",
+                             UsdPreviewSurface, surface->clearcoatRoughness)
+        break;
+      case PropNameHash("inputs:opacity"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:opacity", UsdPreviewSurface,
+                             surface->opacity)
+        break;
+      // From 2.6
+      case PropNameHash("inputs:opacityMode"):
+        PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, "inputs:opacityMode",
+                           UsdPreviewSurface::OpacityMode, OpacityModeHandler, UsdPreviewSurface,
+                           surface->opacityMode, options.strict_allowedToken_check)
+        break;
+      default:
+        break;
+    }
+
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("inputs:opacityThreshold"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:opacityThreshold",
+                             UsdPreviewSurface, surface->opacityThreshold)
+        break;
+      case PropNameHash("inputs:ior"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:ior", UsdPreviewSurface,
+                             surface->ior)
+        break;
+      case PropNameHash("inputs:normal"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:normal", UsdPreviewSurface,
+                             surface->normal)
+        break;
+      case PropNameHash("inputs:dispacement"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:dispacement", UsdPreviewSurface,
+                             surface->displacement)
+        break;
+      case PropNameHash("inputs:occlusion"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:occlusion", UsdPreviewSurface,
+                             surface->occlusion)
+        break;
+      case PropNameHash("inputs:useSpecularWorkflow"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:useSpecularWorkflow",
+                             UsdPreviewSurface, surface->useSpecularWorkflow)
+        break;
+      case PropNameHash("outputs:surface"):
+        PARSE_SHADER_TERMINAL_ATTRIBUTE(table, prop, "outputs:surface", UsdPreviewSurface,
+                       surface->outputsSurface)
+        break;
+      case PropNameHash("outputs:displacement"):
+        PARSE_SHADER_TERMINAL_ATTRIBUTE(table, prop, "outputs:displacement", UsdPreviewSurface,
+                       surface->outputsDisplacement)
+        break;
+      default:
+        break;
+    }
     ADD_PROPERTY(table, prop, UsdPreviewSurface, surface->props)
     PARSE_PROPERTY_END_MAKE_WARN(table, prop)
   }
@@ -4086,33 +4567,57 @@ bool ReconstructShader<UsdUVTexture>(
         "inputs:wrap*", tok, enums);
   };
 
-  std::set<std::string> table;
+  PropertyNameTable table;
   table.insert("info:id"); // `info:id` is already parsed in ReconstructPrim<Shader>
 
   for (auto &prop : properties) {
     DCOUT("prop.name = " << prop.first);
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:file", UsdUVTexture, texture->file)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:st", UsdUVTexture,
-                          texture->st)
-    PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, "inputs:sourceColorSpace",
-                       UsdUVTexture::SourceColorSpace, SourceColorSpaceHandler, UsdUVTexture,
-                       texture->sourceColorSpace, options.strict_allowedToken_check)
-    PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, "inputs:wrapS",
-                       UsdUVTexture::Wrap, WrapHandler, UsdUVTexture,
-                       texture->wrapS, options.strict_allowedToken_check)
-    PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, "inputs:wrapT",
-                       UsdUVTexture::Wrap, WrapHandler, UsdUVTexture,
-                       texture->wrapT, options.strict_allowedToken_check)
-    PARSE_SHADER_TERMINAL_ATTRIBUTE(table, prop, "outputs:r", UsdUVTexture,
-                                  texture->outputsR)
-    PARSE_SHADER_TERMINAL_ATTRIBUTE(table, prop, "outputs:g", UsdUVTexture,
-                                  texture->outputsG)
-    PARSE_SHADER_TERMINAL_ATTRIBUTE(table, prop, "outputs:b", UsdUVTexture,
-                                  texture->outputsB)
-    PARSE_SHADER_TERMINAL_ATTRIBUTE(table, prop, "outputs:a", UsdUVTexture,
-                                  texture->outputsA)
-    PARSE_SHADER_TERMINAL_ATTRIBUTE(table, prop, "outputs:rgb", UsdUVTexture,
-                                  texture->outputsRGB)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("inputs:file"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:file", UsdUVTexture, texture->file)
+        break;
+      case PropNameHash("inputs:st"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:st", UsdUVTexture,
+                              texture->st)
+        break;
+      case PropNameHash("inputs:sourceColorSpace"):
+        PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, "inputs:sourceColorSpace",
+                           UsdUVTexture::SourceColorSpace, SourceColorSpaceHandler, UsdUVTexture,
+                           texture->sourceColorSpace, options.strict_allowedToken_check)
+        break;
+      case PropNameHash("inputs:wrapS"):
+        PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, "inputs:wrapS",
+                           UsdUVTexture::Wrap, WrapHandler, UsdUVTexture,
+                           texture->wrapS, options.strict_allowedToken_check)
+        break;
+      case PropNameHash("inputs:wrapT"):
+        PARSE_TIMESAMPLED_ENUM_PROPERTY(table, prop, "inputs:wrapT",
+                           UsdUVTexture::Wrap, WrapHandler, UsdUVTexture,
+                           texture->wrapT, options.strict_allowedToken_check)
+        break;
+      case PropNameHash("outputs:r"):
+        PARSE_SHADER_TERMINAL_ATTRIBUTE(table, prop, "outputs:r", UsdUVTexture,
+                                      texture->outputsR)
+        break;
+      case PropNameHash("outputs:g"):
+        PARSE_SHADER_TERMINAL_ATTRIBUTE(table, prop, "outputs:g", UsdUVTexture,
+                                      texture->outputsG)
+        break;
+      case PropNameHash("outputs:b"):
+        PARSE_SHADER_TERMINAL_ATTRIBUTE(table, prop, "outputs:b", UsdUVTexture,
+                                      texture->outputsB)
+        break;
+      case PropNameHash("outputs:a"):
+        PARSE_SHADER_TERMINAL_ATTRIBUTE(table, prop, "outputs:a", UsdUVTexture,
+                                      texture->outputsA)
+        break;
+      case PropNameHash("outputs:rgb"):
+        PARSE_SHADER_TERMINAL_ATTRIBUTE(table, prop, "outputs:rgb", UsdUVTexture,
+                                      texture->outputsRGB)
+        break;
+      default:
+        break;
+    }
     ADD_PROPERTY(table, prop, UsdUVTexture, texture->props)
     PARSE_PROPERTY_END_MAKE_WARN(table, prop)
   }
@@ -4134,7 +4639,7 @@ bool ReconstructShader<UsdPrimvarReader_int>(
   (void)spec;
   (void)references;
   (void)options;
-  std::set<std::string> table;
+  PropertyNameTable table;
   table.insert("info:id"); // `info:id` is already parsed in ReconstructPrim<Shader>
   for (auto &prop : properties) {
     PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:fallback", UsdPrimvarReader_int,
@@ -4179,7 +4684,7 @@ bool ReconstructShader<UsdPrimvarReader_float>(
   (void)spec;
   (void)references;
   (void)options;
-  std::set<std::string> table;
+  PropertyNameTable table;
   table.insert("info:id"); // `info:id` is already parsed in ReconstructPrim<Shader>
   for (auto &prop : properties) {
     PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:fallback", UsdPrimvarReader_float,
@@ -4234,7 +4739,7 @@ bool ReconstructShader<UsdPrimvarReader_float2>(
   (void)spec;
   (void)references;
   (void)options;
-  std::set<std::string> table;
+  PropertyNameTable table;
   table.insert("info:id"); // `info:id` is already parsed in ReconstructPrim<Shader>
   for (auto &prop : properties) {
     DCOUT("Primreader_float2 prop = " << prop.first);
@@ -4291,7 +4796,7 @@ bool ReconstructShader<UsdPrimvarReader_float3>(
   (void)spec;
   (void)references;
   (void)options;
-  std::set<std::string> table;
+  PropertyNameTable table;
   table.insert("info:id"); // `info:id` is already parsed in ReconstructPrim<Shader>
   for (auto &prop : properties) {
     PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:fallback", UsdPrimvarReader_float3,
@@ -4347,7 +4852,7 @@ bool ReconstructShader<UsdPrimvarReader_float4>(
   (void)spec;
   (void)references;
   (void)options;
-  std::set<std::string> table;
+  PropertyNameTable table;
   table.insert("info:id"); // `info:id` is already parsed in ReconstructPrim<Shader>
 
   for (auto &prop : properties) {
@@ -4403,7 +4908,7 @@ bool ReconstructShader<UsdPrimvarReader_string>(
   (void)spec;
   (void)references;
   (void)options;
-  std::set<std::string> table;
+  PropertyNameTable table;
   table.insert("info:id"); // `info:id` is already parsed in ReconstructPrim<Shader>
 
   for (auto &prop : properties) {
@@ -4459,7 +4964,7 @@ bool ReconstructShader<UsdPrimvarReader_vector>(
   (void)spec;
   (void)references;
   (void)options;
-  std::set<std::string> table;
+  PropertyNameTable table;
   table.insert("info:id"); // `info:id` is already parsed in ReconstructPrim<Shader>
 
   for (auto &prop : properties) {
@@ -4515,7 +5020,7 @@ bool ReconstructShader<UsdPrimvarReader_normal>(
   (void)spec;
   (void)references;
   (void)options;
-  std::set<std::string> table;
+  PropertyNameTable table;
   table.insert("info:id"); // `info:id` is already parsed in ReconstructPrim<Shader>
 
   for (auto &prop : properties) {
@@ -4571,7 +5076,7 @@ bool ReconstructShader<UsdPrimvarReader_point>(
   (void)spec;
   (void)references;
   (void)options;
-  std::set<std::string> table;
+  PropertyNameTable table;
   table.insert("info:id"); // `info:id` is already parsed in ReconstructPrim<Shader>
 
   for (auto &prop : properties) {
@@ -4627,7 +5132,7 @@ bool ReconstructShader<UsdPrimvarReader_matrix>(
   (void)spec;
   (void)references;
   (void)options;
-  std::set<std::string> table;
+  PropertyNameTable table;
   table.insert("info:id"); // `info:id` is already parsed in ReconstructPrim<Shader>
 
   for (auto &prop : properties) {
@@ -4683,20 +5188,34 @@ bool ReconstructShader<UsdTransform2d>(
   (void)spec;
   (void)references;
   (void)options;
-  std::set<std::string> table;
+  PropertyNameTable table;
   table.insert("info:id"); // `info:id` is already parsed in ReconstructPrim<Shader>
   for (auto &prop : properties) {
     DCOUT("prop = " << prop.first);
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:in", UsdTransform2d,
-                   transform->in)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:rotation", UsdTransform2d,
-                   transform->rotation)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:scale", UsdTransform2d,
-                   transform->scale)
-    PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:translation", UsdTransform2d,
-                   transform->translation)
-    PARSE_SHADER_TERMINAL_ATTRIBUTE(table, prop, "outputs:result",
-                                  UsdTransform2d, transform->result)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("inputs:in"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:in", UsdTransform2d,
+                       transform->in)
+        break;
+      case PropNameHash("inputs:rotation"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:rotation", UsdTransform2d,
+                       transform->rotation)
+        break;
+      case PropNameHash("inputs:scale"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:scale", UsdTransform2d,
+                       transform->scale)
+        break;
+      case PropNameHash("inputs:translation"):
+        PARSE_TYPED_ATTRIBUTE(table, prop, "inputs:translation", UsdTransform2d,
+                       transform->translation)
+        break;
+      case PropNameHash("outputs:result"):
+        PARSE_SHADER_TERMINAL_ATTRIBUTE(table, prop, "outputs:result",
+                                      UsdTransform2d, transform->result)
+        break;
+      default:
+        break;
+    }
     ADD_PROPERTY(table, prop, UsdPrimvarReader_float2, transform->props)
     PARSE_PROPERTY_END_MAKE_WARN(table, prop)
   }
@@ -4891,20 +5410,32 @@ bool ReconstructPrim<Material>(
   (void)spec;
   (void)references;
   (void)options;
-  std::set<std::string> table;
+  PropertyNameTable table;
 
   // TODO: special treatment for properties with 'inputs' and 'outputs' namespace.
 
   // For `Material`, `outputs` are terminal attribute and treated as input attribute with connection(Should be "token output:surface.connect = </path/to/shader>").
   for (auto &prop : properties) {
-    PARSE_SHADER_INPUT_CONNECTION_PROPERTY(table, prop, "outputs:surface",
-                                  Material, material->surface)
-    PARSE_SHADER_INPUT_CONNECTION_PROPERTY(table, prop, "outputs:displacement",
-                                  Material, material->displacement)
-    PARSE_SHADER_INPUT_CONNECTION_PROPERTY(table, prop, "outputs:volume",
-                                  Material, material->volume)
-    PARSE_UNIFORM_ENUM_PROPERTY(table, prop, kPurpose, Purpose, PurposeEnumHandler, Material,
-                       material->purpose, options.strict_allowedToken_check)
+    switch (PropNameHash(prop.first)) {
+      case PropNameHash("outputs:surface"):
+        PARSE_SHADER_INPUT_CONNECTION_PROPERTY(table, prop, "outputs:surface",
+                                      Material, material->surface)
+        break;
+      case PropNameHash("outputs:displacement"):
+        PARSE_SHADER_INPUT_CONNECTION_PROPERTY(table, prop, "outputs:displacement",
+                                      Material, material->displacement)
+        break;
+      case PropNameHash("outputs:volume"):
+        PARSE_SHADER_INPUT_CONNECTION_PROPERTY(table, prop, "outputs:volume",
+                                      Material, material->volume)
+        break;
+      case PropNameHash(kPurpose):
+        PARSE_UNIFORM_ENUM_PROPERTY(table, prop, kPurpose, Purpose, PurposeEnumHandler, Material,
+                           material->purpose, options.strict_allowedToken_check)
+        break;
+      default:
+        break;
+    }
     ADD_PROPERTY(table, prop, Material, material->props)
     PARSE_PROPERTY_END_MAKE_WARN(table, prop)
   }
@@ -8,6 +8,8 @@
 
 #include <string>
 #include <vector>
+#include <algorithm>
+#include <cstring>
 #include <map>
 #include "prim-types.hh"
 
@@ -19,6 +21,92 @@ struct PrimReconstructOptions
   bool strict_allowedToken_check{false};
 };
 
+///
+/// Set of property names already processed in Prim reconstruction.
+/// Internal index over `PropertyMap`(the property containers themselves stay
+/// `std::map`). Flat open-addressing table keyed by interned token, so
+/// marking a property as processed does not allocate a tree node and a copy
+/// of the name per property. Lookup computes the hash of the name and does
+/// not intern it.
+///
+class PropertyNameTable {
+ public:
+  size_t count(const char *name) const { return count(name, strlen(name)); }
+  size_t count(const std::string &name) const {
+    return count(name.c_str(), name.size());
+  }
+
+  void insert(const char *name) { insert(name, strlen(name)); }
+  void insert(const std::string &name) { insert(name.c_str(), name.size()); }
+
+  size_t size() const { return _size; }
+  bool empty() const { return _size == 0; }
+
+ private:
+  struct Slot {
+    uint64_t hash{0};
+    value::token name;
+    bool used{false};
+  };
+
+  static uint64_t Hash(const char *s, size_t n) {
+    // FNV-1a
+    uint64_t h = 14695981039346656037ull;
+    for (size_t i = 0; i < n; i++) {
+      h = (h ^ uint64_t(uint8_t(s[i]))) * 1099511628211ull;
+    }
+    return h;
+  }
+
+  // Returns the index of the slot of `name`, or the empty slot to insert it.
+  size_t find_slot(const char *name, size_t n, uint64_t h) const {
+    const size_t mask = _slots.size() - 1;
+    size_t i = size_t(h) & mask;
+    while (_slots[i].used) {
+      if ((_slots[i].hash == h) && (_slots[i].name.str().size() == n) &&
+          (memcmp(_slots[i].name.str().c_str(), name, n) == 0)) {
+        break;
+      }
+      i = (i + 1) & mask;
+    }
+    return i;
+  }
+
+  size_t count(const char *name, size_t n) const {
+    if (_slots.empty()) {
+      return 0;
+    }
+    return _slots[find_slot(name, n, Hash(name, n))].used ? 1 : 0;
+  }
+
+  void insert(const char *name, size_t n) {
+    // Keep the load factor <= 0.5
+    if ((_size + 1) * 2 > _slots.size()) {
+      std::vector<Slot> slots(std::move(_slots));
+      _slots.clear();
+      _slots.resize((std::max)(size_t(16), slots.size() * 2));
+      for (auto &slot : slots) {
+        if (slot.used) {
+          const std::string &s = slot.name.str();
+          _slots[find_slot(s.c_str(), s.size(), slot.hash)] = std::move(slot);
+        }
+      }
+    }
+
+    const uint64_t h = Hash(name, n);
+    Slot &slot = _slots[find_slot(name, n, h)];
+    if (!slot.used) {
+      slot.hash = h;
+      slot.name = value::token(name, n);
+      slot.used = true;
+      _size++;
+    }
+  }
+
+  std::vector<Slot> _slots;
+  size_t _size{0};
+};
+
 
 ///
 /// Reconstruct property with `xformOp:***` namespace in `properties` to `XformOp` class.
@@ -28,7 +116,7 @@ struct PrimReconstructOptions
 ///
 bool ReconstructXformOpsFromProperties(
       const Specifier &spec,
-      std::set<std::string> &table, /* inout */
+      PropertyNameTable &table, /* inout */
       const PropertyMap &properties,
       std::vector<XformOp> *xformOps,
       std::string *err);
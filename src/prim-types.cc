@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cstdio>
 #include <limits>
+#include <mutex>
 #include <numeric>
 //
 #include "prim-types.hh"
@@ -86,9 +87,16 @@ bool operator==(const Path &lhs, const Path &rhs) {
     return false;
   }
 
-  // Currently simply compare string.
-  // FIXME: Better Path identity check.
-  return (lhs.full_path_name() == rhs.full_path_name());
+  if (lhs.is_same_node(rhs)) {
+    return true;
+  }
+
+  if (lhs.hash() != rhs.hash()) {
+    return false;
+  }
+
+  return (lhs.prim_part() == rhs.prim_part()) &&
+         (lhs.prop_part() == rhs.prop_part());
 }
 
 bool ConvertTokenAttributeToStringAttribute(
@@ -134,14 +142,390 @@ bool ConvertTokenAttributeToStringAttribute(
 // -- Path
 //
 
-void Path::_update(const std::string &p, const std::string &prop) {
+namespace {
+
+// The path table is sharded to reduce lock contention when Paths are created
+// from multiple threads(e.g. threaded USDA parsing).
+constexpr size_t kNumPathTableShards = 16;
+
+inline void PathHashCombine(size_t &seed, size_t v) {
+  seed ^= v + size_t(0x9e3779b97f4a7c15ULL) + (seed << 6) + (seed >> 2);
+}
+
+// FNV-1a. Can be computed incrementally, so the hash of prim_part is computed
+// from the hash of the parent's prim_part.
+constexpr size_t kPathStrHashInit = size_t(14695981039346656037ULL);
+
+inline size_t PathStrHash(size_t h, const char *s, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    h ^= size_t(uint8_t(s[i]));
+    h *= size_t(1099511628211ULL);
+  }
+  return h;
+}
+
+inline size_t PathStrHash(size_t h, const std::string &s) {
+  return PathStrHash(h, s.data(), s.size());
+}
+
+inline size_t PathStrHash(const std::string &s) {
+  return PathStrHash(kPathStrHashInit, s);
+}
+
+inline size_t PathIdentityHash(size_t prim_hash, size_t prop_hash,
+                               bool valid) {
+  size_t seed = prim_hash;
+  PathHashCombine(seed, prop_hash);
+  PathHashCombine(seed, std::hash<bool>()(valid));
+  return seed;
+}
+
+// Split prim_part into element names. Returns false when the prim_part cannot
+// be represented as a chain of elements(e.g. "/a//b", "a/").
+bool SplitPrimPart(const std::string &prim_part,
+                   std::vector<std::string> *names) {
+  size_t s = (prim_part.size() && (prim_part[0] == '/')) ? 1 : 0;
+  if (s == prim_part.size()) {
+    return true;  // "/" or ""
+  }
+
+  while (true) {
+    size_t e = prim_part.find('/', s);
+    if (e == s) {
+      return false;
+    }
+    if (e == std::string::npos) {
+      names->push_back(prim_part.substr(s));
+      return true;
+    }
+    names->push_back(prim_part.substr(s, e - s));
+    s = e + 1;
+    if (s == prim_part.size()) {
+      return false;
+    }
+  }
+}
+
+}  // namespace
+
+struct Path::Shard {
+  std::mutex mutex;
+  std::unordered_multimap<size_t, const Node *> nodes;  // key = node_hash
+};
+
+Path::Shard &Path::GetShard(size_t node_hash) {
+  // Intentionally leaked so that Paths can be destroyed during static
+  // destruction.
+  static Shard *shards = new Shard[kNumPathTableShards];
+  return shards[(node_hash >> 8) % kNumPathTableShards];
+}
+
+Path::PathData Path::Node::data() const {
+  PathData d;
+  d.prim_part = prim_part();
+  d.prop_part = prop_part();
+  d.variant_part = variant_part;
+  d.variant_selection_part = variant_selection_part;
+  d.element = element;
+  d.path_type = path_type;
+  d.valid = valid;
+  return d;
+}
+
+Path::PathData Path::Node::child_data(const std::string &elem) const {
+  PathData d;
+  d.variant_part = variant_part;
+  d.variant_selection_part = variant_selection_part;
+  d.element = elem;
+  d.path_type = path_type;
+  d.valid = valid;
+  return d;
+}
+
+const std::string &Path::Node::build_prim_part() const {
+  if (kind == Kind::Property) {
+    // Shares the parent's string.
+    return parent ? parent->prim_part() : EmptyNode()->prim_part();
+  }
+
+  std::string *s = new std::string();
+  if (kind == Kind::Root) {
+    (*s) = "/";
+  } else {
+    if (parent) {
+      (*s) = parent->prim_part();
+      if ((kind == Kind::Prim) && !parent->prim_part_is_root) {
+        (*s) += '/';
+      }
+    }
+    (*s) += name;
+  }
+
+  // Other thread may have built the string in the meantime.
+  const std::string *expected = nullptr;
+  if (!prim_part_cache.compare_exchange_strong(expected, s,
+                                               std::memory_order_acq_rel,
+                                               std::memory_order_acquire)) {
+    delete s;
+    return *expected;
+  }
+
+  return *s;
+}
+
+const Path::Node *Path::EmptyNode() {
+  static const Node *node = []() {
+    Node *n = new Node();
+    n->prim_part_cache.store(new std::string());
+    n->prop_str = &n->name;
+    n->variant_part_str = "{=}";
+    n->prim_hash = kPathStrHashInit;
+    n->prop_hash = kPathStrHashInit;
+    n->hash = PathIdentityHash(n->prim_hash, n->prop_hash, n->valid);
+    n->interned = false;
+    return n;
+  }();
+  return node;
+}
+
+const Path::Node *Path::Intern(PathData &&d) {
+  if (d.element.empty()) {
+    // Get last item.
+    std::vector<std::string> tokenized_prim_names = split(d.prim_part, "/");
+    if (tokenized_prim_names.size()) {
+      d.element = tokenized_prim_names[size_t(tokenized_prim_names.size() - 1)];
+    }
+  }
+
+  std::vector<std::string> names;
+  if ((d.prim_part.empty() && d.prop_part.empty()) ||
+      !SplitPrimPart(d.prim_part, &names)) {
+    return InternNode(Node::Kind::Flat, nullptr, d.prop_part, std::move(d));
+  }
+
+  bool prim_leaf = d.prop_part.empty();
+
+  // Build the chain of ancestor nodes. Each of them is the same node as
+  // `Path(ancestor_prim_part, "")`.
+  const Node *parent = nullptr;
+  if (d.prim_part.size() && (d.prim_part[0] == '/')) {
+    if (prim_leaf && names.empty()) {
+      return InternNode(Node::Kind::Root, nullptr, "/", std::move(d));
+    }
+
+    PathData root;
+    root.element = "/";
+    root.valid = true;
+    parent = InternNode(Node::Kind::Root, nullptr, "/", std::move(root));
+  }
+
+  for (size_t i = 0; i < names.size(); i++) {
+    const Node *node;
+    if (prim_leaf && ((i + 1) == names.size())) {
+      node = InternNode(Node::Kind::Prim, parent, names[i], std::move(d));
+    } else {
+      PathData pd;
+      pd.element = names[i];
+      pd.valid = true;
+      node = InternNode(Node::Kind::Prim, parent, names[i], std::move(pd));
+    }
+
+    // The child node holds its own reference to the parent node.
+    if (parent) {
+      Release(parent);
+    }
+    parent = node;
+  }
+
+  if (prim_leaf) {
+    return parent;
+  }
+
+  // NOTE: InternNode() does not move out prop_part of `d`.
+  const Node *node =
+      InternNode(Node::Kind::Property, parent, d.prop_part, std::move(d));
+  if (parent) {
+    Release(parent);
+  }
+  return node;
+}
+
+const Path::Node *Path::InternNode(Node::Kind kind, const Node *parent,
+                                   const std::string &name, PathData &&d) {
+  // Hashes of prim_part and prop_part strings.
+  size_t prim_hash = kPathStrHashInit;
+  size_t prop_hash = kPathStrHashInit;
+  bool prim_part_is_root = false;
+  switch (kind) {
+    case Node::Kind::Flat:
+      prim_hash = PathStrHash(d.prim_part);
+      prop_hash = PathStrHash(name);
+      prim_part_is_root = (d.prim_part == "/");
+      break;
+    case Node::Kind::Root:
+      prim_hash = PathStrHash("/");
+      prim_part_is_root = true;
+      break;
+    case Node::Kind::Prim:
+      if (parent) {
+        prim_hash = parent->prim_hash;
+        if (!parent->prim_part_is_root) {
+          prim_hash = PathStrHash(prim_hash, "/", 1);
+        }
+        prop_hash = parent->prop_hash;
+      }
+      prim_hash = PathStrHash(prim_hash, name);
+      break;
+    case Node::Kind::Variant:
+      if (parent) {
+        prim_hash = parent->prim_hash;
+        prop_hash = parent->prop_hash;
+      }
+      prim_hash = PathStrHash(prim_hash, name);
+      break;
+    case Node::Kind::Property:
+      if (parent) {
+        prim_hash = parent->prim_hash;
+        prim_part_is_root = parent->prim_part_is_root;
+      }
+      prop_hash = PathStrHash(name);
+      break;
+  }
+
+  size_t hash = PathIdentityHash(prim_hash, prop_hash, d.valid);
+
+  size_t node_hash = hash;
+  PathHashCombine(node_hash, size_t(kind));
+  PathHashCombine(node_hash, std::hash<const Node *>()(parent));
+  PathHashCombine(node_hash, PathStrHash(name));
+  PathHashCombine(node_hash, std::hash<std::string>()(d.variant_part));
+  PathHashCombine(node_hash,
+                  std::hash<std::string>()(d.variant_selection_part));
+  PathHashCombine(node_hash, std::hash<std::string>()(d.element));
+  PathHashCombine(node_hash, d.path_type ? size_t(d.path_type.value()) + 1 : 0);
+
+  auto &shard = GetShard(node_hash);
+
+  std::lock_guard<std::mutex> lock(shard.mutex);
+
+  auto range = shard.nodes.equal_range(node_hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    const Node *n = it->second;
+    if ((n->kind == kind) && (n->parent == parent) && (n->valid == d.valid) &&
+        (n->path_type == d.path_type) && (n->name == name) &&
+        (n->element == d.element) && (n->variant_part == d.variant_part) &&
+        (n->variant_selection_part == d.variant_selection_part) &&
+        ((kind != Node::Kind::Flat) || (n->prim_part() == d.prim_part))) {
+      // Reference count only drops to zero while the lock is held(see
+      // ReleaseLast()), so `n` is alive here.
+      n->refcount.fetch_add(1, std::memory_order_relaxed);
+      return n;
+    }
+  }
+
+  Node *node = new Node();
+  node->kind = kind;
+  node->parent = parent;
+  node->name = name;
+  node->variant_part = std::move(d.variant_part);
+  node->variant_selection_part = std::move(d.variant_selection_part);
+  node->element = std::move(d.element);
+  node->path_type = d.path_type;
+  node->valid = d.valid;
+  node->variant_part_str =
+      "{" + node->variant_part + "=" + node->variant_selection_part + "}";
+  if (kind == Node::Kind::Flat) {
+    node->prim_part_cache.store(new std::string(std::move(d.prim_part)),
+                                std::memory_order_relaxed);
+  }
+  if ((kind == Node::Kind::Flat) || (kind == Node::Kind::Property)) {
+    node->prop_str = &node->name;
+  } else if (parent && (kind != Node::Kind::Root)) {
+    node->prop_str = parent->prop_str;
+  } else {
+    node->prop_str = EmptyNode()->prop_str;
+  }
+  node->prim_hash = prim_hash;
+  node->prop_hash = prop_hash;
+  node->hash = hash;
+  node->node_hash = node_hash;
+  node->prim_part_is_root = prim_part_is_root;
+  node->interned = true;
+  node->refcount.store(1, std::memory_order_relaxed);
+
+  if (parent) {
+    Retain(parent);
+  }
+
+  shard.nodes.emplace(node_hash, node);
+
+  return node;
+}
+
+void Path::ReleaseLast(const Node *node) {
+  while (node) {
+    const Node *parent = nullptr;
+    {
+      auto &shard = GetShard(node->node_hash);
+
+      std::lock_guard<std::mutex> lock(shard.mutex);
+
+      // Other thread may have looked up the node from the table in the
+      // meantime.
+      if (node->refcount.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+      }
+
+      auto range = shard.nodes.equal_range(node->node_hash);
+      for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == node) {
+          shard.nodes.erase(it);
+          break;
+        }
+      }
+
+      parent = node->parent;
+      delete node;
+    }
+
+    // Drop the reference to the parent node(without recursion, so deep
+    // hierarchy does not overflow the stack).
+    if (!parent || !parent->interned) {
+      return;
+    }
+
+    uint32_t count = parent->refcount.load(std::memory_order_relaxed);
+    while (count > 1) {
+      if (parent->refcount.compare_exchange_weak(count, count - 1,
+                                                 std::memory_order_acq_rel,
+                                                 std::memory_order_relaxed)) {
+        return;
+      }
+    }
+
+    node = parent;
+  }
+}
+
+size_t Path::num_interned_nodes() {
+  size_t n = 0;
+  for (size_t i = 0; i < kNumPathTableShards; i++) {
+    auto &shard = GetShard(i << 8);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    n += shard.nodes.size();
+  }
+  return n;
+}
+
+void Path::_update(PathData &d, const std::string &p,
+                   const std::string &prop) {
   //
   // For absolute path, starts with '/' and no other '/' exists.
   // For property part, '.' exists only once.
   //
 
   if (p.empty() && prop.empty()) {
-    _valid = false;
+    d.valid = false;
     return;
   }
 
@@ -156,13 +540,13 @@ void Path::_update(const std::string &p, const std::string &prop) {
     // prop should not contain slashes
     auto nslashes = std::count_if(prop.begin(), prop.end(), slash_fun);
     if (nslashes) {
-      _valid = false;
+      d.valid = false;
       return;
     }
 
     // prop does not start with '.'
     if (startsWith(prop, ".")) {
-      _valid = false;
+      d.valid = false;
       return;
     }
   }
@@ -174,56 +558,56 @@ void Path::_update(const std::string &p, const std::string &prop) {
 
     if (ndots == 0) {
       // absolute prim.
-      _prim_part = p;
+      d.prim_part = p;
 
       if (prop.size()) {
-        _prop_part = prop;
-        _element = prop;
+        d.prop_part = prop;
+        d.element = prop;
       } else {
         if (prims.size()) {
-          _element = prims[prims.size() - 1];
+          d.element = prims[prims.size() - 1];
         } else {
-          _element = p;
+          d.element = p;
         }
       }
-      _valid = true;
+      d.valid = true;
     } else if (ndots == 1) {
       // prim_part contains property name.
       if (prop.size()) {
         // prop must be empty.
-        _valid = false;
+        d.valid = false;
         return;
       }
 
       if (p.size() < 3) {
         // "/."
-        _valid = false;
+        d.valid = false;
         return;
       }
 
       auto loc = p.find_first_of('.');
       if (loc == std::string::npos) {
         // ?
-        _valid = false;
+        d.valid = false;
         return;
       }
 
       if (loc <= 0) {
         // this should not happen though.
-        _valid = false;
+        d.valid = false;
       }
 
       // split
       std::string prop_name = p.substr(size_t(loc));
 
-      _prop_part = prop_name.erase(0, 1);  // remove '.'
-      _prim_part = p.substr(0, size_t(loc));
-      _element = _prop_part;  // elementName is property path
+      d.prop_part = prop_name.erase(0, 1);  // remove '.'
+      d.prim_part = p.substr(0, size_t(loc));
+      d.element = d.prop_part;  // elementName is property path
 
-      _valid = true;
+      d.valid = true;
 
     } else {
-      _valid = false;
+      d.valid = false;
       return;
     }
 
@@ -234,26 +618,26 @@ void Path::_update(const std::string &p, const std::string &prop) {
 #if 0
     auto nslashes = std::count_if(p.begin(), p.end(), slash_fun);
     if (nslashes > 0) {
-      _valid = false;
+      d.valid = false;
       return;
     }
 
-    _prop_part = p;
-    _prop_part = _prop_part.erase(0, 1);
-    _valid = true;
+    d.prop_part = p;
+    d.prop_part = d.prop_part.erase(0, 1);
+    d.valid = true;
 #else
-    _prim_part = p;
+    d.prim_part = p;
     if (prop.size()) {
-      _prop_part = prop;
-      _element = prop;
+      d.prop_part = prop;
+      d.element = prop;
     } else {
       if (prims.size()) {
-        _element = prims[prims.size() - 1];
+        d.element = prims[prims.size() - 1];
       } else {
-        _element = p;
+        d.element = p;
       }
     }
-    _valid = true;
+    d.valid = true;
 
 #endif
 
@@ -263,28 +647,28 @@ void Path::_update(const std::string &p, const std::string &prop) {
     auto ndots = std::count_if(p.begin(), p.end(), dot_fun);
     if (ndots == 0) {
       // relative prim.
-      _prim_part = p;
+      d.prim_part = p;
       if (prop.size()) {
-        _prop_part = prop;
+        d.prop_part = prop;
       }
-      _valid = true;
+      d.valid = true;
     } else if (ndots == 1) {
       if (p.size() < 3) {
         // "/."
-        _valid = false;
+        d.valid = false;
         return;
       }
 
       auto loc = p.find_first_of('.');
       if (loc == std::string::npos) {
         // ?
-        _valid = false;
+        d.valid = false;
         return;
       }
 
       if (loc <= 0) {
         // this should not happen though.
-        _valid = false;
+        d.valid = false;
       }
 
       // split
@@ -292,57 +676,56 @@ void Path::_update(const std::string &p, const std::string &prop) {
 
       // Check if No '/' in prop_part
       if (std::count_if(prop_name.begin(), prop_name.end(), slash_fun) > 0) {
-        _valid = false;
+        d.valid = false;
         return;
       }
 
-      _prim_part = p.substr(0, size_t(loc));
-      _prop_part = prop_name.erase(0, 1);  // remove '.'
+      d.prim_part = p.substr(0, size_t(loc));
+      d.prop_part = prop_name.erase(0, 1);  // remove '.'
 
-      _valid = true;
+      d.valid = true;
 
     } else {
-      _valid = false;
+      d.valid = false;
       return;
     }
   }
 }
 
 Path::Path(const std::string &p, const std::string &prop) {
-  _update(p, prop); 
+  PathData d;
+  _update(d, p, prop);
+  _node = Intern(std::move(d));
 }
 
 Path Path::append_property(const std::string &elem) {
-  Path &p = (*this);
+  bool valid = true;
 
   if (elem.empty()) {
-    p._valid = false;
-    return p;
-  }
-
-  if (is_variantElementName(elem)) {
+    valid = false;
+  } else if (is_variantElementName(elem)) {
     // variant chars are not supported yet.
-    p._valid = false;
-    return p;
-  }
-
-  if (elem[0] == '[') {
+    valid = false;
+  } else if (elem[0] == '[') {
     // relational attrib are not supported
-    p._valid = false;
-    return p;
+    valid = false;
   } else if (elem[0] == '.') {
     // Relative
     // std::cerr << "???. elem[0] is '.'\n";
     // For a while, make this valid.
-    p._valid = false;
-    return p;
-  } else {
-    // TODO: Validate property path.
-    p._prop_part = elem;
-    p._element = elem;
+    valid = false;
+  }
 
-    return p;
+  if (!valid) {
+    PathData d = _node->data();
+    d.valid = false;
+    _assign(std::move(d));
+    return *this;
   }
+
+  // TODO: Validate property path.
+  _append(Node::Kind::Property, elem, _node->child_data(elem));
+  return *this;
 }
 
 const Path Path::AppendPrim(const std::string &elem) const {
@@ -373,11 +756,12 @@ bool Path::replace_prefix(const Path &srcPrefix, const Path &dstPrefix) {
   const std::string &srcPrefixStr = srcPrefix.prim_part();
   const std::string &dstPrefixStr = dstPrefix.prim_part();
 
-  std::string pathStr = prim_part();
+  const std::string &pathStr = prim_part();
   if (startsWith(pathStr, srcPrefixStr)) {
-    pathStr = dstPrefixStr + removePrefix(pathStr, srcPrefixStr);
-
-    _update(pathStr, prop_part());
+    PathData d = _node->data();
+    _update(d, dstPrefixStr + removePrefix(pathStr, srcPrefixStr),
+            prop_part());
+    _assign(std::move(d));
 
     return true;
   }
@@ -567,57 +951,87 @@ bool Path::has_prefix(const Path &prefix) const {
 }
 
 Path Path::append_element(const std::string &elem) {
-  Path &p = (*this);
-
   if (elem.empty()) {
-    p._valid = false;
-    return p;
+    PathData d = _node->data();
+    d.valid = false;
+    _assign(std::move(d));
+    return *this;
   }
 
+  PathData d = _node->child_data(elem);
+
   // {variant=value}
   if (is_variantElementName(elem)) {
     std::array<std::string, 2> variant;
     if (tokenize_variantElement(elem, &variant)) {
-      _variant_part = variant[0];
-      _variant_selection_part = variant[0];
-      _prim_part += elem;
-      _element = elem;
-      return p;
+      d.variant_part = variant[0];
+      d.variant_selection_part = variant[0];
+      _append(Node::Kind::Variant, elem, std::move(d));
+      return *this;
     } else {
-      p._valid = false;
+      d.valid = false;
     }
   }
 
   if (elem[0] == '[') {
     // relational attrib are not supported
-    p._valid = false;
-    return p;
+    PathData pd = _node->data();
+    pd.valid = false;
+    _assign(std::move(pd));
   } else if (elem[0] == '.') {
     // Relative path
     // For a while, make this valid.
-    p._valid = false;
-    return p;
+    PathData pd = _node->data();
+    pd.valid = false;
+    _assign(std::move(pd));
   } else {
-    // std::cout << "elem " << elem << "\n";
-    if ((p._prim_part.size() == 1) && (p._prim_part[0] == '/')) {
-      p._prim_part += elem;
-    } else {
-      // TODO: Validate element name.
-      p._prim_part += '/' + elem;
+    // TODO: Validate element name.
+    // Also store raw element name
+    _append(Node::Kind::Prim, elem, std::move(d));
+  }
+
+  return *this;
+}
+
+const Path::Node *Path::CanonicalParent(const Node *node) {
+  const Node *parent = node->parent;
+  if (!parent || !parent->interned) {
+    return nullptr;
+  }
+
+  if (node->kind == Node::Kind::Prim) {
+    if (!node->prop_part().empty() ||
+        (node->name.find('/') != std::string::npos)) {
+      return nullptr;
     }
+  } else if (node->kind != Node::Kind::Property) {
+    return nullptr;
+  }
 
-    // Also store raw element name
-    p._element = elem;
+  if ((parent->kind != Node::Kind::Prim) &&
+      (parent->kind != Node::Kind::Root)) {
+    return nullptr;
+  }
 
-    return p;
+  if (!parent->valid || parent->path_type || parent->variant_part.size() ||
+      parent->variant_selection_part.size() || parent->prop_part().size() ||
+      (parent->element != parent->name)) {
+    return nullptr;
   }
+
+  return parent;
 }
 
 Path Path::get_parent_path() const {
-  if (!_valid) {
+  if (!is_valid()) {
     return Path();
   }
 
+  if (const Node *parent = CanonicalParent(_node)) {
+    Retain(parent);
+    return Path(parent);
+  }
+
   if (is_root_path()) {
     Path p("", "");
     return p;
@@ -628,7 +1042,7 @@ Path Path::get_parent_path() const {
     return Path(prim_part(), "");
   }
 
-  size_t n = _prim_part.find_last_of('/');
+  size_t n = prim_part().find_last_of('/');
   if (n == std::string::npos) {
     // relative path(e.g. "bora") or propery only path(e.g. ".myval").
     return Path();
@@ -639,11 +1053,11 @@ Path Path::get_parent_path() const {
     return Path("/", "");
   }
 
-  return Path(_prim_part.substr(0, n), "");
+  return Path(prim_part().substr(0, n), "");
 }
 
 Path Path::get_parent_prim_path() const {
-  if (!_valid) {
+  if (!is_valid()) {
     return Path();
   }
 
@@ -651,12 +1065,17 @@ Path Path::get_parent_prim_path() const {
     return *this;
   }
 
+  if (const Node *parent = CanonicalParent(_node)) {
+    Retain(parent);
+    return Path(parent);
+  }
+
   if (is_prim_property_path()) {
     // return prim part
     return Path(prim_part(), "");
   }
 
-  size_t n = _prim_part.find_last_of('/');
+  size_t n = prim_part().find_last_of('/');
   if (n == std::string::npos) {
     // this should never happen though.
     return Path();
@@ -667,19 +1086,7 @@ Path Path::get_parent_prim_path() const {
     return Path("/", "");
   }
 
-  return Path(_prim_part.substr(0, n), "");
-}
-
-const std::string &Path::element_name() const {
-  if (_element.empty()) {
-    // Get last item.
-    std::vector<std::string> tokenized_prim_names = split(prim_part(), "/");
-    if (tokenized_prim_names.size()) {
-      _element = tokenized_prim_names[size_t(tokenized_prim_names.size() - 1)];
-    }
-  }
-
-  return _element;
+  return Path(prim_part().substr(0, n), "");
 }
 
 nonstd::optional<Kind> KindFromString(const std::string &str) {
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
@@ -315,8 +316,15 @@ bool ValidatePrimElementName(const std::string &tok);
 /// NOTE: We are doging refactoring of Path class, so the following comment may
 /// not be correct.
 ///
-/// We don't need the performance for USDZ, so use naiive implementation
-/// to represent Path.
+/// Path is a pointer-sized handle to an interned, immutable path node(like
+/// SdfPath). Path nodes are shared among all Path instances which have the same
+/// contents and are stored in a global(thread-safe) path table, so copying a
+/// Path does not allocate and equality check/hashing of Paths are cheap.
+/// Path nodes are reference counted and removed from the table when the last
+/// Path referencing it is destroyed.
+/// Functions modifying the Path(e.g. `append_property`) create(or look up) a
+/// new path node and replace the handle.
+///
 /// Path is something like Unix path, delimited by `/`, ':' and '.'
 /// Square brackets('<', '>' is not included)
 ///
@@ -353,14 +361,93 @@ class Path {
     Root,
   };
 
-  Path() : _valid(false) {}
+ private:
+  // Contents of Path.
+  struct PathData {
+    std::string prim_part;     // e.g. /Model/MyMesh, MySphere
+    std::string prop_part;     // e.g. visibility (`.` is not included)
+    std::string variant_part;  // e.g. `variantColor` for {variantColor=green}
+    std::string variant_selection_part;  // e.g. `green` for
+                                         // {variantColor=green}. Could be
+                                         // empty({variantColor=}).
+    std::string element;                 // Element name
+
+    nonstd::optional<PathType> path_type;  // Currently optional.
+
+    bool valid{false};
+  };
+
+  ///
+  /// Interned path node. Immutable once registered to the path table.
+  ///
+  /// Like SdfPathNode, a node references its parent node and only stores the
+  /// element appended to it, so appending an element or getting the parent
+  /// path does not build strings. `prim_part` string is built on the first
+  /// access and cached. A path which cannot be represented as a chain of
+  /// elements(e.g. "/a//b") is stored in a Flat node.
+  ///
+  struct Node {
+    enum class Kind : uint8_t {
+      Flat,      // prim_part and prop_part(`name`) are stored as is.
+      Root,      // "/"
+      Prim,      // parent's prim_part + '/' + name(`name` when no parent)
+      Variant,   // parent's prim_part + name(e.g. "{variant=selection}")
+      Property,  // parent's prim_part. prop_part is `name`.
+    };
+
+    ~Node() { delete prim_part_cache.load(std::memory_order_relaxed); }
+
+    const std::string &prim_part() const {
+      const std::string *s = prim_part_cache.load(std::memory_order_acquire);
+      return s ? *s : build_prim_part();
+    }
+
+    const std::string &prop_part() const { return *prop_str; }
+
+    PathData data() const;
+
+    // Contents of the child node which appends `elem`(prim_part and prop_part
+    // are not set).
+    PathData child_data(const std::string &elem) const;
+
+    Kind kind{Kind::Flat};
+    const Node *parent{nullptr};  // Holds a reference to the parent node.
+    std::string name;             // Element appended to the parent.
+
+    std::string variant_part;
+    std::string variant_selection_part;
+    std::string element;
+    nonstd::optional<PathType> path_type;
+    bool valid{false};
+
+    std::string variant_part_str;  // "{variant=selection}"
+    const std::string *prop_str{nullptr};  // `name` of this or ancestor node.
+    size_t prim_hash{0};  // Hash of prim_part string.
+    size_t prop_hash{0};  // Hash of prop_part string.
+    size_t hash{0};       // Hash of Path identity(prim_part, prop_part, valid)
+    size_t node_hash{0};  // Hash of all contents. Used in the path table.
+    bool prim_part_is_root{false};  // prim_part == "/"
+    bool interned{false};  // false for the node of empty Path.
+    mutable std::atomic<uint32_t> refcount{0};
+
+   private:
+    const std::string &build_prim_part() const;
+
+    mutable std::atomic<const std::string *> prim_part_cache{nullptr};
+
+    friend class Path;
+  };
+
+ public:
+  Path() : _node(EmptyNode()) {}
 
   static Path make_root_path() {
-    Path p = Path("/", "");
+    PathData d;
+    _update(d, "/", "");
     // elementPath is empty for root.
-    p._element = "";
-    p._valid = true;
-    return p;
+    d.element = "";
+    d.valid = true;
+    return Path(Intern(std::move(d)));
   }
 
   // Create Path both from Prim Path and Prop
@@ -379,67 +466,79 @@ class Path {
   // Path(const std::string &prim, const std::string &prop)
   //    : prim_part(prim), prop_part(prop) {}
 
-  Path(const Path &rhs) = default;
+  Path(const Path &rhs) : _node(rhs._node) { Retain(_node); }
+
+  Path(Path &&rhs) noexcept : _node(rhs._node) { rhs._node = EmptyNode(); }
+
+  ~Path() { Release(_node); }
 
   Path &operator=(const Path &rhs) {
-    this->_valid = rhs._valid;
+    Retain(rhs._node);
+    Release(_node);
+    _node = rhs._node;
 
-    this->_prim_part = rhs._prim_part;
-    this->_prop_part = rhs._prop_part;
-    this->_element = rhs._element;
+    return (*this);
+  }
+
+  Path &operator=(Path &&rhs) noexcept {
+    if (this != &rhs) {
+      Release(_node);
+      _node = rhs._node;
+      rhs._node = EmptyNode();
+    }
 
     return (*this);
   }
 
   std::string full_path_name() const {
     std::string s;
-    if (!_valid) {
+    if (!_node->valid) {
       s += "#INVALID#";
     }
 
-    s += _prim_part;
-    if (_prop_part.empty()) {
+    s += _node->prim_part();
+    if (_node->prop_part().empty()) {
       return s;
     }
 
-    s += "." + _prop_part;
+    s += "." + _node->prop_part();
 
     return s;
   }
 
-  const std::string &prim_part() const { return _prim_part; }
-  const std::string &prop_part() const { return _prop_part; }
+  const std::string &prim_part() const { return _node->prim_part(); }
+  const std::string &prop_part() const { return _node->prop_part(); }
 
-  const std::string &variant_part() const {
-    _variant_part_str =
-        "{" + _variant_part + "=" + _variant_selection_part + "}";
-    return _variant_part_str;
-  }
+  const std::string &variant_part() const { return _node->variant_part_str; }
 
-  void set_path_type(const PathType ty) { _path_type = ty; }
+  void set_path_type(const PathType ty) {
+    PathData d = _node->data();
+    d.path_type = ty;
+    _assign(std::move(d));
+  }
 
   bool get_path_type(PathType &ty) {
-    if (_path_type) {
-      ty = _path_type.value();
+    if (_node->path_type) {
+      ty = _node->path_type.value();
     }
     return false;
   }
 
   // IsPropertyPath: PrimProperty or RelationalAttribute
   bool is_property_path() const {
-    if (_path_type) {
-      if ((_path_type.value() == PathType::PrimProperty ||
-           (_path_type.value() == PathType::RelationalAttribute))) {
+    if (_node->path_type) {
+      if ((_node->path_type.value() == PathType::PrimProperty ||
+           (_node->path_type.value() == PathType::RelationalAttribute))) {
         return true;
       }
     }
 
     // TODO: RelationalAttribute
-    if (_prim_part.empty()) {
+    if (_node->prim_part().empty()) {
       return false;
     }
 
-    if (_prop_part.size()) {
+    if (_node->prop_part().size()) {
       return true;
     }
 
@@ -448,11 +547,11 @@ class Path {
 
   // Is Prim path?
   bool is_prim_path() const {
-    if (_prop_part.size()) {
+    if (_node->prop_part().size()) {
       return false;
     }
 
-    if (_prim_part.size()) {
+    if (_node->prim_part().size()) {
       return true;
     }
 
@@ -462,21 +561,34 @@ class Path {
   // Is Prim's property path?
   // True when both PrimPart and PropPart are not empty.
   bool is_prim_property_path() const {
-    if (_prim_part.empty()) {
+    if (_node->prim_part().empty()) {
       return false;
     }
-    if (_prop_part.size()) {
+    if (_node->prop_part().size()) {
       return true;
     }
     return false;
   }
 
-  bool is_valid() const { return _valid; }
+  bool is_valid() const { return _node->valid; }
 
   bool is_empty() {
-    return (_prim_part.empty() && _variant_part.empty() && _prop_part.empty());
+    return (_node->prim_part().empty() && _node->variant_part.empty() &&
+            _node->prop_part().empty());
   }
 
+  ///
+  /// Hash value of the Path. Paths which are equal(operator==) have the same
+  /// hash value. The hash is precomputed when the path node is interned.
+  ///
+  size_t hash() const { return _node->hash; }
+
+  ///
+  /// @returns true when both Paths share the same path node.
+  /// (i.e. have exactly the same contents)
+  ///
+  bool is_same_node(const Path &rhs) const { return _node == rhs._node; }
+
   // static Path RelativePath() { return Path("."); }
 
   // Append property path(change internal state)
@@ -495,7 +607,7 @@ class Path {
 
   // Get element name(the last element of Path. i.e. Prim's name, Property's
   // name)
-  const std::string &element_name() const;
+  const std::string &element_name() const { return _node->element; }
 
   ///
   /// Split a path to the root(common ancestor) and its siblings
@@ -563,8 +675,8 @@ class Path {
   /// example.
   /// srcPrefix = /bora/dora
   /// dstPrefix = /bora2/dora2
-  /// 
-  /// /bora/dora/muda -> /bora2/dora2/muda 
+  ///
+  /// /bora/dora/muda -> /bora2/dora2/muda
   ///
   bool replace_prefix(const Path &srcPrefix, const Path &dstPrefix);
 
@@ -572,11 +684,12 @@ class Path {
   /// @returns true if a path is '/' only
   ///
   bool is_root_path() const {
-    if (!_valid) {
+    if (!_node->valid) {
       return false;
     }
 
-    if ((_prim_part.size() == 1) && (_prim_part[0] == '/')) {
+    const std::string &prim_part = _node->prim_part();
+    if ((prim_part.size() == 1) && (prim_part[0] == '/')) {
       return true;
     }
 
@@ -587,7 +700,7 @@ class Path {
   /// @returns true if a path is root prim: e.g. '/bora'
   ///
   bool is_root_prim() const {
-    if (!_valid) {
+    if (!_node->valid) {
       return false;
     }
 
@@ -595,9 +708,10 @@ class Path {
       return false;
     }
 
-    if ((_prim_part.size() > 1) && (_prim_part[0] == '/')) {
+    const std::string &prim_part = _node->prim_part();
+    if ((prim_part.size() > 1) && (prim_part[0] == '/')) {
       // no other '/' except for the fist one
-      if (_prim_part.find_last_of('/') == 0) {
+      if (prim_part.find_last_of('/') == 0) {
         return true;
       }
     }
@@ -606,7 +720,8 @@ class Path {
   }
 
   bool is_absolute_path() const {
-    if (_prim_part.size() && _prim_part[0] == '/') {
+    const std::string &prim_part = _node->prim_part();
+    if (prim_part.size() && prim_part[0] == '/') {
       return true;
     }
 
@@ -614,7 +729,7 @@ class Path {
   }
 
   bool is_relative_path() const {
-    if (_prim_part.size()) {
+    if (_node->prim_part().size()) {
       return !is_absolute_path();
     }
 
@@ -637,9 +752,11 @@ class Path {
 
   // Strip '/'
   Path &make_relative() {
-    if (is_absolute_path() && (_prim_part.size() > 1)) {
+    if (is_absolute_path() && (_node->prim_part().size() > 1)) {
       // Remove first '/'
-      _prim_part.erase(0, 1);
+      PathData d = _node->data();
+      d.prim_part.erase(0, 1);
+      _assign(std::move(d));
     }
     return *this;
   }
@@ -671,20 +788,79 @@ class Path {
     return LessThan(*this, rhs);
   }
 
+  ///
+  /// Number of path nodes in the global path table(for debugging/statistics).
+  ///
+  static size_t num_interned_nodes();
+
  private:
-  void _update(const std::string &p, const std::string &prop);
+  // Takes the ownership of a reference to `node`.
+  explicit Path(const Node *node) : _node(node) {}
+
+  static void _update(PathData &d, const std::string &p,
+                      const std::string &prop);
+
+  // Replace the path node with the one for `d`.
+  void _assign(PathData &&d) {
+    const Node *node = Intern(std::move(d));
+    Release(_node);
+    _node = node;
+  }
+
+  // Node of the empty(invalid) Path. Not registered to the path table.
+  static const Node *EmptyNode();
+
+  // Look up the path table and return the node for `d`(registers new node
+  // when not found). Increments the reference count of returned node.
+  static const Node *Intern(PathData &&d);
+
+  // Same as Intern(), but for the node of `kind` which appends `name` to
+  // `parent`. prim_part and prop_part of `d` are not used except for Flat
+  // node(`name` is prop_part for Flat node).
+  static const Node *InternNode(Node::Kind kind, const Node *parent,
+                                const std::string &name, PathData &&d);
+
+  // Replace the path node with its child node.
+  void _append(Node::Kind kind, const std::string &name, PathData &&d) {
+    const Node *node = InternNode(kind, _node, name, std::move(d));
+    Release(_node);
+    _node = node;
+  }
+
+  // Returns the parent node of `node` when it represents the same path as
+  // `Path(parent_prim_part, "")`, nullptr otherwise.
+  static const Node *CanonicalParent(const Node *node);
+
+  static void Retain(const Node *node) {
+    if (node->interned) {
+      node->refcount.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  static void Release(const Node *node) {
+    if (!node->interned) {
+      return;
+    }
 
-  std::string _prim_part;     // e.g. /Model/MyMesh, MySphere
-  std::string _prop_part;     // e.g. visibility (`.` is not included)
-  std::string _variant_part;  // e.g. `variantColor` for {variantColor=green}
-  std::string _variant_selection_part;  // e.g. `green` for {variantColor=green}
-                                        // . Could be empty({variantColor=}).
-  mutable std::string _variant_part_str;  // str buffer for variant_part()
-  mutable std::string _element;           // Element name
+    // Decrement without taking a lock unless this is the last reference.
+    uint32_t count = node->refcount.load(std::memory_order_relaxed);
+    while (count > 1) {
+      if (node->refcount.compare_exchange_weak(count, count - 1,
+                                               std::memory_order_acq_rel,
+                                               std::memory_order_relaxed)) {
+        return;
+      }
+    }
+
+    ReleaseLast(node);
+  }
 
-  nonstd::optional<PathType> _path_type;  // Currently optional.
+  static void ReleaseLast(const Node *node);
 
-  bool _valid{false};
+  struct Shard;
+  static Shard &GetShard(size_t node_hash);
+
+  const Node *_node;
 };
 
 #if 0
@@ -1157,7 +1333,9 @@ struct TypedTimeSamples {
     bool blocked{false};
   };
 
-  bool empty() const { return _samples.empty(); }
+  bool empty() const {
+    return _deferred ? _deferred->ts.empty() : _samples.empty();
+  }
 
   void update() const {
     std::sort(_samples.begin(), _samples.end(),
@@ -1168,6 +1346,51 @@ struct TypedTimeSamples {
     return;
   }
 
+  void clear() {
+    _samples.clear();
+    _deferred.reset();
+    _dirty = false;
+  }
+
+  ///
+  /// Use deferred(or `times` shared) samples in `ts`(e.g. TimeSamples in
+  /// USDC) as is. Sample values are decoded and converted to T on demand, so
+  /// type mismatch of sample values other than the first one is reported at
+  /// get(). Returns false when the first sample is not T(or ValueBlock).
+  ///
+  bool set_deferred(const value::TimeSamples &ts, std::string *err = nullptr) {
+    if (!ts.has_shared_times() || ts.empty()) {
+      return false;
+    }
+
+    auto v = ts.get_value(0, err);
+    if (!v) {
+      return false;
+    }
+
+    if (!v.value().is_none() && !v.value().as<T>()) {
+      return false;
+    }
+
+    clear();
+    _deferred = std::make_shared<DeferredSamples>();
+    _deferred->ts = ts;
+    _deferred->convert = [](const value::Value &src, T *dst) {
+      if (const auto pv = src.as<T>()) {
+        (*dst) = (*pv);
+        return true;
+      }
+      return false;
+    };
+    _deferred->get = [](const value::TimeSamples &src, T *dst, double t,
+                        value::TimeSampleInterpolationType interp) {
+      return src.get(dst, t, interp);
+    };
+    return true;
+  }
+
+  bool is_deferred() const { return bool(_deferred); }
+
   // Get value at specified time.
   // For non-interpolatable types(includes enums and unknown types)
   //
@@ -1188,6 +1411,10 @@ struct TypedTimeSamples {
       return false;
     }
 
+    if (_deferred) {
+      return _deferred->get(_deferred->ts, dst, t, interp);
+    }
+
     if (_dirty) {
       update();
     }
@@ -1243,6 +1470,10 @@ struct TypedTimeSamples {
       return false;
     }
 
+    if (_deferred) {
+      return _deferred->get(_deferred->ts, dst, t, interp);
+    }
+
     if (_dirty) {
       update();
     }
@@ -1326,11 +1557,13 @@ struct TypedTimeSamples {
   }
 
   void add_sample(const Sample &s) {
+    detach();
     _samples.push_back(s);
     _dirty = true;
   }
 
   void add_sample(const double t, const T &v) {
+    detach();
     Sample s;
     s.t = t;
     s.value = v;
@@ -1339,6 +1572,7 @@ struct TypedTimeSamples {
   }
 
   void add_blocked_sample(const double t) {
+    detach();
     Sample s;
     s.t = t;
     s.blocked = true;
@@ -1347,6 +1581,10 @@ struct TypedTimeSamples {
   }
 
   bool has_sample_at(const double t) const {
+    if (_deferred) {
+      return _deferred->ts.has_sample_at(t);
+    }
+
     if (_dirty) {
       update();
     }
@@ -1363,6 +1601,8 @@ struct TypedTimeSamples {
       return false;
     }
 
+    detach();
+
     if (_dirty) {
       update();
     }
@@ -1377,7 +1617,15 @@ struct TypedTimeSamples {
     return false;
   }
 
+  ///
+  /// Deferred samples are decoded and converted to T on the first call.
+  /// Returns empty samples when failed to decode or type mismatch.
+  ///
   const std::vector<Sample> &get_samples() const {
+    if (_deferred) {
+      return _deferred->get_samples();
+    }
+
     if (_dirty) {
       update();
     }
@@ -1386,6 +1634,8 @@ struct TypedTimeSamples {
   }
 
   std::vector<Sample> &samples() {
+    detach();
+
     if (_dirty) {
       update();
     }
@@ -1395,15 +1645,21 @@ struct TypedTimeSamples {
 
   // From typeless timesamples.
   bool from_timesamples(const value::TimeSamples &ts) {
+    const std::vector<value::TimeSamples::Sample> &samples = ts.get_samples();
+    if (samples.size() != ts.size()) {
+      // Failed to decode deferred samples.
+      return false;
+    }
+
     std::vector<Sample> buf;
-    for (size_t i = 0; i < ts.size(); i++) {
-      if (ts.get_samples()[i].value.type_id() != value::TypeTraits<T>::type_id()) {
+    for (size_t i = 0; i < samples.size(); i++) {
+      if (samples[i].value.type_id() != value::TypeTraits<T>::type_id()) {
         return false;
       }
       Sample s;
-      s.t = ts.get_samples()[i].t;
-      s.blocked = ts.get_samples()[i].blocked;
-      if (const auto pv = ts.get_samples()[i].value.as<T>()) {
+      s.t = samples[i].t;
+      s.blocked = samples[i].blocked;
+      if (const auto pv = samples[i].value.as<T>()) {
         s.value = (*pv);
       } else {
         return false;
@@ -1413,6 +1669,7 @@ struct TypedTimeSamples {
     }
 
 
+    clear();
     _samples = std::move(buf);
     _dirty = true;
 
@@ -1420,6 +1677,10 @@ struct TypedTimeSamples {
   }
 
   size_t size() const {
+    if (_deferred) {
+      return _deferred->ts.size();
+    }
+
     if (_dirty) {
       update();
     }
@@ -1427,9 +1688,59 @@ struct TypedTimeSamples {
   }
 
  private:
+  // Deferred samples and their values converted to T(built on demand).
+  // Shared among copies.
+  struct DeferredSamples {
+    value::TimeSamples ts;
+
+    // Set in set_deferred(), so that types without value::TypeTraits(e.g.
+    // enums) can instantiate TypedTimeSamples.
+    bool (*convert)(const value::Value &src, T *dst){nullptr};
+    bool (*get)(const value::TimeSamples &src, T *dst, double t,
+                value::TimeSampleInterpolationType interp){nullptr};
+
+    std::mutex mutex;  // Guards members below.
+    std::vector<Sample> samples;
+    bool converted{false};
+
+    const std::vector<Sample> &get_samples() {
+      std::lock_guard<std::mutex> lock(mutex);
+
+      if (!converted) {
+        converted = true;
+
+        std::vector<Sample> buf;
+        for (const auto &item : ts.get_samples()) {
+          Sample s;
+          s.t = item.t;
+          s.blocked = item.blocked;
+          if (!item.blocked && !convert(item.value, &s.value)) {
+            return samples;
+          }
+          buf.push_back(s);
+        }
+
+        samples = std::move(buf);
+      }
+
+      return samples;
+    }
+  };
+
+  // Copy deferred samples to `_samples` so that they can be modified.
+  void detach() {
+    if (_deferred) {
+      _samples = _deferred->get_samples();
+      _deferred.reset();
+      _dirty = false;
+    }
+  }
+
   // Need to be sorted when looking up the value.
   mutable std::vector<Sample> _samples;
   mutable bool _dirty{false};
+
+  std::shared_ptr<DeferredSamples> _deferred;
 };
 
 //
@@ -1476,8 +1787,7 @@ struct Animatable {
 
     if (value::TimeCode(t).is_default()) {
       if (has_value()) {
-        (*v) = _value;
-        return true;
+        return get_scalar(v);
       }
     }
 
@@ -1502,6 +1812,9 @@ struct Animatable {
 
     if (is_blocked()) {
       return false;
+    } else if (_deferred_value.valid()) {
+      // Decoded on the first access.
+      return _deferred_get(_deferred_value, v);
     } else if (has_value()) {
       (*v) = _value;
       return true;
@@ -1526,6 +1839,7 @@ struct Animatable {
   // Scalar
   void set(const T &v) {
     _value = v;
+    _deferred_value = value::DeferredValue();
     _blocked = false;
     _has_value = true;
   }
@@ -1534,6 +1848,31 @@ struct Animatable {
     set(v);
   }
 
+  ///
+  /// Set default value which is decoded on the first access(e.g. array value
+  /// in USDC). Returns false when the type of `dv` is not T.
+  ///
+  bool set_deferred_default(const value::DeferredValue &dv) {
+    if (!dv.valid() || (dv.type_id != value::TypeTraits<T>::type_id())) {
+      return false;
+    }
+
+    _value = T{};
+    _deferred_value = dv;
+    _deferred_get = [](const value::DeferredValue &src, T *dst) {
+      if (const auto pv = src.get().as<T>()) {
+        (*dst) = (*pv);
+        return true;
+      }
+      return false;
+    };
+    _blocked = false;
+    _has_value = true;
+    return true;
+  }
+
+  bool is_deferred_default() const { return _deferred_value.valid(); }
+
   void set(const TypedTimeSamples<T> &ts) {
     _ts = ts;
   }
@@ -1551,11 +1890,12 @@ struct Animatable {
   }
 
   void clear_scalar() {
+    _deferred_value = value::DeferredValue();
     _has_value = false;
   }
 
   void clear_timesamples() {
-    _ts.samples().clear();
+    _ts.clear();
   }
 
   bool has_value() const {
@@ -1586,6 +1926,12 @@ struct Animatable {
   bool _has_value{false};
   bool _blocked{false};
 
+  // Deferred scalar. `_deferred_get` is set in set_deferred_default(), so
+  // that types without value::TypeTraits(e.g. enums) can instantiate
+  // Animatable.
+  value::DeferredValue _deferred_value;
+  bool (*_deferred_get)(const value::DeferredValue &src, T *dst){nullptr};
+
   // timesamples
   TypedTimeSamples<T> _ts;
 };
@@ -2961,7 +3307,7 @@ struct XformOp {
 
   void set_timesamples(const value::TimeSamples &v) { _var.set_timesamples(v); }
 
-  void set_timesamples(value::TimeSamples &&v) { _var.set_timesamples(v); }
+  void set_timesamples(value::TimeSamples &&v) { _var.set_timesamples(std::move(v)); }
 
   bool is_timesamples() const { return _var.is_timesamples(); }
   bool has_timesamples() const { return _var.has_timesamples(); }
@@ -2984,7 +3330,7 @@ struct XformOp {
 
   nonstd::optional<value::Value> get_scalar() const {
     if (has_default()) {
-      return _var.value_raw();
+      return _var.get_default_raw();
     }
     return nonstd::nullopt;
   }
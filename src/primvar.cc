@@ -28,7 +28,7 @@ bool PrimVar::get_interpolated_value(const double t, const value::TimeSampleInte
 
   if (value::TimeCode(t).is_default()) {
     if (has_default()) {
-      (*dst) = _value;
+      (*dst) = get_default_raw();
       return true;
     }
   }
@@ -103,7 +103,7 @@ bool PrimVar::get_interpolated_value(const double t, const value::TimeSampleInte
   }
 
   if (has_default()) {
-    (*dst) = _value;
+    (*dst) = get_default_raw();
     return true;
   }
 
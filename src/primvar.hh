@@ -42,11 +42,21 @@ struct PrimVar {
   bool _blocked{false}; // ValueBlocked.
   value::TimeSamples _ts; // For TimeSamples value.
 
+  // Borrowed(zero-copy) array for default value. Exclusive with `_value`.
+  value::BorrowedArray _borrowed;
+
+  // Default value decoded on the first access. Exclusive with `_value` and
+  // `_borrowed`.
+  value::DeferredValue _deferred;
+
   bool has_value() const {
     // ValueBlock is treated as having a value.
     if (_blocked) {
       return true;
     }
+    if (_borrowed.valid() || _deferred.valid()) {
+      return true;
+    }
     return (_value.type_id() != value::TypeId::TYPE_ID_INVALID) && (_value.type_id() != value::TypeId::TYPE_ID_NULL);
   }
 
@@ -95,6 +105,14 @@ struct PrimVar {
   }
 
   std::string type_name() const {
+    if (_borrowed.valid()) {
+      return value::GetTypeName(_borrowed.type_id);
+    }
+
+    if (_deferred.valid()) {
+      return value::GetTypeName(_deferred.type_id);
+    }
+
     if (has_default()) {
       return _value.type_name();
     }
@@ -111,6 +129,14 @@ struct PrimVar {
       return value::TYPE_ID_INVALID;
     }
 
+    if (_borrowed.valid()) {
+      return _borrowed.type_id;
+    }
+
+    if (_deferred.valid()) {
+      return _deferred.type_id;
+    }
+
     if (has_default()) {
       return _value.type_id();
     }
@@ -139,9 +165,114 @@ struct PrimVar {
       return nonstd::nullopt;
     }
 
+    if (_borrowed.valid()) {
+      // Copy borrowed array to std::vector.
+      return _borrowed.to_value().get_value<T>();
+    }
+
+    if (_deferred.valid()) {
+      return _deferred.get().get_value<T>();
+    }
+
     return _value.get_value<T>();
   }
 
+  ///
+  /// Get read-only pointer and the number of elements of 1D array default
+  /// value without copying. Works for both borrowed and owned(`std::vector`)
+  /// array.
+  ///
+  template <class T>
+  bool get_array_view(const T **data, size_t *n) const {
+    if (!data || !n) {
+      return false;
+    }
+
+    if (is_blocked() || !has_default()) {
+      return false;
+    }
+
+    if (_borrowed.valid()) {
+      if (const T *p = _borrowed.as<T>()) {
+        (*data) = p;
+        (*n) = _borrowed.size;
+        return true;
+      }
+      return false;
+    }
+
+    // Deferred value is decoded here.
+    if (const std::vector<T> *pv = value_raw().as<std::vector<T>>()) {
+      (*data) = pv->data();
+      (*n) = pv->size();
+      return true;
+    }
+
+    return false;
+  }
+
+  ///
+  /// Get default value as `value::Value`.
+  /// Borrowed array is copied to `std::vector`.
+  ///
+  value::Value get_default_raw() const {
+    if (_borrowed.valid()) {
+      return _borrowed.to_value();
+    }
+    if (_deferred.valid()) {
+      return _deferred.get();
+    }
+    return _value;
+  }
+
+  bool is_borrowed_array() const {
+    return _borrowed.valid();
+  }
+
+  const value::BorrowedArray &borrowed_array() const {
+    return _borrowed;
+  }
+
+  void set_borrowed_array(const value::BorrowedArray &v) {
+    _value = nullptr;
+    _deferred = value::DeferredValue();
+    _borrowed = v;
+    if (!_borrowed.materialized) {
+      // For value_raw() const, as<T>()
+      _borrowed.materialized =
+          std::make_shared<value::BorrowedArray::Materialized>();
+    }
+  }
+
+  bool is_deferred_value() const {
+    return _deferred.valid();
+  }
+
+  const value::DeferredValue &deferred_value() const {
+    return _deferred;
+  }
+
+  void set_deferred_value(const value::DeferredValue &v) {
+    _value = nullptr;
+    _borrowed = value::BorrowedArray();
+    _deferred = v;
+  }
+
+  ///
+  /// Copy borrowed array(or decode deferred value) to owned storage, so that
+  /// the external storage can be released.
+  ///
+  void materialize() {
+    if (_borrowed.valid()) {
+      _value = _borrowed.to_value();
+      _borrowed = value::BorrowedArray();
+    }
+    if (_deferred.valid()) {
+      _value = _deferred.get();
+      _deferred = value::DeferredValue();
+    }
+  }
+
   template <class T>
   nonstd::optional<T> get_default_value() const {
     return get_value<T>();
@@ -200,6 +331,8 @@ struct PrimVar {
 
   // For Scalar only
   // Returns nullptr when type-mismatch.
+  // Borrowed array is copied to `std::vector` on the first call and the copy
+  // is kept with the PrimVar(use get_array_view() to avoid the copy).
   template <class T>
   const T* as() const {
 
@@ -207,15 +340,19 @@ struct PrimVar {
       return nullptr;
     }
 
-    return _value.as<T>();
+    return value_raw().as<T>();
   }
 
   template <class T>
   void set_value(const T &v) {
+    _borrowed = value::BorrowedArray();
+    _deferred = value::DeferredValue();
     _value = v;
   }
 
   void clear_value() {
+    _borrowed = value::BorrowedArray();
+    _deferred = value::DeferredValue();
     _value = nullptr;
   }
 
@@ -328,11 +465,22 @@ struct PrimVar {
     return _ts;
   }
   
+  // Borrowed array(and deferred value) is converted to owned storage.
   value::Value &value_raw() {
+    materialize();
     return _value;
   }
 
+  // Borrowed array is copied to `std::vector` on the first call and the copy
+  // is kept with the PrimVar(shared among copies of this PrimVar).
+  // Deferred value is decoded on the first call.
   const value::Value &value_raw() const {
+    if (_borrowed.valid()) {
+      return _borrowed.materialized_value();
+    }
+    if (_deferred.valid()) {
+      return _deferred.get();
+    }
     return _value;
   }
   
@@ -292,7 +292,8 @@ PYBIND11_MODULE(ctinyusdz, m) {
 
              return py::none();
            })
-      .def("ExportToString", &Stage::ExportToString)
+      .def("ExportToString", &Stage::ExportToString,
+           py::arg("relative_path") = false, py::arg("num_threads") = -1)
       .def("dump_prim_tree", &Stage::dump_prim_tree)
       .def("find_prim_by_prim_id",
            [](Stage &s, uint64_t prim_id) -> py::object {
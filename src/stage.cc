@@ -460,23 +460,30 @@ void PrimPrintRec(std::stringstream &ss, const Prim &prim, uint32_t indent) {
 
 }  // namespace
 
-std::string Stage::ExportToString(bool relative_path) const {
-  (void)relative_path; // TODO
-
+std::string Stage::ExportToString(bool relative_path, int num_threads) const {
   std::stringstream ss;
 
+  ExportToStream(ss, relative_path, num_threads);
+
+  return ss.str();
+}
+
+void Stage::ExportToStream(std::ostream &ss, bool relative_path,
+                           int num_threads) const {
+  (void)relative_path; // TODO
+
   ss << "#usda 1.0\n";
 
-  std::stringstream meta_ss;
-  meta_ss << print_layer_metas(stage_metas, /* indent */1);
-  if (meta_ss.str().size()) {
+  std::string meta_str = print_layer_metas(stage_metas, /* indent */1);
+  if (meta_str.size()) {
     ss << "(\n";
-    ss << meta_ss.str();
+    ss << meta_str;
     ss << ")\n";
   }
 
   ss << "\n";
 
+  std::vector<const Prim *> root_prims;
   if (stage_metas.primChildren.size() == _root_nodes.size()) {
     std::map<std::string, const Prim *> primNameTable;
     for (size_t i = 0; i < _root_nodes.size(); i++) {
@@ -489,27 +496,19 @@ std::string Stage::ExportToString(bool relative_path) const {
                         stage_metas.primChildren.size(), nameTok.str()));
       const auto it = primNameTable.find(nameTok.str());
       if (it != primNameTable.end()) {
-        //PrimPrintRec(ss, *(it->second), 0);
-        ss << prim::print_prim(*(it->second), 0);
-        if (i != (stage_metas.primChildren.size() - 1)) {
-          ss << "\n";
-        }
+        root_prims.push_back(it->second);
       } else {
         // TODO: Report warning?
       }
     }
   } else {
     for (size_t i = 0; i < _root_nodes.size(); i++) {
-      //PrimPrintRec(ss, _root_nodes[i], 0);
-      ss << prim::print_prim(_root_nodes[i], 0);
-
-      if (i != (_root_nodes.size() - 1)) {
-        ss << "\n";
-      }
+      root_prims.push_back(&_root_nodes[i]);
     }
   }
 
-  return ss.str();
+  // Root Prims and their subtrees are printed in parallel.
+  prim::print_prims(ss, root_prims, 0, num_threads);
 }
 
 bool Stage::allocate_prim_id(uint64_t *prim_id) const {
@@ -50,8 +50,19 @@ class Stage {
   ///
   /// Dump Stage as ASCII(USDA) representation.
   /// @param[in] relative_path (optional) Print Path as relative Path.
+  /// @param[in] num_threads (optional) # of threads to print Prims. -1 = use
+  /// all cores. 1 = no threading. The output does not depend on the # of
+  /// threads.
   ///
-  std::string ExportToString(bool relative_path = false) const;
+  std::string ExportToString(bool relative_path = false, int num_threads = -1) const;
+
+  ///
+  /// Write Stage as ASCII(USDA) representation to the stream.
+  /// Same output as ExportToString(), but Prim subtrees are printed in
+  /// batches of `num_threads` and each batch is written to `os` before the
+  /// next one is printed, so the whole USDA string is not built in memory.
+  ///
+  void ExportToStream(std::ostream &os, bool relative_path = false, int num_threads = -1) const;
 
   // pxrUSD compat API end -------------------------------------
 
@@ -31,305 +31,243 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // Simple byte stream writer. Consider endianness when writing 2, 4, 8 bytes data.
 //
 
+#include <algorithm>
 #include <cstdint>
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
-#include <memory>
+#include <limits>
+#include <vector>
 
 namespace tinyusdz {
 
-namespace {
-
-static inline void swap2(unsigned short *val) {
-  unsigned short tmp = *val;
-  uint8_t *dst = reinterpret_cast<uint8_t *>(val);
-  uint8_t *src = reinterpret_cast<uint8_t *>(&tmp);
-
-  dst[0] = src[1];
-  dst[1] = src[0];
-}
-
-static inline void swap4(uint32_t *val) {
-  uint32_t tmp = *val;
-  uint8_t *dst = reinterpret_cast<uint8_t *>(val);
-  uint8_t *src = reinterpret_cast<uint8_t *>(&tmp);
-
-  dst[0] = src[3];
-  dst[1] = src[2];
-  dst[2] = src[1];
-  dst[3] = src[0];
-}
-
-static inline void swap4(int *val) {
-  int tmp = *val;
-  uint8_t *dst = reinterpret_cast<uint8_t *>(val);
-  uint8_t *src = reinterpret_cast<uint8_t *>(&tmp);
-
-  dst[0] = src[3];
-  dst[1] = src[2];
-  dst[2] = src[1];
-  dst[3] = src[0];
-}
-
-static inline void swap8(uint64_t *val) {
-  uint64_t tmp = (*val);
-  uint8_t *dst = reinterpret_cast<uint8_t *>(val);
-  uint8_t *src = reinterpret_cast<uint8_t *>(&tmp);
-
-  dst[0] = src[7];
-  dst[1] = src[6];
-  dst[2] = src[5];
-  dst[3] = src[4];
-  dst[4] = src[3];
-  dst[5] = src[2];
-  dst[6] = src[1];
-  dst[7] = src[0];
-}
-
-static inline void swap8(int64_t *val) {
-  int64_t tmp = (*val);
-  uint8_t *dst = reinterpret_cast<uint8_t *>(val);
-  uint8_t *src = reinterpret_cast<uint8_t *>(&tmp);
-
-  dst[0] = src[7];
-  dst[1] = src[6];
-  dst[2] = src[5];
-  dst[3] = src[4];
-  dst[4] = src[3];
-  dst[5] = src[2];
-  dst[6] = src[1];
-  dst[7] = src[0];
-}
-
-} // namespace
-
-#if 0 // TODO
-
 ///
-/// Simple stream writeer
+/// Simple stream writer backed by memory or a file.
+/// The buffer grows on demand up to `max_length` bytes.
+///
+/// In file-backed mode, written data is buffered up to `buffer_size` bytes and
+/// then appended to the file, so memory usage is bounded regardless of the
+/// output size. seek_set() is limited to the buffered(not yet flushed) range,
+/// and data()/buffer()/release() are not available.
 ///
 class StreamWriter {
  public:
   // max_length: Max byte lengths.
-  explicit StreamWriter(const size_t max_length,
-                        const bool swap_endian)
-      : max_length_(max_length), swap_endian_(swap_endian), idx_(0) {
-    (void)pad_;
+  explicit StreamWriter(const size_t max_length = (std::numeric_limits<size_t>::max)(),
+                        const bool swap_endian = false)
+      : max_length_(max_length), swap_endian_(swap_endian) {}
+
+  // fp: File opened with read/write mode("w+b"). Not closed by StreamWriter.
+  // buffer_size: Bytes to buffer before appending to the file.
+  StreamWriter(FILE *fp, const size_t buffer_size,
+               const bool swap_endian = false)
+      : max_length_((std::numeric_limits<size_t>::max)()),
+        swap_endian_(swap_endian),
+        fp_(fp),
+        buffer_size_((std::max)(buffer_size, size_t(1))) {
+    binary_.reserve(buffer_size_);
   }
 
-  bool seek_set(const uint64_t offset) const {
-    if (offset >= max_length_) {
-      return false;
-    }
+  StreamWriter(const StreamWriter &) = delete;
+  StreamWriter &operator=(const StreamWriter &) = delete;
 
-    idx_ = offset;
-    return true;
-  }
-
-  bool seek_from_current(const int64_t offset) const {
-    if ((int64_t(idx_) + offset) < 0) {
-      return false;
-    }
+  bool is_file_backed() const { return fp_ != nullptr; }
 
-    if (size_t((int64_t(idx_) + offset)) > length_) {
+  bool seek_set(const uint64_t offset) {
+    if ((offset < base_) || ((offset - base_) > binary_.size())) {
       return false;
     }
 
-    idx_ = size_t(int64_t(idx_) + offset);
+    idx_ = size_t(offset - base_);
     return true;
   }
 
-  size_t writeN(const size_t n, const uint64_t dst_len, uint8_t *dst) const {
-    size_t len = n;
-    if ((idx_ + len) > length_) {
-      len = length_ - size_t(idx_);
-    }
-
-    if (len > 0) {
-      if (dst_len < len) {
-        // dst does not have enough space. return 0 for a while.
-        return 0;
-      }
-
-      memcpy(dst, &binary_[idx_], len);
-      idx_ += len;
-      return len;
+  bool seek_end() {
+    idx_ = binary_.size();
+    return true;
+  }
 
-    } else {
-      return 0;
+  ///
+  /// Write `n` bytes at the current position.
+  ///
+  bool write(const void *src, const size_t n) {
+    if (n == 0) {
+      return true;
     }
-  }
 
-  bool write1(uint8_t *ret) const {
-    if ((idx_ + 1) > length_) {
+    if (!src) {
       return false;
     }
 
-    const uint8_t val = binary_[idx_];
-
-    (*ret) = val;
-    idx_ += 1;
-
-    return true;
-  }
-
-  bool write_bool(bool *ret) const {
-    if ((idx_ + 1) > length_) {
+    if (!Reserve_(n)) {
       return false;
     }
 
-    const char val = static_cast<const char>(binary_[idx_]);
+    memcpy(&binary_[idx_], src, n);
+    idx_ += n;
 
-    (*ret) = bool(val);
-    idx_ += 1;
+    if (fp_ && (binary_.size() >= buffer_size_) && (idx_ == binary_.size())) {
+      return flush();
+    }
 
     return true;
   }
 
-  bool write1(char *ret) const {
-    if ((idx_ + 1) > length_) {
-      return false;
-    }
-
-    const char val = static_cast<const char>(binary_[idx_]);
+  bool write1(const uint8_t v) { return write(&v, 1); }
 
-    (*ret) = val;
-    idx_ += 1;
-
-    return true;
-  }
+  bool write_bool(const bool v) { return write1(v ? 1 : 0); }
 
-  bool write2(unsigned short *ret) const {
-    if ((idx_ + 2) > length_) {
-      return false;
-    }
+  bool write2(const uint16_t v) { return write_swapped(&v, 2); }
 
-    unsigned short val =
-        *(reinterpret_cast<const unsigned short *>(&binary_[idx_]));
+  bool write4(const uint32_t v) { return write_swapped(&v, 4); }
+  bool write4(const int32_t v) { return write_swapped(&v, 4); }
 
-    if (swap_endian_) {
-      swap2(&val);
-    }
+  bool write8(const uint64_t v) { return write_swapped(&v, 8); }
+  bool write8(const int64_t v) { return write_swapped(&v, 8); }
 
-    (*ret) = val;
-    idx_ += 2;
+  bool write_float(const float v) { return write_swapped(&v, 4); }
 
-    return true;
-  }
+  bool write_double(const double v) { return write_swapped(&v, 8); }
 
-  bool write4(uint32_t *ret) const {
-    if ((idx_ + 4) > length_) {
+  ///
+  /// Overwrite bytes at `offset` without changing the current position.
+  ///
+  bool write_at(const uint64_t offset, const void *src, const size_t n) {
+    if ((offset > size()) || (n > (size() - offset))) {
       return false;
     }
 
-    uint32_t val = *(reinterpret_cast<const uint32_t *>(&binary_[idx_]));
+    const uint8_t *p = reinterpret_cast<const uint8_t *>(src);
 
-    if (swap_endian_) {
-      swap4(&val);
+    // Flushed(file) part.
+    if (offset < base_) {
+      size_t sz = size_t((std::min)(uint64_t(n), base_ - offset));
+      if (!seek_file_(offset) || (fwrite(p, 1, sz, fp_) != sz) ||
+          !seek_file_(base_)) {
+        return false;
+      }
+      if (sz == n) {
+        return true;
+      }
+      return write_at(base_, p + sz, n - sz);
     }
 
-    (*ret) = val;
-    idx_ += 4;
-
+    memcpy(&binary_[size_t(offset - base_)], p, n);
     return true;
   }
 
-  bool write4(int *ret) const {
-    if ((idx_ + 4) > length_) {
+  ///
+  /// Read back `n` bytes at `offset` written so far.
+  ///
+  bool read_at(const uint64_t offset, void *dst, const size_t n) {
+    if ((offset > size()) || (n > (size() - offset))) {
       return false;
     }
 
-    int val = *(reinterpret_cast<const int *>(&binary_[idx_]));
+    uint8_t *p = reinterpret_cast<uint8_t *>(dst);
 
-    if (swap_endian_) {
-      swap4(&val);
+    if (offset < base_) {
+      size_t sz = size_t((std::min)(uint64_t(n), base_ - offset));
+      if (!seek_file_(offset) || (fread(p, 1, sz, fp_) != sz) ||
+          !seek_file_(base_)) {
+        return false;
+      }
+      if (sz == n) {
+        return true;
+      }
+      return read_at(base_, p + sz, n - sz);
     }
 
-    (*ret) = val;
-    idx_ += 4;
-
+    memcpy(p, &binary_[size_t(offset - base_)], n);
     return true;
   }
 
-  bool write8(uint64_t *ret) const {
-    if ((idx_ + 8) > length_) {
-      return false;
+  ///
+  /// Append buffered data to the file(file-backed mode only).
+  ///
+  bool flush() {
+    if (!fp_) {
+      return true;
     }
 
-    uint64_t val = *(reinterpret_cast<const uint64_t *>(&binary_[idx_]));
-
-    if (swap_endian_) {
-      swap8(&val);
+    if (!binary_.empty()) {
+      if (fwrite(binary_.data(), 1, binary_.size(), fp_) != binary_.size()) {
+        return false;
+      }
+      base_ += binary_.size();
+      binary_.clear();
+      idx_ = 0;
     }
 
-    (*ret) = val;
-    idx_ += 8;
-
-    return true;
+    return fflush(fp_) == 0;
   }
 
-  bool write8(int64_t *ret) const {
-    if ((idx_ + 8) > length_) {
-      return false;
-    }
-
-    int64_t val = *(reinterpret_cast<const int64_t *>(&binary_[idx_]));
+  uint64_t tell() const { return base_ + idx_; }
 
-    if (swap_endian_) {
-      swap8(&val);
-    }
+  bool swap_endian() const { return swap_endian_; }
 
-    (*ret) = val;
-    idx_ += 8;
+  uint64_t size() const { return base_ + binary_.size(); }
 
-    return true;
-  }
+  const uint8_t *data() const { return binary_.data(); }
 
-  bool write_float(const float value) const {
-    if (!write4(reinterpret_cast<const int *>(&value))) {
-      return false;
-    }
+  const std::vector<uint8_t> &buffer() const { return binary_; }
 
-    return true;
+  ///
+  /// Move out written data. StreamWriter becomes empty.
+  ///
+  void release(std::vector<uint8_t> *dst) {
+    (*dst) = std::move(binary_);
+    binary_.clear();
+    idx_ = 0;
   }
 
-  bool write_double(const double value) const {
-    if (!write8(reinterpret_cast<const uint64_t *>(&value))) {
-      return false;
+ private:
+  bool write_swapped(const void *src, const size_t n) {
+    if (!swap_endian_) {
+      return write(src, n);
     }
 
-    return true;
+    uint8_t buf[8];
+    memcpy(buf, src, n);
+    std::reverse(buf, buf + n);
+    return write(buf, n);
   }
 
-  size_t tell() const { return size_t(idx_); }
-  //bool eof() const { return idx_ >= length_; }
-
-  bool swap_endian() const { return swap_endian_; }
-
-  size_t size() const { return length_; }
-
- private:
+  bool seek_file_(const uint64_t offset) {
+#if defined(_WIN32)
+    return _fseeki64(fp_, int64_t(offset), SEEK_SET) == 0;
+#else
+    return fseeko(fp_, off_t(offset), SEEK_SET) == 0;
+#endif
+  }
 
   bool Reserve_(size_t additional_bytes) {
-    size_t req_bytes = binary_.size() + additional_bytes;
-
-    if (req_bytes > max_length_) {
+    if (additional_bytes > (max_length_ - idx_)) {
       return false;
     }
 
-    // grow +20%
-
-    //
-    binary_.resize
+    size_t req_bytes = idx_ + additional_bytes;
+    if (req_bytes > binary_.size()) {
+      if (req_bytes > binary_.capacity()) {
+        // grow x1.5
+        size_t new_cap = (std::max)(req_bytes, binary_.capacity() + binary_.capacity() / 2);
+        binary_.reserve((std::min)(new_cap, max_length_));
+      }
+      binary_.resize(req_bytes);
+    }
 
+    return true;
   }
 
-  const std::vector<uint8_t> binary_;
-  const size_t max_length_;
-  bool swap_endian_;
-  char pad_[7];
-  mutable uint64_t idx_;
+  std::vector<uint8_t> binary_;
+  size_t max_length_;
+  bool swap_endian_{false};
+  size_t idx_{0};  // position in `binary_`
+
+  // file-backed mode
+  FILE *fp_{nullptr};
+  size_t buffer_size_{0};
+  uint64_t base_{0};  // file offset of `binary_[0]`(= flushed bytes)
 };
-#endif
 
 } // namespace tinyusdz
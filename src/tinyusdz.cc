@@ -78,10 +78,43 @@ namespace tinyusdz {
   }
 //#define PushWarn(s) if (warn) { (*warn) += s; }
 
-bool LoadUSDCFromMemory(const uint8_t *addr, const size_t length,
-                        const std::string &filename, Stage *stage,
-                        std::string *warn, std::string *err,
-                        const USDLoadOptions &options) {
+bool USDLoadFilter::accept_prim_path(const std::string &prim_path) const {
+  if (prim_path_prefixes.empty()) {
+    return true;
+  }
+
+  for (const auto &prefix : prim_path_prefixes) {
+    if (prefix.empty() || (prefix == "/") || (prefix == prim_path)) {
+      return true;
+    }
+
+    // descendant of `prefix`
+    if ((prim_path.size() > prefix.size()) &&
+        (prim_path.compare(0, prefix.size(), prefix) == 0) &&
+        (prim_path[prefix.size()] == '/')) {
+      return true;
+    }
+
+    // ancestor of `prefix`
+    if ((prefix.size() > prim_path.size()) &&
+        (prefix.compare(0, prim_path.size(), prim_path) == 0) &&
+        (prefix[prim_path.size()] == '/')) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+namespace {
+
+// `buffer_owner` : Owner of `addr`(used for zero-copy array and deferred
+// TimeSamples/values).
+bool LoadUSDCFromMemoryImpl(const uint8_t *addr, const size_t length,
+                            const std::string &filename, Stage *stage,
+                            std::string *warn, std::string *err,
+                            const USDLoadOptions &options,
+                            std::shared_ptr<const void> buffer_owner) {
   if (stage == nullptr) {
     if (err) {
       (*err) = "null pointer for `stage` argument.\n";
@@ -125,6 +158,20 @@ bool LoadUSDCFromMemory(const uint8_t *addr, const size_t length,
   usdc::USDCReaderConfig config;
   config.numThreads = options.num_threads;
   config.strict_allowedToken_check = options.strict_allowedToken_check;
+  if (options.zero_copy_arrays && buffer_owner) {
+    config.zero_copy_arrays = true;
+    config.buffer_owner = buffer_owner;
+  }
+  if (options.deferred_timesamples && buffer_owner) {
+    config.deferred_timesamples = true;
+    config.max_cached_timesamples = options.max_cached_timesamples;
+    config.buffer_owner = buffer_owner;
+  }
+  config.deferred_value_unpack = options.deferred_value_unpack;
+  if (options.deferred_value_unpack && buffer_owner) {
+    config.buffer_owner = buffer_owner;
+  }
+  config.filter = options.filter;
   usdc::USDCReader reader(&sr, config);
 
   if (!reader.ReadUSDC()) {
@@ -171,6 +218,17 @@ bool LoadUSDCFromMemory(const uint8_t *addr, const size_t length,
   return true;
 }
 
+}  // namespace
+
+bool LoadUSDCFromMemory(const uint8_t *addr, const size_t length,
+                        const std::string &filename, Stage *stage,
+                        std::string *warn, std::string *err,
+                        const USDLoadOptions &options) {
+  // `addr` is owned by the caller, so no zero-copy array.
+  return LoadUSDCFromMemoryImpl(addr, length, filename, stage, warn, err,
+                                options, nullptr);
+}
+
 bool LoadUSDCFromFile(const std::string &_filename, Stage *stage,
                       std::string *warn, std::string *err,
                       const USDLoadOptions &options) {
@@ -195,6 +253,23 @@ bool LoadUSDCFromFile(const std::string &_filename, Stage *stage,
       }
     }
 
+    if (options.zero_copy_arrays || options.deferred_timesamples ||
+        options.deferred_value_unpack) {
+      // Unmap the file when the last Attribute referencing it is destroyed.
+      std::shared_ptr<const void> mapping(
+          new io::MMapFileHandle(handle), [](const void *p) {
+            const io::MMapFileHandle *h =
+                static_cast<const io::MMapFileHandle *>(p);
+            std::string _err;
+            io::UnmapFile(*h, &_err);
+            delete h;
+          });
+
+      return LoadUSDCFromMemoryImpl(handle.addr, size_t(handle.size),
+                                    filepath, stage, warn, err, options,
+                                    mapping);
+    }
+
     bool ret = LoadUSDCFromMemory(handle.addr, size_t(handle.size), filepath, stage, warn,
                               err, options);
 
@@ -213,7 +288,10 @@ bool LoadUSDCFromFile(const std::string &_filename, Stage *stage,
     return ret;
 
   } else {
-    std::vector<uint8_t> data;
+    // Shared since Attributes may reference the data(zero-copy array,
+    // deferred TimeSamples).
+    auto buffer = std::make_shared<std::vector<uint8_t>>();
+    std::vector<uint8_t> &data = *buffer;
     size_t max_bytes = 1024 * 1024 * size_t(options.max_memory_limit_in_mb);
     if (!io::ReadWholeFile(&data, err, filepath, max_bytes,
                            /* userdata */ nullptr)) {
@@ -235,8 +313,8 @@ bool LoadUSDCFromFile(const std::string &_filename, Stage *stage,
       return false;
     }
 
-    return LoadUSDCFromMemory(data.data(), data.size(), filepath, stage, warn,
-                              err, options);
+    return LoadUSDCFromMemoryImpl(data.data(), data.size(), filepath, stage,
+                                  warn, err, options, buffer);
   }
 }
 
@@ -728,6 +806,8 @@ bool LoadUSDAFromMemory(const uint8_t *addr, const size_t length,
   tinyusdz::usda::USDAReaderConfig config;
   config.strict_allowedToken_check = options.strict_allowedToken_check;
   config.allow_unknown_apiSchema = !options.strict_apiSchema_check;
+  config.num_threads = options.num_threads;
+  config.filter = options.filter;
   reader.set_reader_config(config);
 
   reader.SetBaseDir(base_dir);
@@ -790,7 +870,7 @@ bool LoadUSDAFromFile(const std::string &_filename, Stage *stage,
       }
     }
 
-    bool ret = LoadUSDAFromMemory(handle.addr, size_t(handle.size), filepath, stage, warn,
+    bool ret = LoadUSDAFromMemory(handle.addr, size_t(handle.size), base_dir, stage, warn,
                               err, options);
 
     {
@@ -846,6 +926,16 @@ bool LoadUSDFromFile(const std::string &_filename, Stage *stage,
       }
     }
 
+    if ((options.zero_copy_arrays || options.deferred_timesamples ||
+         options.deferred_value_unpack) &&
+        IsUSDC(handle.addr, size_t(handle.size))) {
+      // LoadUSDCFromFile() keeps the file mapped while Attributes reference
+      // it.
+      std::string _err;
+      io::UnmapFile(handle, &_err);
+      return LoadUSDCFromFile(filepath, stage, warn, err, options);
+    }
+
     bool ret = LoadUSDFromMemory(handle.addr, size_t(handle.size), filepath, stage, warn,
                               err, options);
 
@@ -1139,6 +1229,9 @@ bool LoadUSDCLayerFromMemory(const uint8_t *addr, const size_t length,
   config.numThreads = options.num_threads;
   config.strict_allowedToken_check = options.strict_allowedToken_check;
   config.allow_unknown_apiSchemas = !options.strict_apiSchema_check;
+  // `sr` is alive until get_as_layer() finishes.
+  config.deferred_value_unpack = options.deferred_value_unpack;
+  config.filter = options.filter;
   usdc::USDCReader reader(&sr, config);
 
   if (!reader.ReadUSDC()) {
@@ -1218,6 +1311,8 @@ bool LoadUSDALayerFromMemory(const uint8_t *addr, const size_t length,
 
   tinyusdz::usda::USDAReaderConfig config;
   config.strict_allowedToken_check = options.strict_allowedToken_check;
+  config.num_threads = options.num_threads;
+  config.filter = options.filter;
   reader.set_reader_config(config);
 
   uint32_t load_states = static_cast<uint32_t>(tinyusdz::LoadState::Toplevel);
@@ -1500,6 +1595,59 @@ bool LoadLayerFromFile(const std::string &_filename, Layer *stage,
   std::string filepath = io::ExpandFilePath(_filename, /* userdata */ nullptr);
   std::string base_dir = io::GetBaseDir(_filename);
 
+  if (io::IsMMapSupported()) {
+    // Parse directly from the mapped file. Layer does not reference the input
+    // buffer after loading, so the file can be unmapped on return.
+    io::MMapFileHandle handle;
+
+    {
+      std::string _err;
+      if (!io::MMapFile(filepath, &handle, /* writable */false, &_err)) {
+        if (err) {
+          (*err) += _err + "\n";
+        }
+        return false;
+      }
+
+      if (_err.size()) {
+        if (warn) {
+          (*warn) += _err + "\n";
+        }
+      }
+    }
+
+    // Apply the same limit as ReadWholeFile().
+    size_t max_bytes = 1024 * 1024 * size_t(options.max_memory_limit_in_mb);
+    if ((max_bytes > 0) && (uint64_t(handle.size) > uint64_t(max_bytes))) {
+      std::string _err;
+      io::UnmapFile(handle, &_err);
+      if (err) {
+        (*err) += "File size is too large : " + filepath +
+                  " sz = " + std::to_string(handle.size) +
+                  ", allowed max filesize = " + std::to_string(max_bytes) +
+                  "\n";
+      }
+      return false;
+    }
+
+    bool ret = LoadLayerFromMemory(handle.addr, size_t(handle.size), filepath,
+                                   stage, warn, err, options);
+
+    {
+      std::string _err;
+      // Ignore unmap result for now.
+      io::UnmapFile(handle, &_err);
+
+      if (_err.size()) {
+        if (warn) {
+          (*warn) += _err + "\n";
+        }
+      }
+    }
+
+    return ret;
+  }
+
   std::vector<uint8_t> data;
   size_t max_bytes = 1024 * 1024 * size_t(options.max_memory_limit_in_mb);
   if (!io::ReadWholeFile(&data, err, filepath, max_bytes,
@@ -8,8 +8,10 @@
 #include <array>
 #include <cmath>
 #include <cstring>
+#include <functional>
 #include <limits>
 #include <map>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -50,6 +52,66 @@ constexpr int version_minor = 9;
 constexpr int version_micro = 1;
 constexpr auto version_rev = "";  // extra revision suffix(e.g. "rc.1")
 
+///
+/// Load-time filter for selective Prim/Property loading.
+/// Filtered-out Prims and Properties are skipped before their Prim objects
+/// are built(and for USDC, before Property values are unpacked when
+/// `USDLoadOptions::deferred_value_unpack` is enabled).
+///
+struct USDLoadFilter {
+  ///
+  /// Load Prims under these absolute Prim paths(e.g. `/root/geom`) only.
+  /// Ancestor Prims of these paths are also loaded to keep the hierarchy.
+  /// Empty = load all Prims.
+  ///
+  std::vector<std::string> prim_path_prefixes;
+
+  ///
+  /// Load Prims with these type names(e.g. `Material`, `Shader`) only.
+  /// Prims of other types are skipped together with their descendants, so
+  /// include grouping types(e.g. `Xform`, `Scope`) to reach nested Prims.
+  /// Untyped Prims(no typeName) are always loaded.
+  /// Empty = load all types.
+  ///
+  std::set<std::string> prim_types;
+
+  ///
+  /// Return false to skip the Property.
+  /// args: absolute Prim path, Property name(e.g. `primvars:st`)
+  /// nullptr = load all Properties.
+  /// Called from the thread calling the load function only(also when
+  /// `USDLoadOptions::num_threads` != 1), so it does not need to be
+  /// thread-safe.
+  ///
+  std::function<bool(const std::string &prim_path,
+                     const std::string &prop_name)>
+      property_filter;
+
+  bool empty() const {
+    return prim_path_prefixes.empty() && prim_types.empty() &&
+           !property_filter;
+  }
+
+  /// True when the Prim at `prim_path` is(or is an ancestor of) a Prim
+  /// selected by `prim_path_prefixes`.
+  bool accept_prim_path(const std::string &prim_path) const;
+
+  bool accept_prim_type(const std::string &type_name) const {
+    if (prim_types.empty() || type_name.empty()) {
+      return true;
+    }
+    return prim_types.count(type_name) > 0;
+  }
+
+  bool accept_property(const std::string &prim_path,
+                       const std::string &prop_name) const {
+    if (!property_filter) {
+      return true;
+    }
+    return property_filter(prim_path, prop_name);
+  }
+};
+
 struct USDLoadOptions {
   ///
   /// Set the number of threads to use when parsing USD scene.
@@ -111,6 +173,38 @@ struct USDLoadOptions {
   /// apiSchema
   ///
   bool strict_apiSchema_check{false}; // Make parse error when unknown apiSchema
+
+  ///
+  /// USDC only. When the file is loaded with mmap, uncompressed array
+  /// values(e.g. `point3f[] points`) are not copied and Attributes reference
+  /// the mapped file data directly(see `value::BorrowedArray`). The file stays
+  /// mapped while any Attribute references it.
+  ///
+  bool zero_copy_arrays{false};
+
+  ///
+  /// USDC only. Decode TimeSamples values on demand(when evaluated with
+  /// `get()`) instead of decoding all samples at load time. The file data is
+  /// kept in memory while any deferred TimeSamples references it.
+  /// `max_cached_timesamples` : Max number of decoded samples kept in each
+  /// TimeSamples(least recently used ones are released). 0 = no limit.
+  ///
+  bool deferred_timesamples{false};
+  size_t max_cached_timesamples{0};
+
+  ///
+  /// USDC only. Unpack field values of each Prim when the Prim is
+  /// reconstructed, instead of unpacking all values at once. When the file is
+  /// loaded with mmap, numeric array values(e.g. `point3f[] points`) are
+  /// decoded on the first access(e.g. `Animatable::get()`) and the file data
+  /// is kept in memory while any Attribute references it.
+  ///
+  bool deferred_value_unpack{false};
+
+  ///
+  /// Load only a part of the scene(USDA/USDC). See USDLoadFilter.
+  ///
+  USDLoadFilter filter;
   
   ///
   /// User-defined fileformat hander.
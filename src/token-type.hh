@@ -7,16 +7,17 @@
 //
 // `token` is primarily used for a short-length string.
 //
-// Unlike pxrUSD, `Token` class does not acquire a lock by default. This means
-// there is a potential hash collision for the hash value of `Token` string, but
-// TinyUSDZ does not require token(string) hashes are unique inside of TinyUSDZ
-// library. If you need pxrUSD-like behavior of `Token` class(i.e, you want a
-// token hash with no collision), you can compile TinyUSDZ with
-// TINYUSDZ_USE_STRING_ID_FOR_TOKEN_TYPE.
-// (Also you need to include foonathan/string_id c++ files(Please see <tinyusdz>/CMakeLists.txt) to your project)
+// By default, `Token` is a pointer to a string interned in the global token
+// table(like pxrUSD's TfToken). Same strings share the same table entry, so
+// copying a Token does not allocate, equality check is a pointer comparison
+// and the hash value is precomputed when the string is interned.
+// The token table is guarded with sharded locks, so Tokens can be constructed
+// from multiple threads. Table entries are reference counted, and an entry is
+// removed from the table when the last Token referring it is destroyed.
 //
 // TINYUSDZ_USE_STRING_ID_FOR_TOKEN_TYPE
 //   - Use foonathan/string_id to implement Token class.
+//   (Also you need to include foonathan/string_id c++ files(Please see <tinyusdz>/CMakeLists.txt) to your project)
 //   - database(token storage) is accessed with mutex so an application should
 //   not frequently construct Token class among threads.
 //
@@ -45,6 +46,8 @@
 #endif
 
 #else  // TINYUSDZ_USE_STRING_ID_FOR_TOKEN_TYPE
+#include <atomic>
+#include <cstring>
 #include <functional>
 #endif  // TINYUSDZ_USE_STRING_ID_FOR_TOKEN_TYPE
 
@@ -93,6 +96,8 @@ class Token {
     str_ = sid::string_id(str, TokenStorage::GetInstance());
   }
 
+  explicit Token(const char *str, size_t len) : Token(std::string(str, len)) {}
+
   const std::string str() const {
     if (!str_) {
       return std::string();
@@ -143,49 +148,131 @@ struct TokenKeyEqual {
 
 #else  // TINYUSDZ_USE_STRING_ID_FOR_TOKEN_TYPE
 
+// Entry of the global token table. Immutable once interned(except for
+// `refcount`).
+struct TokenEntry {
+  std::string str;
+  size_t hash{0};
+  mutable std::atomic<uint32_t> refcount{0};
+};
+
+///
+/// Look up the global token table and return the entry for `str`(registers
+/// new entry when not found). Increments the reference count of returned
+/// entry. Returns nullptr for an empty string.
+///
+const TokenEntry *InternToken(const char *str, size_t len);
+
+///
+/// Remove the entry from the global token table and free it. Called when the
+/// reference count of the entry drops to zero.
+///
+void ReleaseTokenLast(const TokenEntry *entry);
+
+///
+/// Number of strings in the global token table(for debugging/statistics).
+///
+size_t NumInternedTokens();
+
 class Token {
  public:
   Token() {}
 
-  explicit Token(const std::string &str) { str_ = str; }
+  explicit Token(const std::string &str)
+      : entry_(InternToken(str.c_str(), str.size())) {}
 
-  explicit Token(const char *str) { str_ = str; }
+  explicit Token(const char *str)
+      : entry_(InternToken(str, str ? strlen(str) : 0)) {}
 
-  const std::string &str() const { return str_; }
+  explicit Token(const char *str, size_t len) : entry_(InternToken(str, len)) {}
 
-  bool valid() const {
-    if (str().empty()) {
-      return false;
+  Token(const Token &rhs) : entry_(rhs.entry_) { Retain(entry_); }
+
+  Token(Token &&rhs) noexcept : entry_(rhs.entry_) { rhs.entry_ = nullptr; }
+
+  ~Token() { Release(entry_); }
+
+  Token &operator=(const Token &rhs) {
+    Retain(rhs.entry_);
+    Release(entry_);
+    entry_ = rhs.entry_;
+    return (*this);
+  }
+
+  Token &operator=(Token &&rhs) noexcept {
+    if (this != &rhs) {
+      Release(entry_);
+      entry_ = rhs.entry_;
+      rhs.entry_ = nullptr;
     }
+    return (*this);
+  }
 
-    return true;
+  const std::string &str() const {
+    if (!entry_) {
+      return EmptyString();
+    }
+    return entry_->str;
   }
 
-  // No string hash for TinyUSDZ
-#if 0
-  uint64_t hash() const {
-    if (!str_) {
+  // Precomputed hash of the string. 0 for an empty Token.
+  size_t hash() const {
+    if (!entry_) {
       return 0;
     }
+    return entry_->hash;
+  }
 
-    // Assume non-zero hash value for non-empty string.
-    return str_.value().hash_code();
+  bool valid() const {
+    // Empty string is not interned.
+    return entry_ != nullptr;
   }
-#endif
+
+  // Tokens are equal iff they point to the same table entry.
+  bool is_same(const Token &rhs) const { return entry_ == rhs.entry_; }
 
  private:
-  std::string str_;
+  static const std::string &EmptyString() {
+    static const std::string *s = new std::string();
+    return *s;
+  }
+
+  static void Retain(const TokenEntry *entry) {
+    if (entry) {
+      entry->refcount.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  static void Release(const TokenEntry *entry) {
+    if (!entry) {
+      return;
+    }
+
+    // Decrement without taking a lock unless this is the last reference.
+    uint32_t count = entry->refcount.load(std::memory_order_relaxed);
+    while (count > 1) {
+      if (entry->refcount.compare_exchange_weak(count, count - 1,
+                                                std::memory_order_acq_rel,
+                                                std::memory_order_relaxed)) {
+        return;
+      }
+    }
+
+    ReleaseTokenLast(entry);
+  }
+
+  const TokenEntry *entry_{nullptr};
 };
 
 struct TokenHasher {
   inline size_t operator()(const Token &tok) const {
-    return std::hash<std::string>()(tok.str());
+    return tok.hash();
   }
 };
 
 struct TokenKeyEqual {
   bool operator()(const Token &lhs, const Token &rhs) const {
-    return lhs.str() == rhs.str();
+    return lhs.is_same(rhs);
   }
 };
 
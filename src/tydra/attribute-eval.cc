@@ -45,11 +45,16 @@ bool ToTerminalAttributeValue(
   if (!var.is_valid()) {
     PUSH_ERROR_AND_RETURN("[InternalError] Attribute is invalid.");
   } else if (var.is_scalar()) {
-    const value::Value &v = var.value_raw();
-    DCOUT("Attribute is scalar type:" << v.type_name());
-    DCOUT("Attribute value = " << pprint_value(v));
+    if (var.is_borrowed_array()) {
+      // Copy zero-copy array to the output directly.
+      value->set_value(var.get_default_raw());
+    } else {
+      const value::Value &v = var.value_raw();
+      DCOUT("Attribute is scalar type:" << v.type_name());
+      DCOUT("Attribute value = " << pprint_value(v));
 
-    value->set_value(v);
+      value->set_value(v);
+    }
   } else if (var.is_timesamples()) {
     value::Value v;
     if (!var.get_interpolated_value(t, tinterp, &v)) {
@@ -501,9 +501,11 @@ bool GeomPrimvar::get_value(T *dest, std::string *err) const {
       return false;
     }
     
-    if (auto pv =ts.get_samples().at(0).value.as<T>()) {
-      (*dest) = (*pv);
-      return true;
+    if (auto v = ts.get_value(0, err)) {
+      if (auto pv = v.value().as<T>()) {
+        (*dest) = (*pv);
+        return true;
+      }
     }
   }
 
@@ -398,6 +398,10 @@ class USDAReader::Impl {
                 "Unexpected primIdx value. primIdx must be positive.");
           }
 
+          if (size_t(primIdx) >= _prim_nodes.size()) {
+            _prim_nodes.resize(size_t(primIdx) + 1);
+          }
+
           T prim;
 
           if (!ReconstructPrimMeta(in_meta, &prim.meta)) {
@@ -471,9 +475,6 @@ class USDAReader::Impl {
           // Add to scene graph.
           // NOTE: Scene graph is constructed from bottom up manner(Children
           // first), so add this primIdx to parent's children.
-          if (size_t(primIdx) >= _prim_nodes.size()) {
-            _prim_nodes.resize(size_t(primIdx) + 1);
-          }
           DCOUT("sz " << std::to_string(_prim_nodes.size())
                       << ", primIdx = " << primIdx);
 
@@ -700,6 +701,33 @@ class USDAReader::Impl {
         });
   }
 
+  void RegisterFilterCallback() {
+    if (!_config.filter.prim_path_prefixes.empty() ||
+        !_config.filter.prim_types.empty()) {
+      _parser.RegisterPrimFilterFunction(
+          [&](const Path &full_path, const std::string &primTypeName) {
+            if ((primTypeName != "__AnyType__") &&
+                !_config.filter.accept_prim_type(primTypeName)) {
+              return false;
+            }
+            const std::string prim_path = full_path.prim_part();
+            if (prim_path.find('{') != std::string::npos) {
+              // Prim in variantSet statement.
+              return true;
+            }
+            return _config.filter.accept_prim_path(prim_path);
+          });
+    }
+
+    if (_config.filter.property_filter) {
+      _parser.RegisterPropertyFilterFunction(
+          [&](const Path &prim_path, const std::string &prop_name) {
+            return _config.filter.accept_property(prim_path.prim_part(),
+                                                  prop_name);
+          });
+    }
+  }
+
   void RegisterPrimIdxAssignCallback() {
     _parser.RegisterPrimIdxAssignFunction([&](const int64_t parentPrimIdx) {
       size_t idx = _prim_nodes.size();
@@ -1482,7 +1510,6 @@ bool ConstructPrimTreeRec(const size_t primIdx,
         } else {
           // Add prim to variants
           if ((vidx >= 0) && (size_t(vidx) <= prim_nodes.size())) {
-
             Prim variantChildPrim(value::Value(nullptr)); // dummy
             if (!ConstructPrimTreeRec(size_t(vidx), prim_nodes, &variantChildPrim, err)) {
               return false;
@@ -1642,6 +1669,7 @@ bool USDAReader::Impl::Read(const uint32_t state_flags, bool as_primspec) {
   ascii_parser_option.allow_unknown_prim = _config.allow_unknown_prims;
   ascii_parser_option.allow_unknown_apiSchema = _config.allow_unknown_apiSchema;
   ascii_parser_option.strict_allowedToken_check = _config.strict_allowedToken_check;
+  ascii_parser_option.num_threads = _config.num_threads;
 
   ///
   /// Setup callbacks.
@@ -1650,6 +1678,8 @@ bool USDAReader::Impl::Read(const uint32_t state_flags, bool as_primspec) {
 
   RegisterPrimIdxAssignCallback();
 
+  RegisterFilterCallback();
+
   // For composition(as_primspec == true)
   RegisterPrimSpecHandler();
 
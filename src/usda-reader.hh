@@ -18,6 +18,13 @@ struct USDAReaderConfig {
   bool allow_unknown_shader{true};
   bool allow_unknown_apiSchema{true};
   bool strict_allowedToken_check{false};
+
+  // # of threads to parse large array literals and timeSamples.
+  // -1 = use system's # of threads.
+  int num_threads{-1};
+
+  // Selective Prim/Property loading for ReconstructStage().
+  USDLoadFilter filter;
 };
 
 ///
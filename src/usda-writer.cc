@@ -32,9 +32,13 @@ bool SaveAsUSDA(const std::string &filename, const Stage &stage,
   (void)warn;
 
   // TODO: Handle warn and err on export.
-  std::string s = stage.ExportToString();
-
-  if (!io::WriteWholeFile(filename, reinterpret_cast<const unsigned char *>(s.data()), s.size(), err)) {
+  // Prim subtrees are printed and written to the file in bounded batches.
+  if (!io::WriteFileStream(filename,
+                           [&stage](std::ostream &os) {
+                             stage.ExportToStream(os);
+                             return true;
+                           },
+                           err)) {
     return false;
   }
 
@@ -50,9 +54,13 @@ bool SaveAsUSDA(const std::wstring &filename, const Stage &stage,
   (void)warn;
 
   // TODO: Handle warn and err on export.
-  std::string s = stage.ExportToString();
-
-  if (!io::WriteWholeFile(filename, reinterpret_cast<const unsigned char *>(s.data()), s.size(), err)) {
+  // Prim subtrees are printed and written to the file in bounded batches.
+  if (!io::WriteFileStream(filename,
+                           [&stage](std::ostream &os) {
+                             stage.ExportToStream(os);
+                             return true;
+                           },
+                           err)) {
     return false;
   }
 
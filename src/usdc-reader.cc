@@ -251,6 +251,8 @@ class USDCReader::Impl {
 
   bool ReadUSDC();
 
+  bool ScanHierarchy(USDCHierarchy *hierarchy);
+
   using PathIndexToSpecIndexMap = std::unordered_map<uint32_t, uint32_t>;
 
   ///
@@ -283,11 +285,22 @@ class USDCReader::Impl {
   /// Returns reconstruct Prim to `primOut`
   /// When `current` is 0(StageMeta), `primOut` is not set.
   /// `is_parent_variant` : True when parent path is Variant
+  /// `filteredOut` : Set true when the Prim is skipped by USDLoadFilter
+  /// (its descendants are also skipped).
   ///
   bool ReconstructPrimNode(int parent, int current, int level,
                            bool is_parent_variant,
                            const PathIndexToSpecIndexMap &psmap, Stage *stage,
-                           nonstd::optional<Prim> *primOut);
+                           nonstd::optional<Prim> *primOut,
+                           bool *filteredOut);
+
+  ///
+  /// Check USDLoadFilter for the Prim spec before unpacking its fields.
+  /// Only `typeName` field is unpacked when `prim_types` filter is set.
+  /// `filteredOut` : Set true when the Prim(and its descendants) is skipped.
+  ///
+  bool CheckPrimFilter(const crate::Spec &spec, bool is_parent_variant,
+                       bool *filteredOut);
 
   ///
   /// Reconstrcut PrimSpec node.
@@ -300,7 +313,8 @@ class USDCReader::Impl {
   bool ReconstructPrimSpecNode(int parent, int current, int level,
                            bool is_parent_variant,
                            const PathIndexToSpecIndexMap &psmap, Layer *layer,
-                           nonstd::optional<PrimSpec> *primOut);
+                           nonstd::optional<PrimSpec> *primOut,
+                           bool *filteredOut);
 
   ///
   /// Reconstruct Prim from given `typeName` string(e.g. "Xform")
@@ -390,6 +404,15 @@ class USDCReader::Impl {
 
   bool AddVariantToPrimNode(int32_t prim_idx, const value::Value &variant);
 
+  ///
+  /// Get FieldValuePairs of the fieldset.
+  /// When `deferred_value_unpack` is enabled, field values are unpacked to
+  /// `storage` at this time and the pointer to `storage` is returned.
+  /// Returns nullptr when the fieldset is not found(or failed to unpack).
+  ///
+  const crate::FieldValuePairVector *GetLiveFieldSet(
+      crate::Index fieldset_index, crate::FieldValuePairVector *storage);
+
   crate::CrateReader *crate_reader{nullptr};
 
   StreamReader *_sr = nullptr;
@@ -509,14 +532,16 @@ bool USDCReader::Impl::ReconstructGeomSubset(
                              << ", prop part: " << path.prop_part()
                              << ", spec_index = " << spec_index);
 
-    if (!_live_fieldsets.count(spec.fieldset_index)) {
+    FieldValuePairVector deferred_fields;
+    const FieldValuePairVector *pchild_fields =
+        GetLiveFieldSet(spec.fieldset_index, &deferred_fields);
+    if (!pchild_fields) {
       _err += "FieldSet id: " + std::to_string(spec.fieldset_index.value) +
               " must exist in live fieldsets.\n";
       return false;
     }
 
-    const FieldValuePairVector &child_fields =
-        _live_fieldsets.at(spec.fieldset_index);
+    const FieldValuePairVector &child_fields = *pchild_fields;
 
     {
       std::string prop_name = path.prop_part();
@@ -852,14 +877,22 @@ bool USDCReader::Impl::BuildPropertyMap(const std::vector<size_t> &pathIndices,
                              << ", prop part: " << path.value().prop_part()
                              << ", spec_index = " << spec_index);
 
-    if (!_live_fieldsets.count(spec.fieldset_index)) {
+    // Skip filtered-out Property before unpacking its fields.
+    if (!_config.filter.accept_property(path.value().prim_part(),
+                                        path.value().prop_part())) {
+      continue;
+    }
+
+    crate::FieldValuePairVector deferred_fvs;
+    const crate::FieldValuePairVector *pchild_fvs =
+        GetLiveFieldSet(spec.fieldset_index, &deferred_fvs);
+    if (!pchild_fvs) {
       PUSH_ERROR("FieldSet id: " + std::to_string(spec.fieldset_index.value) +
                  " must exist in live fieldsets.");
       return false;
     }
 
-    const crate::FieldValuePairVector &child_fvs =
-        _live_fieldsets.at(spec.fieldset_index);
+    const crate::FieldValuePairVector &child_fvs = *pchild_fvs;
 
     {
       std::string prop_name = path.value().prop_part();
@@ -870,7 +903,7 @@ bool USDCReader::Impl::BuildPropertyMap(const std::vector<size_t> &pathIndices,
       }
 
       std::string prop_err;
-      if (!pathutil::ValidatePropPath(Path("", prop_name), &prop_err)) {
+      if (!pathutil::ValidatePropName(prop_name, &prop_err)) {
         PUSH_ERROR_AND_RETURN_TAG(kTag, fmt::format("Invalid Property name `{}`: {}", prop_name, prop_err));
       }
 
@@ -935,6 +968,8 @@ bool USDCReader::Impl::ParseProperty(const SpecType spec_type,
   Attribute attr;
 
   value::Value defaultValue;
+  value::BorrowedArray borrowedDefault; // zero-copy array
+  value::DeferredValue deferredDefault; // decoded on the first access
   Relationship rel;
 
   // for attribute
@@ -998,6 +1033,18 @@ bool USDCReader::Impl::ParseProperty(const SpecType spec_type,
 
       // Set scalar(non-timesampled) value
       // TODO: Easier CrateValue to Attribute.var conversion
+      if (fv.second.is_borrowed_array()) {
+        borrowedDefault = fv.second.get_borrowed_array();
+        hasDefault = true;
+        continue;
+      }
+
+      if (fv.second.is_deferred_value()) {
+        deferredDefault = fv.second.get_deferred_value();
+        hasDefault = true;
+        continue;
+      }
+
       defaultValue = fv.second.get_raw();
       hasDefault = true;
 
@@ -1319,9 +1366,60 @@ bool USDCReader::Impl::ParseProperty(const SpecType spec_type,
   (void)hasConnectionPaths;
 #endif
 
+  // Borrowed array does not need a copy when `typeName` is the same type or
+  // its role type(e.g. `point3f[]` for `float3[]`). Otherwise copy it and do
+  // type cast below.
+  if (hasDefault && borrowedDefault.valid()) {
+    bool borrowed = true;
+    if (typeName) {
+      const std::string reqTy = typeName.value().str();
+      if (reqTy.compare(value::GetTypeName(borrowedDefault.type_id)) != 0) {
+        auto utyid = value::TryGetUnderlyingTypeId(reqTy);
+        if (utyid && (utyid.value() == borrowedDefault.underlying_type_id)) {
+          borrowedDefault.type_id = value::GetTypeId(reqTy);
+        } else {
+          borrowed = false;
+        }
+      }
+    }
+
+    if (borrowed) {
+      var.set_borrowed_array(borrowedDefault);
+    } else {
+      defaultValue = borrowedDefault.to_value();
+    }
+  }
+
+  // Same for deferred value. Role type cast is done when the value is
+  // decoded.
+  if (hasDefault && deferredDefault.valid()) {
+    bool deferred = true;
+    if (typeName) {
+      const std::string reqTy = typeName.value().str();
+      if (reqTy.compare(value::GetTypeName(deferredDefault.type_id)) != 0) {
+        auto utyid = value::TryGetUnderlyingTypeId(reqTy);
+        if (utyid && (utyid.value() == deferredDefault.underlying_type_id)) {
+          deferredDefault.type_id = value::GetTypeId(reqTy);
+        } else {
+          deferred = false;
+        }
+      }
+    }
+
+    if (deferred) {
+      var.set_deferred_value(deferredDefault);
+    } else {
+      std::string local_err;
+      defaultValue = deferredDefault.get(&local_err);
+      if (!local_err.empty()) {
+        PUSH_ERROR_AND_RETURN_TAG(kTag, local_err);
+      }
+    }
+  }
+
   // Do role type cast for default value.
   // (TODO: do role type cast for timeSamples?)
-  if (hasDefault) {
+  if (hasDefault && !var.is_borrowed_array() && !var.is_deferred_value()) {
     if (typeName) {
       if (defaultValue.type_id() == value::TypeTraits<value::ValueBlock>::type_id()) {
         // nothing to do
@@ -2320,7 +2418,8 @@ bool USDCReader::Impl::ReconstructPrimNode(int parent, int current, int level,
                                            bool is_parent_variant,
                                            const PathIndexToSpecIndexMap &psmap,
                                            Stage *stage,
-                                           nonstd::optional<Prim> *primOut) {
+                                           nonstd::optional<Prim> *primOut,
+                                           bool *filteredOut) {
   (void)level;
   const crate::CrateReader::Node &node = _nodes[size_t(current)];
 
@@ -2369,14 +2468,25 @@ bool USDCReader::Impl::ReconstructPrimNode(int parent, int current, int level,
     }
   }
 
-  if (!_live_fieldsets.count(spec.fieldset_index)) {
+  // Skip filtered-out Prim before unpacking its fields.
+  if (!CheckPrimFilter(spec, is_parent_variant, filteredOut)) {
+    return false;
+  }
+
+  if (filteredOut && (*filteredOut)) {
+    return true;
+  }
+
+  crate::FieldValuePairVector deferred_fvs;
+  const crate::FieldValuePairVector *pfvs =
+      GetLiveFieldSet(spec.fieldset_index, &deferred_fvs);
+  if (!pfvs) {
     PUSH_ERROR("FieldSet id: " + std::to_string(spec.fieldset_index.value) +
                " must exist in live fieldsets.");
     return false;
   }
 
-  const crate::FieldValuePairVector &fvs =
-      _live_fieldsets.at(spec.fieldset_index);
+  const crate::FieldValuePairVector &fvs = *pfvs;
 
   if (fvs.size() > _config.kMaxFieldValuePairs) {
     PUSH_ERROR_AND_RETURN_TAG(kTag, "Too much FieldValue pairs.");
@@ -2779,11 +2889,63 @@ bool USDCReader::Impl::ReconstructPrimNode(int parent, int current, int level,
   return true;
 }
 
+bool USDCReader::Impl::CheckPrimFilter(const crate::Spec &spec,
+                                       bool is_parent_variant,
+                                       bool *filteredOut) {
+  if ((spec.spec_type != SpecType::Prim) || is_parent_variant ||
+      _config.filter.empty()) {
+    return true;
+  }
+
+  if (!_config.filter.prim_path_prefixes.empty()) {
+    if (auto pv = GetPath(spec.path_index)) {
+      const std::string prim_path = pv.value().prim_part();
+      if ((prim_path.find('{') == std::string::npos) &&
+          !_config.filter.accept_prim_path(prim_path)) {
+        DCOUT("Skip Prim by path filter: " << prim_path);
+        if (filteredOut) {
+          (*filteredOut) = true;
+        }
+        return true;
+      }
+    }
+  }
+
+  if (!_config.filter.prim_types.empty()) {
+    // Field values are unpacked on demand when the filter is set(see
+    // ReadUSDC()), so unpack `typeName` only.
+    static const std::set<std::string> kTypeNameField{"typeName"};
+
+    crate::FieldValuePairVector fvs;
+    if (!crate_reader->UnpackLiveFieldSet(spec.fieldset_index, kTypeNameField,
+                                          &fvs)) {
+      PUSH_ERROR_AND_RETURN_TAG(kTag, "Failed to unpack `typeName` field.\n"
+                                          << crate_reader->GetError());
+    }
+
+    for (const auto &fv : fvs) {
+      if (auto pv = fv.second.as<value::token>()) {
+        if ((pv->str() != "__AnyType__") &&
+            !_config.filter.accept_prim_type(pv->str())) {
+          DCOUT("Skip Prim by type filter: " << pv->str());
+          if (filteredOut) {
+            (*filteredOut) = true;
+          }
+          return true;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
 bool USDCReader::Impl::ReconstructPrimSpecNode(int parent, int current, int level,
                                            bool is_parent_variant,
                                            const PathIndexToSpecIndexMap &psmap,
                                            Layer *layer,
-                                           nonstd::optional<PrimSpec> *primOut) {
+                                           nonstd::optional<PrimSpec> *primOut,
+                                           bool *filteredOut) {
   (void)level;
   const crate::CrateReader::Node &node = _nodes[size_t(current)];
 
@@ -2830,14 +2992,25 @@ bool USDCReader::Impl::ReconstructPrimSpecNode(int parent, int current, int leve
     }
   }
 
-  if (!_live_fieldsets.count(spec.fieldset_index)) {
+  // Skip filtered-out PrimSpec before unpacking its fields.
+  if (!CheckPrimFilter(spec, is_parent_variant, filteredOut)) {
+    return false;
+  }
+
+  if (filteredOut && (*filteredOut)) {
+    return true;
+  }
+
+  crate::FieldValuePairVector deferred_fvs;
+  const crate::FieldValuePairVector *pfvs =
+      GetLiveFieldSet(spec.fieldset_index, &deferred_fvs);
+  if (!pfvs) {
     PUSH_ERROR("FieldSet id: " + std::to_string(spec.fieldset_index.value) +
                " must exist in live fieldsets.");
     return false;
   }
 
-  const crate::FieldValuePairVector &fvs =
-      _live_fieldsets.at(spec.fieldset_index);
+  const crate::FieldValuePairVector &fvs = *pfvs;
 
   if (fvs.size() > _config.kMaxFieldValuePairs) {
     PUSH_ERROR_AND_RETURN_TAG(kTag, "Too much FieldValue pairs.");
@@ -3308,11 +3481,17 @@ bool USDCReader::Impl::ReconstructPrimRecursively(
 
   bool is_parent_variant = _variantPrims.count(parent);
 
+  bool filteredOut{false};
   if (!ReconstructPrimNode(parent, current, level, is_parent_variant, psmap,
-                           stage, &prim)) {
+                           stage, &prim, &filteredOut)) {
     return false;
   }
 
+  if (filteredOut) {
+    // Skip descendants.
+    return true;
+  }
+
   if (prim) {
     currPrimPtr = &(prim.value());
   }
@@ -3473,6 +3652,29 @@ bool USDCReader::Impl::ReconstructPrimRecursively(
   return true;
 }
 
+const crate::FieldValuePairVector *USDCReader::Impl::GetLiveFieldSet(
+    crate::Index fieldset_index, crate::FieldValuePairVector *storage) {
+  if (crate_reader && crate_reader->IsDeferredValueUnpack()) {
+    if (!storage) {
+      return nullptr;
+    }
+
+    if (!crate_reader->UnpackLiveFieldSet(fieldset_index, storage)) {
+      PushError(crate_reader->GetError());
+      return nullptr;
+    }
+
+    return storage;
+  }
+
+  auto it = _live_fieldsets.find(fieldset_index);
+  if (it == _live_fieldsets.end()) {
+    return nullptr;
+  }
+
+  return &(it->second);
+}
+
 bool USDCReader::Impl::ReconstructStage(Stage *stage) {
 
   // format test
@@ -3556,11 +3758,17 @@ bool USDCReader::Impl::ReconstructPrimSpecRecursively(
   // Assume parent node is already processed.
   bool is_parent_variant = _variantPrims.count(parent);
 
+  bool filteredOut{false};
   if (!ReconstructPrimSpecNode(parent, current, level, is_parent_variant, psmap,
-                           layer, &primspec)) {
+                           layer, &primspec, &filteredOut)) {
     return false;
   }
 
+  if (filteredOut) {
+    // Skip descendants.
+    return true;
+  }
+
   if (primspec) {
     currPrimSpecPtr = &(primspec.value());
   }
@@ -3790,6 +3998,14 @@ bool USDCReader::Impl::ReadUSDC() {
 
   // Transfer settings
   config.numThreads = _config.numThreads;
+  // Unpack field values on demand with the load filter, so that the fields
+  // of filtered-out Prims and Properties are never unpacked.
+  config.deferredValueUnpack =
+      _config.deferred_value_unpack || !_config.filter.empty();
+  config.zeroCopyArrays = _config.zero_copy_arrays;
+  config.bufferOwner = _config.buffer_owner;
+  config.deferredTimeSamples = _config.deferred_timesamples;
+  config.maxCachedTimeSamples = _config.max_cached_timesamples;
 
   size_t sz_mb = _config.kMaxAllowedMemoryInMB;
   if (sizeof(size_t) == 4) {
@@ -3821,59 +4037,197 @@ bool USDCReader::Impl::ReadUSDC() {
 
   // Read known sections
 
-  if (!crate_reader->ReadTokens()) {
+  if (!crate_reader->ReadSections()) {
     _warn = crate_reader->GetWarning();
     _err = crate_reader->GetError();
     return false;
   }
 
-  if (!crate_reader->ReadStrings()) {
+  // TODO(syoyo): Read unknown sections
+
+  ///
+  /// Reconstruct C++ representation of USD scene graph.
+  ///
+  DCOUT("BuildLiveFieldSets");
+  if (!crate_reader->BuildLiveFieldSets()) {
     _warn = crate_reader->GetWarning();
     _err = crate_reader->GetError();
+
     return false;
   }
 
-  if (!crate_reader->ReadFields()) {
-    _warn = crate_reader->GetWarning();
-    _err = crate_reader->GetError();
-    return false;
+  _warn += crate_reader->GetWarning();
+  _err += crate_reader->GetError();
+
+  DCOUT("Read Crate.");
+
+  return true;
+}
+
+bool USDCReader::Impl::ScanHierarchy(USDCHierarchy *hierarchy) {
+  if (!hierarchy) {
+    PUSH_ERROR_AND_RETURN_TAG(kTag, "`hierarchy` is nullptr.");
   }
 
-  if (!crate_reader->ReadFieldSets()) {
-    _warn = crate_reader->GetWarning();
-    _err = crate_reader->GetError();
-    return false;
+  if (crate_reader) {
+    delete crate_reader;
   }
 
-  if (!crate_reader->ReadPaths()) {
-    _warn = crate_reader->GetWarning();
-    _err = crate_reader->GetError();
-    return false;
+  // Scan-only CrateReader. Field values are not unpacked(only Prim fields
+  // listed in `kScanFields` are unpacked below), so TimeSamples and array
+  // settings are not required.
+  crate::CrateReaderConfig config;
+  config.numThreads = _config.numThreads;
+  config.deferredValueUnpack = true;
+  if (sizeof(size_t) == 4) {
+    // 32bit
+    // cap to 2GB
+    config.maxMemoryBudget =
+        (std::min)(size_t(1024 * 2), _config.kMaxAllowedMemoryInMB) * 1024 *
+        1024;
+  } else {
+    config.maxMemoryBudget = _config.kMaxAllowedMemoryInMB * 1024ull * 1024ull;
   }
 
-  if (!crate_reader->ReadSpecs()) {
-    _warn = crate_reader->GetWarning();
-    _err = crate_reader->GetError();
+  crate_reader = new crate::CrateReader(_sr, config);
+
+  _warn.clear();
+  _err.clear();
+
+  // Read the sections required to walk Prim specs only: TOKENS, STRINGS and
+  // PATHS for the hierarchy, and SPECS, FIELDS and FIELDSETS to look up
+  // `kScanFields` of each Prim spec. Value payloads are never read.
+  bool ret = crate_reader->ReadBootStrap() && crate_reader->ReadTOC() &&
+             crate_reader->ReadTokens() && crate_reader->ReadStrings() &&
+             crate_reader->ReadPaths() && crate_reader->ReadSpecs() &&
+             crate_reader->ReadFields() && crate_reader->ReadFieldSets() &&
+             crate_reader->BuildLiveFieldSets();
+
+  _warn += crate_reader->GetWarning();
+
+  if (!ret) {
+    _err += crate_reader->GetError();
     return false;
   }
 
-  // TODO(syoyo): Read unknown sections
+  hierarchy->prims.clear();
+  hierarchy->root_prims.clear();
 
-  ///
-  /// Reconstruct C++ representation of USD scene graph.
-  ///
-  DCOUT("BuildLiveFieldSets");
-  if (!crate_reader->BuildLiveFieldSets()) {
-    _warn = crate_reader->GetWarning();
-    _err = crate_reader->GetError();
+  const std::vector<crate::CrateReader::Node> &nodes =
+      crate_reader->GetNodes();
+  const std::vector<crate::Spec> &specs = crate_reader->GetSpecs();
 
-    return false;
+  if (nodes.empty()) {
+    PUSH_WARN("Empty scene.");
+    return true;
   }
 
-  _warn += crate_reader->GetWarning();
-  _err += crate_reader->GetError();
+  // path index(= node index) -> spec index
+  std::vector<int64_t> path_to_spec(nodes.size(), -1);
+  for (size_t i = 0; i < specs.size(); i++) {
+    if (specs[i].path_index.value < path_to_spec.size()) {
+      path_to_spec[specs[i].path_index.value] = int64_t(i);
+    }
+  }
 
-  DCOUT("Read Crate.");
+  static const std::set<std::string> kScanFields = {
+      "typeName", "specifier", "kind", "variantSetNames"};
+
+  struct StackItem {
+    size_t node_index;
+    int64_t parent;  // parent Prim index in `hierarchy->prims`
+    uint32_t level;
+  };
+
+  // Depth-first traversal. Children are pushed in reverse order to keep
+  // Prim order.
+  std::vector<StackItem> stack;
+  stack.push_back({0, -1, 0});
+
+  crate::FieldValuePairVector fvs;
+
+  while (!stack.empty()) {
+    const StackItem item = stack.back();
+    stack.pop_back();
+
+    if (item.level > _config.kMaxPrimNestLevel) {
+      PUSH_ERROR_AND_RETURN_TAG(kTag, "Prim hierarchy is too deep.");
+    }
+
+    if (item.node_index >= nodes.size()) {
+      PUSH_ERROR_AND_RETURN_TAG(kTag, "Invalid node index: " << item.node_index);
+    }
+
+    int64_t spec_index = path_to_spec[item.node_index];
+    if (spec_index < 0) {
+      continue;
+    }
+
+    const crate::Spec &spec = specs[size_t(spec_index)];
+    int64_t prim_index = item.parent;
+
+    if (spec.spec_type == SpecType::Prim) {
+      const crate::CrateReader::Node &node = nodes[item.node_index];
+
+      USDCPrimEntry entry;
+      entry.path = node.GetPath().prim_part();
+      entry.name = entry.path.substr(entry.path.find_last_of('/') + 1);
+      entry.parent = item.parent;
+
+      if (!crate_reader->UnpackLiveFieldSet(spec.fieldset_index, kScanFields,
+                                            &fvs)) {
+        PUSH_ERROR_AND_RETURN_TAG(
+            kTag, "Failed to unpack fields of Prim: " << entry.path << "\n"
+                                                      << crate_reader->GetError());
+      }
+
+      for (const auto &fv : fvs) {
+        if (fv.first == "typeName") {
+          if (auto pv = fv.second.as<value::token>()) {
+            entry.type_name = pv->str();
+          }
+        } else if (fv.first == "specifier") {
+          if (auto pv = fv.second.as<Specifier>()) {
+            entry.specifier = (*pv);
+          }
+        } else if (fv.first == "kind") {
+          if (auto pv = fv.second.as<value::token>()) {
+            entry.kind = pv->str();
+          }
+        } else if (fv.first == "variantSetNames") {
+          if (auto pv = fv.second.as<ListOp<std::string>>()) {
+            for (const auto &ps : DecodeListOp<std::string>(*pv)) {
+              if ((std::get<0>(ps) == ListEditQual::Delete) ||
+                  (std::get<0>(ps) == ListEditQual::Order)) {
+                continue;
+              }
+              for (const auto &name : std::get<1>(ps)) {
+                entry.variant_set_names.push_back(name);
+              }
+            }
+          }
+        }
+      }
+
+      prim_index = int64_t(hierarchy->prims.size());
+      if (item.parent == -1) {
+        hierarchy->root_prims.push_back(size_t(prim_index));
+      } else {
+        hierarchy->prims[size_t(item.parent)].children.push_back(
+            size_t(prim_index));
+      }
+      hierarchy->prims.emplace_back(std::move(entry));
+
+    } else if (spec.spec_type != SpecType::PseudoRoot) {
+      // Property, VariantSet, ...: Skip descendants.
+      continue;
+    }
+
+    const std::vector<size_t> &children = nodes[item.node_index].GetChildren();
+    for (auto it = children.rbegin(); it != children.rend(); ++it) {
+      stack.push_back({(*it), prim_index, item.level + 1});
+    }
+  }
 
   return true;
 }
@@ -3913,6 +4267,10 @@ std::string USDCReader::GetWarning() { return impl_->GetWarning(); }
 
 bool USDCReader::ReadUSDC() { return impl_->ReadUSDC(); }
 
+bool USDCReader::ScanHierarchy(USDCHierarchy *hierarchy) {
+  return impl_->ScanHierarchy(hierarchy);
+}
+
 }  // namespace usdc
 }  // namespace tinyusdz
 
@@ -3956,6 +4314,11 @@ std::string USDCReader::GetError() {
 
 std::string USDCReader::GetWarning() { return ""; }
 
+bool USDCReader::ScanHierarchy(USDCHierarchy *hierarchy) {
+  (void)hierarchy;
+  return false;
+}
+
 }  // namespace usdc
 }  // namespace tinyusdz
 
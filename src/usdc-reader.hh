@@ -27,6 +27,58 @@ struct USDCReaderConfig {
   bool allow_unknown_apiSchemas = true;
 
   bool strict_allowedToken_check = false;
+
+  // Unpack field values(e.g. `points` array, timeSamples) on demand when the
+  // Prim/PrimSpec is reconstructed, instead of unpacking all values in
+  // ReadUSDC(). Reduces peak memory usage for large scenes.
+  // StreamReader(Crate data) must be alive until ReconstructStage() or
+  // get_as_layer() finishes. With `buffer_owner`, numeric array `default`
+  // values(e.g. `points`) are not decoded at reconstruction either. They are
+  // decoded on the first access(value::DeferredValue).
+  bool deferred_value_unpack = false;
+
+  // Reference uncompressed array data of attribute `default` value(e.g.
+  // `point3f[] points`) in Crate data directly(no copy). `buffer_owner` must
+  // own Crate data(e.g. memory-mapped file handle). It is shared with each
+  // attribute which borrows the data, so Crate data is kept alive as long as
+  // the attribute is alive.
+  bool zero_copy_arrays = false;
+  std::shared_ptr<const void> buffer_owner;
+
+  // Decode TimeSamples values on demand(value::TimeSamples::get()) instead
+  // of decoding all samples in ReadUSDC(). Requires `buffer_owner`. Crate
+  // data is kept alive as long as any deferred TimeSamples is alive.
+  // `max_cached_timesamples` : Max number of decoded samples kept in each
+  // TimeSamples(0 = no limit).
+  bool deferred_timesamples = false;
+  size_t max_cached_timesamples = 0;
+
+  // Selective Prim/Property loading for ReconstructStage().
+  USDLoadFilter filter;
+};
+
+///
+/// Prim entry of USDCHierarchy.
+///
+struct USDCPrimEntry {
+  std::string name;  // element name(e.g. `geom0`)
+  std::string path;  // absolute Prim path(e.g. `/root/geom0`)
+  std::string type_name;  // empty for untyped Prim(e.g. `def "root"`)
+  Specifier specifier{Specifier::Def};
+  std::string kind;  // empty when `kind` is not authored
+  std::vector<std::string> variant_set_names;
+
+  int64_t parent{-1};  // index to USDCHierarchy::prims. -1 = root Prim
+  std::vector<size_t> children;  // indices to USDCHierarchy::prims
+};
+
+///
+/// Compact Prim hierarchy index of USDC data(no Property values).
+/// Prims under VariantSet are not included.
+///
+struct USDCHierarchy {
+  std::vector<USDCPrimEntry> prims;  // in depth-first order
+  std::vector<size_t> root_prims;    // indices to `prims`
 };
 
 class USDCReader {
@@ -40,6 +92,14 @@ class USDCReader {
 
   bool ReadUSDC();
 
+  ///
+  /// Read Prim hierarchy only(path, typeName, specifier, kind and
+  /// variantSet names). Faster than ReadUSDC() + ReconstructStage() since
+  /// Property values(e.g. `points`) are not unpacked.
+  /// Call this instead of ReadUSDC().
+  ///
+  bool ScanHierarchy(USDCHierarchy *hierarchy);
+
   bool ReconstructStage(Stage *stage);
 
   // For composition.
@@ -34,14 +34,42 @@
 #endif
 
 
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <set>
 #include <sstream>
+#include <unordered_map>
+
+// Use std::thread to encode(compress) large array values in parallel.
+// # of threads is controlled by `USDCWriteOptions::num_threads` at runtime.
+#if defined(__wasi__)
+// no threading
+#elif defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+// no threading
+#else
+#define TINYUSDZ_USDC_WRITER_USE_THREAD
+#endif
+
+#if defined(TINYUSDZ_USDC_WRITER_USE_THREAD)
+#include <atomic>
+#include <thread>
+#endif
 
 #include "crate-format.hh"
+#include "crate-writer.hh"
+#include "integerCoding.h"
 #include "io-util.hh"
 #include "lz4-compression.hh"
+#include "pprinter.hh"
+#include "stream-writer.hh"
 #include "token-type.hh"
+#include "value-types.hh"
 
 #include "common-macros.inc"
 
@@ -50,7 +78,33 @@ namespace usdc {
 
 namespace {
 
-constexpr size_t kSectionNameMaxLength = 15;
+// "PXR-USDC"(8) + version(8) + TOC offset(8) + reserved(64)
+constexpr size_t kHeaderSize = 88;
+
+// Value data is aligned to 8 bytes so that the reader can reference(borrow)
+// array data in the Crate buffer without copying.
+constexpr size_t kValueAlignment = 8;
+
+// ValueRep payload is 48bit.
+constexpr uint64_t kMaxValueOffset = (1ull << 48) - 1;
+
+// ListOp header bits.
+constexpr uint8_t kListOpIsExplicit = 1 << 0;
+constexpr uint8_t kListOpHasExplicitItems = 1 << 1;
+constexpr uint8_t kListOpHasAddedItems = 1 << 2;
+constexpr uint8_t kListOpHasDeletedItems = 1 << 3;
+constexpr uint8_t kListOpHasOrderedItems = 1 << 4;
+constexpr uint8_t kListOpHasPrependedItems = 1 << 5;
+constexpr uint8_t kListOpHasAppendedItems = 1 << 6;
+
+#if defined(TINYUSDZ_USDC_WRITER_USE_THREAD)
+// Arrays smaller than this are encoded on the fly.
+constexpr size_t kMinParallelArrayBytes = 64 * 1024;
+
+// Raw bytes of arrays encoded at once per thread. Bounds the memory held by
+// encoded arrays waiting to be written.
+constexpr size_t kArrayBatchBytesPerThread = 16 * 1024 * 1024;
+#endif
 
 #ifdef _WIN32
 std::wstring UTF8ToWchar(const std::string &str) {
@@ -61,502 +115,3140 @@ std::wstring UTF8ToWchar(const std::string &str) {
                       int(wstr.size()));
   return wstr;
 }
+#endif
+
+// readable: Open with "w+b" so that written data can be read back.
+FILE *OpenFileToWrite(const std::string &filename, bool readable,
+                      std::string *err) {
+#ifdef _WIN32
+#if defined(_MSC_VER) || defined(__GLIBCXX__) || defined(__clang__)
+  FILE *fp = nullptr;
+  errno_t fperr = _wfopen_s(&fp, UTF8ToWchar(filename).c_str(),
+                            readable ? L"w+b" : L"wb");
+  if (fperr != 0) {
+    if (err) {
+      // TODO: WChar
+      (*err) += "Failed to open file to write.\n";
+    }
+    return nullptr;
+  }
+#else
+  FILE *fp = nullptr;
+  errno_t fperr = fopen_s(&fp, filename.c_str(), readable ? "w+b" : "wb");
+  if (fperr != 0) {
+    if (err) {
+      (*err) += "Failed to open file `" + filename + "` to write.\n";
+    }
+    return nullptr;
+  }
+#endif
+
+#else
+  FILE *fp = fopen(filename.c_str(), readable ? "w+b" : "wb");
+  if (fp == nullptr) {
+    if (err) {
+      (*err) += "Failed to open file `" + filename + "` to write.\n";
+    }
+    return nullptr;
+  }
+#endif
+
+  return fp;
+}
+
+bool WriteBinaryToFile(const std::string &filename,
+                       const std::vector<uint8_t> &output, std::string *err) {
+  FILE *fp = OpenFileToWrite(filename, /* readable */ false, err);
+  if (!fp) {
+    return false;
+  }
+
+  size_t n = fwrite(output.data(), /* size */ 1, /* count */ output.size(), fp);
+  fclose(fp);
+
+  if (n < output.size()) {
+    // TODO: Retry writing data when n < output.size()
+
+    if (err) {
+      (*err) += "Failed to write data to a file.\n";
+    }
+    return false;
+  }
+
+  return true;
+}
+
+// 64bit hash of byte sequence. Used to find duplicated values.
+uint64_t HashBytes(const void *data, size_t n, uint64_t seed) {
+  constexpr uint64_t kMul = 0x9ddfea08eb382d69ull;
+
+  const uint8_t *p = reinterpret_cast<const uint8_t *>(data);
+  uint64_t h = seed ^ (uint64_t(n) * kMul);
+
+  while (n >= 8) {
+    uint64_t w;
+    memcpy(&w, p, 8);
+    h = (h ^ w) * kMul;
+    h ^= (h >> 47);
+    p += 8;
+    n -= 8;
+  }
+
+  if (n > 0) {
+    uint64_t w{0};
+    memcpy(&w, p, n);
+    h = (h ^ w) * kMul;
+    h ^= (h >> 47);
+  }
+
+  return h;
+}
+
+template <typename T>
+crate::ValueRep InlinedRep(crate::CrateDataTypeId ty, T payload) {
+  return crate::ValueRep(int32_t(ty), /* inlined */ true, /* array */ false,
+                         uint64_t(payload));
+}
+
+inline float ToFloatingPoint(value::half v) { return value::half_to_float(v); }
+inline float ToFloatingPoint(float v) { return v; }
+inline double ToFloatingPoint(double v) { return v; }
+
+// Returns true when all values are exactly representable as int32.
+template <typename T>
+bool IsAllInt32Representable(const T *data, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    const auto v = ToFloatingPoint(data[i]);
+    using F = decltype(v);
+    // NaN fails both comparisons.
+    if (!((v >= F(-2147483648.0)) && (v <= F(2147483647.0)))) {
+      return false;
+    }
+    if (F(int32_t(v)) != v) {
+      return false;
+    }
+    // -0.0 cannot be represented as int.
+    if ((v == F(0)) && std::signbit(v)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Unsigned integer type which has the same bit width as T. Used to compare
+// floating point values by bits(distinguishes -0.0 and 0.0, NaN payloads).
+template <typename T>
+using BitsType = typename std::conditional<
+    sizeof(T) == 2, uint16_t,
+    typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type>::type;
+
+// Integer-coded + LZ4 compression of 32bit integers.
+template <typename T>
+bool CompressInts(const T *data, size_t n, std::vector<char> *comp,
+                  size_t *comp_size) {
+  comp->resize(Usd_IntegerCompression::GetCompressedBufferSize(n));
+  std::string err;
+  size_t sz =
+      Usd_IntegerCompression::CompressToBuffer(data, n, comp->data(), &err);
+  if (!err.empty() || (sz == 0) || (sz > comp->size())) {
+    return false;
+  }
+
+  (*comp_size) = sz;
+  return true;
+}
+
+///
+/// Serialized array value: `head` followed by `body`. `body` points to
+/// `storage`(compressed data) or the source array data(uncompressed).
+///
+struct EncodedArray {
+  crate::CrateDataTypeId ty{crate::CrateDataTypeId::CRATE_DATA_TYPE_INVALID};
+  bool compressed{false};
+  std::vector<uint8_t> head;
+  std::vector<char> storage;
+  const void *body{nullptr};
+  size_t body_size{0};
+};
+
+uint64_t HashValueBytes(const void *head, size_t head_size, const void *body,
+                        size_t body_size) {
+  return HashBytes(body, body_size, HashBytes(head, head_size, 0));
+}
+
+uint64_t HashEncodedArray(const EncodedArray &enc) {
+  return HashValueBytes(enc.head.data(), enc.head.size(), enc.body,
+                        enc.body_size);
+}
+
+// uncompressed array: u64 n + elements
+template <typename T>
+void EncodeRawArray(crate::CrateDataTypeId ty, const T *data, size_t n,
+                    EncodedArray *enc) {
+  const uint64_t num = uint64_t(n);
+
+  enc->ty = ty;
+  enc->compressed = false;
+  enc->head.resize(sizeof(uint64_t));
+  memcpy(enc->head.data(), &num, sizeof(uint64_t));
+  enc->storage.clear();
+  enc->body = data;
+  enc->body_size = sizeof(T) * n;
+}
+
+void SetCompressedArray(crate::CrateDataTypeId ty, const StreamWriter &head,
+                        std::vector<char> &&comp, size_t comp_size,
+                        EncodedArray *enc) {
+  enc->ty = ty;
+  enc->compressed = true;
+  enc->head.assign(head.data(), head.data() + head.size());
+  enc->storage = std::move(comp);
+  enc->storage.resize(comp_size);
+  enc->body = enc->storage.data();
+  enc->body_size = comp_size;
+}
+
+// compressed int array: u64 n + u64 compressedSize + compressed ints
+template <class Compressor, typename T>
+void EncodeIntArray(crate::CrateDataTypeId ty, const T *data, size_t n,
+                    EncodedArray *enc) {
+  if (n < crate::kMinCompressedArraySize) {
+    EncodeRawArray(ty, data, n, enc);
+    return;
+  }
+
+  std::vector<char> comp(Compressor::GetCompressedBufferSize(n));
+  std::string err;
+  size_t comp_size = Compressor::CompressToBuffer(data, n, comp.data(), &err);
+  if (!err.empty() || (comp_size == 0) || (comp_size > comp.size()) ||
+      ((comp_size + sizeof(uint64_t)) >= (sizeof(T) * n))) {
+    // Not compressible. Store as is.
+    EncodeRawArray(ty, data, n, enc);
+    return;
+  }
+
+  StreamWriter head;
+  head.write8(uint64_t(n));
+  head.write8(uint64_t(comp_size));
+
+  SetCompressedArray(ty, head, std::move(comp), comp_size, enc);
+}
+
+template <typename T>
+bool EncodeFloatArrayAsInts(crate::CrateDataTypeId ty, const T *data,
+                            size_t n, EncodedArray *enc) {
+  std::vector<int32_t> ints(n);
+  for (size_t i = 0; i < n; i++) {
+    ints[i] = int32_t(ToFloatingPoint(data[i]));
+  }
+
+  std::vector<char> comp;
+  size_t comp_size;
+  if (!CompressInts(ints.data(), n, &comp, &comp_size) ||
+      ((comp_size + sizeof(uint64_t) + 1) >= (sizeof(T) * n))) {
+    return false;
+  }
+
+  StreamWriter head;
+  head.write8(uint64_t(n));
+  head.write1(uint8_t('i'));
+  head.write8(uint64_t(comp_size));
+
+  SetCompressedArray(ty, head, std::move(comp), comp_size, enc);
+  return true;
+}
+
+template <typename T>
+bool EncodeFloatArrayAsLUT(crate::CrateDataTypeId ty, const T *data, size_t n,
+                           EncodedArray *enc) {
+  // Same limit as pxrUSD. Also LUT must be much smaller than the array.
+  constexpr size_t kMaxLUTSize = 1024;
+  const size_t max_lut_size = (std::min)(kMaxLUTSize, n / 4);
+
+  using Bits = BitsType<T>;
+
+  std::vector<T> lut;
+  std::vector<uint32_t> indices(n);
+  std::unordered_map<Bits, uint32_t> lut_indices;
+
+  for (size_t i = 0; i < n; i++) {
+    Bits bits;
+    memcpy(&bits, &data[i], sizeof(T));
+
+    auto it = lut_indices.find(bits);
+    if (it != lut_indices.end()) {
+      indices[i] = it->second;
+      continue;
+    }
+
+    if (lut.size() >= max_lut_size) {
+      // Too many distinct values.
+      return false;
+    }
+
+    indices[i] = uint32_t(lut.size());
+    lut_indices.emplace(bits, indices[i]);
+    lut.push_back(data[i]);
+  }
+
+  std::vector<char> comp;
+  size_t comp_size;
+  if (!CompressInts(indices.data(), n, &comp, &comp_size) ||
+      ((1 + sizeof(uint32_t) + sizeof(T) * lut.size() + sizeof(uint64_t) +
+        comp_size) >= (sizeof(T) * n))) {
+    return false;
+  }
+
+  StreamWriter head;
+  head.write8(uint64_t(n));
+  head.write1(uint8_t('t'));
+  head.write4(uint32_t(lut.size()));
+  head.write(lut.data(), sizeof(T) * lut.size());
+  head.write8(uint64_t(comp_size));
+
+  SetCompressedArray(ty, head, std::move(comp), comp_size, enc);
+  return true;
+}
+
+// Compressed half/float/double array is encoded as either
+//
+// - 'i' : all values are integers. u64 n + 'i' + u64 compressedSize +
+//         compressed int32
+// - 't' : few distinct values. u64 n + 't' + u32 lutSize + LUT +
+//         u64 compressedSize + compressed u32 LUT indices
+//
+// Otherwise the array is written uncompressed.
+template <typename T>
+void EncodeFloatArray(crate::CrateDataTypeId ty, const T *data, size_t n,
+                      EncodedArray *enc) {
+  if (n >= crate::kMinCompressedArraySize) {
+    if (IsAllInt32Representable(data, n)) {
+      if (EncodeFloatArrayAsInts(ty, data, n, enc)) {
+        return;
+      }
+    } else if (EncodeFloatArrayAsLUT(ty, data, n, enc)) {
+      return;
+    }
+  }
+
+  EncodeRawArray(ty, data, n, enc);
+}
+
+template <typename T>
+void EncodeArray(crate::CrateDataTypeId ty, const T *data, size_t n,
+                 EncodedArray *enc) {
+  EncodeRawArray(ty, data, n, enc);
+}
+
+void EncodeArray(crate::CrateDataTypeId ty, const int32_t *data, size_t n,
+                 EncodedArray *enc) {
+  EncodeIntArray<Usd_IntegerCompression>(ty, data, n, enc);
+}
+
+void EncodeArray(crate::CrateDataTypeId ty, const uint32_t *data, size_t n,
+                 EncodedArray *enc) {
+  EncodeIntArray<Usd_IntegerCompression>(ty, data, n, enc);
+}
+
+void EncodeArray(crate::CrateDataTypeId ty, const int64_t *data, size_t n,
+                 EncodedArray *enc) {
+  EncodeIntArray<Usd_IntegerCompression64>(ty, data, n, enc);
+}
+
+void EncodeArray(crate::CrateDataTypeId ty, const uint64_t *data, size_t n,
+                 EncodedArray *enc) {
+  EncodeIntArray<Usd_IntegerCompression64>(ty, data, n, enc);
+}
+
+void EncodeArray(crate::CrateDataTypeId ty, const value::half *data, size_t n,
+                 EncodedArray *enc) {
+  EncodeFloatArray(ty, data, n, enc);
+}
+
+void EncodeArray(crate::CrateDataTypeId ty, const float *data, size_t n,
+                 EncodedArray *enc) {
+  EncodeFloatArray(ty, data, n, enc);
+}
+
+void EncodeArray(crate::CrateDataTypeId ty, const double *data, size_t n,
+                 EncodedArray *enc) {
+  EncodeFloatArray(ty, data, n, enc);
+}
+
+// Array types whose elements are stored in the same memory layout in Crate.
+// (value::TypeId, C++ type, CrateDataTypeId)
+#define CRATE_WRITER_POD_ARRAY_TYPES(X) \
+  X(TYPE_ID_UCHAR, uint8_t, UCHAR)      \
+  X(TYPE_ID_INT32, int32_t, INT)        \
+  X(TYPE_ID_UINT32, uint32_t, UINT)     \
+  X(TYPE_ID_INT64, int64_t, INT64)      \
+  X(TYPE_ID_UINT64, uint64_t, UINT64)   \
+  X(TYPE_ID_HALF, value::half, HALF)    \
+  X(TYPE_ID_FLOAT, float, FLOAT)        \
+  X(TYPE_ID_DOUBLE, double, DOUBLE)     \
+  X(TYPE_ID_HALF2, value::half2, VEC2H) \
+  X(TYPE_ID_HALF3, value::half3, VEC3H) \
+  X(TYPE_ID_HALF4, value::half4, VEC4H) \
+  X(TYPE_ID_FLOAT2, value::float2, VEC2F) \
+  X(TYPE_ID_FLOAT3, value::float3, VEC3F) \
+  X(TYPE_ID_FLOAT4, value::float4, VEC4F) \
+  X(TYPE_ID_DOUBLE2, value::double2, VEC2D) \
+  X(TYPE_ID_DOUBLE3, value::double3, VEC3D) \
+  X(TYPE_ID_DOUBLE4, value::double4, VEC4D) \
+  X(TYPE_ID_INT2, value::int2, VEC2I)   \
+  X(TYPE_ID_INT3, value::int3, VEC3I)   \
+  X(TYPE_ID_INT4, value::int4, VEC4I)   \
+  X(TYPE_ID_QUATH, value::quath, QUATH) \
+  X(TYPE_ID_QUATF, value::quatf, QUATF) \
+  X(TYPE_ID_QUATD, value::quatd, QUATD) \
+  X(TYPE_ID_MATRIX2D, value::matrix2d, MATRIX2D) \
+  X(TYPE_ID_MATRIX3D, value::matrix3d, MATRIX3D) \
+  X(TYPE_ID_MATRIX4D, value::matrix4d, MATRIX4D)
+
+///
+/// Reference to array data whose elements are stored as is in Crate.
+///
+struct PODArrayRef {
+  uint32_t elem_type_id{value::TYPE_ID_INVALID};  // underlying element type
+  const void *data{nullptr};
+  size_t size{0};  // The number of elements
+  size_t elem_size{0};
+
+  size_t bytes() const { return size * elem_size; }
+};
+
+bool GetPODArray(const value::Value &v, PODArrayRef *ref) {
+  const uint32_t tyid = v.underlying_type_id();
+  if (!(tyid & value::TYPE_ID_1D_ARRAY_BIT)) {
+    return false;
+  }
+
+  switch (tyid & (~value::TYPE_ID_1D_ARRAY_BIT)) {
+#define CASE_POD_ARRAY(__tyid, __ty, __cty)        \
+  case value::__tyid: {                           \
+    if (const auto pv = v.as<std::vector<__ty>>()) { \
+      ref->elem_type_id = value::__tyid;          \
+      ref->data = pv->data();                     \
+      ref->size = pv->size();                     \
+      ref->elem_size = sizeof(__ty);              \
+      return true;                                \
+    }                                             \
+    return false;                                 \
+  }
+    CRATE_WRITER_POD_ARRAY_TYPES(CASE_POD_ARRAY)
+#undef CASE_POD_ARRAY
+    default:
+      break;
+  }
+
+  return false;
+}
+
+bool GetPODArray(const value::BorrowedArray &b, PODArrayRef *ref) {
+  switch (b.underlying_type_id & (~value::TYPE_ID_1D_ARRAY_BIT)) {
+#define CASE_POD_ARRAY(__tyid, __ty, __cty) \
+  case value::__tyid: {                    \
+    ref->elem_type_id = value::__tyid;     \
+    ref->data = b.data;                    \
+    ref->size = b.size;                    \
+    ref->elem_size = sizeof(__ty);         \
+    return true;                           \
+  }
+    CRATE_WRITER_POD_ARRAY_TYPES(CASE_POD_ARRAY)
+#undef CASE_POD_ARRAY
+    default:
+      break;
+  }
+
+  return false;
+}
 
-#if 0
-std::string WcharToUTF8(const std::wstring &wstr) {
-  int str_size = WideCharToMultiByte(CP_UTF8, 0, wstr.data(), int(wstr.size()),
-                                     nullptr, 0, nullptr, nullptr);
-  std::string str(size_t(str_size), 0);
-  WideCharToMultiByte(CP_UTF8, 0, wstr.data(), int(wstr.size()), &str[0],
-                      int(str.size()), nullptr, nullptr);
-  return str;
+void EncodePODArray(const PODArrayRef &ref, EncodedArray *enc) {
+  switch (ref.elem_type_id) {
+#define CASE_POD_ARRAY(__tyid, __ty, __cty)                                \
+  case value::__tyid: {                                                   \
+    EncodeArray(crate::CrateDataTypeId::CRATE_DATA_TYPE_##__cty,          \
+                static_cast<const __ty *>(ref.data), ref.size, enc);      \
+    return;                                                               \
+  }
+    CRATE_WRITER_POD_ARRAY_TYPES(CASE_POD_ARRAY)
+#undef CASE_POD_ARRAY
+    default:
+      break;
+  }
 }
+
+///
+/// Serialize Layer(PrimSpec tree) into Crate binary.
+///
+/// Layout of the output:
+///
+/// - Header(88 bytes)
+/// - Value data(non-inlined values referenced from ValueRep)
+/// - TOKENS, STRINGS, FIELDS, FIELDSETS, PATHS, SPECS sections
+/// - TOC
+///
+/// Identical values(arrays, dictionaries, TimeSamples, ...) are written once
+/// and shared among ValueReps. Tokens, strings, paths, fields and fieldsets are
+/// also deduplicated.
+///
+class Writer {
+ public:
+  Writer(const Layer &layer, const USDCWriteOptions &options)
+      : layer_(&layer) {
+    Init(options);
+  }
+
+  ///
+  /// Streaming mode. Serialized data is written to `fp` while serializing
+  /// Prims(buffered up to `buffer_size` bytes), so the whole file is not
+  /// built in memory. `fp` must be opened with "w+b" mode.
+  ///
+  Writer(const Layer &layer, const USDCWriteOptions &options, FILE *fp)
+      : layer_(&layer), sw_(fp, options.stream_buffer_size) {
+    Init(options);
+  }
+
+  const std::string &GetError() const { return err_; }
+  const std::string &GetWarning() const { return warn_; }
+
+  void ClearMessages() {
+    err_.clear();
+    warn_.clear();
+  }
+
+  bool Write();
+
+  ///
+  /// Incremental mode. Write specs/values in `layer` after the data written
+  /// by the previous Write() or Append(), then write new sections and TOC.
+  /// Values already written are shared. Existing specs are merged with the
+  /// specs in `layer`(see USDCAppender).
+  ///
+  bool Append(const Layer &layer);
+
+  ///
+  /// Keep the states required for Append()(must be set before Write()).
+  ///
+  void SetIncremental(bool onoff) { incremental_ = onoff; }
+
+  ///
+  /// Move out the serialized data(memory mode only).
+  ///
+  void GetOutput(std::vector<uint8_t> *output) { sw_.release(output); }
+
+ private:
+  Writer() = delete;
+  Writer(const Writer &) = delete;
+
+  using FieldList = std::vector<crate::FieldIndex>;
+
+  struct PathNode {
+    uint32_t token_index{0};
+    bool is_property{false};
+    bool encoded{true};  // false: Path slot not present in the path tree.
+    std::vector<uint32_t> children;
+  };
+
+  struct ValueLocation {
+    uint64_t offset;
+    uint64_t size;
+  };
+
+  void Init(const USDCWriteOptions &options) {
+#if defined(TINYUSDZ_USDC_WRITER_USE_THREAD)
+    num_threads_ = options.num_threads;
+    if (num_threads_ == -1) {
+      num_threads_ = (std::max)(1, int(std::thread::hardware_concurrency()));
+    }
+    // Limit to 1024 threads.
+    num_threads_ = (std::max)(1, (std::min)(1024, num_threads_));
+#else
+    (void)options;
 #endif
+
+    // Token 0 is reserved for empty token.
+    AddToken("");
+
+    // PathIndex 0 = root('/')
+    nodes_.emplace_back();
+  }
+
+  void PushError(const std::string &s) { err_ += s; }
+
+  void PushWarn(const std::string &s) { warn_ += s; }
+
+  //
+  // Tables
+  //
+  crate::TokenIndex AddToken(const std::string &token);
+  crate::StringIndex AddString(const std::string &str);
+  uint32_t AddChildPath(uint32_t parent, const std::string &element,
+                        bool is_property);
+  bool AddPath(const Path &path, crate::PathIndex *index);
+  bool AddField(const std::string &name, const crate::ValueRep &rep,
+                FieldList *fields);
+  crate::FieldIndex AddField(const crate::Field &field);
+  uint32_t AddFieldSet(const FieldList &fields);
+  void AddSpec(uint32_t path_index, const FieldList &fields,
+               SpecType spec_type);
+  void CollectFieldList(uint32_t fieldset_index, FieldList *fields) const;
+  void RebuildFieldSets();
+
+  //
+  // Values
+  //
+  bool IsSameBytes(uint64_t offset, const void *head, size_t head_size,
+                   const void *body, size_t body_size);
+  bool WriteValueBytes(const void *head, size_t head_size, const void *body,
+                       size_t body_size, uint64_t *offset);
+  bool WriteHashedValueBytes(uint64_t hash, const void *head, size_t head_size,
+                             const void *body, size_t body_size,
+                             uint64_t *offset);
+  bool WriteValue(crate::CrateDataTypeId ty, const StreamWriter &buf,
+                  crate::ValueRep *rep);
+
+  template <typename T>
+  bool PackRawValue(crate::CrateDataTypeId ty, const T &v,
+                    crate::ValueRep *rep);
+
+  template <typename T>
+  bool PackInlinableValue(crate::CrateDataTypeId ty, const T &v,
+                          crate::ValueRep *rep);
+
+  bool WriteEncodedArray(const EncodedArray &enc, uint64_t hash,
+                         crate::ValueRep *rep);
+  template <typename T>
+  bool PackTypedArray(crate::CrateDataTypeId ty, const T *data, size_t n,
+                      crate::ValueRep *rep);
+  bool PackPODArray(const PODArrayRef &ref, crate::ValueRep *rep);
+  bool PackArray(const value::Value &v, crate::ValueRep *rep);
+  bool PackBorrowedArray(const value::BorrowedArray &b, crate::ValueRep *rep);
+  bool PackIndexArray(crate::CrateDataTypeId ty,
+                      const std::vector<uint32_t> &indices,
+                      crate::ValueRep *rep);
+
+  bool PackValue(const value::Value &v, crate::ValueRep *rep);
+  crate::ValueRep PackToken(const std::string &tok);
+  crate::ValueRep PackString(const std::string &str);
+  bool PackDouble(double d, crate::ValueRep *rep);
+  bool PackDictionary(const Dictionary &dict, crate::ValueRep *rep);
+  bool WriteDictionaryEntries(const Dictionary &dict, StreamWriter *buf);
+  bool PackTimeSampleValues(const value::TimeSamples &ts,
+                            std::vector<double> *times,
+                            std::vector<uint64_t> *reps);
+  bool WriteTimeSamples(const std::vector<double> &times,
+                        const std::vector<uint64_t> &reps,
+                        crate::ValueRep *rep);
+  void MergeTimeSamples(uint32_t node, std::vector<double> *times,
+                        std::vector<uint64_t> *reps);
+
+  bool PackTokenVector(const std::vector<value::token> &toks,
+                       crate::ValueRep *rep);
+  bool PackChildList(uint32_t node, const std::string &name,
+                     const std::vector<value::token> &toks,
+                     crate::ValueRep *rep);
+  bool PackStringVector(const std::vector<std::string> &strs,
+                        crate::ValueRep *rep);
+  bool PackLayerOffsetVector(const std::vector<LayerOffset> &v,
+                             crate::ValueRep *rep);
+  bool PackVariantSelectionMap(const VariantSelectionMap &m,
+                               crate::ValueRep *rep);
+  bool PackPayload(const Payload &payload, crate::ValueRep *rep);
+
+  template <typename T, class ItemWriter>
+  bool PackListOp(crate::CrateDataTypeId ty, ListEditQual qual,
+                  const std::vector<T> &items, ItemWriter write_item,
+                  crate::ValueRep *rep);
+  bool PackTokenListOp(ListEditQual qual, const std::vector<value::token> &items,
+                       crate::ValueRep *rep);
+  bool PackStringListOp(ListEditQual qual,
+                        const std::vector<std::string> &items,
+                        crate::ValueRep *rep);
+  bool PackPathListOp(ListEditQual qual, const std::vector<Path> &items,
+                      crate::ValueRep *rep);
+  bool PackReferenceListOp(ListEditQual qual,
+                           const std::vector<Reference> &items,
+                           crate::ValueRep *rep);
+  bool PackPayloadListOp(ListEditQual qual, const std::vector<Payload> &items,
+                         crate::ValueRep *rep);
+
+  //
+  // Specs
+  //
+  std::vector<std::string> RootPrimNames() const;
+  std::vector<std::string> PropertyNames(const PrimSpec &ps) const;
+  void RegisterPrimPaths(uint32_t node, const PrimSpec &ps);
+  bool WriteLayer();
+  bool WriteLayerSpec();
+  bool WritePrimSpec(uint32_t node, const PrimSpec &ps, SpecType spec_type);
+  bool WritePrimMetas(const PrimMeta &metas, FieldList *fields);
+  bool WriteAttrMetas(const AttrMeta &metas, FieldList *fields);
+  bool WriteAttributeSpec(uint32_t node, const Property &prop);
+  bool WriteRelationshipSpec(uint32_t node, const Property &prop);
+
+#if defined(TINYUSDZ_USDC_WRITER_USE_THREAD)
+  //
+  // Parallel array encoding
+  //
+  void CollectArrayTasks(const PrimSpec &ps);
+  void CollectArrayTask(const PODArrayRef &ref);
+  void EncodeArrayTasks(size_t start);
+  bool TakePreEncodedArray(const PODArrayRef &ref, EncodedArray *enc,
+                           uint64_t *hash);
+#endif
+
+  //
+  // Sections
+  //
+  bool WriteCompressedInts(const int32_t *data, size_t n);
+  bool WriteCompressedInts(const uint32_t *data, size_t n);
+  void EncodePathNode(uint32_t node, bool has_sibling,
+                      std::vector<uint32_t> *path_indexes,
+                      std::vector<int32_t> *element_token_indexes,
+                      std::vector<int32_t> *jumps);
+  bool WriteTokensSection();
+  bool WriteStringsSection();
+  bool WriteFieldsSection();
+  bool WriteFieldSetsSection();
+  bool WritePathsSection();
+  bool WriteSpecsSection();
+  void BeginSection(const char *name);
+  void EndSection();
+  bool WriteTOC(uint64_t *toc_offset);
+
+  const Layer *layer_{nullptr};  // Valid only in Write() and Append()
+
+  std::vector<std::string> tokens_;
+  std::unordered_map<std::string, uint32_t> token_indices_;
+
+  std::vector<uint32_t> strings_;  // TokenIndex of each string.
+  std::unordered_map<std::string, uint32_t> string_indices_;
+
+  std::vector<PathNode> nodes_;
+  // key = (parent << 32) | (token_index << 1) | is_property
+  std::unordered_map<uint64_t, uint32_t> child_path_indices_;
+  nonstd::optional<uint32_t> empty_path_index_;
+
+  std::vector<crate::Field> fields_;
+  std::unordered_map<crate::Field, uint32_t, crate::FieldHasher,
+                     crate::FieldKeyEqual>
+      field_indices_;
+
+  std::vector<uint32_t> fieldsets_;  // flattened. each set is terminated by ~0
+  std::unordered_map<std::vector<crate::FieldIndex>, uint32_t,
+                     crate::FieldSetHasher>
+      fieldset_indices_;
+
+  std::vector<crate::Spec> specs_;
+
+  //
+  // States for Append()
+  //
+  bool incremental_{false};
+  // path index -> index to `specs_`
+  std::unordered_map<uint32_t, size_t> spec_indices_;
+  // (path index << 32) | field name token index -> token indices of
+  // primChildren, properties, ...
+  std::unordered_map<uint64_t, std::vector<uint32_t>> child_lists_;
+  struct TimeSampleReps {
+    std::vector<double> times;
+    std::vector<uint64_t> reps;
+  };
+  // attribute path index -> TimeSamples
+  std::unordered_map<uint32_t, TimeSampleReps> timesamples_;
+
+  // hash of value bytes -> locations in `sw_`
+  std::unordered_map<uint64_t, std::vector<ValueLocation>> value_locations_;
+
+  std::vector<crate::Section> sections_;
+
+#if defined(TINYUSDZ_USDC_WRITER_USE_THREAD)
+  struct PreEncodedArray {
+    EncodedArray enc;
+    uint64_t hash{0};
+  };
+
+  int num_threads_{1};
+
+  // Large arrays in the order they are written.
+  std::vector<PODArrayRef> array_tasks_;
+  // array data address -> index to `array_tasks_`. Removed once written.
+  std::unordered_map<const void *, size_t> array_task_indices_;
+  size_t num_encoded_array_tasks_{0};  // Tasks before this are encoded.
+  // index to `array_tasks_` -> encoded array. Removed once written.
+  std::unordered_map<size_t, PreEncodedArray> pre_encoded_arrays_;
 #endif
 
-struct Section {
-  Section() { memset(this, 0, sizeof(*this)); }
-  Section(char const *name, int64_t start, int64_t size);
-  char name[kSectionNameMaxLength + 1];
-  int64_t start, size;  // byte offset to section info and its data size
+  StreamWriter sw_;
+
+  std::string err_;
+  std::string warn_;
 };
 
-//
-// TOC = list of sections.
-//
-struct TableOfContents {
-  // Section const *GetSection(SectionName) const;
-  // int64_t GetMinimumSectionStart() const;
-  std::vector<Section> sections;
-};
+crate::TokenIndex Writer::AddToken(const std::string &token) {
+  auto it = token_indices_.find(token);
+  if (it != token_indices_.end()) {
+    return crate::TokenIndex(it->second);
+  }
+
+  uint32_t idx = uint32_t(tokens_.size());
+  tokens_.push_back(token);
+  token_indices_.emplace(token, idx);
+
+  return crate::TokenIndex(idx);
+}
+
+crate::StringIndex Writer::AddString(const std::string &str) {
+  auto it = string_indices_.find(str);
+  if (it != string_indices_.end()) {
+    return crate::StringIndex(it->second);
+  }
+
+  uint32_t idx = uint32_t(strings_.size());
+  strings_.push_back(AddToken(str).value);
+  string_indices_.emplace(str, idx);
+
+  return crate::StringIndex(idx);
+}
+
+uint32_t Writer::AddChildPath(uint32_t parent, const std::string &element,
+                              bool is_property) {
+  uint32_t tok = AddToken(element).value;
+  uint64_t key = (uint64_t(parent) << 32) | (uint64_t(tok) << 1) |
+                 (is_property ? 1u : 0u);
+
+  auto it = child_path_indices_.find(key);
+  if (it != child_path_indices_.end()) {
+    return it->second;
+  }
+
+  uint32_t idx = uint32_t(nodes_.size());
+  PathNode node;
+  node.token_index = tok;
+  node.is_property = is_property;
+  nodes_.emplace_back(std::move(node));
+  nodes_[parent].children.push_back(idx);
+  child_path_indices_.emplace(key, idx);
+
+  return idx;
+}
+
+bool Writer::AddPath(const Path &path, crate::PathIndex *index) {
+  const std::string &prim_part = path.prim_part();
+  const std::string &prop_part = path.prop_part();
+
+  if (!path.is_valid() || (prim_part.empty() && prop_part.empty())) {
+    // Empty path(e.g. Reference without prim path).
+    // Use a path slot which does not appear in the path tree.
+    if (!empty_path_index_) {
+      empty_path_index_ = uint32_t(nodes_.size());
+      PathNode node;
+      node.encoded = false;
+      nodes_.emplace_back(std::move(node));
+    }
+    (*index) = crate::PathIndex(empty_path_index_.value());
+    return true;
+  }
+
+  if (prim_part.empty() || (prim_part[0] != '/')) {
+    PUSH_ERROR_AND_RETURN("Relative path is not supported in USDC writer: "
+                          << path.full_path_name());
+  }
+
+  uint32_t node = 0;
+
+  // Split prim part into elements. Variant selection(`{set=sel}`) is an
+  // element.
+  size_t s = 1;
+  while (s < prim_part.size()) {
+    size_t e = prim_part.find('/', s);
+    if (e == std::string::npos) {
+      e = prim_part.size();
+    }
+
+    size_t p = s;
+    while (p < e) {
+      size_t q;
+      if (prim_part[p] == '{') {
+        q = prim_part.find('}', p);
+        if ((q == std::string::npos) || (q >= e)) {
+          PUSH_ERROR_AND_RETURN("Invalid variant selection in path: "
+                                << path.full_path_name());
+        }
+        q += 1;
+      } else {
+        q = prim_part.find('{', p);
+        if ((q == std::string::npos) || (q > e)) {
+          q = e;
+        }
+      }
+
+      node = AddChildPath(node, prim_part.substr(p, q - p),
+                          /* property */ false);
+      p = q;
+    }
+
+    s = e + 1;
+  }
+
+  if (!prop_part.empty()) {
+    node = AddChildPath(node, prop_part, /* property */ true);
+  }
+
+  (*index) = crate::PathIndex(node);
+  return true;
+}
+
+bool Writer::AddField(const std::string &name, const crate::ValueRep &rep,
+                      FieldList *fields) {
+  crate::Field field;
+  field.token_index = AddToken(name);
+  field.value_rep = rep;
+
+  fields->push_back(AddField(field));
+
+  return true;
+}
+
+crate::FieldIndex Writer::AddField(const crate::Field &field) {
+  auto it = field_indices_.find(field);
+  if (it != field_indices_.end()) {
+    return crate::FieldIndex(it->second);
+  }
+
+  uint32_t idx = uint32_t(fields_.size());
+  fields_.push_back(field);
+  field_indices_.emplace(field, idx);
+
+  return crate::FieldIndex(idx);
+}
+
+uint32_t Writer::AddFieldSet(const FieldList &fields) {
+  auto it = fieldset_indices_.find(fields);
+  if (it != fieldset_indices_.end()) {
+    return it->second;
+  }
+
+  // FieldSetIndex is the start offset of the fieldset in the flattened
+  // array.
+  uint32_t fieldset_index = uint32_t(fieldsets_.size());
+  for (const auto &f : fields) {
+    fieldsets_.push_back(f.value);
+  }
+  fieldsets_.push_back(~0u);  // terminator
+  fieldset_indices_.emplace(fields, fieldset_index);
+
+  return fieldset_index;
+}
+
+void Writer::AddSpec(uint32_t path_index, const FieldList &fields,
+                     SpecType spec_type) {
+  if (incremental_) {
+    auto it = spec_indices_.find(path_index);
+    if (it != spec_indices_.end()) {
+      // Merge with the spec written before. Fields in `fields` replace the
+      // fields of the same name.
+      crate::Spec &spec = specs_[it->second];
+
+      FieldList merged;
+      CollectFieldList(spec.fieldset_index.value, &merged);
+      for (const auto &f : fields) {
+        const crate::TokenIndex name = fields_[f.value].token_index;
+        auto fit = std::find_if(merged.begin(), merged.end(),
+                                [&](const crate::FieldIndex &m) {
+                                  return fields_[m.value].token_index == name;
+                                });
+        if (fit != merged.end()) {
+          (*fit) = f;
+        } else {
+          merged.push_back(f);
+        }
+      }
+
+      spec.fieldset_index = crate::Index(AddFieldSet(merged));
+      spec.spec_type = spec_type;
+      return;
+    }
+
+    spec_indices_.emplace(path_index, specs_.size());
+  }
+
+  crate::Spec spec;
+  spec.path_index = crate::Index(path_index);
+  spec.fieldset_index = crate::Index(AddFieldSet(fields));
+  spec.spec_type = spec_type;
+  specs_.push_back(spec);
+}
+
+void Writer::CollectFieldList(uint32_t fieldset_index,
+                              FieldList *fields) const {
+  for (size_t i = fieldset_index;
+       (i < fieldsets_.size()) && (fieldsets_[i] != ~0u); i++) {
+    fields->push_back(crate::FieldIndex(fieldsets_[i]));
+  }
+}
+
+// Remove fields and fieldsets which are no longer referenced from specs
+// (replaced by Append()).
+void Writer::RebuildFieldSets() {
+  std::vector<std::vector<crate::Field>> spec_fields(specs_.size());
+  for (size_t i = 0; i < specs_.size(); i++) {
+    FieldList fields;
+    CollectFieldList(specs_[i].fieldset_index.value, &fields);
+    for (const auto &f : fields) {
+      spec_fields[i].push_back(fields_[f.value]);
+    }
+  }
+
+  fields_.clear();
+  field_indices_.clear();
+  fieldsets_.clear();
+  fieldset_indices_.clear();
+
+  for (size_t i = 0; i < specs_.size(); i++) {
+    FieldList fields;
+    for (const auto &f : spec_fields[i]) {
+      fields.push_back(AddField(f));
+    }
+    specs_[i].fieldset_index = crate::Index(AddFieldSet(fields));
+  }
+}
+
+// Compare `head` + `body` with the bytes already written at `offset`.
+bool Writer::IsSameBytes(uint64_t offset, const void *head, size_t head_size,
+                         const void *body, size_t body_size) {
+  if (!sw_.is_file_backed()) {
+    const uint8_t *p = sw_.data() + offset;
+    return (head_size == 0 || (memcmp(p, head, head_size) == 0)) &&
+           (body_size == 0 || (memcmp(p + head_size, body, body_size) == 0));
+  }
+
+  // Read back from the file in chunks to bound memory usage.
+  constexpr size_t kChunkSize = 64 * 1024;
+  std::vector<uint8_t> chunk(kChunkSize);
+
+  const uint8_t *srcs[2] = {reinterpret_cast<const uint8_t *>(head),
+                            reinterpret_cast<const uint8_t *>(body)};
+  const size_t sizes[2] = {head_size, body_size};
+
+  for (size_t k = 0; k < 2; k++) {
+    size_t done = 0;
+    while (done < sizes[k]) {
+      size_t n = (std::min)(kChunkSize, sizes[k] - done);
+      if (!sw_.read_at(offset, chunk.data(), n) ||
+          (memcmp(chunk.data(), srcs[k] + done, n) != 0)) {
+        return false;
+      }
+      offset += n;
+      done += n;
+    }
+  }
+
+  return true;
+}
+
+bool Writer::WriteValueBytes(const void *head, size_t head_size,
+                             const void *body, size_t body_size,
+                             uint64_t *offset) {
+  return WriteHashedValueBytes(HashValueBytes(head, head_size, body, body_size),
+                               head, head_size, body, body_size, offset);
+}
+
+// `hash` : HashValueBytes() of `head` + `body`
+bool Writer::WriteHashedValueBytes(uint64_t hash, const void *head,
+                                   size_t head_size, const void *body,
+                                   size_t body_size, uint64_t *offset) {
+  const uint64_t total = uint64_t(head_size) + uint64_t(body_size);
+
+  std::vector<ValueLocation> &locs = value_locations_[hash];
+  for (const auto &loc : locs) {
+    if (loc.size != total) {
+      continue;
+    }
+
+    if (IsSameBytes(loc.offset, head, head_size, body, body_size)) {
+      // Identical value already written.
+      (*offset) = loc.offset;
+      return true;
+    }
+  }
+
+  sw_.seek_end();
+
+  // Align
+  size_t pad = size_t((kValueAlignment - (sw_.tell() % kValueAlignment)) %
+                      kValueAlignment);
+  if (pad) {
+    const uint8_t zeros[kValueAlignment] = {};
+    if (!sw_.write(zeros, pad)) {
+      PUSH_ERROR_AND_RETURN("Failed to write padding bytes.");
+    }
+  }
+
+  uint64_t loc = uint64_t(sw_.tell());
+  if ((loc + total) > kMaxValueOffset) {
+    PUSH_ERROR_AND_RETURN("Value data exceeds 48bit offset limit of ValueRep.");
+  }
+
+  if (!sw_.write(head, head_size) || !sw_.write(body, body_size)) {
+    PUSH_ERROR_AND_RETURN("Failed to write value data.");
+  }
+
+  locs.push_back({loc, total});
+  (*offset) = loc;
+
+  return true;
+}
+
+bool Writer::WriteValue(crate::CrateDataTypeId ty, const StreamWriter &buf,
+                        crate::ValueRep *rep) {
+  uint64_t offset;
+  if (!WriteValueBytes(nullptr, 0, buf.data(), size_t(buf.size()), &offset)) {
+    return false;
+  }
+
+  (*rep) = crate::ValueRep(int32_t(ty), /* inlined */ false, /* array */ false,
+                           offset);
+  return true;
+}
+
+template <typename T>
+bool Writer::PackRawValue(crate::CrateDataTypeId ty, const T &v,
+                          crate::ValueRep *rep) {
+  uint64_t offset;
+  if (!WriteValueBytes(nullptr, 0, &v, sizeof(T), &offset)) {
+    return false;
+  }
+
+  (*rep) = crate::ValueRep(int32_t(ty), /* inlined */ false, /* array */ false,
+                           offset);
+  return true;
+}
+
+template <typename T>
+bool Writer::PackInlinableValue(crate::CrateDataTypeId ty, const T &v,
+                                crate::ValueRep *rep) {
+  if (auto enc = crate::TryEncodeInline(v)) {
+    (*rep) = InlinedRep(ty, enc.value());
+    return true;
+  }
+
+  return PackRawValue(ty, v, rep);
+}
+
+bool Writer::WriteEncodedArray(const EncodedArray &enc, uint64_t hash,
+                               crate::ValueRep *rep) {
+  uint64_t offset;
+  if (!WriteHashedValueBytes(hash, enc.head.data(), enc.head.size(), enc.body,
+                             enc.body_size, &offset)) {
+    return false;
+  }
+
+  (*rep) = crate::ValueRep(int32_t(enc.ty), /* inlined */ false,
+                           /* array */ true, offset);
+  if (enc.compressed) {
+    rep->SetIsCompressed();
+  }
+  return true;
+}
+
+template <typename T>
+bool Writer::PackTypedArray(crate::CrateDataTypeId ty, const T *data,
+                            size_t n, crate::ValueRep *rep) {
+  EncodedArray enc;
+  EncodeArray(ty, data, n, &enc);
+  return WriteEncodedArray(enc, HashEncodedArray(enc), rep);
+}
+
+bool Writer::PackPODArray(const PODArrayRef &ref, crate::ValueRep *rep) {
+  EncodedArray enc;
+  uint64_t hash;
+
+#if defined(TINYUSDZ_USDC_WRITER_USE_THREAD)
+  if (TakePreEncodedArray(ref, &enc, &hash)) {
+    return WriteEncodedArray(enc, hash, rep);
+  }
+#endif
+
+  EncodePODArray(ref, &enc);
+  hash = HashEncodedArray(enc);
+  return WriteEncodedArray(enc, hash, rep);
+}
+
+bool Writer::PackIndexArray(crate::CrateDataTypeId ty,
+                            const std::vector<uint32_t> &indices,
+                            crate::ValueRep *rep) {
+  // Token/String index array is not compressed.
+  const uint64_t num = uint64_t(indices.size());
+
+  uint64_t offset;
+  if (!WriteValueBytes(&num, sizeof(uint64_t), indices.data(),
+                       sizeof(uint32_t) * indices.size(), &offset)) {
+    return false;
+  }
+
+  (*rep) = crate::ValueRep(int32_t(ty), /* inlined */ false, /* array */ true,
+                           offset);
+  return true;
+}
+
+bool Writer::PackArray(const value::Value &v, crate::ValueRep *rep) {
+  const uint32_t elem_tyid =
+      v.underlying_type_id() & (~value::TYPE_ID_1D_ARRAY_BIT);
+
+  PODArrayRef ref;
+  if (GetPODArray(v, &ref)) {
+    return PackPODArray(ref, rep);
+  }
+
+  switch (elem_tyid) {
+    case value::TYPE_ID_BOOL: {
+      if (const auto pv = v.as<std::vector<bool>>()) {
+        // 1 byte per element.
+        std::vector<uint8_t> bs(pv->size());
+        for (size_t i = 0; i < pv->size(); i++) {
+          bs[i] = (*pv)[i] ? 1 : 0;
+        }
+        return PackTypedArray(crate::CrateDataTypeId::CRATE_DATA_TYPE_BOOL,
+                              bs.data(), bs.size(), rep);
+      }
+      break;
+    }
+    case value::TYPE_ID_TIMECODE: {
+      if (const auto pv = v.as<std::vector<value::timecode>>()) {
+        std::vector<double> ds(pv->size());
+        for (size_t i = 0; i < pv->size(); i++) {
+          ds[i] = (*pv)[i].value;
+        }
+        return PackTypedArray(crate::CrateDataTypeId::CRATE_DATA_TYPE_DOUBLE,
+                              ds.data(), ds.size(), rep);
+      }
+      break;
+    }
+    case value::TYPE_ID_TOKEN: {
+      if (const auto pv = v.as<std::vector<value::token>>()) {
+        std::vector<uint32_t> indices(pv->size());
+        for (size_t i = 0; i < pv->size(); i++) {
+          indices[i] = AddToken((*pv)[i].str()).value;
+        }
+        return PackIndexArray(crate::CrateDataTypeId::CRATE_DATA_TYPE_TOKEN,
+                              indices, rep);
+      }
+      break;
+    }
+    case value::TYPE_ID_STRING: {
+      if (const auto pv = v.as<std::vector<std::string>>()) {
+        std::vector<uint32_t> indices(pv->size());
+        for (size_t i = 0; i < pv->size(); i++) {
+          indices[i] = AddString((*pv)[i]).value;
+        }
+        return PackIndexArray(crate::CrateDataTypeId::CRATE_DATA_TYPE_STRING,
+                              indices, rep);
+      }
+      break;
+    }
+    case value::TYPE_ID_STRING_DATA: {
+      if (const auto pv = v.as<std::vector<value::StringData>>()) {
+        std::vector<uint32_t> indices(pv->size());
+        for (size_t i = 0; i < pv->size(); i++) {
+          indices[i] = AddString((*pv)[i].value).value;
+        }
+        return PackIndexArray(crate::CrateDataTypeId::CRATE_DATA_TYPE_STRING,
+                              indices, rep);
+      }
+      break;
+    }
+    case value::TYPE_ID_ASSET_PATH: {
+      if (const auto pv = v.as<std::vector<value::AssetPath>>()) {
+        // AssetPath array is encoded as StringIndex array.
+        std::vector<uint32_t> indices(pv->size());
+        for (size_t i = 0; i < pv->size(); i++) {
+          indices[i] = AddString((*pv)[i].GetAssetPath()).value;
+        }
+        return PackIndexArray(
+            crate::CrateDataTypeId::CRATE_DATA_TYPE_ASSET_PATH, indices, rep);
+      }
+      break;
+    }
+    default:
+      break;
+  }
+
+  PUSH_ERROR_AND_RETURN("Unsupported array type for USDC: " << v.type_name());
+}
+
+bool Writer::PackBorrowedArray(const value::BorrowedArray &b,
+                               crate::ValueRep *rep) {
+  PODArrayRef ref;
+  if (GetPODArray(b, &ref)) {
+    return PackPODArray(ref, rep);
+  }
+
+  // Fallback. Copy to `std::vector`.
+  return PackArray(b.to_value(), rep);
+}
+
+crate::ValueRep Writer::PackToken(const std::string &tok) {
+  return InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_TOKEN,
+                    AddToken(tok).value);
+}
+
+crate::ValueRep Writer::PackString(const std::string &str) {
+  return InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_STRING,
+                    AddString(str).value);
+}
+
+bool Writer::PackDouble(double d, crate::ValueRep *rep) {
+  return PackInlinableValue(crate::CrateDataTypeId::CRATE_DATA_TYPE_DOUBLE, d,
+                            rep);
+}
+
+bool Writer::PackValue(const value::Value &v, crate::ValueRep *rep) {
+  const uint32_t tyid = v.underlying_type_id();
+
+  if (tyid & value::TYPE_ID_1D_ARRAY_BIT) {
+    return PackArray(v, rep);
+  }
+
+  switch (tyid) {
+    case value::TYPE_ID_VALUEBLOCK: {
+      (*rep) = InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_VALUE_BLOCK,
+                          0);
+      return true;
+    }
+    case value::TYPE_ID_BOOL: {
+      if (const auto pv = v.as<bool>()) {
+        (*rep) = InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_BOOL,
+                            (*pv) ? 1 : 0);
+        return true;
+      }
+      break;
+    }
+    case value::TYPE_ID_UCHAR: {
+      if (const auto pv = v.as<uint8_t>()) {
+        (*rep) = InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_UCHAR, *pv);
+        return true;
+      }
+      break;
+    }
+    case value::TYPE_ID_INT32: {
+      if (const auto pv = v.as<int32_t>()) {
+        (*rep) = InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_INT,
+                            uint32_t(*pv));
+        return true;
+      }
+      break;
+    }
+    case value::TYPE_ID_UINT32: {
+      if (const auto pv = v.as<uint32_t>()) {
+        (*rep) = InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_UINT, *pv);
+        return true;
+      }
+      break;
+    }
+    case value::TYPE_ID_INT64: {
+      if (const auto pv = v.as<int64_t>()) {
+        return PackInlinableValue(
+            crate::CrateDataTypeId::CRATE_DATA_TYPE_INT64, *pv, rep);
+      }
+      break;
+    }
+    case value::TYPE_ID_UINT64: {
+      if (const auto pv = v.as<uint64_t>()) {
+        return PackInlinableValue(
+            crate::CrateDataTypeId::CRATE_DATA_TYPE_UINT64, *pv, rep);
+      }
+      break;
+    }
+    case value::TYPE_ID_HALF: {
+      if (const auto pv = v.as<value::half>()) {
+        (*rep) = InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_HALF,
+                            pv->value);
+        return true;
+      }
+      break;
+    }
+    case value::TYPE_ID_FLOAT: {
+      if (const auto pv = v.as<float>()) {
+        uint32_t bits;
+        memcpy(&bits, pv, sizeof(float));
+        (*rep) = InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_FLOAT, bits);
+        return true;
+      }
+      break;
+    }
+    case value::TYPE_ID_DOUBLE: {
+      if (const auto pv = v.as<double>()) {
+        return PackDouble(*pv, rep);
+      }
+      break;
+    }
+    case value::TYPE_ID_TIMECODE: {
+      if (const auto pv = v.as<value::timecode>()) {
+        return PackDouble(pv->value, rep);
+      }
+      break;
+    }
+    case value::TYPE_ID_TOKEN: {
+      if (const auto pv = v.as<value::token>()) {
+        (*rep) = PackToken(pv->str());
+        return true;
+      }
+      break;
+    }
+    case value::TYPE_ID_STRING: {
+      if (const auto pv = v.as<std::string>()) {
+        (*rep) = PackString(*pv);
+        return true;
+      }
+      break;
+    }
+    case value::TYPE_ID_STRING_DATA: {
+      if (const auto pv = v.as<value::StringData>()) {
+        (*rep) = PackString(pv->value);
+        return true;
+      }
+      break;
+    }
+    case value::TYPE_ID_ASSET_PATH: {
+      if (const auto pv = v.as<value::AssetPath>()) {
+        // Inlined AssetPath uses TokenIndex.
+        (*rep) = InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_ASSET_PATH,
+                            AddToken(pv->GetAssetPath()).value);
+        return true;
+      }
+      break;
+    }
+#define CASE_INLINABLE(__tyid, __ty, __cty)                                    \
+  case value::__tyid: {                                                       \
+    if (const auto pv = v.as<__ty>()) {                                       \
+      return PackInlinableValue(crate::CrateDataTypeId::CRATE_DATA_TYPE_##__cty, \
+                                *pv, rep);                                    \
+    }                                                                         \
+    break;                                                                    \
+  }
+      CASE_INLINABLE(TYPE_ID_FLOAT2, value::float2, VEC2F)
+      CASE_INLINABLE(TYPE_ID_FLOAT3, value::float3, VEC3F)
+      CASE_INLINABLE(TYPE_ID_FLOAT4, value::float4, VEC4F)
+      CASE_INLINABLE(TYPE_ID_DOUBLE2, value::double2, VEC2D)
+      CASE_INLINABLE(TYPE_ID_DOUBLE3, value::double3, VEC3D)
+      CASE_INLINABLE(TYPE_ID_DOUBLE4, value::double4, VEC4D)
+      CASE_INLINABLE(TYPE_ID_INT2, value::int2, VEC2I)
+      CASE_INLINABLE(TYPE_ID_INT3, value::int3, VEC3I)
+      CASE_INLINABLE(TYPE_ID_INT4, value::int4, VEC4I)
+      CASE_INLINABLE(TYPE_ID_MATRIX2D, value::matrix2d, MATRIX2D)
+      CASE_INLINABLE(TYPE_ID_MATRIX3D, value::matrix3d, MATRIX3D)
+      CASE_INLINABLE(TYPE_ID_MATRIX4D, value::matrix4d, MATRIX4D)
+#undef CASE_INLINABLE
+#define CASE_RAW(__tyid, __ty, __cty)                                       \
+  case value::__tyid: {                                                    \
+    if (const auto pv = v.as<__ty>()) {                                    \
+      return PackRawValue(crate::CrateDataTypeId::CRATE_DATA_TYPE_##__cty, \
+                          *pv, rep);                                       \
+    }                                                                      \
+    break;                                                                 \
+  }
+      CASE_RAW(TYPE_ID_HALF2, value::half2, VEC2H)
+      CASE_RAW(TYPE_ID_HALF3, value::half3, VEC3H)
+      CASE_RAW(TYPE_ID_HALF4, value::half4, VEC4H)
+      CASE_RAW(TYPE_ID_QUATH, value::quath, QUATH)
+      CASE_RAW(TYPE_ID_QUATF, value::quatf, QUATF)
+      CASE_RAW(TYPE_ID_QUATD, value::quatd, QUATD)
+#undef CASE_RAW
+    case value::TYPE_ID_CUSTOMDATA: {
+      if (const auto pv = v.as<CustomDataType>()) {
+        return PackDictionary(*pv, rep);
+      }
+      break;
+    }
+    default:
+      break;
+  }
+
+  PUSH_ERROR_AND_RETURN("Unsupported value type for USDC: " << v.type_name());
+}
+
+bool Writer::WriteDictionaryEntries(const Dictionary &dict, StreamWriter *buf) {
+  buf->write8(uint64_t(dict.size()));
+
+  for (const auto &item : dict) {
+    // Pack the value first, since nested value is written to `sw_`.
+    crate::ValueRep rep;
+    if (!PackValue(item.second.get_raw_value(), &rep)) {
+      PUSH_ERROR_AND_RETURN("Failed to pack dictionary value: " << item.first);
+    }
+
+    buf->write4(AddString(item.first).value);
+    // Offset to ValueRep(relative to this offset field). ValueRep immediately
+    // follows.
+    buf->write8(int64_t(sizeof(int64_t)));
+    buf->write8(rep.GetData());
+  }
+
+  return true;
+}
+
+bool Writer::PackDictionary(const Dictionary &dict, crate::ValueRep *rep) {
+  if (dict.empty()) {
+    (*rep) = InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_DICTIONARY, 0);
+    return true;
+  }
+
+  StreamWriter buf;
+  if (!WriteDictionaryEntries(dict, &buf)) {
+    return false;
+  }
+
+  return WriteValue(crate::CrateDataTypeId::CRATE_DATA_TYPE_DICTIONARY, buf,
+                    rep);
+}
+
+bool Writer::PackTimeSampleValues(const value::TimeSamples &ts,
+                                  std::vector<double> *times,
+                                  std::vector<uint64_t> *reps) {
+  const auto &samples = ts.get_samples();
+
+  times->resize(samples.size());
+  reps->resize(samples.size());
+
+  for (size_t i = 0; i < samples.size(); i++) {
+    (*times)[i] = samples[i].t;
+
+    crate::ValueRep vrep;
+    if (samples[i].blocked) {
+      vrep = InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_VALUE_BLOCK, 0);
+    } else if (!PackValue(samples[i].value, &vrep)) {
+      PUSH_ERROR_AND_RETURN("Failed to pack TimeSamples value at time "
+                            << samples[i].t);
+    }
+    (*reps)[i] = vrep.GetData();
+  }
+
+  return true;
+}
+
+bool Writer::WriteTimeSamples(const std::vector<double> &times,
+                              const std::vector<uint64_t> &reps,
+                              crate::ValueRep *rep) {
+  // `times` is usually shared among attributes.
+  crate::ValueRep times_rep;
+  if (!PackTypedArray(crate::CrateDataTypeId::CRATE_DATA_TYPE_DOUBLE,
+                      times.data(), times.size(), &times_rep)) {
+    return false;
+  }
+
+  StreamWriter buf;
+  buf.write8(int64_t(sizeof(int64_t)));  // offset to `times` ValueRep
+  buf.write8(times_rep.GetData());
+  buf.write8(int64_t(sizeof(int64_t)));  // offset to values
+  buf.write8(uint64_t(reps.size()));
+  for (const auto &r : reps) {
+    buf.write8(r);
+  }
+
+  return WriteValue(crate::CrateDataTypeId::CRATE_DATA_TYPE_TIME_SAMPLES, buf,
+                    rep);
+}
+
+// Merge samples with the samples of the attribute written before. Samples in
+// `times`/`reps` win at the same time. The result is kept for the next
+// Append().
+void Writer::MergeTimeSamples(uint32_t node, std::vector<double> *times,
+                              std::vector<uint64_t> *reps) {
+  TimeSampleReps &prev = timesamples_[node];
+
+  TimeSampleReps merged;
+  merged.times.reserve(prev.times.size() + times->size());
+  merged.reps.reserve(prev.reps.size() + reps->size());
+
+  // Both are sorted by time.
+  size_t a = 0;
+  size_t b = 0;
+  while ((a < prev.times.size()) || (b < times->size())) {
+    if ((b >= times->size()) ||
+        ((a < prev.times.size()) && (prev.times[a] < (*times)[b]))) {
+      merged.times.push_back(prev.times[a]);
+      merged.reps.push_back(prev.reps[a]);
+      a++;
+    } else {
+      if ((a < prev.times.size()) && (prev.times[a] == (*times)[b])) {
+        a++;  // overwritten
+      }
+      merged.times.push_back((*times)[b]);
+      merged.reps.push_back((*reps)[b]);
+      b++;
+    }
+  }
+
+  (*times) = merged.times;
+  (*reps) = merged.reps;
+  prev = std::move(merged);
+}
+
+bool Writer::PackTokenVector(const std::vector<value::token> &toks,
+                             crate::ValueRep *rep) {
+  StreamWriter buf;
+  buf.write8(uint64_t(toks.size()));
+  for (const auto &tok : toks) {
+    buf.write4(AddToken(tok.str()).value);
+  }
+
+  return WriteValue(crate::CrateDataTypeId::CRATE_DATA_TYPE_TOKEN_VECTOR, buf,
+                    rep);
+}
+
+// Pack child names(primChildren, properties, ...) of the spec at `node`.
+// In incremental mode, names written before are kept(in the original order)
+// and new names are appended.
+bool Writer::PackChildList(uint32_t node, const std::string &name,
+                           const std::vector<value::token> &toks,
+                           crate::ValueRep *rep) {
+  if (!incremental_) {
+    return PackTokenVector(toks, rep);
+  }
+
+  const uint64_t key = (uint64_t(node) << 32) | AddToken(name).value;
+  std::vector<uint32_t> &list = child_lists_[key];
+  for (const auto &tok : toks) {
+    const uint32_t idx = AddToken(tok.str()).value;
+    if (std::find(list.begin(), list.end(), idx) == list.end()) {
+      list.push_back(idx);
+    }
+  }
+
+  std::vector<value::token> merged;
+  for (const auto idx : list) {
+    merged.push_back(value::token(tokens_[idx]));
+  }
+
+  return PackTokenVector(merged, rep);
+}
+
+bool Writer::PackStringVector(const std::vector<std::string> &strs,
+                              crate::ValueRep *rep) {
+  StreamWriter buf;
+  buf.write8(uint64_t(strs.size()));
+  for (const auto &s : strs) {
+    buf.write4(AddString(s).value);
+  }
+
+  return WriteValue(crate::CrateDataTypeId::CRATE_DATA_TYPE_STRING_VECTOR, buf,
+                    rep);
+}
+
+bool Writer::PackLayerOffsetVector(const std::vector<LayerOffset> &v,
+                                   crate::ValueRep *rep) {
+  StreamWriter buf;
+  buf.write8(uint64_t(v.size()));
+  for (const auto &lo : v) {
+    buf.write_double(lo._offset);
+    buf.write_double(lo._scale);
+  }
+
+  return WriteValue(crate::CrateDataTypeId::CRATE_DATA_TYPE_LAYER_OFFSET_VECTOR,
+                    buf, rep);
+}
+
+bool Writer::PackVariantSelectionMap(const VariantSelectionMap &m,
+                                     crate::ValueRep *rep) {
+  StreamWriter buf;
+  buf.write8(uint64_t(m.size()));
+  for (const auto &item : m) {
+    buf.write4(AddString(item.first).value);
+    buf.write4(AddString(item.second).value);
+  }
+
+  return WriteValue(
+      crate::CrateDataTypeId::CRATE_DATA_TYPE_VARIANT_SELECTION_MAP, buf, rep);
+}
+
+bool Writer::PackPayload(const Payload &payload, crate::ValueRep *rep) {
+  crate::PathIndex path_index;
+  if (!AddPath(payload.prim_path, &path_index)) {
+    return false;
+  }
+
+  StreamWriter buf;
+  buf.write4(AddString(payload.asset_path.GetAssetPath()).value);
+  buf.write4(path_index.value);
+  buf.write_double(payload.layerOffset._offset);
+  buf.write_double(payload.layerOffset._scale);
+
+  return WriteValue(crate::CrateDataTypeId::CRATE_DATA_TYPE_PAYLOAD, buf, rep);
+}
+
+// ListOp: u8 header bits + (u64 n + items) for each item list.
+// Single item list is written according to `qual`.
+template <typename T, class ItemWriter>
+bool Writer::PackListOp(crate::CrateDataTypeId ty, ListEditQual qual,
+                        const std::vector<T> &items, ItemWriter write_item,
+                        crate::ValueRep *rep) {
+  uint8_t bits{0};
+  switch (qual) {
+    case ListEditQual::ResetToExplicit:
+      bits = kListOpIsExplicit | kListOpHasExplicitItems;
+      break;
+    case ListEditQual::Append:
+      bits = kListOpHasAppendedItems;
+      break;
+    case ListEditQual::Add:
+      bits = kListOpHasAddedItems;
+      break;
+    case ListEditQual::Delete:
+      bits = kListOpHasDeletedItems;
+      break;
+    case ListEditQual::Prepend:
+      bits = kListOpHasPrependedItems;
+      break;
+    case ListEditQual::Order:
+      bits = kListOpHasOrderedItems;
+      break;
+    case ListEditQual::Invalid:
+      PUSH_ERROR_AND_RETURN("Invalid ListEdit qualifier.");
+  }
+
+  StreamWriter buf;
+  buf.write1(bits);
+  buf.write8(uint64_t(items.size()));
+  for (const auto &item : items) {
+    if (!write_item(item, &buf)) {
+      return false;
+    }
+  }
+
+  return WriteValue(ty, buf, rep);
+}
+
+bool Writer::PackTokenListOp(ListEditQual qual,
+                             const std::vector<value::token> &items,
+                             crate::ValueRep *rep) {
+  return PackListOp(
+      crate::CrateDataTypeId::CRATE_DATA_TYPE_TOKEN_LIST_OP, qual, items,
+      [this](const value::token &tok, StreamWriter *buf) {
+        return buf->write4(AddToken(tok.str()).value);
+      },
+      rep);
+}
+
+bool Writer::PackStringListOp(ListEditQual qual,
+                              const std::vector<std::string> &items,
+                              crate::ValueRep *rep) {
+  return PackListOp(
+      crate::CrateDataTypeId::CRATE_DATA_TYPE_STRING_LIST_OP, qual, items,
+      [this](const std::string &s, StreamWriter *buf) {
+        return buf->write4(AddString(s).value);
+      },
+      rep);
+}
+
+bool Writer::PackPathListOp(ListEditQual qual, const std::vector<Path> &items,
+                            crate::ValueRep *rep) {
+  return PackListOp(
+      crate::CrateDataTypeId::CRATE_DATA_TYPE_PATH_LIST_OP, qual, items,
+      [this](const Path &path, StreamWriter *buf) {
+        crate::PathIndex idx;
+        if (!AddPath(path, &idx)) {
+          return false;
+        }
+        return buf->write4(idx.value);
+      },
+      rep);
+}
+
+bool Writer::PackReferenceListOp(ListEditQual qual,
+                                 const std::vector<Reference> &items,
+                                 crate::ValueRep *rep) {
+  return PackListOp(
+      crate::CrateDataTypeId::CRATE_DATA_TYPE_REFERENCE_LIST_OP, qual, items,
+      [this](const Reference &ref, StreamWriter *buf) {
+        crate::PathIndex idx;
+        if (!AddPath(ref.prim_path, &idx)) {
+          return false;
+        }
+        buf->write4(AddString(ref.asset_path.GetAssetPath()).value);
+        buf->write4(idx.value);
+        buf->write_double(ref.layerOffset._offset);
+        buf->write_double(ref.layerOffset._scale);
+        return WriteDictionaryEntries(ref.customData, buf);
+      },
+      rep);
+}
+
+bool Writer::PackPayloadListOp(ListEditQual qual,
+                               const std::vector<Payload> &items,
+                               crate::ValueRep *rep) {
+  return PackListOp(
+      crate::CrateDataTypeId::CRATE_DATA_TYPE_PAYLOAD_LIST_OP, qual, items,
+      [this](const Payload &payload, StreamWriter *buf) {
+        crate::PathIndex idx;
+        if (!AddPath(payload.prim_path, &idx)) {
+          return false;
+        }
+        buf->write4(AddString(payload.asset_path.GetAssetPath()).value);
+        buf->write4(idx.value);
+        buf->write_double(payload.layerOffset._offset);
+        buf->write_double(payload.layerOffset._scale);
+        return true;
+      },
+      rep);
+}
+
+std::vector<std::string> Writer::RootPrimNames() const {
+  // `primChildren` order first, then remaining root prims in name order.
+  std::vector<std::string> names;
+  std::set<std::string> visited;
+
+  for (const auto &tok : layer_->metas().primChildren) {
+    if (layer_->primspecs().count(tok.str()) && !visited.count(tok.str())) {
+      names.push_back(tok.str());
+      visited.insert(tok.str());
+    }
+  }
+
+  std::vector<std::string> remaining;
+  for (const auto &item : layer_->primspecs()) {
+    if (!visited.count(item.first)) {
+      remaining.push_back(item.first);
+    }
+  }
+  std::sort(remaining.begin(), remaining.end());
+  names.insert(names.end(), remaining.begin(), remaining.end());
+
+  return names;
+}
+
+std::vector<std::string> Writer::PropertyNames(const PrimSpec &ps) const {
+  // `properties` order first, then remaining properties in name order.
+  std::vector<std::string> names;
+  std::set<std::string> visited;
+
+  for (const auto &tok : ps.propertyNames()) {
+    if (ps.props().count(tok.str()) && !visited.count(tok.str())) {
+      names.push_back(tok.str());
+      visited.insert(tok.str());
+    }
+  }
+
+  for (const auto &item : ps.props()) {
+    if (!visited.count(item.first)) {
+      names.push_back(item.first);
+    }
+  }
+
+  return names;
+}
+
+// Assign path indices in the PrimSpec tree order before writing any values, so
+// that the order of children in the path tree follows the PrimSpec tree even
+// when a value(e.g. relationship target) refers a path which appears later.
+void Writer::RegisterPrimPaths(uint32_t node, const PrimSpec &ps) {
+  for (const auto &name : PropertyNames(ps)) {
+    AddChildPath(node, name, /* property */ true);
+  }
+
+  for (const auto &vs : ps.variantSets()) {
+    AddChildPath(node, "{" + vs.first + "=}", /* property */ false);
+    for (const auto &variant : vs.second.variantSet) {
+      uint32_t variant_node = AddChildPath(
+          node, "{" + vs.first + "=" + variant.first + "}", /* property */ false);
+      RegisterPrimPaths(variant_node, variant.second);
+    }
+  }
+
+  for (const auto &child : ps.children()) {
+    uint32_t child_node = AddChildPath(node, child.name(), /* property */ false);
+    RegisterPrimPaths(child_node, child);
+  }
+}
+
+bool Writer::WriteLayerSpec() {
+  const LayerMetas &metas = layer_->metas();
+
+  FieldList fields;
+
+  auto add_double = [&](const std::string &name,
+                        const TypedAttributeWithFallback<double> &attr) {
+    if (!attr.authored()) {
+      return true;
+    }
+    crate::ValueRep rep;
+    if (!PackDouble(attr.get_value(), &rep)) {
+      return false;
+    }
+    return AddField(name, rep, &fields);
+  };
+
+  if (metas.upAxis.authored()) {
+    AddField("upAxis", PackToken(to_string(metas.upAxis.get_value())),
+             &fields);
+  }
+
+  if (!add_double("metersPerUnit", metas.metersPerUnit) ||
+      !add_double("kilogramsPerUnit", metas.kilogramsPerUnit) ||
+      !add_double("timeCodesPerSecond", metas.timeCodesPerSecond) ||
+      !add_double("framesPerSecond", metas.framesPerSecond) ||
+      !add_double("startTimeCode", metas.startTimeCode) ||
+      !add_double("endTimeCode", metas.endTimeCode)) {
+    return false;
+  }
+
+  if (!metas.defaultPrim.str().empty()) {
+    AddField("defaultPrim", PackToken(metas.defaultPrim.str()), &fields);
+  }
+
+  if (!metas.subLayers.empty()) {
+    std::vector<std::string> paths;
+    std::vector<LayerOffset> offsets;
+    bool has_offset{false};
+    for (const auto &sublayer : metas.subLayers) {
+      paths.push_back(sublayer.assetPath.GetAssetPath());
+      offsets.push_back(sublayer.layerOffset);
+      if ((sublayer.layerOffset._offset != 0.0) ||
+          (sublayer.layerOffset._scale != 1.0)) {
+        has_offset = true;
+      }
+    }
+
+    crate::ValueRep rep;
+    if (!PackStringVector(paths, &rep)) {
+      return false;
+    }
+    AddField("subLayers", rep, &fields);
+
+    if (has_offset) {
+      if (!PackLayerOffsetVector(offsets, &rep)) {
+        return false;
+      }
+      AddField("subLayerOffsets", rep, &fields);
+    }
+  }
+
+  if (!metas.customLayerData.empty()) {
+    crate::ValueRep rep;
+    if (!PackDictionary(metas.customLayerData, &rep)) {
+      return false;
+    }
+    AddField("customLayerData", rep, &fields);
+  }
+
+  if (!metas.doc.value.empty()) {
+    AddField("documentation", PackString(metas.doc.value), &fields);
+  }
+
+  if (!metas.comment.value.empty()) {
+    AddField("comment", PackString(metas.comment.value), &fields);
+  }
+
+  if (metas.autoPlay.authored()) {
+    AddField("autoPlay",
+             InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_BOOL,
+                        metas.autoPlay.get_value() ? 1 : 0),
+             &fields);
+  }
+
+  if (metas.playbackMode.authored()) {
+    AddField("playbackMode",
+             PackToken(metas.playbackMode.get_value() ==
+                               LayerMetas::PlaybackMode::PlaybackModeNone
+                           ? "none"
+                           : "loop"),
+             &fields);
+  }
+
+  const std::vector<std::string> root_names = RootPrimNames();
+  if (!root_names.empty()) {
+    std::vector<value::token> toks;
+    for (const auto &name : root_names) {
+      toks.push_back(value::token(name));
+    }
+
+    crate::ValueRep rep;
+    if (!PackChildList(/* root */ 0, "primChildren", toks, &rep)) {
+      return false;
+    }
+    AddField("primChildren", rep, &fields);
+  }
+
+  AddSpec(/* root */ 0, fields, SpecType::PseudoRoot);
+
+  for (const auto &name : root_names) {
+    uint32_t node = AddChildPath(0, name, /* property */ false);
+    if (!WritePrimSpec(node, layer_->primspecs().at(name), SpecType::Prim)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool Writer::WritePrimMetas(const PrimMeta &metas, FieldList *fields) {
+  crate::ValueRep rep;
+
+  auto add_bool = [&](const char *name, const nonstd::optional<bool> &v) {
+    if (v) {
+      AddField(name,
+               InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_BOOL,
+                          v.value() ? 1 : 0),
+               fields);
+    }
+  };
+
+  auto add_dict = [&](const char *name,
+                      const nonstd::optional<Dictionary> &v) {
+    if (v) {
+      if (!PackDictionary(v.value(), &rep)) {
+        return false;
+      }
+      AddField(name, rep, fields);
+    }
+    return true;
+  };
+
+  auto add_path_listop =
+      [&](const char *name,
+          const nonstd::optional<std::pair<ListEditQual, std::vector<Path>>>
+              &v) {
+        if (v) {
+          if (!PackPathListOp(v.value().first, v.value().second, &rep)) {
+            return false;
+          }
+          AddField(name, rep, fields);
+        }
+        return true;
+      };
+
+  add_bool("active", metas.active);
+  add_bool("hidden", metas.hidden);
+  add_bool("instanceable", metas.instanceable);
+
+  if (metas.kind) {
+    AddField("kind", PackToken(metas.get_kind()), fields);
+  }
+
+  if (!add_dict("assetInfo", metas.assetInfo) ||
+      !add_dict("customData", metas.customData) ||
+      !add_dict("sdrMetadata", metas.sdrMetadata) ||
+      !add_dict("clips", metas.clips)) {
+    return false;
+  }
+
+  if (metas.doc) {
+    AddField("documentation", PackString(metas.doc.value().value), fields);
+  }
+
+  if (metas.comment) {
+    AddField("comment", PackString(metas.comment.value().value), fields);
+  }
+
+  if (metas.sceneName) {
+    AddField("sceneName", PackString(metas.sceneName.value()), fields);
+  }
+
+  if (metas.displayName) {
+    AddField("displayName", PackString(metas.displayName.value()), fields);
+  }
+
+  if (metas.apiSchemas) {
+    std::vector<value::token> names;
+    for (const auto &item : metas.apiSchemas.value().names) {
+      std::string name = to_string(item.first);
+      if (!item.second.empty()) {
+        // multiple-apply schema
+        name += ":" + item.second;
+      }
+      names.push_back(value::token(name));
+    }
+    if (!PackTokenListOp(metas.apiSchemas.value().listOpQual, names, &rep)) {
+      return false;
+    }
+    AddField("apiSchemas", rep, fields);
+  }
+
+  if (!add_path_listop("inherits", metas.inherits) ||
+      !add_path_listop("specializes", metas.specializes) ||
+      !add_path_listop("inheritPaths", metas.inheritPaths)) {
+    return false;
+  }
+
+  if (metas.references) {
+    if (!PackReferenceListOp(metas.references.value().first,
+                             metas.references.value().second, &rep)) {
+      return false;
+    }
+    AddField("references", rep, fields);
+  }
+
+  if (metas.payload) {
+    const auto &payloads = metas.payload.value().second;
+    if ((metas.payload.value().first == ListEditQual::ResetToExplicit) &&
+        (payloads.size() == 1)) {
+      if (!PackPayload(payloads[0], &rep)) {
+        return false;
+      }
+    } else if (!PackPayloadListOp(metas.payload.value().first, payloads,
+                                  &rep)) {
+      return false;
+    }
+    AddField("payload", rep, fields);
+  }
+
+  if (metas.variantSets) {
+    if (!PackStringListOp(metas.variantSets.value().first,
+                          metas.variantSets.value().second, &rep)) {
+      return false;
+    }
+    AddField("variantSetNames", rep, fields);
+  }
+
+  if (metas.variants) {
+    if (!PackVariantSelectionMap(metas.variants.value(), &rep)) {
+      return false;
+    }
+    AddField("variantSelection", rep, fields);
+  }
+
+  for (const auto &item : metas.unregisteredMetas) {
+    AddField(item.first, PackString(item.second), fields);
+  }
+
+  for (const auto &item : metas.meta) {
+    if (!PackValue(item.second.get_raw_value(), &rep)) {
+      PUSH_ERROR_AND_RETURN("Failed to pack Prim metadatum: " << item.first);
+    }
+    AddField(item.first, rep, fields);
+  }
+
+  return true;
+}
+
+bool Writer::WritePrimSpec(uint32_t node, const PrimSpec &ps,
+                           SpecType spec_type) {
+  FieldList fields;
+  crate::ValueRep rep;
+
+  // `over` does not change the specifier of the Prim written before.
+  if (!incremental_ || (ps.specifier() != Specifier::Over) ||
+      !spec_indices_.count(node)) {
+    AddField("specifier",
+             InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_SPECIFIER,
+                        uint32_t(ps.specifier())),
+             &fields);
+  }
+
+  if (!ps.typeName().empty()) {
+    AddField("typeName", PackToken(ps.typeName()), &fields);
+  }
+
+  if (!WritePrimMetas(ps.metas(), &fields)) {
+    return false;
+  }
+
+  const std::vector<std::string> prop_names = PropertyNames(ps);
+  if (!prop_names.empty()) {
+    std::vector<value::token> toks;
+    for (const auto &name : prop_names) {
+      toks.push_back(value::token(name));
+    }
+    if (!PackChildList(node, "properties", toks, &rep)) {
+      return false;
+    }
+    AddField("properties", rep, &fields);
+  }
+
+  if (!ps.variantSets().empty()) {
+    std::vector<value::token> toks;
+    for (const auto &vs : ps.variantSets()) {
+      toks.push_back(value::token(vs.first));
+    }
+    if (!PackChildList(node, "variantSetChildren", toks, &rep)) {
+      return false;
+    }
+    AddField("variantSetChildren", rep, &fields);
+  }
+
+  if (!ps.children().empty()) {
+    std::vector<value::token> toks;
+    for (const auto &child : ps.children()) {
+      toks.push_back(value::token(child.name()));
+    }
+    if (!PackChildList(node, "primChildren", toks, &rep)) {
+      return false;
+    }
+    AddField("primChildren", rep, &fields);
+  }
+
+  AddSpec(node, fields, spec_type);
+
+  for (const auto &name : prop_names) {
+    const Property &prop = ps.props().at(name);
+    uint32_t prop_node = AddChildPath(node, name, /* property */ true);
+
+    if (prop.is_relationship()) {
+      if (!WriteRelationshipSpec(prop_node, prop)) {
+        PUSH_ERROR_AND_RETURN("Failed to write Relationship: " << name);
+      }
+    } else {
+      if (!WriteAttributeSpec(prop_node, prop)) {
+        PUSH_ERROR_AND_RETURN("Failed to write Attribute: " << name);
+      }
+    }
+  }
+
+  for (const auto &vs : ps.variantSets()) {
+    uint32_t vs_node = AddChildPath(node, "{" + vs.first + "=}",
+                                    /* property */ false);
+
+    std::vector<value::token> variant_names;
+    for (const auto &variant : vs.second.variantSet) {
+      variant_names.push_back(value::token(variant.first));
+    }
+
+    FieldList vs_fields;
+    if (!PackChildList(vs_node, "variantChildren", variant_names, &rep)) {
+      return false;
+    }
+    AddField("variantChildren", rep, &vs_fields);
+    AddSpec(vs_node, vs_fields, SpecType::VariantSet);
+
+    for (const auto &variant : vs.second.variantSet) {
+      uint32_t variant_node =
+          AddChildPath(node, "{" + vs.first + "=" + variant.first + "}",
+                       /* property */ false);
+      if (!WritePrimSpec(variant_node, variant.second, SpecType::Variant)) {
+        return false;
+      }
+    }
+  }
+
+  for (const auto &child : ps.children()) {
+    uint32_t child_node = AddChildPath(node, child.name(), /* property */ false);
+    if (!WritePrimSpec(child_node, child, SpecType::Prim)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool Writer::WriteAttrMetas(const AttrMeta &metas, FieldList *fields) {
+  crate::ValueRep rep;
+
+  if (metas.interpolation) {
+    AddField("interpolation", PackToken(to_string(metas.interpolation.value())),
+             fields);
+  }
+
+  if (metas.elementSize) {
+    AddField("elementSize",
+             InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_INT,
+                        metas.elementSize.value()),
+             fields);
+  }
+
+  if (metas.hidden) {
+    AddField("hidden",
+             InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_BOOL,
+                        metas.hidden.value() ? 1 : 0),
+             fields);
+  }
+
+  if (metas.comment) {
+    AddField("comment", PackString(metas.comment.value().value), fields);
+  }
+
+  if (metas.customData) {
+    if (!PackDictionary(metas.customData.value(), &rep)) {
+      return false;
+    }
+    AddField("customData", rep, fields);
+  }
+
+  if (metas.weight) {
+    // `weight` is float in Crate.
+    float w = float(metas.weight.value());
+    uint32_t bits;
+    memcpy(&bits, &w, sizeof(float));
+    AddField("weight",
+             InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_FLOAT, bits),
+             fields);
+  }
+
+  if (metas.connectability) {
+    AddField("connectability", PackToken(metas.connectability.value().str()),
+             fields);
+  }
+
+  if (metas.outputName) {
+    AddField("outputName", PackToken(metas.outputName.value().str()), fields);
+  }
+
+  if (metas.renderType) {
+    AddField("renderType", PackToken(metas.renderType.value().str()), fields);
+  }
+
+  if (metas.sdrMetadata) {
+    if (!PackDictionary(metas.sdrMetadata.value(), &rep)) {
+      return false;
+    }
+    AddField("sdrMetadata", rep, fields);
+  }
+
+  if (metas.displayName) {
+    AddField("displayName", PackString(metas.displayName.value()), fields);
+  }
+
+  if (metas.displayGroup) {
+    AddField("displayGroup", PackString(metas.displayGroup.value()), fields);
+  }
+
+  if (metas.bindMaterialAs) {
+    AddField("bindMaterialAs", PackToken(metas.bindMaterialAs.value().str()),
+             fields);
+  }
+
+  // Other metadatum(e.g. `colorSpace`, `unauthoredValuesIndex`)
+  for (const auto &item : metas.meta) {
+    if (!PackValue(item.second.get_raw_value(), &rep)) {
+      PUSH_ERROR_AND_RETURN("Failed to pack Attribute metadatum: "
+                            << item.first);
+    }
+    AddField(item.first, rep, fields);
+  }
+
+  return true;
+}
+
+bool Writer::WriteAttributeSpec(uint32_t node, const Property &prop) {
+  const Attribute &attr = prop.get_attribute();
+  const primvar::PrimVar &var = attr.get_var();
+
+  FieldList fields;
+  crate::ValueRep rep;
+
+  const std::string type_name = attr.type_name();
+  if (type_name.empty()) {
+    PUSH_ERROR_AND_RETURN("Attribute has no type name.");
+  }
+  AddField("typeName", PackToken(type_name), &fields);
+
+  if (prop.has_custom()) {
+    AddField("custom",
+             InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_BOOL, 1),
+             &fields);
+  }
+
+  if ((attr.variability() != Variability::Varying) ||
+      attr.is_varying_authored()) {
+    AddField("variability",
+             InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_VARIABILITY,
+                        uint32_t(attr.variability())),
+             &fields);
+  }
+
+  if (var.is_blocked()) {
+    AddField(
+        "default",
+        InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_VALUE_BLOCK, 0),
+        &fields);
+  } else if (var.is_borrowed_array()) {
+    if (!PackBorrowedArray(var.borrowed_array(), &rep)) {
+      return false;
+    }
+    AddField("default", rep, &fields);
+  } else if (var.has_default()) {
+    if (!PackValue(var.value_raw(), &rep)) {
+      return false;
+    }
+    AddField("default", rep, &fields);
+  }
+
+  if (var.has_timesamples()) {
+    std::vector<double> times;
+    std::vector<uint64_t> reps;
+    if (!PackTimeSampleValues(var.ts_raw(), &times, &reps)) {
+      return false;
+    }
+    if (incremental_) {
+      MergeTimeSamples(node, &times, &reps);
+    }
+    if (!WriteTimeSamples(times, reps, &rep)) {
+      return false;
+    }
+    AddField("timeSamples", rep, &fields);
+  }
+
+  if (attr.has_connections()) {
+    if (!PackPathListOp(ListEditQual::ResetToExplicit, attr.connections(),
+                        &rep)) {
+      return false;
+    }
+    AddField("connectionPaths", rep, &fields);
+  }
+
+  if (!WriteAttrMetas(attr.metas(), &fields)) {
+    return false;
+  }
+
+  AddSpec(node, fields, SpecType::Attribute);
+
+  return true;
+}
+
+bool Writer::WriteRelationshipSpec(uint32_t node, const Property &prop) {
+  const Relationship &rel = prop.get_relationship();
+
+  FieldList fields;
+  crate::ValueRep rep;
+
+  if (prop.has_custom()) {
+    AddField("custom",
+             InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_BOOL, 1),
+             &fields);
+  }
+
+  if (rel.is_varying_authored()) {
+    AddField("variability",
+             InlinedRep(crate::CrateDataTypeId::CRATE_DATA_TYPE_VARIABILITY,
+                        uint32_t(Variability::Varying)),
+             &fields);
+  }
+
+  if (rel.is_path()) {
+    if (!PackPathListOp(rel.get_listedit_qual(), {rel.targetPath}, &rep)) {
+      return false;
+    }
+    AddField("targetPaths", rep, &fields);
+  } else if (rel.is_pathvector()) {
+    if (!PackPathListOp(rel.get_listedit_qual(), rel.targetPathVector, &rep)) {
+      return false;
+    }
+    AddField("targetPaths", rep, &fields);
+  } else if (rel.is_blocked()) {
+    PUSH_WARN("ValueBlock for Relationship is not supported in USDC. Written "
+              "as Relationship without targets.");
+  }
+
+  if (!WriteAttrMetas(rel.metas(), &fields)) {
+    return false;
+  }
+
+  AddSpec(node, fields, SpecType::Relationship);
+
+  return true;
+}
+
+bool Writer::WriteCompressedInts(const int32_t *data, size_t n) {
+  std::vector<char> comp(Usd_IntegerCompression::GetCompressedBufferSize(n));
+  std::string err;
+  size_t comp_size =
+      Usd_IntegerCompression::CompressToBuffer(data, n, comp.data(), &err);
+  if (!err.empty() || (comp_size == 0) || (comp_size > comp.size())) {
+    PUSH_ERROR_AND_RETURN("Failed to compress integers. " << err);
+  }
+
+  sw_.write8(uint64_t(comp_size));
+  sw_.write(comp.data(), comp_size);
+
+  return true;
+}
+
+bool Writer::WriteCompressedInts(const uint32_t *data, size_t n) {
+  std::vector<char> comp(Usd_IntegerCompression::GetCompressedBufferSize(n));
+  std::string err;
+  size_t comp_size =
+      Usd_IntegerCompression::CompressToBuffer(data, n, comp.data(), &err);
+  if (!err.empty() || (comp_size == 0) || (comp_size > comp.size())) {
+    PUSH_ERROR_AND_RETURN("Failed to compress integers. " << err);
+  }
+
+  sw_.write8(uint64_t(comp_size));
+  sw_.write(comp.data(), comp_size);
+
+  return true;
+}
+
+void Writer::BeginSection(const char *name) {
+  crate::Section sec;
+  strncpy(sec.name, name, crate::kSectionNameMaxLength);
+  sec.start = int64_t(sw_.tell());
+  sections_.push_back(sec);
+}
+
+void Writer::EndSection() {
+  crate::Section &sec = sections_.back();
+  sec.size = int64_t(sw_.tell()) - sec.start;
+}
+
+bool Writer::WriteTokensSection() {
+  // '\0' terminated strings, then LZ4 compressed.
+  std::string chars;
+  for (const auto &tok : tokens_) {
+    chars += tok;
+    chars.push_back('\0');
+  }
+
+  // Reader requires uncompressed size >= 3 + num_tokens(and >= 4)
+  size_t min_size = (std::max)(size_t(4), 3 + tokens_.size());
+  if (chars.size() < min_size) {
+    chars.resize(min_size, '\0');
+  }
+
+  std::vector<char> comp(LZ4Compression::GetCompressedBufferSize(chars.size()));
+  std::string err;
+  size_t comp_size = LZ4Compression::CompressToBuffer(
+      chars.data(), comp.data(), chars.size(), &err);
+  if (!err.empty() || (comp_size == 0) || (comp_size > comp.size())) {
+    PUSH_ERROR_AND_RETURN("Failed to compress tokens. " << err);
+  }
+
+  BeginSection("TOKENS");
+  sw_.write8(uint64_t(tokens_.size()));
+  sw_.write8(uint64_t(chars.size()));
+  sw_.write8(uint64_t(comp_size));
+  sw_.write(comp.data(), comp_size);
+  EndSection();
+
+  return true;
+}
+
+bool Writer::WriteStringsSection() {
+  BeginSection("STRINGS");
+  sw_.write8(uint64_t(strings_.size()));
+  sw_.write(strings_.data(), sizeof(uint32_t) * strings_.size());
+  EndSection();
+
+  return true;
+}
+
+bool Writer::WriteFieldsSection() {
+  BeginSection("FIELDS");
+
+  sw_.write8(uint64_t(fields_.size()));
+
+  if (!fields_.empty()) {
+    std::vector<uint32_t> token_indices(fields_.size());
+    std::vector<uint64_t> reps(fields_.size());
+    for (size_t i = 0; i < fields_.size(); i++) {
+      token_indices[i] = fields_[i].token_index.value;
+      reps[i] = fields_[i].value_rep.GetData();
+    }
+
+    if (!WriteCompressedInts(token_indices.data(), token_indices.size())) {
+      return false;
+    }
+
+    const size_t reps_size = sizeof(uint64_t) * reps.size();
+    std::vector<char> comp(LZ4Compression::GetCompressedBufferSize(reps_size));
+    std::string err;
+    size_t comp_size = LZ4Compression::CompressToBuffer(
+        reinterpret_cast<const char *>(reps.data()), comp.data(), reps_size,
+        &err);
+    if (!err.empty() || (comp_size == 0) || (comp_size > comp.size())) {
+      PUSH_ERROR_AND_RETURN("Failed to compress ValueReps. " << err);
+    }
+
+    sw_.write8(uint64_t(comp_size));
+    sw_.write(comp.data(), comp_size);
+  }
+
+  EndSection();
+
+  return true;
+}
+
+bool Writer::WriteFieldSetsSection() {
+  BeginSection("FIELDSETS");
+  sw_.write8(uint64_t(fieldsets_.size()));
+  if (!WriteCompressedInts(fieldsets_.data(), fieldsets_.size())) {
+    return false;
+  }
+  EndSection();
+
+  return true;
+}
+
+// Pre-order DFS. jump:
+//   -2 : no child, no sibling
+//   -1 : child only(child is the next entry)
+//    0 : sibling only(sibling is the next entry)
+//   >0 : both child and sibling. child is the next entry and the sibling is at
+//        `this + jump`
+void Writer::EncodePathNode(uint32_t node, bool has_sibling,
+                            std::vector<uint32_t> *path_indexes,
+                            std::vector<int32_t> *element_token_indexes,
+                            std::vector<int32_t> *jumps) {
+  const size_t this_index = path_indexes->size();
+  const PathNode &n = nodes_[node];
+
+  path_indexes->push_back(node);
+  element_token_indexes->push_back(n.is_property ? -int32_t(n.token_index)
+                                                 : int32_t(n.token_index));
+  jumps->push_back(0);
+
+  // NOTE: Use index access since `nodes_` is not modified here.
+  for (size_t i = 0; i < nodes_[node].children.size(); i++) {
+    EncodePathNode(nodes_[node].children[i],
+                   (i + 1) < nodes_[node].children.size(), path_indexes,
+                   element_token_indexes, jumps);
+  }
+
+  const bool has_child = !nodes_[node].children.empty();
+
+  int32_t jump;
+  if (has_child && has_sibling) {
+    jump = int32_t(path_indexes->size() - this_index);
+  } else if (has_child) {
+    jump = -1;
+  } else if (has_sibling) {
+    jump = 0;
+  } else {
+    jump = -2;
+  }
+  (*jumps)[this_index] = jump;
+}
+
+bool Writer::WritePathsSection() {
+  std::vector<uint32_t> path_indexes;
+  std::vector<int32_t> element_token_indexes;
+  std::vector<int32_t> jumps;
+
+  path_indexes.reserve(nodes_.size());
+  element_token_indexes.reserve(nodes_.size());
+  jumps.reserve(nodes_.size());
+
+  EncodePathNode(/* root */ 0, /* has_sibling */ false, &path_indexes,
+                 &element_token_indexes, &jumps);
+
+  BeginSection("PATHS");
+  sw_.write8(uint64_t(nodes_.size()));
+  sw_.write8(uint64_t(path_indexes.size()));
+  if (!WriteCompressedInts(path_indexes.data(), path_indexes.size()) ||
+      !WriteCompressedInts(element_token_indexes.data(),
+                           element_token_indexes.size()) ||
+      !WriteCompressedInts(jumps.data(), jumps.size())) {
+    return false;
+  }
+  EndSection();
+
+  return true;
+}
+
+bool Writer::WriteSpecsSection() {
+  std::vector<uint32_t> path_indices(specs_.size());
+  std::vector<uint32_t> fieldset_indices(specs_.size());
+  std::vector<uint32_t> spec_types(specs_.size());
+
+  for (size_t i = 0; i < specs_.size(); i++) {
+    path_indices[i] = specs_[i].path_index.value;
+    fieldset_indices[i] = specs_[i].fieldset_index.value;
+    spec_types[i] = uint32_t(specs_[i].spec_type);
+  }
+
+  BeginSection("SPECS");
+  sw_.write8(uint64_t(specs_.size()));
+  if (!WriteCompressedInts(path_indices.data(), path_indices.size()) ||
+      !WriteCompressedInts(fieldset_indices.data(), fieldset_indices.size()) ||
+      !WriteCompressedInts(spec_types.data(), spec_types.size())) {
+    return false;
+  }
+  EndSection();
 
-//struct Field {
-//  // FIXME(syoyo): Do we need 4 bytes padding as done in pxrUSD?
-//  // uint32_t padding_;
-//
-//  crate::TokenIndex token_index;
-//  crate::ValueRep value_rep;
-//};
-
-#if 0
-// For unordered_map
-
-// https://stackoverflow.com/questions/8513911/how-to-create-a-good-hash-combine-with-64-bit-output-inspired-by-boosthash-co
-// From CityHash code.
-template <class T>
-inline void hash_combine(std::size_t &seed, const T &v) {
-#ifdef __wasi__  // 32bit platform
-  // Use boost version.
-  std::hash<T> hasher;
-  seed ^= hasher(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-#else
-  std::hash<T> hasher;
-  const uint64_t kMul = 0x9ddfea08eb382d69ULL;
-  std::size_t a = (hasher(v) ^ seed) * kMul;
-  a ^= (a >> 47);
-  std::size_t b = (seed ^ a) * kMul;
-  b ^= (b >> 47);
-  seed = b * kMul;
-#endif
+  return true;
 }
 
-struct PathHasher {
-  size_t operator()(const Path &path) const {
-    size_t seed = std::hash<std::string>()(path.GetPrimPart());
-    hash_combine(seed, std::hash<std::string>()(path.GetPropPart()));
-    hash_combine(seed, std::hash<std::string>()(path.GetLocalPart()));
-    hash_combine(seed, std::hash<bool>()(path.IsValid()));
+bool Writer::WriteTOC(uint64_t *toc_offset) {
+  (*toc_offset) = uint64_t(sw_.tell());
 
-    return seed;
+  sw_.write8(uint64_t(sections_.size()));
+  for (const auto &sec : sections_) {
+    sw_.write(sec.name, sizeof(sec.name));
+    sw_.write8(sec.start);
+    sw_.write8(sec.size);
   }
-};
 
-struct PathKeyEqual {
-  bool operator()(const Path &lhs, const Path &rhs) const {
-    bool ret = lhs.GetPrimPart() == rhs.GetPrimPart();
-    ret &= lhs.GetPropPart() == rhs.GetPropPart();
-    ret &= lhs.GetLocalPart() == rhs.GetLocalPart();
-    ret &= lhs.IsValid() == rhs.IsValid();
+  return true;
+}
 
-    return ret;
+#if defined(TINYUSDZ_USDC_WRITER_USE_THREAD)
+void Writer::CollectArrayTask(const PODArrayRef &ref) {
+  if (ref.bytes() < kMinParallelArrayBytes) {
+    return;
   }
-};
 
-struct FieldHasher {
-  size_t operator()(const Field &field) const {
-    size_t seed = std::hash<uint32_t>()(field.token_index.value);
-    hash_combine(seed, std::hash<uint64_t>()(field.value_rep.GetData()));
-
-    return seed;
+  // Same array data is encoded once.
+  if (array_task_indices_.emplace(ref.data, array_tasks_.size()).second) {
+    array_tasks_.push_back(ref);
   }
-};
+}
 
-struct FieldKeyEqual {
-  bool operator()(const Field &lhs, const Field &rhs) const {
-    bool ret = lhs.token_index == rhs.token_index;
-    ret &= lhs.value_rep == rhs.value_rep;
+// Visit arrays in the same order as WritePrimSpec.
+void Writer::CollectArrayTasks(const PrimSpec &ps) {
+  for (const auto &name : PropertyNames(ps)) {
+    const Property &prop = ps.props().at(name);
+    if (prop.is_relationship()) {
+      continue;
+    }
 
-    return ret;
-  }
-};
+    const primvar::PrimVar &var = prop.get_attribute().get_var();
 
-struct FieldSetHasher {
-  size_t operator()(const std::vector<crate::FieldIndex> &fieldset) const {
-    if (fieldset.empty()) {
-      return 0;
+    PODArrayRef ref;
+    if (var.is_blocked()) {
+      // no value
+    } else if (var.is_borrowed_array()) {
+      if (GetPODArray(var.borrowed_array(), &ref)) {
+        CollectArrayTask(ref);
+      }
+    } else if (var.has_default()) {
+      if (GetPODArray(var.value_raw(), &ref)) {
+        CollectArrayTask(ref);
+      }
     }
 
-    size_t seed = std::hash<uint32_t>()(fieldset[0].value);
-    for (size_t i = 1; i < fieldset.size(); i++) {
-      hash_combine(seed, std::hash<uint32_t>()(fieldset[i].value));
+    if (var.has_timesamples()) {
+      for (const auto &sample : var.ts_raw().get_samples()) {
+        if (!sample.blocked && GetPODArray(sample.value, &ref)) {
+          CollectArrayTask(ref);
+        }
+      }
     }
+  }
 
-    return seed;
+  for (const auto &vs : ps.variantSets()) {
+    for (const auto &variant : vs.second.variantSet) {
+      CollectArrayTasks(variant.second);
+    }
   }
-};
-#endif
 
-class Packer {
- public:
-  crate::TokenIndex AddToken(const Token &token);
-  crate::StringIndex AddString(const std::string &str);
-  crate::PathIndex AddPath(const Path &path);
-  crate::FieldIndex AddField(const crate::Field &field);
-  crate::FieldSetIndex AddFieldSet(
-      const std::vector<crate::FieldIndex> &field_indices);
+  for (const auto &child : ps.children()) {
+    CollectArrayTasks(child);
+  }
+}
 
-  const std::vector<Token> &GetTokens() const { return tokens_; }
+// Encode the next batch of arrays starting at `array_tasks_[start]` in
+// parallel. Encoding has no side effect on the Writer, so the output is
+// identical to the single-threaded encoding.
+void Writer::EncodeArrayTasks(size_t start) {
+  const size_t max_batch_bytes =
+      size_t(num_threads_) * kArrayBatchBytesPerThread;
+
+  size_t end = start;
+  size_t batch_bytes = 0;
+  while ((end < array_tasks_.size()) &&
+         ((end == start) || (batch_bytes < max_batch_bytes))) {
+    batch_bytes += array_tasks_[end].bytes();
+    end++;
+  }
 
- private:
-  std::unordered_map<Token, crate::TokenIndex, TokenHasher, TokenKeyEqual>
-      token_to_index_map;
-  std::unordered_map<std::string, crate::StringIndex> string_to_index_map;
-  std::unordered_map<Path, crate::PathIndex, crate::PathHasher, crate::PathKeyEqual>
-      path_to_index_map;
-  std::unordered_map<crate::Field, crate::FieldIndex, crate::FieldHasher, crate::FieldKeyEqual>
-      field_to_index_map;
-  std::unordered_map<std::vector<crate::FieldIndex>, crate::FieldSetIndex,
-                     crate::FieldSetHasher>
-      fieldset_to_index_map;
+  const size_t n = end - start;
+  std::vector<PreEncodedArray> results(n);
 
-  std::vector<Token> tokens_;
-  std::vector<std::string> strings_;
-  std::vector<Path> paths_;
-  std::vector<crate::Field> fields_;
-  std::vector<crate::FieldIndex>
-      fieldsets_;  // flattened 1D array of FieldSets. Each span is terminated
-                   // by Index()(= ~0)
-};
+  std::atomic<size_t> counter(0);
 
-#if 0 // not used atm.
-crate::TokenIndex Packer::AddToken(const Token &token) {
-  if (token_to_index_map.count(token)) {
-    return token_to_index_map[token];
+  auto EncodeArrays = [&]() {
+    size_t i = 0;
+    while ((i = counter++) < n) {
+      EncodePODArray(array_tasks_[start + i], &results[i].enc);
+      results[i].hash = HashEncodedArray(results[i].enc);
+    }
+  };
+
+  const size_t nthreads = (std::min)(size_t(num_threads_), n);
+  if (nthreads > 1) {
+    std::vector<std::thread> threads;
+    threads.reserve(nthreads);
+    for (size_t t = 0; t < nthreads; t++) {
+      threads.emplace_back(EncodeArrays);
+    }
+    for (auto &th : threads) {
+      th.join();
+    }
+  } else {
+    EncodeArrays();
   }
 
-  // index = size of umap
-  token_to_index_map[token] = crate::TokenIndex(uint32_t(tokens_.size()));
-  tokens_.emplace_back(token);
+  for (size_t i = 0; i < n; i++) {
+    pre_encoded_arrays_.emplace(start + i, std::move(results[i]));
+  }
 
-  return token_to_index_map[token];
+  num_encoded_array_tasks_ = end;
 }
 
-crate::StringIndex Packer::AddString(const std::string &str) {
-  if (string_to_index_map.count(str)) {
-    return string_to_index_map[str];
+bool Writer::TakePreEncodedArray(const PODArrayRef &ref, EncodedArray *enc,
+                                 uint64_t *hash) {
+  auto it = array_task_indices_.find(ref.data);
+  if (it == array_task_indices_.end()) {
+    return false;
   }
 
-  // index = size of umap
-  string_to_index_map[str] = crate::StringIndex(uint32_t(strings_.size()));
-  strings_.emplace_back(str);
+  const size_t idx = it->second;
+  const PODArrayRef &task = array_tasks_[idx];
+  if ((task.elem_type_id != ref.elem_type_id) || (task.size != ref.size)) {
+    return false;
+  }
+  array_task_indices_.erase(it);
 
-  return string_to_index_map[str];
-}
+  if (idx >= num_encoded_array_tasks_) {
+    EncodeArrayTasks(idx);
+  }
 
-crate::PathIndex Packer::AddPath(const Path &path) {
-  if (path_to_index_map.count(path)) {
-    return path_to_index_map[path];
+  auto pit = pre_encoded_arrays_.find(idx);
+  if (pit == pre_encoded_arrays_.end()) {
+    // Skipped batch. Happens when arrays are written in a different order.
+    return false;
   }
 
-  // index = size of umap
-  path_to_index_map[path] = crate::PathIndex(uint32_t(paths_.size()));
-  paths_.emplace_back(path);
+  // NOTE: Moving std::vector keeps its buffer, so `body` stays valid.
+  (*enc) = std::move(pit->second.enc);
+  (*hash) = pit->second.hash;
+  pre_encoded_arrays_.erase(pit);
 
-  return path_to_index_map[path];
+  return true;
 }
+#endif
 
-crate::FieldIndex Packer::AddField(const crate::Field &field) {
-  if (field_to_index_map.count(field)) {
-    return field_to_index_map[field];
+bool Writer::Write() {
+  // Reserve header. Filled after writing TOC.
+  {
+    const uint8_t header[kHeaderSize] = {};
+    sw_.write(header, kHeaderSize);
   }
 
-  // index = size of umap
-  field_to_index_map[field] = crate::FieldIndex(uint32_t(fields_.size()));
-  fields_.emplace_back(field);
-
-  return field_to_index_map[field];
+  return WriteLayer();
 }
 
-crate::FieldSetIndex Packer::AddFieldSet(
-    const std::vector<crate::FieldIndex> &fieldset) {
-  if (fieldset_to_index_map.count(fieldset)) {
-    return fieldset_to_index_map[fieldset];
+bool Writer::Append(const Layer &layer) {
+  if (!incremental_ || (sw_.size() < kHeaderSize)) {
+    PUSH_ERROR_AND_RETURN("Append() requires Write() in incremental mode.");
   }
 
-  // index = size of umap = star index of FieldSet span.
-  fieldset_to_index_map[fieldset] =
-      crate::FieldSetIndex(uint32_t(fieldsets_.size()));
+  layer_ = &layer;
 
-  fieldsets_.insert(fieldsets_.end(), fieldset.begin(), fieldset.end());
-  fieldsets_.push_back(crate::FieldIndex());  // terminator(~0)
-
-  return fieldset_to_index_map[fieldset];
+  // Previous sections and TOC are left as unused data.
+  return WriteLayer();
 }
+
+bool Writer::WriteLayer() {
+  for (const auto &name : RootPrimNames()) {
+    uint32_t node = AddChildPath(0, name, /* property */ false);
+    RegisterPrimPaths(node, layer_->primspecs().at(name));
+  }
+
+#if defined(TINYUSDZ_USDC_WRITER_USE_THREAD)
+  if (num_threads_ > 1) {
+    for (const auto &name : RootPrimNames()) {
+      CollectArrayTasks(layer_->primspecs().at(name));
+    }
+  }
 #endif
 
-class Writer {
- public:
-  Writer(const Stage &stage) : stage_(stage) {}
+  // Specs and non-inlined values.
+  const bool ok = WriteLayerSpec();
 
-  const Stage &stage_;
+#if defined(TINYUSDZ_USDC_WRITER_USE_THREAD)
+  pre_encoded_arrays_.clear();
+  array_task_indices_.clear();
+  array_tasks_.clear();
+#endif
 
-  const std::string &GetError() const { return err_; }
-  const std::string &GetWarning() const { return warn_; }
+  layer_ = nullptr;
 
-  void PushError(const std::string &s) {
-    err_ += s;
+  if (!ok) {
+    PUSH_ERROR_AND_RETURN("Failed to write Specs.");
   }
 
-  void PushWarn(const std::string &s) {
-    warn_ += s;
+  if (incremental_) {
+    RebuildFieldSets();
   }
 
-  bool WriteHeader(uint64_t toc_offset) {
-    char magic[8];
-    magic[0] = 'P';
-    magic[1] = 'X';
-    magic[2] = 'R';
-    magic[3] = '-';
-    magic[4] = 'U';
-    magic[5] = 'S';
-    magic[6] = 'D';
-    magic[7] = 'C';
-
-    uint8_t version[8];  // Only first 3 bytes are used.
-    version[0] = 0;
-    version[1] = 8;
-    version[2] = 0;
+  sw_.seek_end();
+  sections_.clear();
 
-    std::array<uint8_t, 88> header;
-    memset(&header, 0, 88);
-
-    memcpy(&header[0], magic, 8);
-    memcpy(&header[8], version, 8);
-    memcpy(&header[16], &toc_offset, 8);
+  if (!WriteTokensSection() || !WriteStringsSection() ||
+      !WriteFieldsSection() || !WriteFieldSetsSection() ||
+      !WritePathsSection() || !WriteSpecsSection()) {
+    PUSH_ERROR_AND_RETURN("Failed to write sections.");
+  }
 
-    oss_.write(reinterpret_cast<const char *>(&header[0]), 88);
+  uint64_t toc_offset{0};
+  if (!WriteTOC(&toc_offset)) {
+    PUSH_ERROR_AND_RETURN("Failed to write TOC.");
+  }
 
-    return true;
+  // Write data before updating the header, so that the file stays valid(points
+  // to the previous TOC) when writing is interrupted.
+  if (!sw_.flush()) {
+    PUSH_ERROR_AND_RETURN("Failed to write data to a file.");
   }
 
-  bool WriteTokens() {
-    // Build single string separated by '\0', then compress it with lz4
-    std::ostringstream oss;
+  // Header
+  const char magic[8] = {'P', 'X', 'R', '-', 'U', 'S', 'D', 'C'};
+  const uint8_t version[8] = {0, 8, 0, 0, 0, 0, 0, 0};  // Only first 3 bytes are used.
 
-    auto tokens = packer_.GetTokens();
+  if (!sw_.write_at(0, magic, 8) || !sw_.write_at(8, version, 8) ||
+      !sw_.write_at(16, &toc_offset, 8)) {
+    PUSH_ERROR_AND_RETURN("Failed to write header.");
+  }
 
-    for (size_t i = 0; i < tokens.size(); i++) {
-      oss << tokens[i].str();
+  if (!sw_.flush()) {
+    PUSH_ERROR_AND_RETURN("Failed to write data to a file.");
+  }
 
-      if (i != (tokens.size() - 1)) {
-        oss.put('\0');  // separator
-      }
-    }
-    // Last string does not terminated with `\0'
+  return true;
+}
 
-    // compress
-    size_t input_bytes = oss.str().size();
-    if (input_bytes == 0) {
-      PUSH_ERROR("Invalid data size.");
-      return false;
-    }
+}  // namespace
 
-    std::vector<char> buf;
-    buf.resize(LZ4Compression::GetCompressedBufferSize(input_bytes));
+bool SaveAsUSDCToFile(const std::string &filename, const Layer &layer,
+                      std::string *warn, std::string *err,
+                      const USDCWriteOptions &options) {
+#ifdef __ANDROID__
+  (void)filename;
+  (void)layer;
+  (void)warn;
+  (void)options;
 
-    std::string err;
-    size_t n = LZ4Compression::CompressToBuffer(oss.str().data(), buf.data(),
-                                                input_bytes, &err);
+  if (err) {
+    (*err) += "Saving USDC to a file is not supported for Android platform(at the moment).\n";
+  }
+  return false;
+#else
 
-    (void)n;
+  if (!options.streaming) {
+    std::vector<uint8_t> output;
 
-    if (!err.empty()) {
-      PUSH_ERROR(err);
+    if (!SaveAsUSDCToMemory(layer, &output, warn, err, options)) {
       return false;
     }
 
-    return true;
+    return WriteBinaryToFile(filename, output, err);
   }
 
-  bool WriteStrings() { return false; }
-
-  bool WriteFields() { return false; }
-
-  bool WriteFieldSets() { return false; }
-
-  bool WritePaths() { return false; }
-
-  bool WriteSpecs() { return false; }
+  FILE *fp = OpenFileToWrite(filename, /* readable */ true, err);
+  if (!fp) {
+    return false;
+  }
 
-  bool WriteTOC() {
-    uint64_t num_sections = toc_.sections.size();
+  bool ret;
+  {
+    Writer writer(layer, options, fp);
 
-    DCOUT("# of sections = " << std::to_string(num_sections));
+    ret = writer.Write();
 
-    if (num_sections == 0) {
-      err_ += "Zero sections in TOC.\n";
-      return false;
+    if (warn) {
+      (*warn) += writer.GetWarning();
     }
 
-    // # of sections
-    oss_.write(reinterpret_cast<const char *>(&num_sections), 8);
+    if (!ret && err) {
+      (*err) += writer.GetError();
+    }
+  }
 
-    return true;
+  if (fclose(fp) != 0) {
+    if (ret && err) {
+      (*err) += "Failed to close file `" + filename + "`.\n";
+    }
+    ret = false;
   }
 
-  bool Write() {
-    //
-    //  - TOC
-    //  - Tokens
-    //  - Strings
-    //  - Fields
-    //  - FieldSets
-    //  - Paths
-    //  - Specs
-    //
+  return ret;
+#endif
+}
 
-    if (!WriteTokens()) {
-      PUSH_ERROR("Failed to write Tokens.");
-      return false;
+bool SaveAsUSDCToMemory(const Layer &layer, std::vector<uint8_t> *output,
+                        std::string *warn, std::string *err,
+                        const USDCWriteOptions &options) {
+  if (!output) {
+    if (err) {
+      (*err) += "`output` argument is nullptr.\n";
     }
+    return false;
+  }
 
-    if (!WriteStrings()) {
-      PUSH_ERROR("Failed to write Strings.");
-      return false;
-    }
+  Writer writer(layer, options);
 
-    if (!WriteFields()) {
-      PUSH_ERROR("Failed to write Fields.");
-      return false;
-    }
+  bool ret = writer.Write();
 
-    if (!WriteFieldSets()) {
-      PUSH_ERROR("Failed to write FieldSets.");
-      return false;
-    }
+  if (warn) {
+    (*warn) += writer.GetWarning();
+  }
 
-    if (!WritePaths()) {
-      PUSH_ERROR("Failed to write Paths.");
-      return false;
+  if (!ret) {
+    if (err) {
+      (*err) += writer.GetError();
     }
+    return false;
+  }
 
-    if (!WriteSpecs()) {
-      PUSH_ERROR("Failed to write Specs.");
-      return false;
-    }
+  writer.GetOutput(output);
 
-    // TODO(syoyo): Add feature to support writing unknown section(custom user
-    // data)
-    // if (!WriteUnknownSections()) {
-    //  PUSH_ERROR("Failed to write custom sections.");
-    //  return false;
-    //}
+  return true;
+}
 
-    const uint64_t toc_offset = static_cast<uint64_t>(oss_.tellp());
-    if (!WriteTOC()) {
-      PUSH_ERROR("Failed to write TOC.");
-      return false;
-    }
+namespace {
 
-    // write header
-    oss_.seekp(0, std::ios::beg);
-    if (!WriteHeader(toc_offset)) {
-      PUSH_ERROR("Failed to write Header.");
-      return false;
-    }
+// Stage holds reconstructed Prims. Convert it to Layer(PrimSpec tree) through
+// USDA.
+// TODO: Direct Stage -> Layer conversion.
+bool StageToLayer(const Stage &stage, Layer *layer, std::string *warn,
+                  std::string *err) {
+  const std::string usda = stage.ExportToString();
 
-    return true;
+  if (!LoadUSDALayerFromMemory(reinterpret_cast<const uint8_t *>(usda.data()),
+                               usda.size(), "[Stage]", layer, warn, err)) {
+    if (err) {
+      (*err) += "Failed to convert Stage to Layer.\n";
+    }
+    return false;
   }
 
-  // Get serialized USDC binary data
-  bool GetOutput(std::vector<uint8_t> *output) {
-    if (!err_.empty()) {
-      return false;
-    }
+  return true;
+}
 
-    (void)output;
+}  // namespace
 
-    // TODO
+bool SaveAsUSDCToFile(const std::string &filename, const Stage &stage,
+                      std::string *warn, std::string *err,
+                      const USDCWriteOptions &options) {
+  Layer layer;
+  if (!StageToLayer(stage, &layer, warn, err)) {
     return false;
   }
 
- private:
-  Writer() = delete;
-  Writer(const Writer &) = delete;
-
-  TableOfContents toc_;
+  return SaveAsUSDCToFile(filename, layer, warn, err, options);
+}
 
-  Packer packer_;
+bool SaveAsUSDCToMemory(const Stage &stage, std::vector<uint8_t> *output,
+                        std::string *warn, std::string *err,
+                        const USDCWriteOptions &options) {
+  Layer layer;
+  if (!StageToLayer(stage, &layer, warn, err)) {
+    return false;
+  }
 
-  //
-  // Serialized data
-  //
-  std::ostringstream oss_;
+  return SaveAsUSDCToMemory(layer, output, warn, err, options);
+}
 
-  std::string err_;
-  std::string warn_;
+class USDCAppender::Impl {
+ public:
+  FILE *fp{nullptr};
+  std::string filename;
+  std::unique_ptr<Writer> writer;
+
+  std::string err;
+  std::string warn;
+
+  void TakeMessages() {
+    if (writer) {
+      warn += writer->GetWarning();
+      err += writer->GetError();
+      writer->ClearMessages();
+    }
+  }
 };
 
-}  // namespace
+USDCAppender::USDCAppender() : impl_(new Impl()) {}
 
-bool SaveAsUSDCToFile(const std::string &filename, const Stage &stage,
-                      std::string *warn, std::string *err) {
+USDCAppender::~USDCAppender() {
+  Close();
+  delete impl_;
+}
+
+bool USDCAppender::Open(const std::string &filename, const Layer &layer,
+                        const USDCWriteOptions &options) {
 #ifdef __ANDROID__
   (void)filename;
-  (void)stage;
-  (void)warn;
+  (void)layer;
+  (void)options;
 
-  if (err) {
-    (*err) += "Saving USDC to a file is not supported for Android platform(at the moment).\n";
-  }
+  impl_->err += "Saving USDC to a file is not supported for Android platform(at the moment).\n";
   return false;
 #else
-
-  std::vector<uint8_t> output;
-
-  if (!SaveAsUSDCToMemory(stage, &output, warn, err)) {
+  if (is_open()) {
+    impl_->err += "File `" + impl_->filename + "` is already opened.\n";
     return false;
   }
 
-#ifdef _WIN32
-#if defined(_MSC_VER) || defined(__GLIBCXX__) || defined(__clang__)
-  FILE *fp = nullptr;
-  errno_t fperr = _wfopen_s(&fp, UTF8ToWchar(filename).c_str(), L"wb");
-  if (fperr != 0) {
-    if (err) {
-      // TODO: WChar
-      (*err) += "Failed to open file to write.\n";
-    }
+  impl_->fp = OpenFileToWrite(filename, /* readable */ true, &impl_->err);
+  if (!impl_->fp) {
     return false;
   }
-#else
-  FILE *fp = nullptr;
-  errno_t fperr = fopen_s(&fp, filename.c_str(), "wb");
-  if (fperr != 0) {
-    if (err) {
-      (*err) += "Failed to open file `" + filename + "` to write.\n";
-    }
+  impl_->filename = filename;
+
+  impl_->writer.reset(new Writer(layer, options, impl_->fp));
+  impl_->writer->SetIncremental(true);
+
+  bool ret = impl_->writer->Write();
+  impl_->TakeMessages();
+
+  if (!ret) {
+    Close();
     return false;
   }
+
+  return true;
 #endif
+}
 
-#else
-  FILE *fp = fopen(filename.c_str(), "wb");
-  if (fp == nullptr) {
-    if (err) {
-      (*err) += "Failed to open file `" + filename + "` to write.\n";
-    }
+bool USDCAppender::Append(const Layer &layer) {
+  if (!is_open()) {
+    impl_->err += "File is not opened.\n";
     return false;
   }
-#endif
 
-  size_t n = fwrite(output.data(), /* size */ 1, /* count */ output.size(), fp);
-  if (n < output.size()) {
-    // TODO: Retry writing data when n < output.size()
+  bool ret = impl_->writer->Append(layer);
+  impl_->TakeMessages();
 
-    if (err) {
-      (*err) += "Failed to write data to a file.\n";
-    }
+  if (!ret) {
+    // Writer states may be inconsistent with the file. The file still points
+    // to the data written by the last successful call.
+    Close();
     return false;
   }
 
   return true;
-#endif
 }
 
-bool SaveAsUSDCToMemory(const Stage &stage, std::vector<uint8_t> *output,
-                        std::string *warn, std::string *err) {
-  (void)warn;
-  (void)output;
+bool USDCAppender::Close() {
+  if (!is_open()) {
+    return true;
+  }
 
-  // TODO
-  Writer writer(stage);
+  impl_->writer.reset();
 
-  if (err) {
-    (*err) += "USDC writer is not yet implemented.\n";
+  bool ret = true;
+  if (fclose(impl_->fp) != 0) {
+    impl_->err += "Failed to close file `" + impl_->filename + "`.\n";
+    ret = false;
   }
+  impl_->fp = nullptr;
 
-  return false;
+  return ret;
+}
+
+bool USDCAppender::is_open() const { return impl_->fp != nullptr; }
+
+std::string USDCAppender::GetError() { return impl_->err; }
+
+std::string USDCAppender::GetWarning() { return impl_->warn; }
+
+bool CompactUSDCFile(const std::string &filename, std::string *warn,
+                     std::string *err, const USDCWriteOptions &options) {
+  Layer layer;
+  {
+    std::vector<uint8_t> data;
+    if (!io::ReadWholeFile(&data, err, filename)) {
+      return false;
+    }
+
+    // Only live specs and values are loaded.
+    if (!LoadUSDCLayerFromMemory(data.data(), data.size(), filename, &layer,
+                                 warn, err)) {
+      return false;
+    }
+  }
+
+  return SaveAsUSDCToFile(filename, layer, warn, err, options);
 }
 
 }  // namespace usdc
@@ -568,10 +3260,12 @@ namespace tinyusdz {
 namespace usdc {
 
 bool SaveAsUSDCToFile(const std::string &filename, const Stage &stage,
-                      std::string *warn, std::string *err) {
+                      std::string *warn, std::string *err,
+                      const USDCWriteOptions &options) {
   (void)filename;
   (void)stage;
   (void)warn;
+  (void)options;
 
   if (err) {
     (*err) = "USDC writer feature is disabled in this build.\n";
@@ -581,10 +3275,84 @@ bool SaveAsUSDCToFile(const std::string &filename, const Stage &stage,
 }
 
 bool SaveAsUSDCToMemory(const Stage &stage, std::vector<uint8_t> *output,
-                        std::string *warn, std::string *err) {
+                        std::string *warn, std::string *err,
+                        const USDCWriteOptions &options) {
   (void)stage;
   (void)output;
   (void)warn;
+  (void)options;
+
+  if (err) {
+    (*err) = "USDC writer feature is disabled in this build.\n";
+  }
+
+  return false;
+}
+
+bool SaveAsUSDCToFile(const std::string &filename, const Layer &layer,
+                      std::string *warn, std::string *err,
+                      const USDCWriteOptions &options) {
+  (void)filename;
+  (void)layer;
+  (void)warn;
+  (void)options;
+
+  if (err) {
+    (*err) = "USDC writer feature is disabled in this build.\n";
+  }
+
+  return false;
+}
+
+bool SaveAsUSDCToMemory(const Layer &layer, std::vector<uint8_t> *output,
+                        std::string *warn, std::string *err,
+                        const USDCWriteOptions &options) {
+  (void)layer;
+  (void)output;
+  (void)warn;
+  (void)options;
+
+  if (err) {
+    (*err) = "USDC writer feature is disabled in this build.\n";
+  }
+
+  return false;
+}
+
+class USDCAppender::Impl {};
+
+USDCAppender::USDCAppender() : impl_(nullptr) {}
+
+USDCAppender::~USDCAppender() {}
+
+bool USDCAppender::Open(const std::string &filename, const Layer &layer,
+                        const USDCWriteOptions &options) {
+  (void)filename;
+  (void)layer;
+  (void)options;
+  return false;
+}
+
+bool USDCAppender::Append(const Layer &layer) {
+  (void)layer;
+  return false;
+}
+
+bool USDCAppender::Close() { return true; }
+
+bool USDCAppender::is_open() const { return false; }
+
+std::string USDCAppender::GetError() {
+  return "USDC writer feature is disabled in this build.\n";
+}
+
+std::string USDCAppender::GetWarning() { return std::string(); }
+
+bool CompactUSDCFile(const std::string &filename, std::string *warn,
+                     std::string *err, const USDCWriteOptions &options) {
+  (void)filename;
+  (void)warn;
+  (void)options;
 
   if (err) {
     (*err) = "USDC writer feature is disabled in this build.\n";
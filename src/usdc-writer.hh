@@ -8,18 +8,46 @@
 namespace tinyusdz {
 namespace usdc {
 
+struct USDCWriteOptions {
+  ///
+  /// SaveAsUSDCToFile only. Write serialized data to the file while
+  /// serializing Prims instead of building the whole file in memory. Only
+  /// token/path/field/fieldset/spec tables are kept in memory until the TOC is
+  /// written, so peak memory stays bounded for large(e.g. point cache)
+  /// exports. The output is identical to the non-streaming mode.
+  ///
+  bool streaming{false};
+
+  ///
+  /// Bytes buffered in memory before written to the file in streaming mode.
+  ///
+  size_t stream_buffer_size{4 * 1024 * 1024};
+
+  ///
+  /// # of threads to encode(compress) large array values.
+  /// -1 = use all cores. 1 = no threading.
+  /// Encoded arrays are written in the same order as the single-threaded
+  /// writer, so the output does not depend on the # of threads.
+  ///
+  int num_threads{-1};
+};
+
 ///
 /// Save scene as USDC(binary) to a file
 ///
+/// Stage is converted to Layer through USDA, then saved with `options`.
+///
 /// @param[in] filename USDC filename
 /// @param[in] stage Stage
 /// @param[out] warn Warning message
 /// @param[out] err Error message
+/// @param[in] options Write options
 ///
 /// @return true upon success.
 ///
 bool SaveAsUSDCToFile(const std::string &filename, const Stage &stage,
-                      std::string *warn, std::string *err);
+                      std::string *warn, std::string *err,
+                      const USDCWriteOptions &options = USDCWriteOptions());
 
 ///
 /// Save scene as USDC(binary) to a memory
@@ -28,11 +56,122 @@ bool SaveAsUSDCToFile(const std::string &filename, const Stage &stage,
 /// @param[out] output Binary data
 /// @param[out] warn Warning message
 /// @param[out] err Error message
+/// @param[in] options Write options
 ///
 /// @return true upon success.
 ///
 bool SaveAsUSDCToMemory(const Stage &stage, std::vector<uint8_t> *output,
-                        std::string *warn, std::string *err);
+                        std::string *warn, std::string *err,
+                        const USDCWriteOptions &options = USDCWriteOptions());
+
+///
+/// Save Layer as USDC(binary) to a file
+///
+/// @param[in] filename USDC filename
+/// @param[in] layer Layer
+/// @param[out] warn Warning message
+/// @param[out] err Error message
+/// @param[in] options Write options
+///
+/// @return true upon success.
+///
+bool SaveAsUSDCToFile(const std::string &filename, const Layer &layer,
+                      std::string *warn, std::string *err,
+                      const USDCWriteOptions &options = USDCWriteOptions());
+
+///
+/// Save Layer as USDC(binary) to a memory
+///
+/// Identical values(arrays, dictionaries, TimeSamples, ...), tokens and paths
+/// are written once and shared in the output.
+///
+/// @param[in] layer Layer
+/// @param[out] output Binary data
+/// @param[out] warn Warning message
+/// @param[out] err Error message
+/// @param[in] options Write options
+///
+/// @return true upon success.
+///
+bool SaveAsUSDCToMemory(const Layer &layer, std::vector<uint8_t> *output,
+                        std::string *warn, std::string *err,
+                        const USDCWriteOptions &options = USDCWriteOptions());
+
+///
+/// Write Layer to a USDC file incrementally(e.g. appending frames of
+/// simulation results to a cache file).
+///
+/// Open() writes `layer` to a file. Each Append() writes only the values which
+/// are not in the file yet(values identical to the ones already written are
+/// shared), then writes a new set of sections and TOC and updates the header
+/// to point to it. So the cost of Append() is proportional to the new data,
+/// not to the file size. The file is a valid USDC file after each call.
+///
+/// Specs in the Layer passed to Append() are merged with the specs written
+/// before:
+///
+/// - New Prims/Properties are added.
+/// - Fields(metadata, `default` value, ...) replace the fields of the same
+///   name. Fields are not removed.
+/// - `timeSamples` are merged. Samples in the new Layer win at the same time.
+/// - `over` Prim does not change the specifier of the existing Prim.
+///
+/// Old sections are left in the file as unused data. Call CompactUSDCFile()
+/// after Close() to remove them.
+///
+/// Specs, tokens, paths and TimeSamples(times and ValueReps only) of the file
+/// are kept in memory while the file is open. To continue appending to a file
+/// written in another session, load it as Layer and pass it to Open().
+///
+class USDCAppender {
+ public:
+  USDCAppender();
+  ~USDCAppender();
+
+  USDCAppender(const USDCAppender &) = delete;
+  USDCAppender &operator=(const USDCAppender &) = delete;
+
+  ///
+  /// Create(overwrite) USDC file `filename` and write `layer`.
+  /// `options.streaming` is ignored(always streamed to the file).
+  ///
+  bool Open(const std::string &filename, const Layer &layer,
+            const USDCWriteOptions &options = USDCWriteOptions());
+
+  ///
+  /// Append `layer` to the file.
+  ///
+  bool Append(const Layer &layer);
+
+  ///
+  /// Close the file. Also called in the destructor.
+  ///
+  bool Close();
+
+  bool is_open() const;
+
+  std::string GetError();
+  std::string GetWarning();
+
+ private:
+  class Impl;
+  Impl *impl_{};
+};
+
+///
+/// Rewrite USDC file `filename` without unused data(e.g. sections left by
+/// USDCAppender::Append()).
+///
+/// @param[in] filename USDC filename
+/// @param[out] warn Warning message
+/// @param[out] err Error message
+/// @param[in] options Write options
+///
+/// @return true upon success.
+///
+bool CompactUSDCFile(const std::string &filename, std::string *warn,
+                     std::string *err,
+                     const USDCWriteOptions &options = USDCWriteOptions());
 
 }  // namespace usdc
 }  // namespace tinyusdz
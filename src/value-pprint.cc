@@ -4,6 +4,7 @@
 
 #include "value-pprint.hh"
 
+#include <cmath>
 #include <sstream>
 
 #include "pprinter.hh"
@@ -20,9 +21,8 @@
 // Default disabled.
 //#define TINYUSDZ_LOCAL_USE_JEAIII_ITOA
 
-#if defined(TINYUSDZ_LOCAL_USE_JEAIII_ITOA)
+// jeaiii itoa is always used for the fast array printing path.
 #include "external/jeaiii_to_text.h"
-#endif
 
 // dtoa_milo does not work well for float types
 // (e.g. it prints float 0.01 as 0.009999999997),
@@ -60,12 +60,259 @@ inline std::string dtos(const float v) {
 }
 
 inline std::string dtos(const double v) {
+  // dtoa_milo does not handle non-finite values.
+  if (std::isnan(v)) {
+    return "nan";
+  } else if (std::isinf(v)) {
+    return (v < 0.0) ? "-inf" : "inf";
+  }
+
   char buf[128];
   dtoa_milo(v, buf);
 
   return std::string(buf);
 }
 
+//
+// Fast 1D array printing.
+// Elements are formatted directly into one char buffer, instead of creating
+// std::string and calling operator<< per element.
+//
+
+// Formatted array is written to std::ostream every this bytes.
+constexpr size_t kArrayPrintChunkSize = 64 * 1024;
+
+inline void AppendNumber(const float v, std::string *dst) {
+  char buf[floaxie::max_buffer_size<float>()];
+  size_t n = floaxie::ftoa(v, buf);
+  dst->append(buf, n);
+}
+
+inline void AppendNumber(const double v, std::string *dst) {
+  if (std::isnan(v) || std::isinf(v)) {
+    dst->append(dtos(v));
+    return;
+  }
+
+  char buf[128];
+  dtoa_milo(v, buf);
+  dst->append(buf);
+}
+
+template <typename T>
+inline void AppendInteger(const T v, std::string *dst) {
+  // numeric_limits<uint64_t>::digits10 is 19, so 24 should suffice
+  // (including the sign).
+  char buf[24];
+  char *p = jeaiii::to_text_from_integer(buf, v);
+  dst->append(buf, size_t(p - buf));
+}
+
+inline void AppendNumber(const uint32_t v, std::string *dst) {
+  AppendInteger(v, dst);
+}
+
+inline void AppendNumber(const uint64_t v, std::string *dst) {
+  AppendInteger(v, dst);
+}
+
+inline void AppendNumber(const int32_t v, std::string *dst) {
+  AppendInteger(v, dst);
+}
+
+inline void AppendNumber(const int64_t v, std::string *dst) {
+  AppendInteger(v, dst);
+}
+
+// Scalar type and the number of components of tuple types.
+template <typename T>
+struct TupleTraits;
+
+#define DEFINE_TUPLE_TRAITS(__ty, __scalar_ty, __n) \
+  template <>                                       \
+  struct TupleTraits<value::__ty> {                 \
+    using scalar_type = __scalar_ty;                \
+    static constexpr size_t size = __n;             \
+  };
+
+DEFINE_TUPLE_TRAITS(int2, int32_t, 2)
+DEFINE_TUPLE_TRAITS(int3, int32_t, 3)
+DEFINE_TUPLE_TRAITS(int4, int32_t, 4)
+DEFINE_TUPLE_TRAITS(uint2, uint32_t, 2)
+DEFINE_TUPLE_TRAITS(uint3, uint32_t, 3)
+DEFINE_TUPLE_TRAITS(uint4, uint32_t, 4)
+DEFINE_TUPLE_TRAITS(float2, float, 2)
+DEFINE_TUPLE_TRAITS(float3, float, 3)
+DEFINE_TUPLE_TRAITS(float4, float, 4)
+DEFINE_TUPLE_TRAITS(double2, double, 2)
+DEFINE_TUPLE_TRAITS(double3, double, 3)
+DEFINE_TUPLE_TRAITS(double4, double, 4)
+DEFINE_TUPLE_TRAITS(point3f, float, 3)
+DEFINE_TUPLE_TRAITS(point3d, double, 3)
+DEFINE_TUPLE_TRAITS(normal3f, float, 3)
+DEFINE_TUPLE_TRAITS(normal3d, double, 3)
+DEFINE_TUPLE_TRAITS(vector3f, float, 3)
+DEFINE_TUPLE_TRAITS(vector3d, double, 3)
+DEFINE_TUPLE_TRAITS(color3f, float, 3)
+DEFINE_TUPLE_TRAITS(color3d, double, 3)
+DEFINE_TUPLE_TRAITS(color4f, float, 4)
+DEFINE_TUPLE_TRAITS(color4d, double, 4)
+DEFINE_TUPLE_TRAITS(texcoord2f, float, 2)
+DEFINE_TUPLE_TRAITS(texcoord2d, double, 2)
+DEFINE_TUPLE_TRAITS(texcoord3f, float, 3)
+DEFINE_TUPLE_TRAITS(texcoord3d, double, 3)
+
+#undef DEFINE_TUPLE_TRAITS
+
+inline void AppendElement(const float v, std::string *dst) {
+  AppendNumber(v, dst);
+}
+inline void AppendElement(const double v, std::string *dst) {
+  AppendNumber(v, dst);
+}
+inline void AppendElement(const int32_t v, std::string *dst) {
+  AppendNumber(v, dst);
+}
+inline void AppendElement(const uint32_t v, std::string *dst) {
+  AppendNumber(v, dst);
+}
+inline void AppendElement(const int64_t v, std::string *dst) {
+  AppendNumber(v, dst);
+}
+inline void AppendElement(const uint64_t v, std::string *dst) {
+  AppendNumber(v, dst);
+}
+
+template <typename T>
+inline void AppendElement(const T &v, std::string *dst) {
+  dst->push_back('(');
+  for (size_t k = 0; k < TupleTraits<T>::size; k++) {
+    if (k > 0) {
+      dst->append(", ");
+    }
+    AppendNumber(typename TupleTraits<T>::scalar_type(v[k]), dst);
+  }
+  dst->push_back(')');
+}
+
+// pxrUSD prints quateron in [w, x, y, z] order
+template <typename T>
+inline void AppendQuat(const T &v, std::string *dst) {
+  dst->push_back('(');
+  AppendNumber(v.real, dst);
+  for (size_t k = 0; k < 3; k++) {
+    dst->append(", ");
+    AppendNumber(v.imag[k], dst);
+  }
+  dst->push_back(')');
+}
+
+inline void AppendElement(const value::quatf &v, std::string *dst) {
+  AppendQuat(v, dst);
+}
+inline void AppendElement(const value::quatd &v, std::string *dst) {
+  AppendQuat(v, dst);
+}
+
+template <typename T>
+void AppendArray(const T *v, size_t n, std::string *dst) {
+  dst->push_back('[');
+  for (size_t i = 0; i < n; i++) {
+    if (i > 0) {
+      dst->append(", ");
+    }
+    AppendElement(v[i], dst);
+  }
+  dst->push_back(']');
+}
+
+#define FAST_ARRAY_PRINT_TYPES(__FUNC) \
+  __FUNC(float)                       \
+  __FUNC(double)                      \
+  __FUNC(int32_t)                     \
+  __FUNC(uint32_t)                    \
+  __FUNC(int64_t)                     \
+  __FUNC(uint64_t)                    \
+  __FUNC(value::int2)                 \
+  __FUNC(value::int3)                 \
+  __FUNC(value::int4)                 \
+  __FUNC(value::uint2)                \
+  __FUNC(value::uint3)                \
+  __FUNC(value::uint4)                \
+  __FUNC(value::float2)               \
+  __FUNC(value::float3)               \
+  __FUNC(value::float4)               \
+  __FUNC(value::double2)              \
+  __FUNC(value::double3)              \
+  __FUNC(value::double4)              \
+  __FUNC(value::quatf)                \
+  __FUNC(value::quatd)                \
+  __FUNC(value::point3f)              \
+  __FUNC(value::point3d)              \
+  __FUNC(value::normal3f)             \
+  __FUNC(value::normal3d)             \
+  __FUNC(value::vector3f)             \
+  __FUNC(value::vector3d)             \
+  __FUNC(value::color3f)              \
+  __FUNC(value::color3d)              \
+  __FUNC(value::color4f)              \
+  __FUNC(value::color4d)              \
+  __FUNC(value::texcoord2f)           \
+  __FUNC(value::texcoord2d)           \
+  __FUNC(value::texcoord3f)           \
+  __FUNC(value::texcoord3d)
+
+// Append 1D array value to `dst`. Return false when `v` is not a 1D array of
+// FAST_ARRAY_PRINT_TYPES.
+bool AppendArrayValue(const value::Value &v, std::string *dst) {
+#define CASE_FAST_ARRAY(__ty)                                           \
+  case value::TypeTraits<std::vector<__ty>>::type_id(): {               \
+    if (auto p = v.as<std::vector<__ty>>()) {                           \
+      /* Roughly 3 chars per byte(e.g. float: `-1.2345e-5, `) */       \
+      dst->reserve(dst->size() + 3 * sizeof(__ty) * p->size() + 2);     \
+      AppendArray(p->data(), p->size(), dst);                           \
+      return true;                                                      \
+    }                                                                   \
+    return false;                                                       \
+  }
+
+  switch (v.type_id()) {
+    FAST_ARRAY_PRINT_TYPES(CASE_FAST_ARRAY)
+    default:
+      break;
+  }
+
+#undef CASE_FAST_ARRAY
+
+  return false;
+}
+
+#undef FAST_ARRAY_PRINT_TYPES
+
+template <typename T>
+std::ostream &PrintArray(std::ostream &os, const std::vector<T> &v) {
+  // Format elements in chunks to bound the buffer size.
+  std::string buf;
+  buf.reserve(kArrayPrintChunkSize + 256);
+
+  buf.push_back('[');
+  for (size_t i = 0; i < v.size(); i++) {
+    if (i > 0) {
+      buf.append(", ");
+    }
+    AppendElement(v[i], &buf);
+
+    if (buf.size() >= kArrayPrintChunkSize) {
+      os.write(buf.data(), std::streamsize(buf.size()));
+      buf.clear();
+    }
+  }
+  buf.push_back(']');
+  os.write(buf.data(), std::streamsize(buf.size()));
+
+  return os;
+}
+
 }  // namespace
 
 }  // namespace tinyusdz
@@ -549,141 +796,48 @@ std::ostream &operator<<(std::ostream &ofs,
   return ofs;
 }
 
-template <>
-std::ostream &operator<<(std::ostream &ofs, const std::vector<double> &v) {
-  // Not sure what is the HARD-LIMT buffer length for dtoa_milo,
-  // but according to std::numeric_limits<double>::digits10(=15),
-  // 32 should be sufficient, but allocate 128 just in case
-  char buf[128];
-
-  // TODO: multi-threading for further performance gain?
-
-  ofs << "[";
-  for (size_t i = 0; i < v.size(); i++) {
-    if (i > 0) {
-      ofs << ", ";
-    }
-    dtoa_milo(v[i], buf);
-    ofs << std::string(buf);
-  }
-  ofs << "]";
-
-  return ofs;
-}
-
-template <>
-std::ostream &operator<<(std::ostream &ofs, const std::vector<float> &v) {
-  // Use floaxie
-  char buf[128];
-
-  // TODO: multi-threading for further performance gain?
-
-  ofs << "[";
-  for (size_t i = 0; i < v.size(); i++) {
-    if (i > 0) {
-      ofs << ", ";
-    }
-    floaxie::ftoa(v[i], buf);
-    ofs << std::string(buf);
-  }
-  ofs << "]";
-
-  return ofs;
-}
-
-template <>
-std::ostream &operator<<(std::ostream &ofs, const std::vector<int32_t> &v) {
-#if defined(TINYUSDZ_LOCAL_USE_JEAIII_ITOA)
-  // numeric_limits<uint64_t>::digits10 is 19, so 32 should suffice.
-  char buf[32];
-#endif
-
-  ofs << "[";
-  for (size_t i = 0; i < v.size(); i++) {
-    if (i > 0) {
-      ofs << ", ";
-    }
-#if defined(TINYUSDZ_LOCAL_USE_JEAIII_ITOA)
-    tinyusdz::itoa(v[i], buf);
-    ofs << buf;
-#else
-    ofs << v[i];
-#endif
-  }
-  ofs << "]";
-
-  return ofs;
-}
-
-template <>
-std::ostream &operator<<(std::ostream &ofs, const std::vector<uint32_t> &v) {
-#if defined(TINYUSDZ_LOCAL_USE_JEAIII_ITOA)
-  char buf[32];
-#endif
-
-  ofs << "[";
-  for (size_t i = 0; i < v.size(); i++) {
-    if (i > 0) {
-      ofs << ", ";
-    }
-#if defined(TINYUSDZ_LOCAL_USE_JEAIII_ITOA)
-    tinyusdz::itoa(v[i], buf);
-    ofs << buf;
-#else
-    ofs << v[i];
-#endif
+#define DEFINE_FAST_ARRAY_PRINT(__ty)                                       \
+  template <>                                                              \
+  std::ostream &operator<<(std::ostream &ofs, const std::vector<__ty> &v) { \
+    return tinyusdz::PrintArray(ofs, v);                                   \
   }
-  ofs << "]";
 
-  return ofs;
-}
-
-template <>
-std::ostream &operator<<(std::ostream &ofs, const std::vector<int64_t> &v) {
-#if defined(TINYUSDZ_LOCAL_USE_JEAIII_ITOA)
-  // numeric_limits<uint64_t>::digits10 is 19, so 32 should suffice.
-  char buf[32];
-#endif
-
-  ofs << "[";
-  for (size_t i = 0; i < v.size(); i++) {
-    if (i > 0) {
-      ofs << ", ";
-    }
-#if defined(TINYUSDZ_LOCAL_USE_JEAIII_ITOA)
-    tinyusdz::itoa(v[i], buf);
-    ofs << buf;
-#else
-    ofs << v[i];
-#endif
-  }
-  ofs << "]";
-
-  return ofs;
-}
-
-template <>
-std::ostream &operator<<(std::ostream &ofs, const std::vector<uint64_t> &v) {
-#if defined(TINYUSDZ_LOCAL_USE_JEAIII_ITOA)
-  char buf[32];
-#endif
-
-  ofs << "[";
-  for (size_t i = 0; i < v.size(); i++) {
-    if (i > 0) {
-      ofs << ", ";
-    }
-#if defined(TINYUSDZ_LOCAL_USE_JEAIII_ITOA)
-    tinyusdz::itoa(v[i], buf);
-    ofs << buf;
-#else
-    ofs << v[i];
-#endif
-  }
-  ofs << "]";
-
-  return ofs;
-}
+DEFINE_FAST_ARRAY_PRINT(double)
+DEFINE_FAST_ARRAY_PRINT(float)
+DEFINE_FAST_ARRAY_PRINT(int32_t)
+DEFINE_FAST_ARRAY_PRINT(uint32_t)
+DEFINE_FAST_ARRAY_PRINT(int64_t)
+DEFINE_FAST_ARRAY_PRINT(uint64_t)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::int2)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::int3)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::int4)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::uint2)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::uint3)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::uint4)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::float2)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::float3)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::float4)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::double2)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::double3)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::double4)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::quatf)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::quatd)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::point3f)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::point3d)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::normal3f)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::normal3d)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::vector3f)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::vector3d)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::color3f)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::color3d)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::color4f)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::color4d)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::texcoord2f)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::texcoord2d)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::texcoord3f)
+DEFINE_FAST_ARRAY_PRINT(tinyusdz::value::texcoord3d)
+
+#undef DEFINE_FAST_ARRAY_PRINT
 
 }  // namespace std
 
@@ -868,6 +1022,15 @@ std::string pprint_any(const linb::any &v, const uint32_t indent,
 
 std::string pprint_value(const value::Value &v, const uint32_t indent,
                          bool closing_brace) {
+  // Numeric arrays(e.g. `points`) are formatted into the returned string
+  // directly.
+  {
+    std::string s;
+    if (AppendArrayValue(v, &s)) {
+      return s;
+    }
+  }
+
 #define BASETYPE_CASE_EXPR(__ty)                           \
   case TypeTraits<__ty>::type_id(): {                      \
     auto p = v.as<__ty>();                                 \
@@ -141,7 +141,7 @@ std::ostream &operator<<(std::ostream &os, const std::vector<T> &v) {
   return os;
 }
 
-// Provide specialized version for int and float array.
+// Provide specialized(fast) version for int and float array.
 template <>
 std::ostream &operator<<(std::ostream &os, const std::vector<double> &v);
 
@@ -160,6 +160,92 @@ std::ostream &operator<<(std::ostream &os, const std::vector<int64_t> &v);
 template <>
 std::ostream &operator<<(std::ostream &os, const std::vector<uint64_t> &v);
 
+// Tuple types whose components are float/double/int.
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::int2> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::int3> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::int4> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::uint2> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::uint3> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::uint4> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::float2> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::float3> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::float4> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::double2> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::double3> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::double4> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::quatf> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::quatd> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::point3f> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::point3d> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::normal3f> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::normal3d> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::vector3f> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::vector3d> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::color3f> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::color3d> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::color4f> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::color4d> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::texcoord2f> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::texcoord2d> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::texcoord3f> &v);
+template <>
+std::ostream &operator<<(std::ostream &os,
+                         const std::vector<tinyusdz::value::texcoord3d> &v);
+
 }  // namespace std
 
 namespace tinyusdz {
@@ -3,6 +3,9 @@
 // Copyright 2023 - Present, Light Transport Entertainment Inc.
 #include "value-types.hh"
 
+#include <mutex>
+#include <unordered_map>
+
 #include "str-util.hh"
 #include "value-pprint.hh"
 #include "value-eval-util.hh"
@@ -17,6 +20,102 @@
 #include "external/mapbox/eternal/include/mapbox/eternal.hpp"
 
 namespace tinyusdz {
+
+#if !defined(TINYUSDZ_USE_STRING_ID_FOR_TOKEN_TYPE)
+
+namespace {
+
+// The token table is sharded to reduce lock contention when Tokens are
+// constructed from multiple threads(e.g. threaded USDA parsing).
+constexpr size_t kNumTokenTableShards = 32;
+
+struct TokenTableShard {
+  std::mutex mutex;
+  std::unordered_multimap<size_t, const TokenEntry *> entries;  // key = hash
+};
+
+TokenTableShard &GetTokenTableShard(size_t hash) {
+  // Intentionally leaked so that Tokens can be used during static
+  // destruction.
+  static TokenTableShard *shards = new TokenTableShard[kNumTokenTableShards];
+  return shards[(hash >> 8) % kNumTokenTableShards];
+}
+
+}  // namespace
+
+const TokenEntry *InternToken(const char *str, size_t len) {
+  if (!str || (len == 0)) {
+    return nullptr;
+  }
+
+  // FNV1a 64bit
+  static constexpr uint64_t kFNV_Prime = 0x00000100000001b3ULL;
+  static constexpr uint64_t kFNV_Offset_Basis = 0xcbf29ce484222325ULL;
+
+  uint64_t h = kFNV_Offset_Basis;
+  for (size_t i = 0; i < len; i++) {
+    h = (h ^ uint64_t(uint8_t(str[i]))) * kFNV_Prime;
+  }
+  size_t hash = size_t(h);
+
+  TokenTableShard &shard = GetTokenTableShard(hash);
+
+  std::lock_guard<std::mutex> lock(shard.mutex);
+
+  auto range = shard.entries.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    const TokenEntry *e = it->second;
+    if ((e->str.size() == len) && (memcmp(e->str.data(), str, len) == 0)) {
+      // The entry is removed from the table under the lock(in
+      // ReleaseTokenLast()), so `e` is alive here.
+      e->refcount.fetch_add(1, std::memory_order_relaxed);
+      return e;
+    }
+  }
+
+  TokenEntry *entry = new TokenEntry();
+  entry->str.assign(str, len);
+  entry->hash = hash;
+  entry->refcount.store(1, std::memory_order_relaxed);
+
+  shard.entries.emplace(hash, entry);
+
+  return entry;
+}
+
+void ReleaseTokenLast(const TokenEntry *entry) {
+  TokenTableShard &shard = GetTokenTableShard(entry->hash);
+
+  std::lock_guard<std::mutex> lock(shard.mutex);
+
+  // Other thread may have looked up the entry from the table in the meantime.
+  if (entry->refcount.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+    return;
+  }
+
+  auto range = shard.entries.equal_range(entry->hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second == entry) {
+      shard.entries.erase(it);
+      break;
+    }
+  }
+
+  delete entry;
+}
+
+size_t NumInternedTokens() {
+  size_t n = 0;
+  for (size_t i = 0; i < kNumTokenTableShards; i++) {
+    TokenTableShard &shard = GetTokenTableShard(i << 8);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    n += shard.entries.size();
+  }
+  return n;
+}
+
+#endif  // !TINYUSDZ_USE_STRING_ID_FOR_TOKEN_TYPE
+
 namespace value {
 
 //
@@ -1077,6 +1176,13 @@ bool FlexibleTypeCast(const value::Value &src, value::Value &dst) {
 #endif
 
 bool TimeSamples::has_sample_at(const double t) const {
+  if (_shared) {
+    const std::vector<double> &times = *_shared->times;
+    return std::find_if(times.begin(), times.end(), [&t](double st) {
+             return math::is_close(t, st);
+           }) != times.end();
+  }
+
   if (_dirty) {
     update();
   }
@@ -1093,6 +1199,8 @@ bool TimeSamples::get_sample_at(const double t, Sample **dst) {
     return false;
   }
 
+  detach();
+
   if (_dirty) {
     update();
   }
@@ -1107,5 +1215,268 @@ bool TimeSamples::get_sample_at(const double t, Sample **dst) {
   return false;
 }
 
+bool TimeSamples::set_samples(std::shared_ptr<const std::vector<double>> times,
+                              std::vector<value::Value> &&values) {
+  if (!times || (times->size() != values.size())) {
+    return false;
+  }
+
+  clear();
+
+  _shared = std::make_shared<SharedSamples>();
+  _shared->times = times;
+  _shared->values = std::move(values);
+  _dirty = false;
+
+  if (!std::is_sorted(times->begin(), times->end())) {
+    // Sample index must be sorted by time.
+    detach();
+    _dirty = true;
+  }
+
+  return true;
+}
+
+void TimeSamples::set_deferred_samples(
+    std::shared_ptr<const std::vector<double>> times,
+    const SampleDecoder &decoder, size_t max_cached_samples) {
+  clear();
+
+  if (!times || !decoder) {
+    return;
+  }
+
+  _shared = std::make_shared<SharedSamples>();
+  _shared->times = times;
+  _shared->decoder = decoder;
+  _dirty = false;
+
+  // get() with Linear interpolation requires two samples at once.
+  _shared->max_cached_samples =
+      (max_cached_samples == 0) ? 0 : (std::max)(size_t(2), max_cached_samples);
+
+  if (!std::is_sorted(times->begin(), times->end())) {
+    // Sample index must not change while samples are deferred.
+    detach();
+    _dirty = true;
+  }
+}
+
+std::shared_ptr<const Value> TimeSamples::load_sample(size_t idx,
+                                                      std::string *err) const {
+  if (!_shared || (idx >= _shared->times->size())) {
+    return nullptr;
+  }
+
+  SharedSamples &shared = *_shared;
+
+  // `values` and `samples` are not modified once they are set, so the
+  // returned pointer shares the ownership of `shared`.
+  if (!shared.decoder) {
+    return std::shared_ptr<const Value>(_shared, &shared.values[idx]);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(shared.mutex);
+
+    if (shared.materialized) {
+      return std::shared_ptr<const Value>(_shared, &shared.samples[idx].value);
+    }
+
+    auto it = shared.cache.find(idx);
+    if (it != shared.cache.end()) {
+      if (shared.max_cached_samples && idx && (shared.lru.back() != idx)) {
+        // Mark as most recently used.
+        shared.lru.remove(idx);
+        shared.lru.push_back(idx);
+      }
+      return it->second;
+    }
+  }
+
+  // Decode without holding the lock. Other thread may decode the same sample
+  // in the meantime.
+  auto v = std::make_shared<Value>();
+  if (!shared.decoder(idx, v.get(), err)) {
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(shared.mutex);
+
+  auto ret = shared.cache.emplace(idx, std::move(v));
+  if (!ret.second) {
+    return ret.first->second;
+  }
+
+  // The first sample is always kept since type_id() and type_name() use it.
+  if (shared.max_cached_samples && idx) {
+    if (shared.lru.size() >= shared.max_cached_samples) {
+      shared.cache.erase(shared.lru.front());
+      shared.lru.pop_front();
+    }
+    shared.lru.push_back(idx);
+  }
+
+  return ret.first->second;
+}
+
+bool TimeSamples::materialize(std::string *err) const {
+  if (!_shared) {
+    return true;
+  }
+
+  SharedSamples &shared = *_shared;
+
+  std::lock_guard<std::mutex> lock(shared.mutex);
+
+  if (shared.materialized) {
+    return true;
+  }
+
+  std::vector<Sample> samples(shared.times->size());
+  for (size_t i = 0; i < samples.size(); i++) {
+    samples[i].t = (*shared.times)[i];
+
+    if (!shared.decoder) {
+      samples[i].value = shared.values[i];
+    } else {
+      auto it = shared.cache.find(i);
+      if (it != shared.cache.end()) {
+        samples[i].value = *(it->second);
+      } else if (!shared.decoder(i, &samples[i].value, err)) {
+        // Keep samples deferred so that the failure is reported again.
+        return false;
+      }
+    }
+    samples[i].blocked = samples[i].value.is_none();
+  }
+
+  shared.samples = std::move(samples);
+  shared.materialized = true;
+
+  // Decoded values are now held in `samples`.
+  shared.cache.clear();
+  shared.lru.clear();
+
+  return true;
+}
+
+void TimeSamples::detach() {
+  if (!_shared) {
+    return;
+  }
+
+  std::vector<Sample> samples;
+  if (materialize()) {
+    if (_shared.use_count() == 1) {
+      // No other TimeSamples(or loaded sample value) references it.
+      samples = std::move(_shared->samples);
+    } else {
+      samples = _shared->samples;
+    }
+  }
+
+  _shared.reset();
+  _samples = std::move(samples);
+}
+
+const Value &BorrowedArray::materialized_value() const {
+  if (!materialized) {
+    // Should not happen. Borrowed arrays are set through
+    // PrimVar::set_borrowed_array().
+    static const Value *s_empty = new Value(nullptr);
+    return *s_empty;
+  }
+
+  std::call_once(materialized->once,
+                 [this]() { materialized->value = to_value(); });
+  return materialized->value;
+}
+
+const Value &DeferredValue::get(std::string *err) const {
+  static const Value *s_empty = new Value(nullptr);
+
+  if (!valid()) {
+    return *s_empty;
+  }
+
+  std::call_once(decoded->once, [this]() {
+    Value v(nullptr);
+    if (!decoder(&v, &decoded->err)) {
+      return;
+    }
+
+    // Decoded value uses base type(e.g. `float3[]`).
+    if ((type_id != underlying_type_id) && !RoleTypeCast(type_id, v)) {
+      decoded->err += "Failed to cast decoded value to type `" +
+                      GetTypeName(type_id) + "`.\n";
+      return;
+    }
+
+    decoded->value = std::move(v);
+    decoded->ok = true;
+  });
+
+  if (!decoded->ok) {
+    if (err) {
+      (*err) += decoded->err;
+    }
+    return *s_empty;
+  }
+
+  return decoded->value;
+}
+
+Value BorrowedArray::to_value() const {
+  if (!valid()) {
+    return Value(nullptr);
+  }
+
+  Value v(nullptr);
+
+#define BORROWED_ARRAY_TO_VALUE(__ty)                                        \
+  if (underlying_type_id == TypeTraits<std::vector<__ty>>::type_id()) {      \
+    const __ty *p = static_cast<const __ty *>(data);                         \
+    v = std::vector<__ty>(p, p + size);                                      \
+  } else
+
+  BORROWED_ARRAY_TO_VALUE(value::half)
+  BORROWED_ARRAY_TO_VALUE(value::half2)
+  BORROWED_ARRAY_TO_VALUE(value::half3)
+  BORROWED_ARRAY_TO_VALUE(value::half4)
+  BORROWED_ARRAY_TO_VALUE(int32_t)
+  BORROWED_ARRAY_TO_VALUE(value::int2)
+  BORROWED_ARRAY_TO_VALUE(value::int3)
+  BORROWED_ARRAY_TO_VALUE(value::int4)
+  BORROWED_ARRAY_TO_VALUE(uint32_t)
+  BORROWED_ARRAY_TO_VALUE(int64_t)
+  BORROWED_ARRAY_TO_VALUE(uint64_t)
+  BORROWED_ARRAY_TO_VALUE(float)
+  BORROWED_ARRAY_TO_VALUE(value::float2)
+  BORROWED_ARRAY_TO_VALUE(value::float3)
+  BORROWED_ARRAY_TO_VALUE(value::float4)
+  BORROWED_ARRAY_TO_VALUE(double)
+  BORROWED_ARRAY_TO_VALUE(value::double2)
+  BORROWED_ARRAY_TO_VALUE(value::double3)
+  BORROWED_ARRAY_TO_VALUE(value::double4)
+  BORROWED_ARRAY_TO_VALUE(value::quath)
+  BORROWED_ARRAY_TO_VALUE(value::quatf)
+  BORROWED_ARRAY_TO_VALUE(value::quatd)
+  BORROWED_ARRAY_TO_VALUE(value::matrix2d)
+  BORROWED_ARRAY_TO_VALUE(value::matrix3d)
+  BORROWED_ARRAY_TO_VALUE(value::matrix4d)
+  {
+    return Value(nullptr);
+  }
+
+#undef BORROWED_ARRAY_TO_VALUE
+
+  if (type_id != underlying_type_id) {
+    RoleTypeCast(type_id, v);
+  }
+
+  return v;
+}
+
 }  // namespace value
 }  // namespace tinyusdz
@@ -17,8 +17,10 @@
 #include <functional>
 #include <iostream>
 #include <limits>
+#include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <vector>
 
@@ -2014,8 +2016,14 @@ class Value {
   template <class T>
   Value(const T &v) : v_(v) {}
 
-  // template <class T>
-  // Value(T &&v) : v_(v) {}
+  // Move construct from rvalue(e.g. Prim with large property map) to avoid
+  // deep copy. Lvalues still go through `Value(const T &)`.
+  template <class T,
+            typename std::enable_if<
+                !std::is_reference<T>::value &&
+                    !std::is_same<typename std::decay<T>::type, Value>::value,
+                std::nullptr_t>::type = nullptr>
+  Value(T &&v) : v_(std::move(v)) {}
 
   const std::string type_name() const { return v_.type_name(); }
   const std::string underlying_type_name() const {
@@ -2138,6 +2146,91 @@ class Value {
   linb::any v_{nullptr};
 };
 
+///
+/// Read-only view of 1D array data which is owned by external storage(e.g.
+/// memory-mapped USDC file). No copy is made until the array is converted to
+/// `std::vector` with `to_value()`(or PrimVar::get_value<std::vector<T>>()).
+///
+/// `owner` keeps the storage of `data` alive.
+///
+struct BorrowedArray {
+  uint32_t type_id{TYPE_ID_INVALID}; // array type. May be role type(e.g. `point3f[]`)
+  uint32_t underlying_type_id{TYPE_ID_INVALID}; // array type of stored data(e.g. `float3[]`)
+  const void *data{nullptr};
+  size_t size{0}; // The number of array elements.
+  std::shared_ptr<const void> owner;
+
+  bool valid() const {
+    return data && (type_id & TYPE_ID_1D_ARRAY_BIT);
+  }
+
+  template <class T>
+  const T *as() const {
+    if (!valid()) {
+      return nullptr;
+    }
+
+    if ((TypeTraits<std::vector<T>>::type_id() == type_id) ||
+        (TypeTraits<std::vector<T>>::underlying_type_id() ==
+         underlying_type_id)) {
+      return static_cast<const T *>(data);
+    }
+
+    return nullptr;
+  }
+
+  ///
+  /// Copy data to `std::vector`. Returns empty Value for unsupported type.
+  ///
+  Value to_value() const;
+
+  // Cache of `to_value()` for accessors which return `const Value &`.
+  // Shared among copies of the view, since they reference the same data.
+  struct Materialized {
+    std::once_flag once;
+    Value value;
+  };
+  std::shared_ptr<Materialized> materialized;
+
+  ///
+  /// `to_value()` result which is computed once(thread-safe) and cached.
+  /// Requires `materialized` to be allocated(PrimVar::set_borrowed_array()
+  /// does it).
+  ///
+  const Value &materialized_value() const;
+};
+
+///
+/// Value which is decoded on the first access(e.g. uncompressed or
+/// compressed array value of Attribute in USDC. See
+/// `USDLoadOptions::deferred_value_unpack`). `decoder` reads the value from
+/// external storage(e.g. USDC file data) and keeps the storage alive.
+///
+struct DeferredValue {
+  uint32_t type_id{TYPE_ID_INVALID}; // May be role type(e.g. `point3f[]`)
+  uint32_t underlying_type_id{TYPE_ID_INVALID}; // type of decoded value(e.g. `float3[]`)
+  std::function<bool(Value *dst, std::string *err)> decoder;
+
+  // Decoded value. Shared among copies of DeferredValue, so the value is
+  // decoded at most once.
+  struct Decoded {
+    std::once_flag once;
+    bool ok{false};
+    std::string err;
+    Value value;
+  };
+  std::shared_ptr<Decoded> decoded;
+
+  bool valid() const { return bool(decoder) && bool(decoded); }
+
+  ///
+  /// Decode the value on the first call(thread-safe) and return it.
+  /// Returns null Value when decoding failed(error message is appended to
+  /// `err`).
+  ///
+  const Value &get(std::string *err = nullptr) const;
+};
+
 // TimeSample interpolation type.
 //
 // Held = something like numpy.digitize(right=False)
@@ -2276,15 +2369,67 @@ struct TimeSamples {
     bool blocked{false};
   };
 
-  bool empty() const { return _samples.empty(); }
+  ///
+  /// Decodes the value of `idx`-th sample(for deferred TimeSamples loading).
+  /// Returns false and appends the reason to `err`(may be nullptr) when
+  /// failed. Must be callable from multiple threads.
+  ///
+  using SampleDecoder =
+      std::function<bool(size_t idx, value::Value *dst, std::string *err)>;
+
+  bool empty() const { return size() == 0; }
 
-  size_t size() const { return _samples.size(); }
+  size_t size() const {
+    return _shared ? _shared->times->size() : _samples.size();
+  }
 
   void clear() {
     _samples.clear();
+    _shared.reset();
     _dirty = true;
   }
 
+  ///
+  /// Replace samples with `values` at `times`. `times` can be shared among
+  /// TimeSamples(e.g. all animated Attributes in a Crate file usually share
+  /// the same `times` array). Returns false when the number of elements
+  /// differs.
+  ///
+  bool set_samples(std::shared_ptr<const std::vector<double>> times,
+                   std::vector<value::Value> &&values);
+
+  ///
+  /// Replace samples with samples whose values are decoded by `decoder` on
+  /// demand. `times` can be shared among TimeSamples(e.g. all animated
+  /// Attributes in a Crate file usually share the same `times` array).
+  /// get() and get_value() decode only the samples they touch; other
+  /// accessors which expose all samples(e.g. get_samples()) decode all.
+  /// `max_cached_samples` : Max number of decoded sample values kept in
+  /// memory(least recently used one is released). 0 = no limit.
+  ///
+  /// The cache is guarded by a mutex, so const accessors(get(),
+  /// get_samples(), ...) can be called concurrently.
+  ///
+  void set_deferred_samples(std::shared_ptr<const std::vector<double>> times,
+                            const SampleDecoder &decoder,
+                            size_t max_cached_samples = 0);
+
+  bool is_deferred() const { return _shared && _shared->decoder; }
+
+  ///
+  /// @returns true when `times` is shared(set_samples() or
+  /// set_deferred_samples()). Modifying samples(e.g. add_sample(), samples())
+  /// makes a copy of `times`.
+  ///
+  bool has_shared_times() const { return bool(_shared); }
+
+  ///
+  /// Decode all deferred samples(for get_samples()). Samples keep sharing
+  /// `times`. Returns false and appends the reason to `err` when failed to
+  /// decode a sample. get_samples() returns empty samples in this case.
+  ///
+  bool materialize(std::string *err = nullptr) const;
+
   void update() const {
     std::sort(_samples.begin(), _samples.end(),
               [](const Sample &a, const Sample &b) { return a.t < b.t; });
@@ -2296,10 +2441,14 @@ struct TimeSamples {
   bool get_sample_at(const double t, Sample **s);
 
   nonstd::optional<double> get_time(size_t idx) const {
-    if (idx >= _samples.size()) {
+    if (idx >= size()) {
       return nonstd::nullopt;
     }
 
+    if (_shared) {
+      return (*_shared->times)[idx];
+    }
+
     if (_dirty) {
       update();
     }
@@ -2307,8 +2456,17 @@ struct TimeSamples {
     return _samples[idx].t;
   }
 
-  nonstd::optional<value::Value> get_value(size_t idx) const {
-    if (idx >= _samples.size()) {
+  // `err` : Decode error of deferred sample.
+  nonstd::optional<value::Value> get_value(size_t idx,
+                                           std::string *err = nullptr) const {
+    if (idx >= size()) {
+      return nonstd::nullopt;
+    }
+
+    if (_shared) {
+      if (const auto pv = load_sample(idx, err)) {
+        return *pv;
+      }
       return nonstd::nullopt;
     }
 
@@ -2320,6 +2478,11 @@ struct TimeSamples {
   }
 
   uint32_t type_id() const {
+    if (_shared) {
+      const auto pv = load_sample(0);
+      return pv ? pv->type_id() : uint32_t(value::TypeId::TYPE_ID_INVALID);
+    }
+
     if (_samples.size()) {
       if (_dirty) {
         update();
@@ -2331,6 +2494,11 @@ struct TimeSamples {
   }
 
   std::string type_name() const {
+    if (_shared) {
+      const auto pv = load_sample(0);
+      return pv ? pv->type_name() : std::string();
+    }
+
     if (_samples.size()) {
       if (_dirty) {
         update();
@@ -2342,12 +2510,14 @@ struct TimeSamples {
   }
 
   void add_sample(const Sample &s) {
+    detach();
     _samples.push_back(s);
     _dirty = true;
   }
 
   // Value may be None(ValueBlock)
   void add_sample(double t, const value::Value &v) {
+    detach();
     Sample s;
     s.t = t;
     s.value = v;
@@ -2358,6 +2528,7 @@ struct TimeSamples {
 
   // We still need "dummy" value for type_name() and type_id()
   void add_blocked_sample(double t, const value::Value &v) {
+    detach();
     Sample s;
     s.t = t;
     s.value = v;
@@ -2368,6 +2539,11 @@ struct TimeSamples {
   }
 
   const std::vector<Sample> &get_samples() const {
+    if (_shared) {
+      materialize();
+      return _shared->samples;
+    }
+
     if (_dirty) {
       update();
     }
@@ -2375,6 +2551,7 @@ struct TimeSamples {
   }
 
   std::vector<Sample> &samples() {
+    detach();
     if (_dirty) {
       update();
     }
@@ -2403,6 +2580,10 @@ struct TimeSamples {
         return false;
       }
 
+      if (_shared) {
+        return get_shared(dst, t, /* linear */false);
+      }
+
       if (_dirty) {
         update();
       }
@@ -2455,6 +2636,11 @@ struct TimeSamples {
       return false;
     }
 
+    if (_shared) {
+      return get_shared(dst, t,
+                        interp == TimeSampleInterpolationType::Linear);
+    }
+
     if (_dirty) {
       update();
     }
@@ -2546,8 +2732,111 @@ struct TimeSamples {
 #endif
 
  private:
+  // Samples which share `times` with other TimeSamples.
+  struct SharedSamples {
+    std::shared_ptr<const std::vector<double>> times;
+    std::vector<value::Value> values;  // Empty when samples are deferred.
+    SampleDecoder decoder;             // Decoder of deferred samples.
+    size_t max_cached_samples{0};
+
+    std::mutex mutex;  // Guards members below.
+    std::map<size_t, std::shared_ptr<const value::Value>> cache; // decoded sample values
+    std::list<size_t> lru; // indices in `cache`(except 0). back = most recently used.
+
+    std::vector<Sample> samples;  // All samples. Built by materialize().
+    bool materialized{false};
+  };
+
+  // Returns the value of `idx`-th sample with shared `times`(decodes deferred
+  // sample). nullptr when failed to decode. The value stays alive while the
+  // returned pointer is held, even if it is released from the cache.
+  std::shared_ptr<const value::Value> load_sample(
+      size_t idx, std::string *err = nullptr) const;
+
+  // Copy samples with shared `times` to `_samples` so that they can be
+  // modified. Samples are cleared when failed to decode a sample.
+  void detach();
+
+  template <typename T>
+  bool get_shared(T *dst, double t, bool linear) const {
+    const std::vector<double> &times = *_shared->times;
+
+    if (value::TimeCode(t).is_default() || (times.size() == 1)) {
+      // FIXME: Use the first item for now.
+      const auto pv = load_sample(0);
+      if (pv) {
+        if (const T *v = pv->as<T>()) {
+          (*dst) = *v;
+          return true;
+        }
+      }
+      return false;
+    }
+
+    if (linear) {
+      auto it = std::lower_bound(times.begin(), times.end(), t);
+      size_t idx0 = (it == times.begin())
+                        ? 0
+                        : size_t(std::distance(times.begin(), it) - 1);
+      idx0 = (std::min)(idx0, times.size() - 1);
+      size_t idx1 = (std::min)(times.size() - 1, idx0 + 1);
+
+      double tl = times[idx0];
+      double tu = times[idx1];
+
+      double dt = (t - tl);
+      if (std::fabs(tu - tl) < std::numeric_limits<double>::epsilon()) {
+        // slope is zero.
+        dt = 0.0;
+      } else {
+        dt /= (tu - tl);
+      }
+
+      // Just in case.
+      dt = std::max(0.0, std::min(1.0, dt));
+
+      const auto p0 = load_sample(idx0);
+      if (!p0) {
+        return false;
+      }
+      const auto p1 = load_sample(idx1);
+      if (!p1) {
+        return false;
+      }
+
+      value::Value p;
+      if (!Lerp(*p0, *p1, dt, &p)) {
+        return false;
+      }
+
+      if (const auto pv = p.as<T>()) {
+        (*dst) = *pv;
+        return true;
+      }
+      return false;
+    }
+
+    // Held
+    auto it = std::upper_bound(times.begin(), times.end(), t);
+    size_t idx = (it == times.begin())
+                     ? 0
+                     : size_t(std::distance(times.begin(), it) - 1);
+
+    const auto pv = load_sample(idx);
+    if (pv) {
+      if (const T *v = pv->as<T>()) {
+        (*dst) = *v;
+        return true;
+      }
+    }
+    return false;
+  }
+
   mutable std::vector<Sample> _samples;
   mutable bool _dirty{false};
+
+  // `_samples` is empty while samples share `times`.
+  std::shared_ptr<SharedSamples> _shared;
 };
 
 
@@ -0,0 +1,184 @@
+#ifdef _MSC_VER
+#define NOMINMAX
+#endif
+
+#define TEST_NO_MAIN
+#include "acutest.h"
+
+#include <sstream>
+
+#include "unit-crate-reader.h"
+#include "crate-reader.hh"
+#include "stream-reader.hh"
+#include "tinyusdz.hh"
+#include "usdc-writer.hh"
+#include "value-pprint.hh"
+
+using namespace tinyusdz;
+
+namespace {
+
+// Many Prims with Attributes under several root Prims, so that the scene has
+// enough fields, paths and independent subtrees for parallel processing.
+bool MakeUSDC(std::vector<uint8_t> *usdc) {
+  std::stringstream ss;
+  ss << "#usda 1.0\n\n";
+  for (size_t r = 0; r < 4; r++) {
+    ss << "def Xform \"root" << r << "\"\n{\n";
+    for (size_t i = 0; i < 64; i++) {
+      ss << "  def Mesh \"mesh" << i << "\"\n  {\n"
+         << "    float value = " << float(r * 100 + i) * 0.5f << "\n"
+         << "    int[] faceVertexCounts = [3, " << i << "]\n"
+         << "    token label = \"label" << i << "\"\n"
+         << "    double radius.timeSamples = { 0: " << i << ", 1: " << r
+         << " }\n"
+         << "  }\n";
+    }
+    ss << "}\n\n";
+  }
+  const std::string usda = ss.str();
+
+  Layer layer;
+  std::string warn, err;
+  if (!LoadUSDALayerFromMemory(reinterpret_cast<const uint8_t *>(usda.data()),
+                               usda.size(), "test.usda", &layer, &warn,
+                               &err)) {
+    TEST_MSG("%s", err.c_str());
+    return false;
+  }
+
+  if (!usdc::SaveAsUSDCToMemory(layer, usdc, &warn, &err)) {
+    TEST_MSG("%s", err.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+// Read Crate data and dump nodes, specs and live fieldsets as a string.
+bool ReadCrate(const std::vector<uint8_t> &usdc,
+               const crate::CrateReaderConfig &config, std::string *out) {
+  StreamReader sr(usdc.data(), usdc.size(), /* swap_endian */ false);
+  crate::CrateReader reader(&sr, config);
+
+  if (!reader.ReadBootStrap() || !reader.ReadTOC() || !reader.ReadSections() ||
+      !reader.BuildLiveFieldSets()) {
+    TEST_MSG("%s", reader.GetError().c_str());
+    return false;
+  }
+
+  std::stringstream ss;
+  for (const auto &tok : reader.GetTokens()) {
+    ss << tok.str() << "\n";
+  }
+
+  const std::vector<crate::CrateReader::Node> &nodes = reader.GetNodes();
+  for (size_t i = 0; i < nodes.size(); i++) {
+    ss << "node " << i << " " << nodes[i].GetPath().full_path_name()
+       << " elem " << nodes[i].GetElementPath().full_path_name() << " parent "
+       << nodes[i].GetParent() << " children";
+    for (const auto &c : nodes[i].GetChildren()) {
+      ss << " " << c;
+    }
+    ss << "\n";
+  }
+
+  for (const auto &spec : reader.GetSpecs()) {
+    ss << "spec " << spec.path_index.value << " " << spec.fieldset_index.value
+       << " " << int(spec.spec_type) << "\n";
+  }
+
+  for (const auto &item : reader.GetLiveFieldSets()) {
+    ss << "fieldset " << item.first.value << "\n";
+    for (const auto &fv : item.second) {
+      ss << "  " << fv.first << " " << fv.second.type_name() << " "
+         << value::pprint_value(fv.second.get_raw()) << "\n";
+    }
+  }
+
+  (*out) = ss.str();
+  return true;
+}
+
+}  // namespace
+
+void crate_reader_parallel_fieldsets_test(void) {
+  std::vector<uint8_t> usdc;
+  TEST_CHECK(MakeUSDC(&usdc));
+
+  crate::CrateReaderConfig serial_config;
+  serial_config.numThreads = 1;
+
+  std::string serial;
+  TEST_CHECK(ReadCrate(usdc, serial_config, &serial));
+  TEST_CHECK(serial.find("label63") != std::string::npos);
+
+  // BuildLiveFieldSetsParallel()
+  crate::CrateReaderConfig config;
+  config.numThreads = 4;
+  config.minFieldsForParallelUnpack = 0;
+
+  std::string parallel;
+  TEST_CHECK(ReadCrate(usdc, config, &parallel));
+  TEST_CHECK(parallel == serial);
+}
+
+void crate_reader_parallel_paths_test(void) {
+  std::vector<uint8_t> usdc;
+  TEST_CHECK(MakeUSDC(&usdc));
+
+  crate::CrateReaderConfig serial_config;
+  serial_config.numThreads = 1;
+
+  std::string serial;
+  TEST_CHECK(ReadCrate(usdc, serial_config, &serial));
+  TEST_CHECK(serial.find("/root3/mesh63") != std::string::npos);
+
+  // BuildDecompressedPathsAndNodesParallel()
+  crate::CrateReaderConfig config;
+  config.numThreads = 4;
+  config.minPathsForParallelDecode = 0;
+
+  std::string parallel;
+  TEST_CHECK(ReadCrate(usdc, config, &parallel));
+  TEST_CHECK(parallel == serial);
+}
+
+void crate_reader_parallel_sections_test(void) {
+  std::vector<uint8_t> usdc;
+  TEST_CHECK(MakeUSDC(&usdc));
+
+  crate::CrateReaderConfig serial_config;
+  serial_config.numThreads = 1;
+
+  std::string serial;
+  TEST_CHECK(ReadCrate(usdc, serial_config, &serial));
+
+  // ReadSectionsParallel()
+  crate::CrateReaderConfig config;
+  config.numThreads = 4;
+  config.minSectionBytesForParallelRead = 0;
+
+  std::string parallel;
+  TEST_CHECK(ReadCrate(usdc, config, &parallel));
+  TEST_CHECK(parallel == serial);
+
+  // All parallel paths together.
+  config.minFieldsForParallelUnpack = 0;
+  config.minPathsForParallelDecode = 0;
+  TEST_CHECK(ReadCrate(usdc, config, &parallel));
+  TEST_CHECK(parallel == serial);
+
+  // Corrupted section data is reported as an error, not a crash.
+  {
+    std::vector<uint8_t> broken = usdc;
+    for (size_t i = broken.size() / 2; i < broken.size() - 64; i += 7) {
+      broken[i] = uint8_t(broken[i] ^ 0x5a);
+    }
+
+    std::string out;
+    bool serial_ret = ReadCrate(broken, serial_config, &out);
+    bool parallel_ret = ReadCrate(broken, config, &out);
+    TEST_CHECK(serial_ret == parallel_ret);
+  }
+}
@@ -0,0 +1,5 @@
+#pragma once
+
+void crate_reader_parallel_fieldsets_test(void);
+void crate_reader_parallel_paths_test(void);
+void crate_reader_parallel_sections_test(void);
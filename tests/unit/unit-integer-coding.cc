@@ -0,0 +1,126 @@
+#ifdef _MSC_VER
+#define NOMINMAX
+#endif
+
+#define TEST_NO_MAIN
+#include "acutest.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "unit-integer-coding.h"
+#include "integerCoding.h"
+#include "lz4-compression.hh"
+
+using namespace tinyusdz;
+
+namespace {
+
+bool RoundTrip(const std::vector<int32_t> &ints) {
+  std::string err;
+  std::vector<char> compressed(
+      Usd_IntegerCompression::GetCompressedBufferSize(ints.size()));
+  size_t compressedSize = Usd_IntegerCompression::CompressToBuffer(
+      ints.data(), ints.size(), compressed.data(), &err);
+  if (!TEST_CHECK(compressedSize > 0)) {
+    return false;
+  }
+
+  // Full decompression(LZ4 + integer decoding)
+  {
+    std::vector<int32_t> decoded(ints.size());
+    size_t n = Usd_IntegerCompression::DecompressFromBuffer(
+        compressed.data(), compressedSize, decoded.data(), ints.size(), &err);
+    TEST_CHECK(n == ints.size());
+    TEST_CHECK(decoded == ints);
+  }
+
+  std::vector<char> encoded(
+      Usd_IntegerCompression::GetDecompressionWorkingSpaceSize(ints.size()));
+  size_t encodedSize = LZ4Compression::DecompressFromBuffer(
+      compressed.data(), encoded.data(), compressedSize, encoded.size(), &err);
+  if (!TEST_CHECK(encodedSize > 0)) {
+    return false;
+  }
+
+  // scalar and SIMD encoder must produce identical results.
+  {
+    std::vector<char> scalar(encoded.size());
+    std::vector<char> simd(encoded.size());
+    size_t scalarSize = Usd_IntegerCompression::EncodeToBuffer(
+        ints.data(), ints.size(), scalar.data(), /* allowSIMD */ false);
+    size_t simdSize = Usd_IntegerCompression::EncodeToBuffer(
+        ints.data(), ints.size(), simd.data(), /* allowSIMD */ true);
+    TEST_CHECK(scalarSize == encodedSize);
+    TEST_CHECK(simdSize == encodedSize);
+    TEST_CHECK(memcmp(scalar.data(), encoded.data(), encodedSize) == 0);
+    TEST_CHECK(memcmp(simd.data(), encoded.data(), encodedSize) == 0);
+  }
+
+  // scalar and SIMD decoder must produce identical results.
+  std::vector<int32_t> scalar(ints.size());
+  std::vector<int32_t> simd(ints.size());
+  TEST_CHECK(Usd_IntegerCompression::DecodeFromBuffer(
+                 encoded.data(), encodedSize, scalar.data(), ints.size(),
+                 /* allowSIMD */ false) == ints.size());
+  TEST_CHECK(Usd_IntegerCompression::DecodeFromBuffer(
+                 encoded.data(), encodedSize, simd.data(), ints.size(),
+                 /* allowSIMD */ true) == ints.size());
+  TEST_CHECK(scalar == ints);
+  TEST_CHECK(simd == ints);
+
+  // Truncated input must be rejected.
+  if (encodedSize > 1) {
+    TEST_CHECK(Usd_IntegerCompression::DecodeFromBuffer(
+                   encoded.data(), encodedSize / 2, simd.data(), ints.size(),
+                   /* allowSIMD */ true) == 0);
+  }
+
+  return true;
+}
+
+}  // namespace
+
+void integer_coding_test(void) {
+  // small(scalar tail only)
+  {
+    std::vector<int32_t> ints = {0, 1, 2, 3, 3, 3, -5};
+    TEST_CHECK(RoundTrip(ints));
+  }
+
+  // quad mesh indices
+  {
+    std::vector<int32_t> ints;
+    const int32_t res = 64;
+    for (int32_t y = 0; y < res; y++) {
+      for (int32_t x = 0; x < res; x++) {
+        int32_t v0 = y * (res + 1) + x;
+        ints.push_back(v0);
+        ints.push_back(v0 + 1);
+        ints.push_back(v0 + res + 2);
+        ints.push_back(v0 + res + 1);
+      }
+    }
+    TEST_CHECK(RoundTrip(ints));
+  }
+
+  // mixed deltas(8, 16 and 32 bit), including int32 limits.
+  {
+    std::vector<int32_t> ints;
+    uint32_t seed = 1;
+    for (size_t i = 0; i < 4099; i++) {
+      seed = seed * 1664525u + 1013904223u;
+      uint32_t r = seed >> 8;
+      switch (seed % 5) {
+        case 0: ints.push_back(int32_t(r % 200) - 100); break;
+        case 1: ints.push_back(int32_t(r % 60000) - 30000); break;
+        case 2: ints.push_back(int32_t(seed)); break;
+        case 3: ints.push_back(INT32_MAX); break;
+        default: ints.push_back(INT32_MIN); break;
+      }
+    }
+    TEST_CHECK(RoundTrip(ints));
+  }
+}
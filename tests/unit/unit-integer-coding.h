@@ -0,0 +1,3 @@
+#pragma once
+
+void integer_coding_test(void);
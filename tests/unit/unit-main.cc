@@ -16,6 +16,11 @@
 #include "unit-strutil.h"
 #include "unit-timesamples.h"
 #include "unit-pprint.h"
+#include "unit-integer-coding.h"
+#include "unit-usdc-writer.h"
+#include "unit-usdc-reader.h"
+#include "unit-crate-reader.h"
+#include "unit-usda-reader.h"
 
 #if defined(TINYUSDZ_WITH_PXR_COMPAT_API)
 #include "unit-pxr-compat-api.h"
@@ -38,6 +43,19 @@ TEST_LIST = {
   { "ioutil_test", ioutil_test },
   { "strutil_test", strutil_test },
   { "timesamples_test", timesamples_test },
+  { "integer_coding_test", integer_coding_test },
+  { "usdc_writer_test", usdc_writer_test },
+  { "usdc_reader_deferred_value_test", usdc_reader_deferred_value_test },
+  { "usdc_reader_load_filter_test", usdc_reader_load_filter_test },
+  { "usdc_reader_scan_hierarchy_test", usdc_reader_scan_hierarchy_test },
+  { "crate_reader_parallel_fieldsets_test", crate_reader_parallel_fieldsets_test },
+  { "crate_reader_parallel_paths_test", crate_reader_parallel_paths_test },
+  { "crate_reader_parallel_sections_test", crate_reader_parallel_sections_test },
+  { "value_type_pprint_test", value_type_pprint_test },
+  { "stage_pprint_test", stage_pprint_test },
+  { "usda_parallel_parse_test", usda_parallel_parse_test },
+  { "usda_parallel_root_blocks_test", usda_parallel_root_blocks_test },
+  { "usda_load_filter_test", usda_load_filter_test },
 #if defined(TINYUSDZ_WITH_PXR_COMPAT_API)
   { "pxr_compat_api_test", pxr_compat_api_test },
 #endif
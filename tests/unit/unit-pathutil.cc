@@ -8,6 +8,7 @@
 #include "unit-pathutil.h"
 #include "prim-types.hh"
 #include "path-util.hh"
+#include "tinyusdz.hh"
 
 using namespace tinyusdz;
 
@@ -148,4 +149,77 @@ void pathutil_test(void) {
     TEST_CHECK(ret == false);
   }
 
+  {
+    // Load filter: prefix match keeps ancestors and descendants
+    USDLoadFilter filter;
+    TEST_CHECK(filter.accept_prim_path("/any"));
+
+    filter.prim_path_prefixes.push_back("/root/geom");
+    TEST_CHECK(filter.accept_prim_path("/root"));
+    TEST_CHECK(filter.accept_prim_path("/root/geom"));
+    TEST_CHECK(filter.accept_prim_path("/root/geom/mesh"));
+    TEST_CHECK(!filter.accept_prim_path("/root/geometry"));
+    TEST_CHECK(!filter.accept_prim_path("/root/looks"));
+    TEST_CHECK(!filter.accept_prim_path("/ro"));
+
+    filter.prim_types.insert("Mesh");
+    TEST_CHECK(filter.accept_prim_type("Mesh"));
+    TEST_CHECK(filter.accept_prim_type(""));
+    TEST_CHECK(!filter.accept_prim_type("Material"));
+  }
+
+  {
+    // Interned Path: same contents share the path node.
+    Path a("/root/geom", "");
+    Path b = Path("/root", "").AppendPrim("geom");
+    TEST_CHECK(a == b);
+    TEST_CHECK(a.is_same_node(b));
+    TEST_CHECK(a.hash() == b.hash());
+    TEST_CHECK(b.element_name() == "geom");
+
+    Path c = a;
+    c.append_property("points");
+    TEST_CHECK(c.full_path_name() == "/root/geom.points");
+    TEST_CHECK(c.element_name() == "points");
+    TEST_CHECK(a.full_path_name() == "/root/geom");  // `a` is not modified.
+    TEST_CHECK(!(a == c));
+
+    Path d = c.get_parent_path();
+    TEST_CHECK(d == a);
+    TEST_CHECK(d.is_same_node(a));
+
+    // Appended Path and the Path constructed from the string are equal.
+    Path f = a.AppendPrim("mesh");
+    TEST_CHECK(f.prim_part() == "/root/geom/mesh");
+    TEST_CHECK(f == Path("/root/geom/mesh", ""));
+    TEST_CHECK(f.hash() == Path("/root/geom/mesh", "").hash());
+    TEST_CHECK(f.get_parent_path().is_same_node(a));
+    TEST_CHECK(Path("/root/geom/mesh", "").get_parent_path().is_same_node(a));
+
+    Path g = Path::make_root_path().AppendPrim("root");
+    TEST_CHECK(g == Path("/root", ""));
+    TEST_CHECK(g.hash() == Path("/root", "").hash());
+    TEST_CHECK(g.get_parent_path().is_root_path());
+
+    Path h = g.AppendElement("{var=sel}");
+    TEST_CHECK(h.prim_part() == "/root{var=sel}");
+    TEST_CHECK(h == Path("/root{var=sel}", ""));
+    TEST_CHECK(h.hash() == Path("/root{var=sel}", "").hash());
+    TEST_CHECK(h.AppendProperty("p").full_path_name() == "/root{var=sel}.p");
+
+    TEST_CHECK(Path("dora/bora", "").get_parent_path() == Path("dora", ""));
+    TEST_CHECK(!Path("dora", "").get_parent_path().is_valid());
+
+    size_t n = Path::num_interned_nodes();
+    {
+      Path e("/unique_path_for_test", "");
+      TEST_CHECK(Path::num_interned_nodes() == n + 1);
+    }
+    TEST_CHECK(Path::num_interned_nodes() == n);
+
+    Path empty;
+    TEST_CHECK(!empty.is_valid());
+    TEST_CHECK(empty.hash() == Path().hash());
+  }
+
 }
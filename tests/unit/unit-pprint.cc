@@ -5,11 +5,15 @@
 #define TEST_NO_MAIN
 #include "acutest.h"
 
+#include <limits>
+
 #include "unit-pprint.h"
 #include "prim-types.hh"
 #include "value-types.hh"
 #include "value-pprint.hh"
 #include "pprinter.hh"
+#include "prim-pprint.hh"
+#include "tinyusdz.hh"
 
 using namespace tinyusdz;
 
@@ -27,5 +31,111 @@ void value_type_pprint_test(void) {
     std::string s = to_string(v);
     TEST_CHECK(s == "(1, 2, 3)");
   }
+
+  // Fast array printing gives the same result as printing each element.
+  {
+    std::vector<value::point3f> pts;
+    std::vector<value::quatf> quats;
+    std::vector<int64_t> ints = {0, -1, 12345, (std::numeric_limits<int64_t>::min)(), (std::numeric_limits<int64_t>::max)()};
+    for (size_t i = 0; i < 10000; i++) {
+      float f = float(i) * 0.37f - 100.0f;
+      pts.push_back({f, f * 1e-6f, f * 1e+7f});
+      quats.push_back({{f, 0.5f, -0.25f}, 1.0f});
+    }
+
+    auto join = [](const std::vector<std::string> &items) {
+      std::string s = "[";
+      for (size_t i = 0; i < items.size(); i++) {
+        if (i > 0) {
+          s += ", ";
+        }
+        s += items[i];
+      }
+      return s + "]";
+    };
+
+    std::vector<std::string> items;
+    for (const auto &p : pts) {
+      items.push_back(to_string(p));
+    }
+    const std::string expected_pts = join(items);
+
+    items.clear();
+    for (const auto &q : quats) {
+      items.push_back(to_string(q));
+    }
+    const std::string expected_quats = join(items);
+
+    items.clear();
+    for (const auto &i : ints) {
+      items.push_back(to_string(i));
+    }
+    const std::string expected_ints = join(items);
+
+    TEST_CHECK(value::pprint_value(value::Value(pts)) == expected_pts);
+    TEST_CHECK(value::pprint_value(value::Value(quats)) == expected_quats);
+    TEST_CHECK(value::pprint_value(value::Value(ints)) == expected_ints);
+
+    std::vector<int32_t> ints32 = {0, -7, 100, (std::numeric_limits<int32_t>::min)(), (std::numeric_limits<int32_t>::max)()};
+    std::vector<uint32_t> uints32 = {0, 9, 10, 99999, (std::numeric_limits<uint32_t>::max)()};
+    TEST_CHECK(value::pprint_value(value::Value(ints32)) == "[0, -7, 100, -2147483648, 2147483647]");
+    TEST_CHECK(value::pprint_value(value::Value(uints32)) == "[0, 9, 10, 99999, 4294967295]");
+
+    // Written to std::ostream in chunks.
+    std::stringstream ss;
+    ss << pts;
+    TEST_CHECK(ss.str() == expected_pts);
+  }
 }
 
+void stage_pprint_test(void) {
+  // Single root Prim with nested children, so that print_prims() has to
+  // descend into the tree to split the work.
+  std::stringstream usda;
+  usda << "#usda 1.0\n\n";
+  usda << "def Xform \"World\"\n{\n";
+  for (size_t i = 0; i < 50; i++) {
+    usda << "  def Xform \"group" << i << "\"\n  {\n";
+    for (size_t j = 0; j < 4; j++) {
+      usda << "    def Mesh \"mesh" << j << "\"\n    {\n";
+      usda << "      int[] faceVertexCounts = [3]\n";
+      usda << "      point3f[] points = [(0, 0, 0), (" << i << ", " << j << ", 0.5), (1, 1, 1)]\n";
+      usda << "    }\n";
+    }
+    usda << "  }\n";
+  }
+  usda << "}\n\n";
+  usda << "def Xform \"Other\"\n{\n}\n";
+
+  const std::string s = usda.str();
+  Stage stage;
+  std::string warn, err;
+  TEST_CHECK(LoadUSDAFromMemory(reinterpret_cast<const uint8_t *>(s.data()),
+                                s.size(), "", &stage, &warn, &err));
+  TEST_MSG("%s", err.c_str());
+
+  const std::string serial = stage.ExportToString(false, /* num_threads */ 1);
+  TEST_CHECK(serial.find("mesh3") != std::string::npos);
+  TEST_CHECK(stage.ExportToString(false, /* num_threads */ 2) == serial);
+  TEST_CHECK(stage.ExportToString(false, /* num_threads */ 16) == serial);
+
+  std::vector<const Prim *> prims;
+  for (const auto &prim : stage.root_prims()) {
+    prims.push_back(&prim);
+  }
+  std::string expected;
+  for (size_t i = 0; i < prims.size(); i++) {
+    if (i > 0) {
+      expected += "\n";
+    }
+    expected += prim::print_prim(*prims[i]);
+  }
+  TEST_CHECK(prim::print_prims(prims, 0, 16) == expected);
+
+  // Streaming export.
+  for (int num_threads : {1, 3, 16}) {
+    std::stringstream ss;
+    stage.ExportToStream(ss, false, num_threads);
+    TEST_CHECK(ss.str() == serial);
+  }
+}
@@ -1,3 +1,4 @@
 #pragma once
 
 void value_type_pprint_test(void);
+void stage_pprint_test(void);
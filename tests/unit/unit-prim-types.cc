@@ -7,6 +7,7 @@
 
 #include "unit-prim-types.h"
 #include "prim-types.hh"
+#include "prim-reconstruct.hh"
 
 using namespace tinyusdz;
 
@@ -114,6 +115,24 @@ void prim_type_test(void) {
     TEST_CHECK(gpath.has_prefix(fpath) == false);
   }
 
+  {
+    // Processed property names in Prim reconstruction.
+    prim::PropertyNameTable table;
+    TEST_CHECK(table.empty());
+    TEST_CHECK(!table.count("points"));
+
+    for (size_t i = 0; i < 100; i++) {
+      table.insert("primvars:st" + std::to_string(i));
+    }
+    table.insert("points");
+    table.insert(std::string("points"));
+    TEST_CHECK(table.size() == 101);
+    TEST_CHECK(table.count("points") == 1);
+    TEST_CHECK(table.count(std::string("primvars:st99")) == 1);
+    TEST_CHECK(!table.count("primvars:st100"));
+    TEST_CHECK(!table.count("point"));
+  }
+
 }
 
 void prim_add_test(void) {
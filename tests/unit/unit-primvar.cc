@@ -33,4 +33,60 @@ void primvar_test(void) {
     
   }
 
+  // borrowed(zero-copy) array
+  {
+    std::shared_ptr<std::vector<float3>> storage =
+        std::make_shared<std::vector<float3>>();
+    storage->push_back({1.0f, 2.0f, 3.0f});
+    storage->push_back({4.0f, 5.0f, 6.0f});
+
+    BorrowedArray view;
+    view.type_id = TypeTraits<std::vector<point3f>>::type_id();
+    view.underlying_type_id = TypeTraits<std::vector<float3>>::type_id();
+    view.data = storage->data();
+    view.size = storage->size();
+    view.owner = storage;
+
+    PrimVar var;
+    var.set_borrowed_array(view);
+    TEST_CHECK(var.has_value());
+    TEST_CHECK(var.is_borrowed_array());
+    TEST_CHECK(var.type_name() == "point3f[]");
+
+    const point3f *p{nullptr};
+    size_t n{0};
+    TEST_CHECK(var.get_array_view(&p, &n));
+    TEST_CHECK(n == 2);
+    TEST_CHECK(reinterpret_cast<const void *>(p) == storage->data());
+
+    auto pv = var.get_value<std::vector<point3f>>();
+    TEST_CHECK(pv.has_value());
+    if (pv) {
+      TEST_CHECK(pv.value().size() == 2);
+      TEST_CHECK(pv.value()[1][2] == 6.0f);
+    }
+    TEST_CHECK(var.get_value<std::vector<float3>>().has_value());
+    TEST_CHECK(!var.get_value<std::vector<float>>().has_value());
+    TEST_CHECK(var.get_default_raw().type_name() == "point3f[]");
+
+    // Accessors returning a reference/pointer materialize the array.
+    {
+      const PrimVar &cvar = var;
+      const std::vector<point3f> *pp = cvar.as<std::vector<point3f>>();
+      TEST_CHECK(pp != nullptr);
+      if (pp) {
+        TEST_CHECK(pp->size() == 2);
+        TEST_CHECK((*pp)[0][1] == 2.0f);
+      }
+      TEST_CHECK(cvar.value_raw().type_name() == "point3f[]");
+      // Cached.
+      TEST_CHECK(cvar.as<std::vector<point3f>>() == pp);
+      TEST_CHECK(cvar.is_borrowed_array());
+    }
+
+    var.materialize();
+    TEST_CHECK(!var.is_borrowed_array());
+    TEST_CHECK(var.as<std::vector<point3f>>() != nullptr);
+  }
+
 }
@@ -199,4 +199,153 @@ void timesamples_test(void) {
     TEST_CHECK(!value::IsLerpSupportedType(value::TypeTraits<std::vector<std::string>>::type_id()));
   }
 
+  // deferred samples
+  {
+    std::vector<size_t> decoded;
+    std::vector<double> times = {0.0, 1.0, 2.0, 3.0, 4.0};
+
+    value::TimeSamples ts;
+    ts.set_deferred_samples(std::make_shared<const std::vector<double>>(times), [&decoded](size_t idx, value::Value *dst, std::string *err) {
+      (void)err;
+      decoded.push_back(idx);
+      (*dst) = float(idx) * 10.0f;
+      return true;
+    }, /* max_cached_samples */2);
+
+    TEST_CHECK(ts.is_deferred());
+    TEST_CHECK(ts.size() == 5);
+    TEST_CHECK(decoded.empty());
+
+    float f{0.0f};
+    TEST_CHECK(ts.get(&f, 2.5, value::TimeSampleInterpolationType::Linear));
+    TEST_CHECK(math::is_close(f, 25.0f));
+    TEST_CHECK(decoded.size() == 2); // sample 2 and 3
+
+    // cached
+    TEST_CHECK(ts.get(&f, 2.0, value::TimeSampleInterpolationType::Held));
+    TEST_CHECK(math::is_close(f, 20.0f));
+    TEST_CHECK(decoded.size() == 2);
+
+    // sample 3 is released(LRU)
+    TEST_CHECK(ts.get(&f, 4.0, value::TimeSampleInterpolationType::Held));
+    TEST_CHECK(math::is_close(f, 40.0f));
+    TEST_CHECK(ts.get(&f, 3.0, value::TimeSampleInterpolationType::Held));
+    TEST_CHECK(math::is_close(f, 30.0f));
+    TEST_CHECK(decoded.size() == 4);
+
+    TEST_CHECK(ts.type_name() == "float");
+
+    // get_samples() decodes all samples.
+    TEST_CHECK(ts.get_samples().size() == 5);
+    TEST_CHECK(ts.has_shared_times());
+    TEST_CHECK(math::is_close(*ts.get_samples()[1].value.as<float>(), 10.0f));
+  }
+
+  // failed to decode a deferred sample.
+  {
+    value::TimeSamples ts;
+    ts.set_deferred_samples(std::make_shared<const std::vector<double>>(std::vector<double>{0.0, 1.0}), [](size_t idx, value::Value *dst, std::string *err) {
+      if (idx == 1) {
+        if (err) {
+          (*err) += "corrupted sample.\n";
+        }
+        return false;
+      }
+      (*dst) = 1.0f;
+      return true;
+    });
+
+    float f{0.0f};
+    TEST_CHECK(ts.get(&f, 0.0, value::TimeSampleInterpolationType::Held));
+    TEST_CHECK(!ts.get(&f, 1.0, value::TimeSampleInterpolationType::Held));
+
+    // Not reported as a ValueBlock.
+    std::string err;
+    TEST_CHECK(!ts.materialize(&err));
+    TEST_CHECK(err.find("corrupted sample.") != std::string::npos);
+    TEST_CHECK(ts.get_samples().empty());
+    TEST_CHECK(ts.is_deferred());
+  }
+
+  // typed attribute keeps samples deferred.
+  {
+    std::vector<size_t> decoded;
+    value::TimeSamples ts;
+    ts.set_deferred_samples(std::make_shared<const std::vector<double>>(std::vector<double>{0.0, 1.0, 2.0}), [&decoded](size_t idx, value::Value *dst, std::string *err) {
+      (void)err;
+      decoded.push_back(idx);
+      (*dst) = float(idx);
+      return true;
+    });
+
+    TypedTimeSamples<float> tts;
+    TEST_CHECK(tts.set_deferred(ts));
+    TEST_CHECK(tts.is_deferred());
+    TEST_CHECK(tts.size() == 3);
+    TEST_CHECK(decoded.size() == 1); // sample 0 for the type check.
+
+    float f{0.0f};
+    TEST_CHECK(tts.get(&f, 2.0, value::TimeSampleInterpolationType::Held));
+    TEST_CHECK(math::is_close(f, 2.0f));
+    TEST_CHECK(decoded.size() == 2);
+
+    // get_samples() converts all samples.
+    TEST_CHECK(tts.get_samples().size() == 3);
+    TEST_CHECK(math::is_close(tts.get_samples()[1].value, 1.0f));
+    TEST_CHECK(decoded.size() == 3);
+
+    // Type mismatch.
+    TypedTimeSamples<double> dts;
+    TEST_CHECK(!dts.set_deferred(ts));
+  }
+
+  // deferred samples sharing `times`
+  {
+    auto times = std::make_shared<const std::vector<double>>(std::vector<double>{0.0, 1.0});
+    auto decoder = [](size_t idx, value::Value *dst, std::string *err) {
+      (void)err;
+      (*dst) = double(idx);
+      return true;
+    };
+
+    value::TimeSamples ts0;
+    value::TimeSamples ts1;
+    ts0.set_deferred_samples(times, decoder);
+    ts1.set_deferred_samples(times, decoder);
+    TEST_CHECK(times.use_count() == 3);
+
+    TEST_CHECK(ts0.has_sample_at(1.0));
+    TEST_CHECK(ts1.get_time(1).value() == 1.0);
+
+    // Decoded samples still share `times`.
+    TEST_CHECK(ts0.materialize());
+    TEST_CHECK(times.use_count() == 3);
+    TEST_CHECK(ts0.size() == 2);
+
+    // Modifying samples releases the reference to `times`.
+    ts0.add_sample(2.0, value::Value(2.0));
+    TEST_CHECK(times.use_count() == 2);
+    TEST_CHECK(ts0.size() == 3);
+    TEST_CHECK(!ts0.has_shared_times());
+  }
+
+  // decoded samples sharing `times`
+  {
+    auto times = std::make_shared<const std::vector<double>>(std::vector<double>{0.0, 1.0});
+
+    value::TimeSamples ts0;
+    value::TimeSamples ts1;
+    TEST_CHECK(ts0.set_samples(times, {value::Value(1.0f), value::Value(2.0f)}));
+    TEST_CHECK(ts1.set_samples(times, {value::Value(3.0f), value::Value(4.0f)}));
+    TEST_CHECK(!ts0.set_samples(times, {value::Value(1.0f)}));
+    TEST_CHECK(times.use_count() == 3);
+    TEST_CHECK(!ts0.is_deferred());
+
+    float f{0.0f};
+    TEST_CHECK(ts1.get(&f, 0.5, value::TimeSampleInterpolationType::Linear));
+    TEST_CHECK(math::is_close(f, 3.5f));
+    TEST_CHECK(ts0.get_samples().size() == 2);
+    TEST_CHECK(math::is_close(*ts0.get_samples()[1].value.as<float>(), 2.0f));
+  }
+
 }
@@ -0,0 +1,421 @@
+#ifdef _MSC_VER
+#define NOMINMAX
+#endif
+
+#define TEST_NO_MAIN
+#include "acutest.h"
+
+#include <sstream>
+#include <thread>
+
+#include "unit-usda-reader.h"
+#include "pprinter.hh"
+#include "tinyusdz.hh"
+#include "usdGeom.hh"
+
+using namespace tinyusdz;
+
+namespace {
+
+bool LoadUSDA(const std::string &s, int num_threads, std::string *out,
+              std::string *err,
+              const USDLoadFilter &filter = USDLoadFilter()) {
+  USDLoadOptions options;
+  options.num_threads = num_threads;
+  options.filter = filter;
+
+  Stage stage;
+  std::string warn;
+  if (!LoadUSDAFromMemory(reinterpret_cast<const uint8_t *>(s.data()),
+                          s.size(), "", &stage, &warn, err, options)) {
+    return false;
+  }
+
+  (*out) = stage.ExportToString(false, /* num_threads */ 1);
+  return true;
+}
+
+bool LoadUSDALayer(const std::string &s, int num_threads, std::string *out,
+                   std::string *err,
+                   const USDLoadFilter &filter = USDLoadFilter()) {
+  USDLoadOptions options;
+  options.num_threads = num_threads;
+  options.filter = filter;
+
+  Layer layer;
+  std::string warn;
+  if (!LoadUSDALayerFromMemory(reinterpret_cast<const uint8_t *>(s.data()),
+                               s.size(), "", &layer, &warn, err, options)) {
+    return false;
+  }
+
+  (*out) = to_string(layer);
+  return true;
+}
+
+}  // namespace
+
+void usda_parallel_parse_test(void) {
+  // Arrays and timeSamples large enough to be split into chunks.
+  std::stringstream usda;
+  usda << "#usda 1.0\n\n";
+  usda << "def Mesh \"mesh\"\n{\n";
+
+  usda << "  int[] faceVertexIndices = [";
+  for (size_t i = 0; i < 100000; i++) {
+    usda << i << ", ";  // `,` after the last element.
+  }
+  usda << "]\n";
+
+  usda << "  point3f[] points = [\n";
+  for (size_t i = 0; i < 40000; i++) {
+    usda << "    (" << float(i) * 0.5f << ", -" << i << ", " << float(i) * 1e-3f
+         << ((i % 7) ? ")," : "),\n");
+  }
+  usda << "  ]\n";
+
+  usda << "  normal3f[] normals.timeSamples = {\n";
+  for (size_t t = 0; t < 32; t++) {
+    if (t == 3) {
+      usda << "    " << t << ": None,\n";
+      continue;
+    }
+    usda << "    " << t << ": [";
+    for (size_t i = 0; i < 2000; i++) {
+      usda << (i ? ", " : "") << "(" << t << ", " << i << ", 0.25)";
+    }
+    usda << "],\n";
+  }
+  usda << "  }\n";
+  usda << "}\n";
+
+  const std::string s = usda.str();
+
+  std::string serial, err;
+  TEST_CHECK(LoadUSDA(s, 1, &serial, &err));
+  TEST_MSG("%s", err.c_str());
+  TEST_CHECK(serial.find("99999") != std::string::npos);
+
+  std::string parallel;
+  TEST_CHECK(LoadUSDA(s, 8, &parallel, &err));
+  TEST_MSG("%s", err.c_str());
+  TEST_CHECK(parallel == serial);
+
+  // Input the fast path does not handle(comment, `inf`) falls back to the
+  // generic parser.
+  {
+    std::string s2 = s;
+    s2.replace(s2.find("12345, "), 7, "12345, # comment ]\n");
+    s2.replace(s2.find("(0.5, -1, "), 10, "(inf, -1, ");
+    s2.replace(s2.find("(1, 7, 0.25)"), 12, "(1, 7, 0.25) # ]\n");
+
+    std::string serial2, parallel2;
+    TEST_CHECK(LoadUSDA(s2, 1, &serial2, &err));
+    TEST_MSG("%s", err.c_str());
+    TEST_CHECK(LoadUSDA(s2, 8, &parallel2, &err));
+    TEST_MSG("%s", err.c_str());
+    TEST_CHECK(parallel2 == serial2);
+    TEST_CHECK(parallel2 != serial);
+  }
+
+  // Parse error is reported at the same location.
+  {
+    std::string s3 = s;
+    s3.replace(s3.find("54321, "), 7, "54321 54322, ");
+
+    std::string out, serial_err, parallel_err;
+    TEST_CHECK(!LoadUSDA(s3, 1, &out, &serial_err));
+    TEST_CHECK(!LoadUSDA(s3, 8, &out, &parallel_err));
+    TEST_CHECK(parallel_err == serial_err);
+  }
+}
+
+void usda_parallel_root_blocks_test(void) {
+  // Many root Prim blocks with braces in metadata, strings, asset paths and
+  // comments, which must not be taken as the end of a block.
+  std::stringstream usda;
+  usda << "#usda 1.0\n(\n  defaultPrim = \"root0\"\n  customLayerData = {\n"
+       << "    string note = \"} {\"\n  }\n)\n\n";
+  for (size_t i = 0; i < 400; i++) {
+    const char *spec = (i % 10 == 9) ? "over" : ((i % 10 == 8) ? "class" : "def");
+    usda << spec << " Xform \"root" << i << "\" (\n"
+         << "  customData = {\n    string s = \"}\"\n    dictionary d = { int a = " << i << " }\n  }\n"
+         << "  variants = {\n    string shape = \"cube\"\n  }\n"
+         << "  prepend variantSets = \"shape\"\n"
+         << ")\n{\n"
+         << "  # } comment with a closing brace\n"
+         << "  string label = 'a { b'\n"
+         << "  string doc = \"\"\"multi\n  line } string\"\"\"\n"
+         << "  asset file = @./dir{v}/file#1.usda@\n"
+         << "  def Mesh \"mesh\"\n  {\n    int[] faceVertexCounts = [3]\n"
+         << "    point3f[] points = [";
+    for (size_t j = 0; j < 200; j++) {
+      usda << (j ? ", " : "") << "(" << i << ", " << j << ", 0.125)";
+    }
+    usda << "]\n  }\n"
+         << "  variantSet \"shape\" = {\n"
+         << "    \"cube\" {\n      def Cube \"cube\" { double size = " << i << " }\n    }\n"
+         << "    \"sphere\" {\n      def Sphere \"sphere\" { double radius = 1 }\n    }\n"
+         << "  }\n"
+         << "}\n\n";
+  }
+  usda << "# trailing comment }\n";
+
+  const std::string s = usda.str();
+  TEST_CHECK(s.size() > 1024 * 1024);
+
+  std::string serial, parallel, err;
+  TEST_CHECK(LoadUSDA(s, 1, &serial, &err));
+  TEST_MSG("%s", err.c_str());
+  TEST_CHECK(serial.find("root399") != std::string::npos);
+  TEST_CHECK(LoadUSDA(s, 8, &parallel, &err));
+  TEST_MSG("%s", err.c_str());
+  TEST_CHECK(parallel == serial);
+
+  // As PrimSpec(for composition).
+  TEST_CHECK(LoadUSDALayer(s, 1, &serial, &err));
+  TEST_MSG("%s", err.c_str());
+  TEST_CHECK(LoadUSDALayer(s, 8, &parallel, &err));
+  TEST_MSG("%s", err.c_str());
+  TEST_CHECK(parallel == serial);
+
+  // Parse error in the middle of the input is reported at the same location.
+  {
+    std::string s2 = s;
+    s2.replace(s2.find("double size = 300"), 17, "double size = ,");
+
+    std::string out, serial_err, parallel_err;
+    TEST_CHECK(!LoadUSDA(s2, 1, &out, &serial_err));
+    TEST_CHECK(!LoadUSDA(s2, 8, &out, &parallel_err));
+    TEST_CHECK(parallel_err == serial_err);
+    TEST_MSG("serial: %s\nparallel: %s", serial_err.c_str(),
+             parallel_err.c_str());
+  }
+
+  // Load filter is applied in the worker parsers.
+  {
+    USDLoadFilter filter;
+    filter.prim_types = {"Xform", "Cube"};
+
+    TEST_CHECK(LoadUSDA(s, 1, &serial, &err, filter));
+    TEST_MSG("%s", err.c_str());
+    TEST_CHECK(LoadUSDA(s, 8, &parallel, &err, filter));
+    TEST_MSG("%s", err.c_str());
+    TEST_CHECK(parallel == serial);
+    TEST_CHECK(serial.find("root399") != std::string::npos);
+    TEST_CHECK(serial.find("def Cube") != std::string::npos);
+    TEST_CHECK(serial.find("def Mesh") == std::string::npos);
+    TEST_CHECK(serial.find("def Sphere") == std::string::npos);
+
+    TEST_CHECK(LoadUSDALayer(s, 1, &serial, &err, filter));
+    TEST_MSG("%s", err.c_str());
+    TEST_CHECK(LoadUSDALayer(s, 8, &parallel, &err, filter));
+    TEST_MSG("%s", err.c_str());
+    TEST_CHECK(parallel == serial);
+    TEST_CHECK(serial.find("def Mesh") == std::string::npos);
+
+    // Property filter is called from the loading thread only.
+    const std::thread::id caller = std::this_thread::get_id();
+    bool other_thread{false};
+    filter.property_filter = [&](const std::string &,
+                                 const std::string &prop_name) {
+      if (std::this_thread::get_id() != caller) {
+        other_thread = true;
+      }
+      return prop_name != "label";
+    };
+
+    TEST_CHECK(LoadUSDA(s, 1, &serial, &err, filter));
+    TEST_MSG("%s", err.c_str());
+    TEST_CHECK(LoadUSDA(s, 8, &parallel, &err, filter));
+    TEST_MSG("%s", err.c_str());
+    TEST_CHECK(parallel == serial);
+    TEST_CHECK(serial.find("string label") == std::string::npos);
+    TEST_CHECK(serial.find("string doc") != std::string::npos);
+    TEST_CHECK(!other_thread);
+  }
+
+  // Prim reconstruction error.
+  {
+    std::string s3 = s;
+    s3.replace(s3.find("double size = 300"), 17, "token size = \"a\"");
+
+    std::string out;
+    TEST_CHECK(!LoadUSDA(s3, 1, &out, &err));
+    TEST_CHECK(!LoadUSDA(s3, 8, &out, &err));
+  }
+
+  // File size limit is applied to the mmap path of LoadLayerFromFile.
+  {
+    const std::string filename = "unit-usda-reader-limit.usda";
+    FILE *fp = fopen(filename.c_str(), "wb");
+    TEST_CHECK(fp != nullptr);
+    if (fp) {
+      fwrite(s.data(), 1, s.size(), fp);
+      fclose(fp);
+    }
+
+    Layer layer;
+    std::string warn, limit_err;
+    USDLoadOptions options;
+    options.max_memory_limit_in_mb = 1;
+    TEST_CHECK(!LoadLayerFromFile(filename, &layer, &warn, &limit_err, options));
+    TEST_CHECK(limit_err.find("too large") != std::string::npos);
+
+    options.max_memory_limit_in_mb = 16;
+    limit_err.clear();
+    TEST_CHECK(LoadLayerFromFile(filename, &layer, &warn, &limit_err, options));
+    TEST_MSG("%s", limit_err.c_str());
+
+    remove(filename.c_str());
+  }
+}
+
+void usda_load_filter_test(void) {
+  const std::string s = R"(#usda 1.0
+
+def Xform "root"
+{
+  def Xform "geom" (
+    variants = {
+      string shading = "a"
+    }
+    prepend variantSets = "shading"
+  )
+  {
+    def Mesh "mesh"
+    {
+      point3f[] points = [(0, 0, 0), (1, 0, 0), (1, 1, 0)]
+      normal3f[] normals = [(0, 0, 1), (0, 0, 1), (0, 0, 1)]
+      float myvalue = 1.5
+    }
+
+    variantSet "shading" = {
+      "a" {
+        def Material "vmat"
+        {
+        }
+      }
+    }
+  }
+
+  def Scope "looks"
+  {
+    def Material "mat"
+    {
+    }
+  }
+}
+
+def Scope "other"
+{
+  def Mesh "mesh2"
+  {
+  }
+}
+)";
+
+  auto load = [&s](const USDLoadFilter &filter, Stage *stage) {
+    USDLoadOptions options;
+    options.filter = filter;
+    std::string warn, err;
+    bool ret = LoadUSDAFromMemory(reinterpret_cast<const uint8_t *>(s.data()),
+                                  s.size(), "", stage, &warn, &err, options);
+    TEST_MSG("%s", err.c_str());
+    return ret;
+  };
+
+  auto has_prim = [](const Stage &stage, const std::string &path) {
+    return stage.GetPrimAtPath(Path(path, "")).has_value();
+  };
+
+  // Prim type filter: Prims of other types are skipped with their
+  // descendants(including Prims in variantSet).
+  {
+    USDLoadFilter filter;
+    filter.prim_types = {"Xform", "Mesh"};
+
+    Stage stage;
+    TEST_CHECK(load(filter, &stage));
+    TEST_CHECK(has_prim(stage, "/root/geom/mesh"));
+    TEST_CHECK(!has_prim(stage, "/root/looks"));
+    TEST_CHECK(!has_prim(stage, "/root/looks/mat"));
+    TEST_CHECK(!has_prim(stage, "/other"));
+    TEST_CHECK(!has_prim(stage, "/other/mesh2"));
+
+    auto geom = stage.GetPrimAtPath(Path("/root/geom", ""));
+    TEST_CHECK(geom.has_value());
+    if (geom) {
+      const auto &vsets = geom.value()->variantSets();
+      TEST_CHECK(vsets.count("shading") == 1);
+      if (vsets.count("shading") &&
+          vsets.at("shading").variantSet.count("a")) {
+        TEST_CHECK(
+            vsets.at("shading").variantSet.at("a").primChildren().empty());
+      }
+    }
+  }
+
+  // Prim path filter: ancestors are kept.
+  {
+    USDLoadFilter filter;
+    filter.prim_path_prefixes.push_back("/root/geom");
+
+    Stage stage;
+    TEST_CHECK(load(filter, &stage));
+    TEST_CHECK(has_prim(stage, "/root"));
+    TEST_CHECK(has_prim(stage, "/root/geom/mesh"));
+    TEST_CHECK(!has_prim(stage, "/root/looks"));
+    TEST_CHECK(!has_prim(stage, "/other"));
+    TEST_CHECK(stage.root_prims().size() == 1);
+  }
+
+  // Property filter.
+  {
+    USDLoadFilter filter;
+    filter.property_filter = [](const std::string &prim_path,
+                                const std::string &prop_name) {
+      return !((prim_path == "/root/geom/mesh") && (prop_name == "normals"));
+    };
+
+    Stage stage;
+    TEST_CHECK(load(filter, &stage));
+    auto prim = stage.GetPrimAtPath(Path("/root/geom/mesh", ""));
+    TEST_CHECK(prim.has_value());
+    if (prim) {
+      const GeomMesh *mesh = prim.value()->as<GeomMesh>();
+      TEST_CHECK(mesh != nullptr);
+      if (mesh) {
+        TEST_CHECK(mesh->points.authored());
+        TEST_CHECK(!mesh->normals.authored());
+        TEST_CHECK(mesh->props.count("myvalue") == 1);
+      }
+    }
+  }
+
+  // Layer(PrimSpec)
+  {
+    USDLoadOptions options;
+    options.filter.prim_path_prefixes.push_back("/root/geom");
+    options.filter.property_filter = [](const std::string &,
+                                        const std::string &prop_name) {
+      return prop_name != "normals";
+    };
+
+    Layer layer;
+    std::string warn, err;
+    TEST_CHECK(LoadUSDALayerFromMemory(
+        reinterpret_cast<const uint8_t *>(s.data()), s.size(), "", &layer,
+        &warn, &err, options));
+    TEST_MSG("%s", err.c_str());
+
+    const PrimSpec *ps{nullptr};
+    TEST_CHECK(layer.find_primspec_at(Path("/root/geom/mesh", ""), &ps, &err));
+    if (ps) {
+      TEST_CHECK(ps->props().count("points") == 1);
+      TEST_CHECK(ps->props().count("normals") == 0);
+    }
+    TEST_CHECK(!layer.find_primspec_at(Path("/root/looks", ""), &ps, &err));
+    TEST_CHECK(!layer.find_primspec_at(Path("/other", ""), &ps, &err));
+  }
+}
@@ -0,0 +1,5 @@
+#pragma once
+
+void usda_parallel_parse_test(void);
+void usda_parallel_root_blocks_test(void);
+void usda_load_filter_test(void);
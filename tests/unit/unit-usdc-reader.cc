@@ -0,0 +1,393 @@
+#ifdef _MSC_VER
+#define NOMINMAX
+#endif
+
+#define TEST_NO_MAIN
+#include "acutest.h"
+
+#include <memory>
+#include <utility>
+
+#include "unit-usdc-reader.h"
+#include "prim-types.hh"
+#include "stream-reader.hh"
+#include "tinyusdz.hh"
+#include "usdc-reader.hh"
+#include "usdc-writer.hh"
+#include "usdGeom.hh"
+#include "math-util.inc"
+
+using namespace tinyusdz;
+
+namespace {
+
+bool ToUSDC(const std::string &usda, std::vector<uint8_t> *usdc) {
+  Layer layer;
+  std::string warn, err;
+  if (!LoadUSDALayerFromMemory(reinterpret_cast<const uint8_t *>(usda.data()),
+                               usda.size(), "test.usda", &layer, &warn,
+                               &err)) {
+    TEST_MSG("%s", err.c_str());
+    return false;
+  }
+
+  if (!usdc::SaveAsUSDCToMemory(layer, usdc, &warn, &err)) {
+    TEST_MSG("%s", err.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+const char *kMeshUSDA = R"(#usda 1.0
+
+def Xform "root"
+{
+  def Mesh "mesh"
+  {
+    point3f[] points = [(0, 0, 0), (1, 0, 0), (1, 1, 0), (0, 1, 0)]
+    int[] faceVertexCounts = [4]
+    int[] faceVertexIndices = [0, 1, 2, 3]
+    float[] myvalues = [0.5, 1.5, 2.5, 3.5]
+  }
+}
+)";
+
+}  // namespace
+
+void usdc_reader_deferred_value_test(void) {
+  auto usdc = std::make_shared<std::vector<uint8_t>>();
+  TEST_CHECK(ToUSDC(kMeshUSDA, usdc.get()));
+
+  usdc::USDCReaderConfig config;
+  config.deferred_value_unpack = true;
+  config.buffer_owner = usdc;
+
+  // Stage: typed schema attributes keep the value deferred.
+  {
+    Stage stage;
+    {
+      StreamReader sr(usdc->data(), usdc->size(), /* swap_endian */ false);
+      usdc::USDCReader reader(&sr, config);
+      TEST_CHECK(reader.ReadUSDC());
+      TEST_CHECK(reader.ReconstructStage(&stage));
+      TEST_MSG("%s", reader.GetError().c_str());
+    }
+
+    auto prim = stage.GetPrimAtPath(Path("/root/mesh", ""));
+    TEST_CHECK(prim.has_value());
+    if (prim) {
+      const GeomMesh *mesh = prim.value()->as<GeomMesh>();
+      TEST_CHECK(mesh != nullptr);
+      if (mesh) {
+        TEST_CHECK(mesh->points.get_value().has_value());
+        if (auto pv = mesh->points.get_value()) {
+          TEST_CHECK(pv.value().is_deferred_default());
+
+          std::vector<value::point3f> points;
+          TEST_CHECK(pv.value().get_scalar(&points));
+          TEST_CHECK(points.size() == 4);
+          if (points.size() == 4) {
+            TEST_CHECK(math::is_close(points[2][1], 1.0f));
+          }
+        }
+
+        // Non-schema attribute
+        TEST_CHECK(mesh->props.count("myvalues") == 1);
+        if (mesh->props.count("myvalues")) {
+          const primvar::PrimVar &var =
+              mesh->props.at("myvalues").get_attribute().get_var();
+          TEST_CHECK(var.is_deferred_value());
+          TEST_CHECK(var.type_name() == "float[]");
+          if (auto pv = var.get_value<std::vector<float>>()) {
+            TEST_CHECK(pv.value().size() == 4);
+            TEST_CHECK(math::is_close(pv.value()[3], 3.5f));
+          } else {
+            TEST_CHECK(false);
+          }
+        }
+      }
+    }
+  }
+
+  // Layer
+  {
+    Layer layer;
+    {
+      StreamReader sr(usdc->data(), usdc->size(), /* swap_endian */ false);
+      usdc::USDCReader reader(&sr, config);
+      TEST_CHECK(reader.ReadUSDC());
+      TEST_CHECK(reader.get_as_layer(&layer));
+    }
+
+    TEST_CHECK(layer.primspecs().count("root") == 1);
+    if (layer.primspecs().count("root")) {
+      const PrimSpec &root = layer.primspecs().at("root");
+      TEST_CHECK(root.children().size() == 1);
+      if (root.children().size() == 1) {
+        const PrimSpec &mesh = root.children()[0];
+        TEST_CHECK(mesh.props().count("points") == 1);
+        if (mesh.props().count("points")) {
+          const primvar::PrimVar &var =
+              mesh.props().at("points").get_attribute().get_var();
+          TEST_CHECK(var.is_deferred_value());
+          TEST_CHECK(var.type_name() == "point3f[]");
+
+          const value::point3f *p{nullptr};
+          size_t n{0};
+          TEST_CHECK(var.get_array_view(&p, &n));
+          TEST_CHECK(n == 4);
+        }
+      }
+    }
+  }
+
+  // Without `buffer_owner`, values are decoded at reconstruction.
+  {
+    usdc::USDCReaderConfig no_owner_config;
+    no_owner_config.deferred_value_unpack = true;
+
+    Layer layer;
+    StreamReader sr(usdc->data(), usdc->size(), /* swap_endian */ false);
+    usdc::USDCReader reader(&sr, no_owner_config);
+    TEST_CHECK(reader.ReadUSDC());
+    TEST_CHECK(reader.get_as_layer(&layer));
+
+    if (layer.primspecs().count("root") &&
+        layer.primspecs().at("root").children().size() == 1) {
+      const PrimSpec &mesh = layer.primspecs().at("root").children()[0];
+      if (mesh.props().count("points")) {
+        const primvar::PrimVar &var =
+            mesh.props().at("points").get_attribute().get_var();
+        TEST_CHECK(!var.is_deferred_value());
+        TEST_CHECK(var.has_value());
+      }
+    }
+  }
+}
+
+void usdc_reader_load_filter_test(void) {
+  const char *usda = R"(#usda 1.0
+
+def Xform "root"
+{
+  def Xform "geom"
+  {
+    def Mesh "mesh"
+    {
+      point3f[] points = [(0, 0, 0), (1, 0, 0), (1, 1, 0)]
+      normal3f[] normals = [(0, 0, 1), (0, 0, 1), (0, 0, 1)]
+      float myvalue = 1.5
+    }
+  }
+
+  def Scope "looks"
+  {
+    def Material "mat"
+    {
+    }
+  }
+}
+
+def Scope "other"
+{
+  def Mesh "mesh2"
+  {
+  }
+}
+)";
+
+  std::vector<uint8_t> usdc;
+  TEST_CHECK(ToUSDC(usda, &usdc));
+
+  auto load = [&usdc](const USDLoadFilter &filter, Stage *stage) {
+    USDLoadOptions options;
+    options.filter = filter;
+    std::string warn, err;
+    bool ret = LoadUSDCFromMemory(usdc.data(), usdc.size(), "test.usdc", stage,
+                                  &warn, &err, options);
+    TEST_MSG("%s", err.c_str());
+    return ret;
+  };
+
+  auto has_prim = [](const Stage &stage, const std::string &path) {
+    return stage.GetPrimAtPath(Path(path, "")).has_value();
+  };
+
+  // Prim type filter
+  {
+    USDLoadFilter filter;
+    filter.prim_types = {"Xform", "Mesh"};
+
+    Stage stage;
+    TEST_CHECK(load(filter, &stage));
+    TEST_CHECK(has_prim(stage, "/root/geom/mesh"));
+    TEST_CHECK(!has_prim(stage, "/root/looks"));
+    TEST_CHECK(!has_prim(stage, "/root/looks/mat"));
+    TEST_CHECK(!has_prim(stage, "/other/mesh2"));
+  }
+
+  // Prim path filter: ancestors are kept.
+  {
+    USDLoadFilter filter;
+    filter.prim_path_prefixes.push_back("/root/geom");
+
+    Stage stage;
+    TEST_CHECK(load(filter, &stage));
+    TEST_CHECK(has_prim(stage, "/root"));
+    TEST_CHECK(has_prim(stage, "/root/geom/mesh"));
+    TEST_CHECK(!has_prim(stage, "/root/looks"));
+    TEST_CHECK(!has_prim(stage, "/other"));
+  }
+
+  // Property filter
+  {
+    USDLoadFilter filter;
+    filter.property_filter = [](const std::string &prim_path,
+                                const std::string &prop_name) {
+      return !((prim_path == "/root/geom/mesh") && (prop_name == "normals"));
+    };
+
+    Stage stage;
+    TEST_CHECK(load(filter, &stage));
+    auto prim = stage.GetPrimAtPath(Path("/root/geom/mesh", ""));
+    TEST_CHECK(prim.has_value());
+    if (prim) {
+      const GeomMesh *mesh = prim.value()->as<GeomMesh>();
+      TEST_CHECK(mesh != nullptr);
+      if (mesh) {
+        TEST_CHECK(mesh->points.authored());
+        TEST_CHECK(!mesh->normals.authored());
+        TEST_CHECK(mesh->props.count("myvalue") == 1);
+      }
+    }
+  }
+
+  // Layer(PrimSpec)
+  {
+    USDLoadOptions options;
+    options.filter.prim_types = {"Xform", "Mesh"};
+    options.filter.property_filter = [](const std::string &,
+                                        const std::string &prop_name) {
+      return prop_name != "normals";
+    };
+
+    Layer layer;
+    std::string warn, err;
+    TEST_CHECK(LoadUSDCLayerFromMemory(usdc.data(), usdc.size(), "test.usdc",
+                                       &layer, &warn, &err, options));
+    TEST_MSG("%s", err.c_str());
+
+    const PrimSpec *ps{nullptr};
+    TEST_CHECK(layer.find_primspec_at(Path("/root/geom/mesh", ""), &ps, &err));
+    if (ps) {
+      TEST_CHECK(ps->props().count("points") == 1);
+      TEST_CHECK(ps->props().count("normals") == 0);
+    }
+    TEST_CHECK(!layer.find_primspec_at(Path("/root/looks", ""), &ps, &err));
+    TEST_CHECK(!layer.find_primspec_at(Path("/other", ""), &ps, &err));
+  }
+}
+
+void usdc_reader_scan_hierarchy_test(void) {
+  const char *usda = R"(#usda 1.0
+
+def Xform "root" (
+  kind = "component"
+  variants = {
+    string shape = "ball"
+  }
+  prepend variantSets = "shape"
+)
+{
+  def Mesh "mesh"
+  {
+    point3f[] points = [(0, 0, 0), (1, 0, 0), (1, 1, 0)]
+  }
+
+  def Scope "looks"
+  {
+    def Material "mat"
+    {
+    }
+  }
+
+  variantSet "shape" = {
+    "ball" {
+      def Sphere "ball"
+      {
+      }
+    }
+  }
+}
+
+over "ov"
+{
+}
+)";
+
+  std::vector<uint8_t> usdc;
+  TEST_CHECK(ToUSDC(usda, &usdc));
+
+  usdc::USDCHierarchy hierarchy;
+  {
+    StreamReader sr(usdc.data(), usdc.size(), /* swap_endian */ false);
+    usdc::USDCReader reader(&sr);
+    TEST_CHECK(reader.ScanHierarchy(&hierarchy));
+    TEST_MSG("%s", reader.GetError().c_str());
+  }
+
+  // Prims under VariantSet are not included.
+  TEST_CHECK(hierarchy.prims.size() == 5);
+  TEST_CHECK(hierarchy.root_prims.size() == 2);
+  if ((hierarchy.prims.size() != 5) || (hierarchy.root_prims.size() != 2)) {
+    return;
+  }
+
+  // Root Prim order follows the USDC data(sorted by the writer).
+  size_t root_idx = hierarchy.root_prims[0];
+  size_t ov_idx = hierarchy.root_prims[1];
+  if (hierarchy.prims[root_idx].name != "root") {
+    std::swap(root_idx, ov_idx);
+  }
+
+  const usdc::USDCPrimEntry &root = hierarchy.prims[root_idx];
+  TEST_CHECK(root.path == "/root");
+  TEST_CHECK(root.name == "root");
+  TEST_CHECK(root.type_name == "Xform");
+  TEST_CHECK(root.specifier == Specifier::Def);
+  TEST_CHECK(root.kind == "component");
+  TEST_CHECK(root.parent == -1);
+  TEST_CHECK(root.variant_set_names.size() == 1);
+  if (root.variant_set_names.size() == 1) {
+    TEST_CHECK(root.variant_set_names[0] == "shape");
+  }
+
+  TEST_CHECK(root.children.size() == 2);
+  if (root.children.size() == 2) {
+    const usdc::USDCPrimEntry &mesh = hierarchy.prims[root.children[0]];
+    TEST_CHECK(mesh.path == "/root/mesh");
+    TEST_CHECK(mesh.type_name == "Mesh");
+    TEST_CHECK(mesh.kind.empty());
+    TEST_CHECK(mesh.parent == int64_t(root_idx));
+    TEST_CHECK(mesh.children.empty());
+
+    const usdc::USDCPrimEntry &looks = hierarchy.prims[root.children[1]];
+    TEST_CHECK(looks.path == "/root/looks");
+    TEST_CHECK(looks.type_name == "Scope");
+    TEST_CHECK(looks.children.size() == 1);
+    if (looks.children.size() == 1) {
+      const usdc::USDCPrimEntry &mat = hierarchy.prims[looks.children[0]];
+      TEST_CHECK(mat.path == "/root/looks/mat");
+      TEST_CHECK(mat.name == "mat");
+      TEST_CHECK(mat.type_name == "Material");
+      TEST_CHECK(mat.parent == int64_t(root.children[1]));
+    }
+  }
+
+  const usdc::USDCPrimEntry &ov = hierarchy.prims[ov_idx];
+  TEST_CHECK(ov.path == "/ov");
+  TEST_CHECK(ov.type_name.empty());
+  TEST_CHECK(ov.specifier == Specifier::Over);
+  TEST_CHECK(ov.children.empty());
+}
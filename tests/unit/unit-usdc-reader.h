@@ -0,0 +1,5 @@
+#pragma once
+
+void usdc_reader_deferred_value_test(void);
+void usdc_reader_load_filter_test(void);
+void usdc_reader_scan_hierarchy_test(void);
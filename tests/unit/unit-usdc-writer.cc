@@ -0,0 +1,530 @@
+#ifdef _MSC_VER
+#define NOMINMAX
+#endif
+
+#define TEST_NO_MAIN
+#include "acutest.h"
+
+#include <cmath>
+#include <cstdio>
+
+#include "unit-usdc-writer.h"
+#include "prim-types.hh"
+#include "tinyusdz.hh"
+#include "usdc-writer.hh"
+#include "math-util.inc"
+
+using namespace tinyusdz;
+
+static bool LoadUSDA(const std::string &usda, Layer *layer) {
+  std::string warn, err;
+  return LoadUSDALayerFromMemory(reinterpret_cast<const uint8_t *>(usda.data()), usda.size(), "test.usda", layer, &warn, &err);
+}
+
+static bool RoundTrip(const Layer &src, std::vector<uint8_t> *usdc, Layer *dst) {
+  std::string warn, err;
+  if (!usdc::SaveAsUSDCToMemory(src, usdc, &warn, &err)) {
+    TEST_MSG("%s", err.c_str());
+    return false;
+  }
+  if (!LoadUSDCLayerFromMemory(usdc->data(), usdc->size(), "test.usdc", dst, &warn, &err)) {
+    TEST_MSG("%s", err.c_str());
+    return false;
+  }
+  return true;
+}
+
+void usdc_writer_test(void) {
+
+  const std::string ints = "[0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19]";
+  const std::string floats = "[0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19.5]";
+  // few distinct values(lookup table)
+  const std::string lut = "[0.5, 1.5, -0.0, 0.5, 1.5, 0.5, 1.5, 0.5, 1.5, 0.5, 1.5, 0.5, 1.5, 0.5, 1.5, 0.5, 1.5, 0.5, 1.5, 0.25]";
+
+  const std::string base = R"(#usda 1.0
+(
+  defaultPrim = "root"
+  upAxis = "Z"
+  metersPerUnit = 0.01
+)
+
+def Xform "root" (
+  customData = {
+    string author = "tinyusdz"
+    int version = 3
+  }
+)
+{
+  int[] ints = )" + ints + R"(
+  float[] floats = )" + floats + R"(
+  double[] lut = )" + lut + R"(
+  half[] halfs = )" + ints + R"(
+  token tok = "bora"
+  double d = 0.3
+  uniform string str = "muda"
+  float f.timeSamples = {
+    0: 1.5,
+    1: 2.5,
+  }
+  rel target = </root/child>
+
+  def Mesh "child"
+  {
+    point3f[] points = [(0, 0, 0), (1, 0, 0), (1, 1, 0)]
+  }
+}
+)";
+
+  Layer layer;
+  TEST_CHECK(LoadUSDA(base, &layer));
+
+  std::vector<uint8_t> usdc;
+  Layer loaded;
+  TEST_CHECK(RoundTrip(layer, &usdc, &loaded));
+
+  TEST_CHECK(loaded.metas().defaultPrim.str() == "root");
+  TEST_CHECK(loaded.metas().upAxis.get_value() == Axis::Z);
+  TEST_CHECK(math::is_close(loaded.metas().metersPerUnit.get_value(), 0.01));
+
+  TEST_CHECK(loaded.primspecs().count("root") == 1);
+  if (loaded.primspecs().count("root")) {
+    const PrimSpec &root = loaded.primspecs().at("root");
+    TEST_CHECK(root.typeName() == "Xform");
+    TEST_CHECK(root.specifier() == Specifier::Def);
+
+    TEST_CHECK(root.metas().customData.has_value());
+    if (root.metas().customData) {
+      TEST_CHECK(root.metas().customData.value().count("author") == 1);
+      TEST_CHECK(root.metas().customData.value().count("version") == 1);
+    }
+
+    TEST_CHECK(root.props().count("ints") == 1);
+    if (root.props().count("ints")) {
+      auto v = root.props().at("ints").get_attribute().get_value<std::vector<int>>();
+      TEST_CHECK(v.has_value());
+      if (v) {
+        TEST_CHECK(v.value().size() == 20);
+        TEST_CHECK(v.value()[19] == 19);
+      }
+    }
+
+    TEST_CHECK(root.props().count("floats") == 1);
+    if (root.props().count("floats")) {
+      auto v = root.props().at("floats").get_attribute().get_value<std::vector<float>>();
+      TEST_CHECK(v.has_value());
+      if (v) {
+        TEST_CHECK(v.value().size() == 20);
+        TEST_CHECK(math::is_close(v.value()[1], 1.0f));
+        TEST_CHECK(math::is_close(v.value()[19], 19.5f));
+      }
+    }
+
+    TEST_CHECK(root.props().count("lut") == 1);
+    if (root.props().count("lut")) {
+      auto v = root.props().at("lut").get_attribute().get_value<std::vector<double>>();
+      TEST_CHECK(v.has_value());
+      if (v) {
+        TEST_CHECK(v.value().size() == 20);
+        TEST_CHECK(math::is_close(v.value()[1], 1.5));
+        TEST_CHECK(std::signbit(v.value()[2]));
+        TEST_CHECK(math::is_close(v.value()[19], 0.25));
+      }
+    }
+
+    // 0.3 cannot be stored inline(as float) in ValueRep.
+    TEST_CHECK(root.props().count("d") == 1);
+    if (root.props().count("d")) {
+      auto v = root.props().at("d").get_attribute().get_value<double>();
+      TEST_CHECK(v.has_value());
+      if (v) {
+        TEST_CHECK(math::is_close(v.value(), 0.3));
+        TEST_MSG("d = %f", v.value());
+      }
+    }
+
+    TEST_CHECK(root.props().count("halfs") == 1);
+    if (root.props().count("halfs")) {
+      auto v = root.props().at("halfs").get_attribute().get_value<std::vector<value::half>>();
+      TEST_CHECK(v.has_value());
+      if (v) {
+        TEST_CHECK(v.value().size() == 20);
+        TEST_CHECK(math::is_close(value::half_to_float(v.value()[19]), 19.0f));
+      }
+    }
+
+    TEST_CHECK(root.props().count("tok") == 1);
+    if (root.props().count("tok")) {
+      auto v = root.props().at("tok").get_attribute().get_value<value::token>();
+      TEST_CHECK(v.has_value() && (v.value().str() == "bora"));
+    }
+
+    TEST_CHECK(root.props().count("str") == 1);
+    if (root.props().count("str")) {
+      const Attribute &attr = root.props().at("str").get_attribute();
+      TEST_CHECK(attr.variability() == Variability::Uniform);
+      auto v = attr.get_value<std::string>();
+      TEST_CHECK(v.has_value() && (v.value() == "muda"));
+    }
+
+    TEST_CHECK(root.props().count("f") == 1);
+    if (root.props().count("f")) {
+      const Attribute &attr = root.props().at("f").get_attribute();
+      TEST_CHECK(attr.get_var().has_timesamples());
+      float f{0.0f};
+      TEST_CHECK(attr.get(1.0, &f, value::TimeSampleInterpolationType::Held));
+      TEST_CHECK(math::is_close(f, 2.5f));
+    }
+
+    TEST_CHECK(root.props().count("target") == 1);
+    if (root.props().count("target")) {
+      const Property &prop = root.props().at("target");
+      TEST_CHECK(prop.is_relationship());
+      TEST_CHECK(prop.get_relationship().is_path());
+      TEST_CHECK(prop.get_relationship().targetPath.full_path_name() == "/root/child");
+    }
+
+    TEST_CHECK(root.children().size() == 1);
+    if (root.children().size() == 1) {
+      const PrimSpec &child = root.children()[0];
+      TEST_CHECK(child.name() == "child");
+      TEST_CHECK(child.typeName() == "Mesh");
+      TEST_CHECK(child.props().count("points") == 1);
+      if (child.props().count("points")) {
+        auto v = child.props().at("points").get_attribute().get_value<std::vector<value::point3f>>();
+        TEST_CHECK(v.has_value());
+        if (v) {
+          TEST_CHECK(v.value().size() == 3);
+          TEST_CHECK(math::is_close(v.value()[2][1], 1.0f));
+        }
+      }
+    }
+  }
+
+  // Streaming mode writes the same data as memory mode.
+  {
+    const std::string filename = "unit-usdc-writer-streaming.usdc";
+
+    usdc::USDCWriteOptions options;
+    options.streaming = true;
+    // Small buffer to flush(and read back for deduplication) frequently.
+    options.stream_buffer_size = 64;
+
+    std::string warn, err;
+    TEST_CHECK(usdc::SaveAsUSDCToFile(filename, layer, &warn, &err, options));
+    TEST_MSG("%s", err.c_str());
+
+    std::vector<uint8_t> streamed;
+    FILE *fp = fopen(filename.c_str(), "rb");
+    TEST_CHECK(fp != nullptr);
+    if (fp) {
+      uint8_t buf[4096];
+      size_t n;
+      while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        streamed.insert(streamed.end(), buf, buf + n);
+      }
+      fclose(fp);
+    }
+    remove(filename.c_str());
+
+    TEST_CHECK(streamed == usdc);
+  }
+
+  // Stage overloads pass write options through.
+  {
+    Stage stage;
+    std::string warn, err;
+    TEST_CHECK(LoadUSDAFromMemory(reinterpret_cast<const uint8_t *>(base.data()), base.size(), "test.usda", &stage, &warn, &err));
+    TEST_MSG("%s", err.c_str());
+
+    std::vector<uint8_t> from_stage;
+    TEST_CHECK(usdc::SaveAsUSDCToMemory(stage, &from_stage, &warn, &err));
+    TEST_MSG("%s", err.c_str());
+
+    const std::string filename = "unit-usdc-writer-stage.usdc";
+
+    usdc::USDCWriteOptions options;
+    options.streaming = true;
+    options.stream_buffer_size = 64;
+    TEST_CHECK(usdc::SaveAsUSDCToFile(filename, stage, &warn, &err, options));
+    TEST_MSG("%s", err.c_str());
+
+    Layer loaded;
+    TEST_CHECK(LoadLayerFromFile(filename, &loaded, &warn, &err));
+    TEST_MSG("%s", err.c_str());
+    remove(filename.c_str());
+
+    TEST_CHECK(loaded.primspecs().count("root") == 1);
+    if (loaded.primspecs().count("root")) {
+      TEST_CHECK(loaded.primspecs().at("root").props().count("d") == 1);
+    }
+    TEST_CHECK(from_stage.size() > 0);
+  }
+
+  // Identical arrays are written once.
+  {
+    const std::string dup = R"(#usda 1.0
+
+def Xform "root"
+{
+  int[] a = )" + ints + R"(
+  int[] b = )" + ints + R"(
+  float[] c = )" + floats + R"(
+  float[] d = )" + floats + R"(
+}
+)";
+
+    const std::string single = R"(#usda 1.0
+
+def Xform "root"
+{
+  int[] a = )" + ints + R"(
+  int[] b = [0]
+  float[] c = )" + floats + R"(
+  float[] d = [0]
+}
+)";
+
+    Layer dup_layer;
+    Layer single_layer;
+    TEST_CHECK(LoadUSDA(dup, &dup_layer));
+    TEST_CHECK(LoadUSDA(single, &single_layer));
+
+    std::vector<uint8_t> dup_usdc;
+    std::vector<uint8_t> single_usdc;
+    Layer dup_loaded;
+    Layer single_loaded;
+    TEST_CHECK(RoundTrip(dup_layer, &dup_usdc, &dup_loaded));
+    TEST_CHECK(RoundTrip(single_layer, &single_usdc, &single_loaded));
+
+    // `b` and `d` share the data of `a` and `c`, so the file does not contain
+    // the second copies(`[0]` arrays in `single` need their own data).
+    TEST_CHECK(dup_usdc.size() <= single_usdc.size());
+
+    if (dup_loaded.primspecs().count("root")) {
+      const PrimSpec &root = dup_loaded.primspecs().at("root");
+      auto b = root.props().at("b").get_attribute().get_value<std::vector<int>>();
+      auto d = root.props().at("d").get_attribute().get_value<std::vector<float>>();
+      TEST_CHECK(b.has_value() && (b.value().size() == 20));
+      TEST_CHECK(d.has_value() && (d.value().size() == 20));
+    } else {
+      TEST_CHECK(false);
+    }
+  }
+
+  // Parallel array encoding produces the same bytes as the single-threaded
+  // writer.
+  {
+    const size_t n = 20000;  // 80KB per int/float array
+    std::string big_ints = "[";
+    std::string big_floats = "[";
+    std::string big_lut = "[";
+    for (size_t i = 0; i < n; i++) {
+      if (i > 0) {
+        big_ints += ", ";
+        big_floats += ", ";
+        big_lut += ", ";
+      }
+      big_ints += std::to_string((i * 7) % 1000);
+      big_floats += std::to_string(double(i) * 0.25 + 0.1);
+      big_lut += (i % 3) ? "0.5" : "1.5";
+    }
+    big_ints += "]";
+    big_floats += "]";
+    big_lut += "]";
+
+    const std::string usda = R"(#usda 1.0
+
+def Xform "root"
+{
+  int[] a = )" + big_ints + R"(
+  float[] b = )" + big_floats + R"(
+  double[] c = )" + big_lut + R"(
+  int[] dup = )" + big_ints + R"(
+  float[] ts.timeSamples = {
+    0: )" + big_floats + R"(,
+    1: )" + big_lut + R"(,
+  }
+
+  def Xform "child"
+  {
+    float[] b = )" + big_floats + R"(
+    int[] small = )" + ints + R"(
+  }
+}
+)";
+
+    Layer layer;
+    TEST_CHECK(LoadUSDA(usda, &layer));
+
+    std::vector<uint8_t> serial;
+    std::vector<uint8_t> parallel;
+    std::string warn, err;
+
+    usdc::USDCWriteOptions options;
+    options.num_threads = 1;
+    TEST_CHECK(usdc::SaveAsUSDCToMemory(layer, &serial, &warn, &err, options));
+    TEST_MSG("%s", err.c_str());
+
+    options.num_threads = 4;
+    TEST_CHECK(usdc::SaveAsUSDCToMemory(layer, &parallel, &warn, &err, options));
+    TEST_MSG("%s", err.c_str());
+
+    TEST_CHECK(serial.size() > 0);
+    TEST_CHECK(serial == parallel);
+
+    Layer loaded;
+    TEST_CHECK(LoadUSDCLayerFromMemory(parallel.data(), parallel.size(), "test.usdc", &loaded, &warn, &err));
+    TEST_MSG("%s", err.c_str());
+    if (loaded.primspecs().count("root")) {
+      const PrimSpec &root = loaded.primspecs().at("root");
+      auto a = root.props().at("dup").get_attribute().get_value<std::vector<int>>();
+      auto c = root.props().at("c").get_attribute().get_value<std::vector<double>>();
+      TEST_CHECK(a.has_value() && (a.value().size() == n) && (a.value()[n - 1] == int((7 * (n - 1)) % 1000)));
+      TEST_CHECK(c.has_value() && (c.value().size() == n) && (c.value()[1] == 0.5));
+    } else {
+      TEST_CHECK(false);
+    }
+  }
+
+  // Append frames to a file.
+  {
+    const std::string filename = "unit-usdc-writer-append.usdc";
+
+    std::string big_ints = "[";
+    std::string frame0 = "[";
+    std::string frame1 = "[";
+    for (size_t i = 0; i < 4096; i++) {
+      if (i > 0) {
+        big_ints += ", ";
+        frame0 += ", ";
+        frame1 += ", ";
+      }
+      big_ints += std::to_string((i * 7919) % 65521);
+      frame0 += std::to_string(double(i) * 0.25 + 0.1);
+      frame1 += std::to_string(double(i) * 0.5 + 0.3);
+    }
+    big_ints += "]";
+    frame0 += "]";
+    frame1 += "]";
+
+    const std::string base_usda = R"(#usda 1.0
+
+def Xform "root"
+{
+  int[] ids = )" + big_ints + R"(
+  float[] pts.timeSamples = {
+    0: )" + frame0 + R"(,
+  }
+}
+)";
+
+    // New frame, new Prim.
+    const std::string append1_usda = R"(#usda 1.0
+
+over "root"
+{
+  float[] pts.timeSamples = {
+    1: )" + frame1 + R"(,
+  }
+
+  def Xform "added"
+  {
+    int[] ids = )" + ints + R"(
+  }
+}
+)";
+
+    // Same values as frame 0 and 1. Only ValueReps are written.
+    const std::string append2_usda = R"(#usda 1.0
+
+over "root"
+{
+  float[] pts.timeSamples = {
+    2: )" + frame0 + R"(,
+    3: )" + frame1 + R"(,
+  }
+}
+)";
+
+    Layer base_layer;
+    Layer append1_layer;
+    Layer append2_layer;
+    TEST_CHECK(LoadUSDA(base_usda, &base_layer));
+    TEST_CHECK(LoadUSDA(append1_usda, &append1_layer));
+    TEST_CHECK(LoadUSDA(append2_usda, &append2_layer));
+
+    auto file_size = [&filename]() -> size_t {
+      size_t sz = 0;
+      FILE *fp = fopen(filename.c_str(), "rb");
+      if (fp) {
+        fseek(fp, 0, SEEK_END);
+        sz = size_t(ftell(fp));
+        fclose(fp);
+      }
+      return sz;
+    };
+
+    usdc::USDCAppender appender;
+    TEST_CHECK(appender.Open(filename, base_layer));
+    TEST_MSG("%s", appender.GetError().c_str());
+    const size_t base_size = file_size();
+
+    TEST_CHECK(appender.Append(append1_layer));
+    TEST_MSG("%s", appender.GetError().c_str());
+    const size_t append1_size = file_size();
+
+    TEST_CHECK(appender.Append(append2_layer));
+    TEST_MSG("%s", appender.GetError().c_str());
+    const size_t append2_size = file_size();
+
+    TEST_CHECK(appender.Close());
+
+    // `ids` is not written again.
+    TEST_CHECK((append1_size - base_size) < base_size);
+    // No array data is written.
+    TEST_CHECK((append2_size - append1_size) < 4096);
+
+    auto check_layer = [&](const std::string &fname) {
+      std::string warn, err;
+      Layer loaded;
+      TEST_CHECK(LoadLayerFromFile(fname, &loaded, &warn, &err));
+      TEST_MSG("%s", err.c_str());
+      if (!TEST_CHECK(loaded.primspecs().count("root") == 1)) {
+        return;
+      }
+
+      const PrimSpec &root = loaded.primspecs().at("root");
+      TEST_CHECK(root.specifier() == Specifier::Def);
+      TEST_CHECK(root.typeName() == "Xform");
+      TEST_CHECK(root.props().count("ids") == 1);
+      TEST_CHECK(root.children().size() == 1);
+      if (root.children().size() == 1) {
+        TEST_CHECK(root.children()[0].name() == "added");
+      }
+
+      if (TEST_CHECK(root.props().count("pts") == 1)) {
+        const auto &ts = root.props().at("pts").get_attribute().get_var().ts_raw();
+        TEST_CHECK(ts.size() == 4);
+        if (ts.size() == 4) {
+          auto v0 = ts.get_samples()[0].value.as<std::vector<float>>();
+          auto v2 = ts.get_samples()[2].value.as<std::vector<float>>();
+          auto v3 = ts.get_samples()[3].value.as<std::vector<float>>();
+          TEST_CHECK(math::is_close(ts.get_samples()[3].t, 3.0));
+          TEST_CHECK(v0 && v2 && (*v0 == *v2));
+          TEST_CHECK(v3 && (v3->size() == 4096) && math::is_close((*v3)[1], 0.8f));
+        }
+      }
+    };
+
+    check_layer(filename);
+
+    // Unused sections are removed.
+    std::string warn, err;
+    TEST_CHECK(usdc::CompactUSDCFile(filename, &warn, &err));
+    TEST_MSG("%s", err.c_str());
+    TEST_CHECK(file_size() < append2_size);
+    check_layer(filename);
+
+    remove(filename.c_str());
+  }
+}
@@ -0,0 +1,3 @@
+#pragma once
+
+void usdc_writer_test(void);
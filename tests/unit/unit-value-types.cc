@@ -20,6 +20,34 @@ void value_types_test(void) {
   TEST_CHECK(tok1 != tok2);
   TEST_CHECK(tok1 == tok3);
 
+#if !defined(TINYUSDZ_USE_STRING_ID_FOR_TOKEN_TYPE)
+  // Interned token: same string shares the same storage.
+  TEST_CHECK(tok1.is_same(tok3));
+  TEST_CHECK(&tok1.str() == &tok3.str());
+  TEST_CHECK(tok1.hash() == tok3.hash());
+  TEST_CHECK(value::token(std::string("bora")).is_same(tok1));
+  TEST_CHECK(value::token("borabora", 4).is_same(tok1));
+  TEST_CHECK(!value::token("").valid());
+  TEST_CHECK(value::token("") == value::token());
+  TEST_CHECK(value::token().str().empty());
+  TEST_CHECK(tok1 < tok2);
+
+  // Table entry is freed when the last Token referring it is destroyed.
+  {
+    size_t n = NumInternedTokens();
+    {
+      value::token a("unique_token_for_test");
+      TEST_CHECK(NumInternedTokens() == n + 1);
+      value::token b = a;
+      value::token c(std::move(b));
+      a = value::token();
+      TEST_CHECK(NumInternedTokens() == n + 1);
+      TEST_CHECK(c.str() == "unique_token_for_test");
+    }
+    TEST_CHECK(NumInternedTokens() == n);
+  }
+#endif
+
   TEST_CHECK(value::GetTypeName(value::TYPE_ID_TOKEN) == "token");
   TEST_CHECK(value::GetTypeName(value::TYPE_ID_TOKEN|value::TYPE_ID_1D_ARRAY_BIT) == "token[]");
 
@@ -39,5 +67,21 @@ void value_types_test(void) {
     TEST_CHECK(math::is_close(tex2f->t, 2.0f));
   }
 
+  // Construct from rvalue(moved) and lvalue(copied).
+  {
+    std::vector<float> src(1024, 3.0f);
+    value::Value copied(src);
+    TEST_CHECK(src.size() == 1024);
+
+    const float *ptr = src.data();
+    value::Value moved(std::move(src));
+    const std::vector<float> *pv = moved.as<std::vector<float>>();
+    TEST_CHECK(pv != nullptr);
+    if (pv) {
+      TEST_CHECK(pv->data() == ptr);
+    }
+    TEST_CHECK(copied.as<std::vector<float>>()->size() == 1024);
+  }
+
 }
 